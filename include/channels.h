@@ -57,6 +57,7 @@ class H323Connection;
 class H323Capability;
 class H323Codec;
 class H323_RTP_Session;
+class H323MediaClock;
 
 
 
@@ -280,6 +281,10 @@ class H323Channel : public PObject
 
   /**@name Member variable access */
   //@{
+    /**Get the connection the channel belongs to.
+     */
+    H323Connection & GetConnection() const { return connection; }
+
     /**Get the number of the channel.
      */
     const H323ChannelNumber & GetNumber() const { return number; }
@@ -607,6 +612,149 @@ class H323_RealTimeChannel : public H323UnidirectionalChannel
 
 ///////////////////////////////////////////////////////////////////////////////
 
+#ifdef H323_VIDEO
+/**Pacer for transmitted video packets.
+   The packets of each frame are spread evenly across the frame interval,
+   taken from the RTP timestamps, using the size of recent frames of the
+   same kind to estimate how much of the frame each packet is. This avoids
+   sending a frame at line rate, or with a fixed delay after each packet.
+   A frame is never sent faster than the channel bit rate, except that key
+   frames may run ahead of it by a burst budget.
+  */
+class H323VideoPacer : public PObject
+{
+  PCLASSINFO(H323VideoPacer, PObject);
+
+  public:
+  /**@name Construction */
+  //@{
+    H323VideoPacer();
+  //@}
+
+  /**@name Operations */
+  //@{
+    /**Set the bit rate frames may not exceed, in bits/sec. Zero removes
+       the limit.
+      */
+    void SetBitRate(
+      unsigned bitRate  ///< Negotiated maximum bit rate
+    );
+
+    /**Set a bit rate limit requested by the remote with a flow control
+       command, in bits/sec. Zero removes the limit.
+      */
+    void SetFlowControlLimit(
+      unsigned bitRate  ///< Flow control bit rate
+    );
+
+    /**Set the budget key frames may burst ahead of the bit rate, in
+       milliseconds worth of the bit rate. Zero holds key frames to the
+       bit rate the same as any other frame.
+      */
+    void SetKeyFrameBurst(unsigned ms) { keyFrameBurst = ms; }
+
+    /**Set the largest pacing backlog, in milliseconds, a new frame may
+       start with. Frames further behind than this are dropped. Zero
+       never drops frames.
+      */
+    void SetMaxDelay(unsigned ms) { maxDelay = ms; }
+
+    /**Set the shortest time between key frame requests made after frames
+       are dropped, in milliseconds.
+      */
+    void SetKeyFrameRequestInterval(unsigned ms) { keyFrameRequestInterval = ms; }
+
+    /**Wait until the packet may be sent.
+       Returns FALSE if the packet belongs to a dropped frame and must not
+       be sent.
+      */
+    PBoolean Pace(
+      PINDEX size,        ///< Size of packet in bytes
+      PBoolean marker,    ///< Packet is the last of its frame
+      PBoolean keyFrame,  ///< Packet is part of a key frame
+      DWORD timestamp     ///< RTP timestamp of the packet, 90kHz clock
+    );
+
+    /**Indicate a key frame should be requested from the encoder as frames
+       were dropped. This is TRUE at most once per key frame request
+       interval, and not once a key frame has been sent.
+      */
+    PBoolean TakeKeyFrameRequest();
+  //@}
+
+  /**@name Statistics */
+  //@{
+    /**Get the bit rate limit, zero if there is none.
+      */
+    unsigned GetBitRate() const;
+
+    /**Get the key frame burst budget in milliseconds.
+      */
+    unsigned GetKeyFrameBurst() const { return keyFrameBurst; }
+
+    /**Get the maximum pacing backlog in milliseconds.
+      */
+    unsigned GetMaxDelay() const { return maxDelay; }
+
+    /**Get the frame interval being paced to in milliseconds.
+      */
+    unsigned GetFrameInterval() const { return frameInterval; }
+
+    /**Get the number of bytes scheduled but not yet due to be sent.
+      */
+    DWORD GetQueueDepth() const { return queueDepth; }
+
+    /**Get the number of packets passed through the pacer.
+      */
+    DWORD GetPacketsPaced() const { return packetsPaced; }
+
+    /**Get the average time packets were held back, in milliseconds.
+      */
+    DWORD GetAveragePacingDelay() const;
+
+    /**Get the longest time a packet was held back, in milliseconds.
+      */
+    DWORD GetMaximumPacingDelay() const { return maximumPacingDelay; }
+
+    /**Get the number of frames dropped as the backlog exceeded the
+       maximum delay.
+      */
+    DWORD GetFramesDropped() const { return framesDropped; }
+  //@}
+
+  protected:
+    PMutex   mutex;
+    unsigned bitRate;
+    unsigned flowControlLimit;
+    unsigned keyFrameBurst;
+    unsigned maxDelay;
+    unsigned keyFrameRequestInterval;
+
+    unsigned frameInterval;   // ms
+    DWORD    lastTimestamp;
+    PBoolean haveTimestamp;
+    PBoolean frameStart;
+    PBoolean frameIsKey;
+    PBoolean dropping;
+    PInt64   frameBits;       // sent so far in this frame
+    PInt64   expectedBits;    // estimated size of this frame
+    PInt64   keyFrameBits;    // recent key frame size
+    PInt64   deltaFrameBits;  // recent other frame size
+    PInt64   frameSpread;     // us over which this frame is sent
+    PInt64   nextSend;        // us, RTP_MediaStatistics::GetTime() clock
+
+    PBoolean keyFrameWanted;
+    PInt64   lastKeyFrameRequest;
+
+    DWORD    queueDepth;
+    DWORD    packetsPaced;
+    PInt64   totalPacingDelay;
+    DWORD    maximumPacingDelay;
+    DWORD    framesDropped;
+};
+#endif // H323_VIDEO
+
+
 /**This class is for encpsulating the IETF Real Time Protocol interface.
  */
 class H323_RTPChannel : public H323_RealTimeChannel
@@ -645,10 +793,20 @@ class H323_RTPChannel : public H323_RealTimeChannel
      */
     virtual void SetSessionID(unsigned id);
 
+    /**Start the channel.
+       An audio transmitter is handed to the endpoint media clock if there
+       is one, otherwise a thread is started as usual.
+      */
+    virtual PBoolean Start();
+
     /**Open the channel.
       */
     virtual PBoolean Open();
 
+    /**Determine if channel is still running.
+      */
+    virtual PBoolean IsRunning() const;
+
     /**Handle channel data reception.
 
        This is called by the thread started by the Start() function and is
@@ -743,6 +901,32 @@ class H323_RTPChannel : public H323_RealTimeChannel
 
     virtual PInt64 GetSilenceDuration() const;
 
+#ifdef H323_AUDIO_CODECS
+    /**Encode and send one packet of audio.
+       This is called by the endpoint media clock once every packet time in
+       place of the Transmit() loop. Returns FALSE when the channel is to
+       stop being clocked. If that is due to an error, failed is set and the
+       clock closes the channel once its worker has finished the tick.
+      */
+    virtual PBoolean OnMediaClockTick(
+      PBoolean & failed   ///< Set if the channel is to be closed
+    );
+#endif
+
+#ifdef H323_VIDEO
+    /**Handle flow control restriction on the channel.
+       The default behaviour passes it to the codec and limits the rate
+       transmitted video is paced to.
+      */
+    virtual void OnFlowControl(
+      long bitRateRestriction   ///< Bit rate limitation
+    );
+
+    /**Get the pacer for transmitted video packets.
+      */
+    H323VideoPacer & GetVideoPacer() { return videoPacer; }
+#endif
+
 
   protected:
     RTP_Session      & rtpSession;
@@ -756,9 +940,98 @@ class H323_RTPChannel : public H323_RealTimeChannel
 
     unsigned rec_written;
     PBoolean rec_ok;
+
+#ifdef H323_VIDEO
+    H323VideoPacer videoPacer;
+#endif
+
+#ifdef H323_AUDIO_CODECS
+    H323MediaClock * mediaClock;
+    PBoolean         clockStopping;
+    RTP_DataFrame    clockFrame;
+    unsigned         clockFramesInPacket;
+    unsigned         clockMaxFrameSize;
+    PBoolean         clockSilent;
+    DWORD            clockTimestamp;
+    PInt64           clockPeriod;
+    PInt64           clockNextDue;
+#endif
 };
 
 
+#ifdef H323_AUDIO_CODECS
+
+/**Shared media clock for audio transmit channels.
+   A clock thread ticks every packet time and a small pool of workers runs
+   the encode and send step of each registered channel, instead of every
+   transmit channel having a thread paced by its own audio device. Channels
+   with the same packet time are ticked together, each by the worker it was
+   assigned to when added.
+  */
+class H323MediaClock : public PObject
+{
+  PCLASSINFO(H323MediaClock, PObject);
+
+  public:
+    H323MediaClock(
+      PINDEX workers = 2,       ///<  Number of worker threads
+      PINDEX stackSize = 30000  ///<  Stack size for clock and worker threads
+    );
+    ~H323MediaClock();
+
+    /**Add a channel to be ticked every packet time.
+      */
+    void Add(
+      H323_RTPChannel & channel,   ///<  Transmit channel to clock
+      unsigned packetTime          ///<  Packet time in milliseconds
+    );
+
+    /**Remove a channel. On return the channel is not being ticked.
+      */
+    void Remove(
+      H323_RTPChannel & channel    ///<  Transmit channel to remove
+    );
+
+    /**Get the number of channels being clocked.
+      */
+    PINDEX GetChannelCount() const;
+
+    /**Get the number of ticks a worker started after the next was due.
+      */
+    PINDEX GetLateTicks() const { return lateTicks; }
+
+  protected:
+    PDECLARE_NOTIFIER(PThread, H323MediaClock, ClockMain);
+
+    class Worker;
+
+    struct Registration {
+      Worker * worker;
+      unsigned packetTime;
+    };
+    typedef std::map<H323_RTPChannel *, Registration> RegistrationMap;
+
+    struct Group {
+      PTimeInterval       nextTick;
+      std::vector<PINDEX> channels;   // per worker
+    };
+    typedef std::map<unsigned, Group> GroupMap;
+
+    std::vector<Worker *> workers;
+    RegistrationMap       registrations;
+    GroupMap              groups;
+    PMutex                mutex;
+    PSyncPoint            changed;
+    PThread             * thread;
+    PBoolean              shutdown;
+    PAtomicInteger        lateTicks;
+
+  friend class Worker;
+};
+
+#endif // H323_AUDIO_CODECS
+
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /**This class is for encpsulating the IETF Real Time Protocol interface as used
@@ -199,6 +199,7 @@ struct PluginCodec_Definition;
 #define PLUGINCODEC_CONTROL_CODEC_EVENT           "event_codec"
 #define PLUGINCODEC_CONTROL_FLOW_OPTIONS          "to_flowcontrol_options"
 #define PLUGINCODEC_CONTROL_SET_FORMAT_OPTIONS    "set_format_options"
+#define PLUGINCODEC_CONTROL_RESET_CODEC           "reset_codec"     // return context to just created state, returns 1 on success
 
 
 /* Log function, plug in gets a pointer to this function which allows
@@ -281,6 +281,12 @@ class H323Codec : public PObject
     */
     PBoolean AttachLogicalChannel(H323Channel *channel);
 
+    /**Attach the media statistics the codec records its encode or decode
+       times in. The statistics are not deleted on destruction, NULL stops
+       the recording.
+    */
+    void AttachMediaStatistics(RTP_MediaStatistics * stats) { mediaStatistics = stats; }
+
     class FilterInfo : public PObject {
         PCLASSINFO(FilterInfo, PObject);
       public:
@@ -382,6 +388,8 @@ class H323Codec : public PObject
 
     H323LIST(FilterList, FilterData);
     FilterList filters;
+
+    RTP_MediaStatistics * mediaStatistics;
 };
 
 #ifdef H323_AUDIO_CODECS
@@ -506,6 +514,20 @@ class H323AudioCodec : public H323Codec
       */
     virtual PBoolean SetRawDataHeld(PBoolean hold);
 
+    /**Set the encoder as paced by the endpoint media clock rather than by
+       its raw data channel. This is set before the raw data channel is
+       opened, see H323EndPoint::SetMediaClockThreads().
+      */
+    void SetMediaClocked(
+      PBoolean clocked   ///< Flag for encoder paced by media clock
+    ) { mediaClocked = clocked; }
+
+    /**Get the flag for the encoder being paced by the endpoint media clock.
+       The raw data channel of a clocked encoder should return each frame
+       without waiting for it to be due.
+      */
+    PBoolean IsMediaClocked() const { return mediaClocked; }
+
 #ifdef H323_AEC	
 	/** Attach Acoustic Echo Cancellation.
 	*/
@@ -531,6 +553,7 @@ class H323AudioCodec : public H323Codec
     unsigned signalFramesReceived;  // Frames of signal received
     unsigned silenceFramesReceived; // Frames of silence received
     PBoolean	 IsRawDataHeld;
+    PBoolean     mediaClocked;          // Paced by the endpoint media clock
 };
 
 
@@ -961,6 +984,12 @@ class H323VideoCodec : public H323Codec
    */
     virtual int GetFrameNum() { return frameNum; }
 
+   /**
+      Indicate the packet last returned by Read() is part of a key (intra)
+      frame. The default behaviour returns FALSE.
+   */
+    virtual PBoolean IsKeyFrame() const { return FALSE; }
+
    /**
       Set the supported Formats the codec is to support
       Return whether codec supports setting Supported Formats.
@@ -1004,6 +1033,35 @@ class H323VideoCodec : public H323Codec
 ///////////////////////////////////////////////////////////////////////////////
 // The simplest codec is the G.711 PCM codec.
 
+/**Convert a block of 16 bit linear PCM samples to G.711 A-Law or u-Law.
+   The results are bit exact with the single sample linear2alaw() and
+   linear2ulaw() functions. SSE2 or AVX2 kernels are selected at run time
+   where the CPU supports them, otherwise a table lookup is used.
+  */
+void H323G711ALawEncode(
+  const short * samples,  ///< Linear PCM samples
+  BYTE * encoded,         ///< Buffer for count encoded bytes
+  unsigned count          ///< Number of samples
+);
+void H323G711uLawEncode(
+  const short * samples,  ///< Linear PCM samples
+  BYTE * encoded,         ///< Buffer for count encoded bytes
+  unsigned count          ///< Number of samples
+);
+
+/**Convert a block of G.711 A-Law or u-Law bytes to 16 bit linear PCM.
+  */
+void H323G711ALawDecode(
+  const BYTE * encoded,   ///< Encoded bytes
+  short * samples,        ///< Buffer for count linear PCM samples
+  unsigned count          ///< Number of bytes
+);
+void H323G711uLawDecode(
+  const BYTE * encoded,   ///< Encoded bytes
+  short * samples,        ///< Buffer for count linear PCM samples
+  unsigned count          ///< Number of bytes
+);
+
 /**This class is a G711 ALaw codec.
  */
 class H323_ALawCodec : public H323StreamedAudioCodec
@@ -1028,6 +1086,22 @@ class H323_ALawCodec : public H323StreamedAudioCodec
     static int   EncodeSample(short sample);
     static short DecodeSample(int   sample);
 
+    /**Encode the whole frame with the batch G.711 conversion.
+     */
+    virtual PBoolean EncodeFrame(
+      BYTE * buffer,    ///< Buffer into which encoded bytes are placed
+      unsigned & length ///< Actual length of encoded data buffer
+    );
+
+    /**Decode the whole frame with the batch G.711 conversion.
+     */
+    virtual PBoolean DecodeFrame(
+      const BYTE * buffer,  ///< Buffer from which encoded data is found
+      unsigned length,      ///< Length of encoded data buffer
+      unsigned & written,   ///< Number of bytes used from data buffer
+      unsigned & samples    ///< Number of sample output from frame
+    );
+
   protected:
     PBoolean sevenBit;
 };
@@ -1057,6 +1131,22 @@ class H323_muLawCodec : public H323StreamedAudioCodec
     static int   EncodeSample(short sample);
     static short DecodeSample(int   sample);
 
+    /**Encode the whole frame with the batch G.711 conversion.
+     */
+    virtual PBoolean EncodeFrame(
+      BYTE * buffer,    ///< Buffer into which encoded bytes are placed
+      unsigned & length ///< Actual length of encoded data buffer
+    );
+
+    /**Decode the whole frame with the batch G.711 conversion.
+     */
+    virtual PBoolean DecodeFrame(
+      const BYTE * buffer,  ///< Buffer from which encoded data is found
+      unsigned length,      ///< Length of encoded data buffer
+      unsigned & written,   ///< Number of bytes used from data buffer
+      unsigned & samples    ///< Number of sample output from frame
+    );
+
   protected:
     PBoolean sevenBit;
 };
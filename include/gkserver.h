@@ -47,6 +47,9 @@
 
 #include <ptlib/safecoll.h>
 
+#include <map>
+#include <vector>
+
 class PASN_Sequence;
 class PASN_Choice;
 
@@ -458,6 +461,13 @@ class H323GatekeeperCall : public PSafeObject
       */
     virtual PBoolean OnHeartbeat();
 
+    /**Get the time at which OnHeartbeat() is next due for the call.
+       This is the time of the last IRR plus the IRR frequency and a grace
+       period. An invalid time (zero) is returned if the call is not
+       monitored via IRR.
+      */
+    virtual PTime GetHeartbeatDeadline() const;
+
 #ifdef H323_H248
 
     /**Get the current credit for this call.
@@ -711,6 +721,13 @@ class H323RegisteredEndPoint : public PSafeObject
       */
     virtual PBoolean OnTimeToLive();
 
+    /**Get the time at which OnTimeToLive() is next due for the endpoint.
+       This is the later of the last RRQ and IRR plus the time to live and a
+       grace period. An invalid time (zero) is returned if the registration
+       does not expire.
+      */
+    virtual PTime GetTimeToLiveDeadline() const;
+
 #ifdef H323_H248
 
     /**Get the current call credit for this endpoint.
@@ -1086,6 +1103,229 @@ class H323GatekeeperListener : public H225_RAS
 };
 
 
+/**This class indexes the registered endpoint database of a gatekeeper.
+   Exact alias and call signal address lookups are done through hash tables,
+   voice prefixes are held in a digit trie so the longest matching prefix of
+   a dialled number is found in a single walk, and a sorted alias map is kept
+   for partial alias searches.
+
+   Lookups take a shared read lock, so concurrent ARQ and LRQ processing does
+   not serialise behind RRQ and URQ updates, which take the write lock.
+  */
+class H323RegistrationIndex : public PObject
+{
+    PCLASSINFO(H323RegistrationIndex, PObject);
+  public:
+    enum Kinds {
+      SignalAddress,
+      Alias,
+      VoicePrefix,
+      NumKinds
+    };
+
+  /**@name Construction */
+  //@{
+    H323RegistrationIndex();
+    ~H323RegistrationIndex();
+  //@}
+
+  /**@name Operations */
+  //@{
+    /**Add a key for the endpoint identifier.
+       Adding the same key and identifier pair a second time is ignored.
+      */
+    void Add(
+      Kinds kind,                 ///<  Index to add key to
+      const PString & key,        ///<  Address, alias or prefix
+      const PString & identifier  ///<  Endpoint identifier
+    );
+
+    /**Remove a key for the endpoint identifier.
+       Returns FALSE if the pair was not in the index.
+      */
+    PBoolean Remove(
+      Kinds kind,                 ///<  Index to remove key from
+      const PString & key,        ///<  Address, alias or prefix
+      const PString & identifier  ///<  Endpoint identifier
+    );
+
+    /**Remove all keys of all kinds for the endpoint identifier.
+      */
+    void RemoveAll(
+      const PString & identifier  ///<  Endpoint identifier
+    );
+
+    /**Find the identifier for an exact signal address or alias match.
+       Returns an empty string if there was no match.
+      */
+    PString Find(
+      Kinds kind,                 ///<  SignalAddress or Alias
+      const PString & key         ///<  Key to search for
+    ) const;
+
+    /**Find the first alias, in sort order, that starts with the partial
+       alias string. Returns an empty string if there was no match.
+      */
+    PString FindPartialAlias(
+      const PString & partial,    ///<  Start of alias to search for
+      PString & alias             ///<  Alias that was matched
+    ) const;
+
+    /**Find the identifier with the longest voice prefix of the number.
+       Returns an empty string if there was no match.
+      */
+    PString FindLongestPrefix(
+      const PString & number      ///<  Dialled number
+    ) const;
+
+    /**Get the number of keys of the kind in the index.
+      */
+    PINDEX GetSize(
+      Kinds kind
+    ) const;
+  //@}
+
+  protected:
+    typedef std::vector<PString> StringVector;
+
+    // Chained hash table of key to identifiers, entries for the same key
+    // are kept in insertion order so the first registration wins.
+    class HashTable {
+      public:
+        HashTable();
+        ~HashTable();
+        PBoolean Add(const PString & key, const PString & identifier);
+        PBoolean Remove(const PString & key, const PString & identifier);
+        PString Find(const PString & key) const;
+        PINDEX GetSize() const { return count; }
+      protected:
+        struct Entry {
+          PString  key;
+          PString  identifier;
+          unsigned hash;
+          Entry  * next;
+        };
+        static unsigned Hash(const PString & key);
+        void Grow();
+        std::vector<Entry *> buckets;
+        PINDEX count;
+    };
+
+    // Voice prefix trie node, indexed by dialable digit
+    enum { PrefixFanout = 12 };
+    struct PrefixNode {
+      PrefixNode(PrefixNode * parent, int slot);
+      ~PrefixNode();
+      PrefixNode   * children[PrefixFanout];
+      PrefixNode   * parent;
+      int            slot;
+      PINDEX         childCount;
+      StringVector   identifiers;
+    };
+    static int GetPrefixSlot(char digit);
+
+    PBoolean InternalRemove(Kinds kind, const PString & key, const PString & identifier);
+    PBoolean AddPrefix(const PString & prefix, const PString & identifier);
+    PBoolean RemovePrefix(const PString & prefix, const PString & identifier);
+
+    HashTable  addresses;
+    HashTable  aliases;
+    std::multimap<PString, PString> sortedAliases;
+    PrefixNode prefixes;
+    std::map<PString, StringVector> otherPrefixes;   // Prefixes with non-dialable characters
+    PINDEX     prefixCount;
+
+    // Reverse lookup used when an endpoint is removed
+    std::map<PString, StringVector> keysByIdentifier[NumKinds];
+
+    mutable PReadWriteMutex mutex;
+};
+
+
+/**This class schedules the aging of gatekeeper registrations and calls.
+   Entries are identified by a key string (endpoint identifier or call
+   description) and are held on a hierarchical timer wheel of one second
+   ticks, so scheduling, rescheduling and cancelling are constant time and
+   the monitor thread only touches entries whose deadline has passed.
+
+   Each level has 64 slots, the first covering a minute in one second steps
+   and each further level covering 64 times the range of the one below.
+   Entries on the upper levels are cascaded down as the wheel turns, entries
+   beyond the range of the top level are parked in its furthest slot and
+   re-placed when they come around.
+  */
+class H323GatekeeperTimerWheel : public PObject
+{
+    PCLASSINFO(H323GatekeeperTimerWheel, PObject);
+  public:
+  /**@name Construction */
+  //@{
+    H323GatekeeperTimerWheel();
+    ~H323GatekeeperTimerWheel();
+  //@}
+
+  /**@name Operations */
+  //@{
+    /**Schedule the key to expire at the deadline.
+       If the key is already scheduled it is moved to the new deadline. A
+       deadline in the past expires on the next tick of the wheel.
+      */
+    void Schedule(
+      const PString & key,        ///<  Endpoint identifier or call description
+      const PTime & deadline      ///<  Time key is due
+    );
+
+    /**Remove the key from the wheel.
+       Returns FALSE if the key was not scheduled.
+      */
+    PBoolean Cancel(
+      const PString & key         ///<  Endpoint identifier or call description
+    );
+
+    /**Turn the wheel up to the time given and collect all keys that are due.
+       The keys are removed from the wheel and must be rescheduled by the
+       caller if they are to be aged again. Returns the number of keys
+       appended to the list.
+      */
+    PINDEX Expire(
+      const PTime & now,          ///<  Current time
+      std::vector<PString> & due  ///<  List to receive expired keys
+    );
+
+    /**Get the number of keys scheduled on the wheel.
+      */
+    PINDEX GetSize() const;
+  //@}
+
+  protected:
+    enum {
+      LevelBits = 6,
+      SlotsPerLevel = 1 << LevelBits,
+      SlotMask = SlotsPerLevel - 1,
+      NumLevels = 4
+    };
+
+    struct Entry {
+      PString   key;
+      PInt64    tick;
+      int       level;
+      int       slot;
+      Entry   * prev;
+      Entry   * next;
+    };
+
+    void Place(Entry * entry);
+    void Unlink(Entry * entry);
+    void Cascade(int level);
+
+    Entry * slots[NumLevels][SlotsPerLevel];
+    std::map<PString, Entry *> entries;
+    PInt64  currentTick;    // Next tick to be expired, in seconds
+
+    mutable PMutex mutex;
+};
+
+
 /**This class implements a basic gatekeeper server functionality.
    An instance of this class contains all of the state information and
    operations for a gatekeeper. Multiple gatekeeper listeners may be using
@@ -1602,6 +1842,10 @@ class H323GatekeeperServer : public H323TransactionServer
       */
     unsigned GetActiveCalls() const { return activeCalls.GetSize(); }
 
+    /**Get the number of registrations and calls scheduled for aging.
+      */
+    PINDEX GetScheduledAging() const { return endpointAging.GetSize() + callAging.GetSize(); }
+
     /**Get the peak calls count.
       */
     unsigned GetPeakCalls() const { return peakCalls; }
@@ -1615,6 +1859,21 @@ class H323GatekeeperServer : public H323TransactionServer
     unsigned GetRejectedCalls() const { return rejectedCalls; }
   //@}
 
+    /**Schedule the next time to live check of the endpoint.
+       This is called whenever an RRQ or IRR is received from the endpoint.
+       Endpoints without any aliases are checked on the next monitor tick.
+      */
+    void ScheduleTimeToLive(
+      H323RegisteredEndPoint & ep
+    );
+
+    /**Schedule the next heartbeat check of the call.
+       This is called whenever the call is admitted or an IRR is received.
+      */
+    void ScheduleHeartbeat(
+      H323GatekeeperCall & call
+    );
+
     // Remove an alias from the server database.
     void RemoveAlias(
       H323RegisteredEndPoint & ep,
@@ -1678,19 +1937,13 @@ class H323GatekeeperServer : public H323TransactionServer
 
     PSafeDictionary<PString, H323RegisteredEndPoint> byIdentifier;
 
-    class StringMap : public PString {
-        PCLASSINFO(StringMap, PString);
-      public:
-        StringMap(const PString & from, const PString & id)
-          : PString(from), identifier(id) { }
-        PString identifier;
-    };
-    PSortedStringList byAddress;
-    PSortedStringList byAlias;
-    PSortedStringList byVoicePrefix;
+    H323RegistrationIndex registrations;
 
     PSafeSortedList<H323GatekeeperCall> activeCalls;
 
+    H323GatekeeperTimerWheel endpointAging;
+    H323GatekeeperTimerWheel callAging;
+
     PINDEX peakRegistrations;
     PINDEX totalRegistrations;
     PINDEX rejectedRegistrations;
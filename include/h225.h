@@ -14,6 +14,7 @@
 #endif
 
 #include <ptclib/asner.h>
+#include "h323arena.h"
 
 #include "h235.h"
 #include "h245.h"
@@ -32,6 +33,7 @@ class H225_ReleaseCompleteReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ReleaseCompleteReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ReleaseCompleteReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -96,6 +98,7 @@ class H225_ScnConnectionType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ScnConnectionType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ScnConnectionType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -123,6 +126,7 @@ class H225_ScnConnectionAggregation : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ScnConnectionAggregation, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ScnConnectionAggregation(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -149,6 +153,7 @@ class H225_PresentationIndicator : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_PresentationIndicator, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_PresentationIndicator(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -172,6 +177,7 @@ class H225_ScreeningIndicator : public PASN_Enumeration
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ScreeningIndicator, PASN_Enumeration);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ScreeningIndicator(unsigned tag = UniversalEnumeration, TagClass tagClass = UniversalTagClass);
 
@@ -196,6 +202,7 @@ class H225_FacilityReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_FacilityReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_FacilityReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -233,6 +240,7 @@ class H225_TransportAddress : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TransportAddress, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TransportAddress(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -304,6 +312,7 @@ class H225_SupportedProtocols : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_SupportedProtocols, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_SupportedProtocols(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -409,6 +418,7 @@ class H225_H221NonStandard : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H221NonStandard, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H221NonStandard(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -436,6 +446,7 @@ class H225_TunnelledProtocolAlternateIdentifier : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TunnelledProtocolAlternateIdentifier, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TunnelledProtocolAlternateIdentifier(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -468,6 +479,7 @@ class H225_NonStandardIdentifier : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_NonStandardIdentifier, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_NonStandardIdentifier(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -502,6 +514,7 @@ class H225_AliasAddress : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_AliasAddress, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_AliasAddress(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -558,6 +571,7 @@ class H225_AddressPattern : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_AddressPattern, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_AddressPattern(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -597,6 +611,7 @@ class H225_PartyNumber : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_PartyNumber, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_PartyNumber(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -641,6 +656,7 @@ class H225_NumberDigits : public PASN_IA5String
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_NumberDigits, PASN_IA5String);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_NumberDigits(unsigned tag = UniversalIA5String, TagClass tagClass = UniversalTagClass);
 
@@ -659,6 +675,7 @@ class H225_DisplayName : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_DisplayName, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_DisplayName(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -689,6 +706,7 @@ class H225_PublicTypeOfNumber : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_PublicTypeOfNumber, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_PublicTypeOfNumber(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -715,6 +733,7 @@ class H225_PrivateTypeOfNumber : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_PrivateTypeOfNumber, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_PrivateTypeOfNumber(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -744,6 +763,7 @@ class H225_MobileUIM : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_MobileUIM, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_MobileUIM(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -779,6 +799,7 @@ class H225_TBCD_STRING : public PASN_IA5String
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TBCD_STRING, PASN_IA5String);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TBCD_STRING(unsigned tag = UniversalIA5String, TagClass tagClass = UniversalTagClass);
 
@@ -797,6 +818,7 @@ class H225_GSM_UIM : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GSM_UIM, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GSM_UIM(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -840,6 +862,7 @@ class H225_IsupNumber : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_IsupNumber, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_IsupNumber(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -884,6 +907,7 @@ class H225_NatureOfAddress : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_NatureOfAddress, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_NatureOfAddress(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -912,6 +936,7 @@ class H225_IsupDigits : public PASN_IA5String
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_IsupDigits, PASN_IA5String);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_IsupDigits(unsigned tag = UniversalIA5String, TagClass tagClass = UniversalTagClass);
 
@@ -930,6 +955,7 @@ class H225_ExtendedAliasAddress : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ExtendedAliasAddress, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ExtendedAliasAddress(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -962,6 +988,7 @@ class H225_UseSpecifiedTransport : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_UseSpecifiedTransport, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_UseSpecifiedTransport(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -987,6 +1014,7 @@ class H225_SecurityServiceMode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_SecurityServiceMode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_SecurityServiceMode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1017,6 +1045,7 @@ class H225_SecurityErrors : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_SecurityErrors, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_SecurityErrors(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1053,6 +1082,7 @@ class H225_SecurityErrors2 : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_SecurityErrors2, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_SecurityErrors2(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1082,6 +1112,7 @@ class H225_H245Security : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H245Security, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H245Security(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1119,6 +1150,7 @@ class H225_Q954Details : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Q954Details, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Q954Details(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1145,6 +1177,7 @@ class H225_GloballyUniqueID : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GloballyUniqueID, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GloballyUniqueID(unsigned tag = UniversalOctetString, TagClass tagClass = UniversalTagClass);
 
@@ -1168,6 +1201,7 @@ class H225_ConferenceIdentifier : public H225_GloballyUniqueID
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ConferenceIdentifier, H225_GloballyUniqueID);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ConferenceIdentifier(unsigned tag = UniversalOctetString, TagClass tagClass = UniversalTagClass);
 
@@ -1191,6 +1225,7 @@ class H225_RequestSeqNum : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RequestSeqNum, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RequestSeqNum(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -1209,6 +1244,7 @@ class H225_GatekeeperIdentifier : public PASN_BMPString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GatekeeperIdentifier, PASN_BMPString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GatekeeperIdentifier(unsigned tag = UniversalBMPString, TagClass tagClass = UniversalTagClass);
 
@@ -1229,6 +1265,7 @@ class H225_BandWidth : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_BandWidth, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_BandWidth(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -1247,6 +1284,7 @@ class H225_CallReferenceValue : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallReferenceValue, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallReferenceValue(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -1265,6 +1303,7 @@ class H225_EndpointIdentifier : public PASN_BMPString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_EndpointIdentifier, PASN_BMPString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_EndpointIdentifier(unsigned tag = UniversalBMPString, TagClass tagClass = UniversalTagClass);
 
@@ -1285,6 +1324,7 @@ class H225_ProtocolIdentifier : public PASN_ObjectId
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ProtocolIdentifier, PASN_ObjectId);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ProtocolIdentifier(unsigned tag = UniversalObjectId, TagClass tagClass = UniversalTagClass);
 
@@ -1301,6 +1341,7 @@ class H225_TimeToLive : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TimeToLive, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TimeToLive(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -1319,6 +1360,7 @@ class H225_H248PackagesDescriptor : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H248PackagesDescriptor, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H248PackagesDescriptor(unsigned tag = UniversalOctetString, TagClass tagClass = UniversalTagClass);
 
@@ -1342,6 +1384,7 @@ class H225_H248SignalsDescriptor : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H248SignalsDescriptor, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H248SignalsDescriptor(unsigned tag = UniversalOctetString, TagClass tagClass = UniversalTagClass);
 
@@ -1365,6 +1408,7 @@ class H225_CallIdentifier : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallIdentifier, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallIdentifier(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1392,6 +1436,7 @@ class H225_EncryptIntAlg : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_EncryptIntAlg, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_EncryptIntAlg(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1423,6 +1468,7 @@ class H225_NonIsoIntegrityMechanism : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_NonIsoIntegrityMechanism, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_NonIsoIntegrityMechanism(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1457,6 +1503,7 @@ class H225_IntegrityMechanism : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_IntegrityMechanism, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_IntegrityMechanism(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1494,6 +1541,7 @@ class H225_ICV : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ICV, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ICV(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1520,6 +1568,7 @@ class H225_FastStartToken : public H235_ClearToken
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_FastStartToken, H235_ClearToken);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_FastStartToken(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1536,6 +1585,7 @@ class H225_EncodedFastStartToken : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_EncodedFastStartToken, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_EncodedFastStartToken(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1559,6 +1609,7 @@ class H225_CryptoH323Token : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CryptoH323Token, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CryptoH323Token(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1624,6 +1675,7 @@ class H225_CallLinkage : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallLinkage, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallLinkage(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1655,6 +1707,7 @@ class H225_CapacityReportingCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CapacityReportingCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CapacityReportingCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1680,6 +1733,7 @@ class H225_CarrierInfo : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CarrierInfo, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CarrierInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1715,6 +1769,7 @@ class H225_ServiceControlDescriptor : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ServiceControlDescriptor, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ServiceControlDescriptor(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1760,6 +1815,7 @@ class H225_CallTerminationCause : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallTerminationCause, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallTerminationCause(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1789,6 +1845,7 @@ class H225_CallCreditCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallCreditCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallCreditCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1822,6 +1879,7 @@ class H225_GenericIdentifier : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GenericIdentifier, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GenericIdentifier(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1858,6 +1916,7 @@ class H225_Content : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Content, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Content(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1921,6 +1980,7 @@ class H225_TransportChannelInfo : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TransportChannelInfo, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TransportChannelInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1952,6 +2012,7 @@ class H225_RehomingModel : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RehomingModel, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RehomingModel(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2008,6 +2069,7 @@ class H225_RasMessage : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RasMessage, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RasMessage(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2262,6 +2324,7 @@ class H225_GatekeeperRejectReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GatekeeperRejectReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GatekeeperRejectReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2301,6 +2364,7 @@ class H225_RegistrationRejectReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RegistrationRejectReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RegistrationRejectReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2361,6 +2425,7 @@ class H225_UnregRequestReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_UnregRequestReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_UnregRequestReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2397,6 +2462,7 @@ class H225_UnregRejectReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_UnregRejectReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_UnregRejectReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2430,6 +2496,7 @@ class H225_CallType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2454,6 +2521,7 @@ class H225_CallModel : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallModel, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallModel(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2478,6 +2546,7 @@ class H225_TransportQOS : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TransportQOS, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TransportQOS(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2509,6 +2578,7 @@ class H225_UUIEsRequested : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_UUIEsRequested, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_UUIEsRequested(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2556,6 +2626,7 @@ class H225_AdmissionRejectReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_AdmissionRejectReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_AdmissionRejectReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2614,6 +2685,7 @@ class H225_BandRejectReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_BandRejectReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_BandRejectReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2652,6 +2724,7 @@ class H225_LocationRejectReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_LocationRejectReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_LocationRejectReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2701,6 +2774,7 @@ class H225_DisengageReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_DisengageReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_DisengageReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2726,6 +2800,7 @@ class H225_DisengageRejectReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_DisengageRejectReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_DisengageRejectReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2757,6 +2832,7 @@ class H225_InfoRequestResponseStatus : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_InfoRequestResponseStatus, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_InfoRequestResponseStatus(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2783,6 +2859,7 @@ class H225_InfoRequestNakReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_InfoRequestNakReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_InfoRequestNakReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2814,6 +2891,7 @@ class H225_H323_UserInformation_user_data : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H323_UserInformation_user_data, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H323_UserInformation_user_data(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2853,6 +2931,7 @@ class H225_H323_UU_PDU_h323_message_body : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H323_UU_PDU_h323_message_body, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H323_UU_PDU_h323_message_body(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2959,6 +3038,7 @@ class H225_ArrayOf_PASN_OctetString : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_PASN_OctetString, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_PASN_OctetString(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2979,6 +3059,7 @@ class H225_ArrayOf_NonStandardParameter : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_NonStandardParameter, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_NonStandardParameter(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2999,6 +3080,7 @@ class H225_ArrayOf_GenericData : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_GenericData, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_GenericData(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3019,6 +3101,7 @@ class H225_ArrayOf_ClearToken : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_ClearToken, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_ClearToken(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3039,6 +3122,7 @@ class H225_ArrayOf_CryptoH323Token : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_CryptoH323Token, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_CryptoH323Token(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3059,6 +3143,7 @@ class H225_ArrayOf_AliasAddress : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_AliasAddress, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_AliasAddress(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3079,6 +3164,7 @@ class H225_ArrayOf_ServiceControlSession : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_ServiceControlSession, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_ServiceControlSession(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3099,6 +3185,7 @@ class H225_ArrayOf_DisplayName : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_DisplayName, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_DisplayName(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3117,6 +3204,7 @@ class H225_Connect_UUIE_language : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Connect_UUIE_language, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Connect_UUIE_language(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3137,6 +3225,7 @@ class H225_ArrayOf_CallReferenceValue : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_CallReferenceValue, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_CallReferenceValue(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3155,6 +3244,7 @@ class H225_Setup_UUIE_conferenceGoal : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Setup_UUIE_conferenceGoal, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Setup_UUIE_conferenceGoal(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3182,6 +3272,7 @@ class H225_ArrayOf_H245Security : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_H245Security, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_H245Security(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3200,6 +3291,7 @@ class H225_Setup_UUIE_connectionParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Setup_UUIE_connectionParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Setup_UUIE_connectionParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3227,6 +3319,7 @@ class H225_Setup_UUIE_language : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Setup_UUIE_language, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Setup_UUIE_language(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3247,6 +3340,7 @@ class H225_ArrayOf_SupportedProtocols : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_SupportedProtocols, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_SupportedProtocols(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3267,6 +3361,7 @@ class H225_ArrayOf_FeatureDescriptor : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_FeatureDescriptor, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_FeatureDescriptor(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3287,6 +3382,7 @@ class H225_ArrayOf_ExtendedAliasAddress : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_ExtendedAliasAddress, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_ExtendedAliasAddress(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3307,6 +3403,7 @@ class H225_ArrayOf_ConferenceList : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_ConferenceList, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_ConferenceList(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3325,6 +3422,7 @@ class H225_TransportAddress_ipAddress : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TransportAddress_ipAddress, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TransportAddress_ipAddress(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3351,6 +3449,7 @@ class H225_TransportAddress_ipxAddress : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TransportAddress_ipxAddress, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TransportAddress_ipxAddress(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3378,6 +3477,7 @@ class H225_TransportAddress_ip6Address : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TransportAddress_ip6Address, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TransportAddress_ip6Address(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3406,6 +3506,7 @@ class H225_ArrayOf_TunnelledProtocol : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_TunnelledProtocol, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_TunnelledProtocol(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3426,6 +3527,7 @@ class H225_ArrayOf_DataRate : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_DataRate, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_DataRate(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3446,6 +3548,7 @@ class H225_ArrayOf_SupportedPrefix : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_SupportedPrefix, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_SupportedPrefix(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3466,6 +3569,7 @@ class H225_TunnelledProtocol_id : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TunnelledProtocol_id, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TunnelledProtocol_id(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3495,6 +3599,7 @@ class H225_AddressPattern_range : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_AddressPattern_range, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_AddressPattern_range(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3521,6 +3626,7 @@ class H225_ANSI_41_UIM_system_id : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ANSI_41_UIM_system_id, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ANSI_41_UIM_system_id(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3545,6 +3651,7 @@ class H225_ArrayOf_TransportAddress : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_TransportAddress, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_TransportAddress(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3565,6 +3672,7 @@ class H225_ArrayOf_AlternateGK : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_AlternateGK, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_AlternateGK(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3583,6 +3691,7 @@ class H225_CryptoH323Token_cryptoEPPwdHash : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CryptoH323Token_cryptoEPPwdHash, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CryptoH323Token_cryptoEPPwdHash(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3610,6 +3719,7 @@ class H225_CryptoH323Token_cryptoGKPwdHash : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CryptoH323Token_cryptoGKPwdHash, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CryptoH323Token_cryptoGKPwdHash(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3637,6 +3747,7 @@ class H225_CapacityReportingSpecification_when : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CapacityReportingSpecification_when, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CapacityReportingSpecification_when(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3670,6 +3781,7 @@ class H225_ArrayOf_CallsAvailable : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_CallsAvailable, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_CallsAvailable(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3688,6 +3800,7 @@ class H225_CicInfo_cic : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CicInfo_cic, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CicInfo_cic(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3706,6 +3819,7 @@ class H225_GroupID_member : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GroupID_member, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GroupID_member(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3724,6 +3838,7 @@ class H225_ServiceControlSession_reason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ServiceControlSession_reason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ServiceControlSession_reason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3747,6 +3862,7 @@ class H225_RasUsageSpecification_when : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RasUsageSpecification_when, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RasUsageSpecification_when(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3780,6 +3896,7 @@ class H225_RasUsageSpecification_callStartingPoint : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RasUsageSpecification_callStartingPoint, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RasUsageSpecification_callStartingPoint(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3811,6 +3928,7 @@ class H225_CallCreditServiceControl_billingMode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallCreditServiceControl_billingMode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallCreditServiceControl_billingMode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3833,6 +3951,7 @@ class H225_CallCreditServiceControl_callStartingPoint : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallCreditServiceControl_callStartingPoint, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallCreditServiceControl_callStartingPoint(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3857,6 +3976,7 @@ class H225_ArrayOf_EnumeratedParameter : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_EnumeratedParameter, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_EnumeratedParameter(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3875,6 +3995,7 @@ class H225_RTPSession_associatedSessionIds : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RTPSession_associatedSessionIds, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RTPSession_associatedSessionIds(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3895,6 +4016,7 @@ class H225_ArrayOf_AdmissionConfirm : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_AdmissionConfirm, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_AdmissionConfirm(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3915,6 +4037,7 @@ class H225_ArrayOf_Endpoint : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_Endpoint, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_Endpoint(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3935,6 +4058,7 @@ class H225_ArrayOf_AuthenticationMechanism : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_AuthenticationMechanism, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_AuthenticationMechanism(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3953,6 +4077,7 @@ class H225_ArrayOf_PASN_ObjectId : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_PASN_ObjectId, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_PASN_ObjectId(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3973,6 +4098,7 @@ class H225_ArrayOf_IntegrityMechanism : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_IntegrityMechanism, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_IntegrityMechanism(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3993,6 +4119,7 @@ class H225_ArrayOf_AddressPattern : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_AddressPattern, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_AddressPattern(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4013,6 +4140,7 @@ class H225_ArrayOf_H248PackagesDescriptor : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_H248PackagesDescriptor, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_H248PackagesDescriptor(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4031,6 +4159,7 @@ class H225_RegistrationRequest_language : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RegistrationRequest_language, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RegistrationRequest_language(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4051,6 +4180,7 @@ class H225_ArrayOf_RasUsageSpecification : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_RasUsageSpecification, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_RasUsageSpecification(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4069,6 +4199,7 @@ class H225_RegistrationConfirm_language : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RegistrationConfirm_language, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RegistrationConfirm_language(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4087,6 +4218,7 @@ class H225_RegistrationRejectReason_invalidTerminalAliases : public PASN_Sequenc
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RegistrationRejectReason_invalidTerminalAliases, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RegistrationRejectReason_invalidTerminalAliases(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4122,6 +4254,7 @@ class H225_ArrayOf_QOSCapability : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_QOSCapability, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_QOSCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4140,6 +4273,7 @@ class H225_AdmissionConfirm_language : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_AdmissionConfirm_language, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_AdmissionConfirm_language(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4160,6 +4294,7 @@ class H225_ArrayOf_PartyNumber : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_PartyNumber, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_PartyNumber(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4180,6 +4315,7 @@ class H225_ArrayOf_BandwidthDetails : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_BandwidthDetails, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_BandwidthDetails(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4198,6 +4334,7 @@ class H225_LocationRequest_language : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_LocationRequest_language, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_LocationRequest_language(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4216,6 +4353,7 @@ class H225_LocationConfirm_language : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_LocationConfirm_language, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_LocationConfirm_language(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4236,6 +4374,7 @@ class H225_InfoRequestResponse_perCallInfo : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_InfoRequestResponse_perCallInfo, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_InfoRequestResponse_perCallInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4254,6 +4393,7 @@ class H225_ServiceControlIndication_callSpecific : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ServiceControlIndication_callSpecific, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ServiceControlIndication_callSpecific(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4281,6 +4421,7 @@ class H225_ServiceControlResponse_result : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ServiceControlResponse_result, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ServiceControlResponse_result(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4306,6 +4447,7 @@ class H225_TransportAddress_ipSourceRoute_route : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TransportAddress_ipSourceRoute_route, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TransportAddress_ipSourceRoute_route(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4324,6 +4466,7 @@ class H225_TransportAddress_ipSourceRoute_routing : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TransportAddress_ipSourceRoute_routing, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TransportAddress_ipSourceRoute_routing(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4348,6 +4491,7 @@ class H225_ArrayOf_RTPSession : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_RTPSession, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_RTPSession(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4368,6 +4512,7 @@ class H225_ArrayOf_TransportChannelInfo : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_TransportChannelInfo, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_TransportChannelInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4388,6 +4533,7 @@ class H225_ArrayOf_ConferenceIdentifier : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ArrayOf_ConferenceIdentifier, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ArrayOf_ConferenceIdentifier(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4408,6 +4554,7 @@ class H225_InfoRequestResponse_perCallInfo_subtype_pdu : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_InfoRequestResponse_perCallInfo_subtype_pdu, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_InfoRequestResponse_perCallInfo_subtype_pdu(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4426,6 +4573,7 @@ class H225_Status_UUIE : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Status_UUIE, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Status_UUIE(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4459,6 +4607,7 @@ class H225_StatusInquiry_UUIE : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_StatusInquiry_UUIE, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_StatusInquiry_UUIE(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4492,6 +4641,7 @@ class H225_SetupAcknowledge_UUIE : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_SetupAcknowledge_UUIE, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_SetupAcknowledge_UUIE(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4525,6 +4675,7 @@ class H225_VendorIdentifier : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_VendorIdentifier, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_VendorIdentifier(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4559,6 +4710,7 @@ class H225_TunnelledProtocol : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TunnelledProtocol, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TunnelledProtocol(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4589,6 +4741,7 @@ class H225_NonStandardParameter : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_NonStandardParameter, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_NonStandardParameter(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4615,6 +4768,7 @@ class H225_PublicPartyNumber : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_PublicPartyNumber, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_PublicPartyNumber(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4641,6 +4795,7 @@ class H225_PrivatePartyNumber : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_PrivatePartyNumber, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_PrivatePartyNumber(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4667,6 +4822,7 @@ class H225_ANSI_41_UIM : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ANSI_41_UIM, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ANSI_41_UIM(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4717,6 +4873,7 @@ class H225_IsupPublicPartyNumber : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_IsupPublicPartyNumber, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_IsupPublicPartyNumber(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4743,6 +4900,7 @@ class H225_IsupPrivatePartyNumber : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_IsupPrivatePartyNumber, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_IsupPrivatePartyNumber(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4769,6 +4927,7 @@ class H225_AlternateTransportAddresses : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_AlternateTransportAddresses, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_AlternateTransportAddresses(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4800,6 +4959,7 @@ class H225_AlternateGK : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_AlternateGK, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_AlternateGK(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4832,6 +4992,7 @@ class H225_AltGKInfo : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_AltGKInfo, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_AltGKInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4858,6 +5019,7 @@ class H225_SecurityCapabilities : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_SecurityCapabilities, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_SecurityCapabilities(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4890,6 +5052,7 @@ class H225_QseriesOptions : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_QseriesOptions, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_QseriesOptions(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4922,6 +5085,7 @@ class H225_DataRate : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_DataRate, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_DataRate(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4954,6 +5118,7 @@ class H225_SupportedPrefix : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_SupportedPrefix, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_SupportedPrefix(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4984,6 +5149,7 @@ class H225_CapacityReportingSpecification : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CapacityReportingSpecification, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CapacityReportingSpecification(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5009,6 +5175,7 @@ class H225_CallCapacityInfo : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallCapacityInfo, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallCapacityInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5060,6 +5227,7 @@ class H225_CallsAvailable : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallsAvailable, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallsAvailable(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5092,6 +5260,7 @@ class H225_CicInfo : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CicInfo, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CicInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5118,6 +5287,7 @@ class H225_GroupID : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GroupID, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GroupID(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5148,6 +5318,7 @@ class H225_ServiceControlSession : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ServiceControlSession, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ServiceControlSession(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5179,6 +5350,7 @@ class H225_RasUsageInfoTypes : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RasUsageInfoTypes, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RasUsageInfoTypes(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5213,6 +5385,7 @@ class H225_RasUsageSpecification : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RasUsageSpecification, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RasUsageSpecification(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5244,6 +5417,7 @@ class H225_RasUsageInformation : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RasUsageInformation, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RasUsageInformation(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5278,6 +5452,7 @@ class H225_BandwidthDetails : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_BandwidthDetails, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_BandwidthDetails(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5306,6 +5481,7 @@ class H225_CallCreditServiceControl : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallCreditServiceControl, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallCreditServiceControl(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5343,6 +5519,7 @@ class H225_GenericData : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GenericData, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GenericData(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5373,6 +5550,7 @@ class H225_EnumeratedParameter : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_EnumeratedParameter, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_EnumeratedParameter(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5403,6 +5581,7 @@ class H225_FeatureSet : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_FeatureSet, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_FeatureSet(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5437,6 +5616,7 @@ class H225_RTPSession : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RTPSession, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RTPSession(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5474,6 +5654,7 @@ class H225_GatekeeperConfirm : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GatekeeperConfirm, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GatekeeperConfirm(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5530,6 +5711,7 @@ class H225_GatekeeperReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GatekeeperReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GatekeeperReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5576,6 +5758,7 @@ class H225_RegistrationReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RegistrationReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RegistrationReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5624,6 +5807,7 @@ class H225_UnregistrationRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_UnregistrationRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_UnregistrationRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5681,6 +5865,7 @@ class H225_UnregistrationConfirm : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_UnregistrationConfirm, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_UnregistrationConfirm(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5721,6 +5906,7 @@ class H225_UnregistrationReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_UnregistrationReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_UnregistrationReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5762,6 +5948,7 @@ class H225_AdmissionReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_AdmissionReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_AdmissionReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5811,6 +5998,7 @@ class H225_BandwidthReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_BandwidthReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_BandwidthReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5853,6 +6041,7 @@ class H225_LocationReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_LocationReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_LocationReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5898,6 +6087,7 @@ class H225_DisengageReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_DisengageReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_DisengageReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5939,6 +6129,7 @@ class H225_InfoRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_InfoRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_InfoRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5996,6 +6187,7 @@ class H225_InfoRequestAck : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_InfoRequestAck, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_InfoRequestAck(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6032,6 +6224,7 @@ class H225_InfoRequestNak : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_InfoRequestNak, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_InfoRequestNak(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6071,6 +6264,7 @@ class H225_NonStandardMessage : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_NonStandardMessage, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_NonStandardMessage(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6110,6 +6304,7 @@ class H225_UnknownMessageResponse : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_UnknownMessageResponse, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_UnknownMessageResponse(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6146,6 +6341,7 @@ class H225_RequestInProgress : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RequestInProgress, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RequestInProgress(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6183,6 +6379,7 @@ class H225_ResourcesAvailableConfirm : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ResourcesAvailableConfirm, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ResourcesAvailableConfirm(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6222,6 +6419,7 @@ class H225_ServiceControlIndication : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ServiceControlIndication, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ServiceControlIndication(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6267,6 +6465,7 @@ class H225_ServiceControlResponse : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ServiceControlResponse, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ServiceControlResponse(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6309,6 +6508,7 @@ class H225_H323_UU_PDU_tunnelledSignallingMessage : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H323_UU_PDU_tunnelledSignallingMessage, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H323_UU_PDU_tunnelledSignallingMessage(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6342,6 +6542,7 @@ class H225_TransportAddress_ipSourceRoute : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TransportAddress_ipSourceRoute, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TransportAddress_ipSourceRoute(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6370,6 +6571,7 @@ class H225_RegistrationConfirm_preGrantedARQ : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RegistrationConfirm_preGrantedARQ, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RegistrationConfirm_preGrantedARQ(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6409,6 +6611,7 @@ class H225_StimulusControl : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_StimulusControl, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_StimulusControl(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6442,6 +6645,7 @@ class H225_ConferenceList : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ConferenceList, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ConferenceList(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6475,6 +6679,7 @@ class H225_GatewayInfo : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GatewayInfo, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GatewayInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6506,6 +6711,7 @@ class H225_H310Caps : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H310Caps, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H310Caps(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6539,6 +6745,7 @@ class H225_H320Caps : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H320Caps, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H320Caps(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6572,6 +6779,7 @@ class H225_H321Caps : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H321Caps, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H321Caps(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6605,6 +6813,7 @@ class H225_H322Caps : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H322Caps, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H322Caps(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6638,6 +6847,7 @@ class H225_H323Caps : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H323Caps, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H323Caps(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6671,6 +6881,7 @@ class H225_H324Caps : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H324Caps, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H324Caps(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6704,6 +6915,7 @@ class H225_VoiceCaps : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_VoiceCaps, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_VoiceCaps(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6737,6 +6949,7 @@ class H225_T120OnlyCaps : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_T120OnlyCaps, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_T120OnlyCaps(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6770,6 +6983,7 @@ class H225_NonStandardProtocol : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_NonStandardProtocol, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_NonStandardProtocol(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6802,6 +7016,7 @@ class H225_T38FaxAnnexbOnlyCaps : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_T38FaxAnnexbOnlyCaps, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_T38FaxAnnexbOnlyCaps(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6836,6 +7051,7 @@ class H225_SIPCaps : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_SIPCaps, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_SIPCaps(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6869,6 +7085,7 @@ class H225_McuInfo : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_McuInfo, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_McuInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6900,6 +7117,7 @@ class H225_TerminalInfo : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_TerminalInfo, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_TerminalInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6929,6 +7147,7 @@ class H225_GatekeeperInfo : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GatekeeperInfo, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GatekeeperInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6958,6 +7177,7 @@ class H225_FeatureDescriptor : public H225_GenericData
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_FeatureDescriptor, H225_GenericData);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_FeatureDescriptor(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6974,6 +7194,7 @@ class H225_CallCapacity : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallCapacity, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallCapacity(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7005,6 +7226,7 @@ class H225_CircuitIdentifier : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CircuitIdentifier, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CircuitIdentifier(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7038,6 +7260,7 @@ class H225_RegistrationConfirm : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RegistrationConfirm, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RegistrationConfirm(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7117,6 +7340,7 @@ class H225_BandwidthRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_BandwidthRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_BandwidthRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7177,6 +7401,7 @@ class H225_BandwidthConfirm : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_BandwidthConfirm, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_BandwidthConfirm(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7220,6 +7445,7 @@ class H225_ResourcesAvailableIndicate : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ResourcesAvailableIndicate, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ResourcesAvailableIndicate(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7264,6 +7490,7 @@ class H225_H323_UU_PDU : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H323_UU_PDU, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H323_UU_PDU(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7312,6 +7539,7 @@ class H225_EndpointType : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_EndpointType, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_EndpointType(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7357,6 +7585,7 @@ class H225_CircuitInfo : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CircuitInfo, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CircuitInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7390,6 +7619,7 @@ class H225_GatekeeperRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_GatekeeperRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_GatekeeperRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7453,6 +7683,7 @@ class H225_RegistrationRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_RegistrationRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_RegistrationRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7547,6 +7778,7 @@ class H225_AdmissionRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_AdmissionRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_AdmissionRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7635,6 +7867,7 @@ class H225_AdmissionConfirm : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_AdmissionConfirm, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_AdmissionConfirm(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7716,6 +7949,7 @@ class H225_LocationRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_LocationRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_LocationRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7784,6 +8018,7 @@ class H225_LocationConfirm : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_LocationConfirm, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_LocationConfirm(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7852,6 +8087,7 @@ class H225_DisengageRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_DisengageRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_DisengageRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7912,6 +8148,7 @@ class H225_DisengageConfirm : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_DisengageConfirm, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_DisengageConfirm(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7958,6 +8195,7 @@ class H225_InfoRequestResponse : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_InfoRequestResponse, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_InfoRequestResponse(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8012,6 +8250,7 @@ class H225_InfoRequestResponse_perCallInfo_subtype : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_InfoRequestResponse_perCallInfo_subtype, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_InfoRequestResponse_perCallInfo_subtype(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8072,6 +8311,7 @@ class H225_InfoRequestResponse_perCallInfo_subtype_pdu_subtype : public PASN_Seq
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_InfoRequestResponse_perCallInfo_subtype_pdu_subtype, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_InfoRequestResponse_perCallInfo_subtype_pdu_subtype(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8098,6 +8338,7 @@ class H225_H323_UserInformation : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_H323_UserInformation, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_H323_UserInformation(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8128,6 +8369,7 @@ class H225_Alerting_UUIE : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Alerting_UUIE, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Alerting_UUIE(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8189,6 +8431,7 @@ class H225_CallProceeding_UUIE : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_CallProceeding_UUIE, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_CallProceeding_UUIE(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8238,6 +8481,7 @@ class H225_Connect_UUIE : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Connect_UUIE, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Connect_UUIE(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8302,6 +8546,7 @@ class H225_Information_UUIE : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Information_UUIE, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Information_UUIE(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8342,6 +8587,7 @@ class H225_ReleaseComplete_UUIE : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_ReleaseComplete_UUIE, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_ReleaseComplete_UUIE(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8394,6 +8640,7 @@ class H225_Setup_UUIE : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Setup_UUIE, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Setup_UUIE(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8497,6 +8744,7 @@ class H225_Facility_UUIE : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Facility_UUIE, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Facility_UUIE(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8564,6 +8812,7 @@ class H225_Progress_UUIE : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Progress_UUIE, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Progress_UUIE(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8610,6 +8859,7 @@ class H225_Notify_UUIE : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Notify_UUIE, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Notify_UUIE(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8653,6 +8903,7 @@ class H225_Endpoint : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H225_Endpoint, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H225_Endpoint(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
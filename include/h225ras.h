@@ -137,6 +137,16 @@ class H225_RAS : public H323Transactor
     virtual void OnSendingPDU(
       PASN_Object & rawPDU
     );
+
+    /**Determine if the PDU may be handled on a dispatch thread.
+       Requests and unsolicited IRRs are dispatched keyed on the endpoint
+       identifier if present, otherwise on the source address. Responses
+       are left to the listener thread.
+      */
+    virtual PBoolean GetDispatchKey(
+      const H323TransactionPDU & pdu,
+      PString & key
+    ) const;
   //@}
 
   /**@name Protocol callbacks */
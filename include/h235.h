@@ -14,6 +14,7 @@
 #endif
 
 #include <ptclib/asner.h>
+#include "h323arena.h"
 
 //
 // ChallengeString
@@ -24,6 +25,7 @@ class H235_ChallengeString : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_ChallengeString, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_ChallengeString(unsigned tag = UniversalOctetString, TagClass tagClass = UniversalTagClass);
 
@@ -47,6 +49,7 @@ class H235_TimeStamp : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_TimeStamp, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_TimeStamp(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -65,6 +68,7 @@ class H235_RandomVal : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_RandomVal, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_RandomVal(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -83,6 +87,7 @@ class H235_Password : public PASN_BMPString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_Password, PASN_BMPString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_Password(unsigned tag = UniversalBMPString, TagClass tagClass = UniversalTagClass);
 
@@ -103,6 +108,7 @@ class H235_Identifier : public PASN_BMPString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_Identifier, PASN_BMPString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_Identifier(unsigned tag = UniversalBMPString, TagClass tagClass = UniversalTagClass);
 
@@ -123,6 +129,7 @@ class H235_KeyMaterial : public PASN_BitString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_KeyMaterial, PASN_BitString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_KeyMaterial(unsigned tag = UniversalBitString, TagClass tagClass = UniversalTagClass);
 
@@ -139,6 +146,7 @@ class H235_KeyMaterialExt : public PASN_BitString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_KeyMaterialExt, PASN_BitString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_KeyMaterialExt(unsigned tag = UniversalBitString, TagClass tagClass = UniversalTagClass);
 
@@ -155,6 +163,7 @@ class H235_NonStandardParameter : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_NonStandardParameter, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_NonStandardParameter(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -181,6 +190,7 @@ class H235_DHset : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_DHset, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_DHset(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -208,6 +218,7 @@ class H235_DHsetExt : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_DHsetExt, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_DHsetExt(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -240,6 +251,7 @@ class H235_ECpoint : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_ECpoint, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_ECpoint(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -274,6 +286,7 @@ class H235_ECKASDH : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_ECKASDH, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_ECKASDH(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -309,6 +322,7 @@ class H235_ECGDSASignature : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_ECGDSASignature, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_ECGDSASignature(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -335,6 +349,7 @@ class H235_TypedCertificate : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_TypedCertificate, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_TypedCertificate(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -361,6 +376,7 @@ class H235_AuthenticationBES : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_AuthenticationBES, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_AuthenticationBES(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -386,6 +402,7 @@ class H235_AuthenticationMechanism : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_AuthenticationMechanism, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_AuthenticationMechanism(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -428,6 +445,7 @@ class H235_Element : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_Element, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_Element(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -453,6 +471,7 @@ class H235_IV8 : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_IV8, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_IV8(unsigned tag = UniversalOctetString, TagClass tagClass = UniversalTagClass);
 
@@ -476,6 +495,7 @@ class H235_IV16 : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_IV16, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_IV16(unsigned tag = UniversalOctetString, TagClass tagClass = UniversalTagClass);
 
@@ -499,6 +519,7 @@ class H235_Params : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_Params, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_Params(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -536,6 +557,7 @@ class H235_ReturnSig : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_ReturnSig, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_ReturnSig(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -569,6 +591,7 @@ class H235_EncodedReturnSig : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_EncodedReturnSig, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_EncodedReturnSig(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -588,6 +611,7 @@ class H235_KeySyncMaterial : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_KeySyncMaterial, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_KeySyncMaterial(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -614,6 +638,7 @@ class H235_EncodedKeySyncMaterial : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_EncodedKeySyncMaterial, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_EncodedKeySyncMaterial(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -633,6 +658,7 @@ class H235_V3KeySyncMaterial : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_V3KeySyncMaterial, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_V3KeySyncMaterial(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -677,6 +703,7 @@ class H235_ECKASDH_eckasdhp : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_ECKASDH_eckasdhp, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_ECKASDH_eckasdhp(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -706,6 +733,7 @@ class H235_ECKASDH_eckasdh2 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_ECKASDH_eckasdh2, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_ECKASDH_eckasdh2(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -737,6 +765,7 @@ class H235_ArrayOf_ProfileElement : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_ArrayOf_ProfileElement, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_ArrayOf_ProfileElement(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -755,6 +784,7 @@ class H235_ProfileElement : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_ProfileElement, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_ProfileElement(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -788,6 +818,7 @@ class H235_SIGNED : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_SIGNED, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_SIGNED(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -817,6 +848,7 @@ class H235_ENCRYPTED : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_ENCRYPTED, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_ENCRYPTED(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -845,6 +877,7 @@ class H235_HASHED : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_HASHED, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_HASHED(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -872,6 +905,7 @@ class H235_KeySignedMaterial : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_KeySignedMaterial, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_KeySignedMaterial(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -906,6 +940,7 @@ class H235_EncodedKeySignedMaterial : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_EncodedKeySignedMaterial, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_EncodedKeySignedMaterial(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -925,6 +960,7 @@ class H235_H235CertificateSignature : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_H235CertificateSignature, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_H235CertificateSignature(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -961,6 +997,7 @@ class H235_H235Key : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_H235Key, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_H235Key(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1017,6 +1054,7 @@ class H235_ClearToken : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_ClearToken, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_ClearToken(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1071,6 +1109,7 @@ class H235_EncodedGeneralToken : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_EncodedGeneralToken, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_EncodedGeneralToken(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1090,6 +1129,7 @@ class H235_PwdCertToken : public H235_ClearToken
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_PwdCertToken, H235_ClearToken);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_PwdCertToken(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1106,6 +1146,7 @@ class H235_EncodedPwdCertToken : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_EncodedPwdCertToken, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_EncodedPwdCertToken(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1129,6 +1170,7 @@ class H235_CryptoToken : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_CryptoToken, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_CryptoToken(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1178,6 +1220,7 @@ class H235_CryptoToken_cryptoEncryptedToken : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_CryptoToken_cryptoEncryptedToken, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_CryptoToken_cryptoEncryptedToken(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1204,6 +1247,7 @@ class H235_CryptoToken_cryptoSignedToken : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_CryptoToken_cryptoSignedToken, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_CryptoToken_cryptoSignedToken(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1230,6 +1274,7 @@ class H235_CryptoToken_cryptoHashedToken : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H235_CryptoToken_cryptoHashedToken, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H235_CryptoToken_cryptoHashedToken(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -45,6 +45,8 @@
 #include <channels.h>
 #include "h235/h235caps.h"
 #include "h235/h235crypto.h"
+#include <deque>
+#include <vector>
 
 /**This class is a derived Class for encpsulating the IETF Real Time Protocol 
    interface. It's only aim is to expose the Created UDP Data channel derive a
@@ -52,6 +54,62 @@
  */
 
 class RTP_Session;
+class H323SecureRTPChannel;
+
+/**This class encrypts and sends the outgoing frames of a secure RTP channel
+   on its own thread, so the transmit thread never waits on the cipher.
+   Frames are copied into recycled buffers on Enqueue() and everything
+   queued when the worker wakes is encrypted as one batch.
+ */
+class H235TransmitWorker : public PThread
+{
+  PCLASSINFO(H235TransmitWorker, PThread);
+
+  public:
+    H235TransmitWorker(
+      H235Session & session,      ///< Session encrypting the frames
+      RTP_Session & rtp,          ///< RTP session sending the frames
+      PINDEX maxQueued            ///< Frames queued before dropping
+    );
+    ~H235TransmitWorker();
+
+    /**Queue a copy of the frame, which must already have been through
+       RTP_Session::PreWriteData(). Frames are dropped when the queue is
+       full. Returns FALSE once the worker has stopped, including when an
+       earlier frame failed to encrypt or send.
+      */
+    PBoolean Enqueue(const RTP_DataFrame & frame);
+
+    /**Send what is queued and stop the thread.
+      */
+    void Stop();
+
+    /**Indicate an earlier frame failed to encrypt or send.
+      */
+    PBoolean HasFailed() const { return m_failed; }
+
+    PINDEX GetDroppedFrames() const { return m_dropped; }
+    PINDEX GetBatchCount() const { return m_batches; }
+    PINDEX GetFrameCount() const { return m_frames; }
+
+  protected:
+    virtual void Main();
+
+    H235Session &                 m_session;
+    RTP_Session &                 m_rtp;
+    PINDEX                        m_maxQueued;
+    std::deque<RTP_DataFrame *>   m_queue;
+    std::vector<RTP_DataFrame *>  m_free;
+    PMutex                        m_mutex;
+    PSyncPoint                    m_wakeup;
+    PBoolean                      m_stop;
+    PBoolean                      m_failed;
+    PAtomicInteger                m_dropped;
+    PAtomicInteger                m_batches;
+    PAtomicInteger                m_frames;
+};
+
+
 class H323SecureRTPChannel  : public H323_RTPChannel
 {
   PCLASSINFO(H323SecureRTPChannel, H323_RTPChannel);
@@ -78,6 +136,11 @@ class H323SecureRTPChannel  : public H323_RTPChannel
     /**This is called to clean up any threads on connection termination.
      */
      virtual void CleanUpOnTermination();
+
+    /**Start the channel, creating the encryption worker for a transmitter
+       if the endpoint has one set with SetH235MediaWorker().
+     */
+     virtual PBoolean Start();
   //@}
 
   /**@name Overrides from class H323Channel */
@@ -187,6 +250,7 @@ protected:
     PString        m_algorithm;
     H235Session    m_encryption;
     int            m_payload;
+    H235TransmitWorker * m_transmitWorker;
 
 };
 
@@ -115,6 +115,9 @@ public:
     PBYTEArray Encrypt(const PBYTEArray & data, unsigned char * ivSequence, bool & rtpPadding);
 
     /** Encrypt In Place
+        Whole blocks go through the cipher in a single call and the final
+        partial block is padded, outData may be the same as inData and must
+        have room for one extra block.
       */
     PINDEX EncryptInPlace(const BYTE * inData, PINDEX inLength, BYTE * outData, unsigned char * ivSequence, bool & rtpPadding);
 
@@ -123,6 +126,8 @@ public:
     PBYTEArray Decrypt(const PBYTEArray & data, unsigned char * ivSequence, bool & rtpPadding);
 
     /** Decrypt In Place
+        outData may be the same as inData unless the data is not a multiple
+        of the block size and rtpPadding is false (ciphertext stealing).
       */
     PINDEX DecryptInPlace(const BYTE * inData, PINDEX inLength, BYTE * outData, unsigned char * ivSequence, bool & rtpPadding);
 
@@ -134,6 +139,8 @@ public:
 
     PString GetAlgorithmOID() const { return m_algorithmOID; }
 
+    int GetBlockSize() const { return m_enc_blockSize > 0 ? m_enc_blockSize : 1; }
+
     PBoolean IsMaxBlocksPerKeyReached() const { return m_operationCnt > AES_KEY_LIMIT; }
     void ResetBlockCount() { m_operationCnt = 0; }
 
@@ -212,11 +219,21 @@ public:
     /** Write Frame (Memory InPlace)
       */
     PBoolean WriteFrameInPlace(RTP_DataFrame & frame);
+
+    /** Write a batch of frames (Memory InPlace) with the session locked
+        once for the whole batch. Returns the number of frames encrypted.
+      */
+    PINDEX WriteFramesInPlace(
+      RTP_DataFrame * const * frames,   ///< Frames to encrypt
+      PINDEX count                      ///< Number of frames
+    );
   //@}
 
     PString GetAlgorithmOID() const { return m_context.GetAlgorithmOID(); }
 
 private:
+    PBoolean InternalWriteFrame(RTP_DataFrame & frame);
+
     H235_DiffieHellman & m_dh;
     H235CryptoEngine     m_context;        /// Media encryption
     H235CryptoEngine     m_dhcontext;      /// Media key encryption
@@ -229,6 +246,7 @@ private:
     PBYTEArray           m_frameBuffer;
     unsigned char        m_ivSequence[6];
     PBoolean             m_padding;
+    PMutex               m_mutex;          /// Media key updates against frame encryption
 };
 
 #endif // H235CRYPTO_H
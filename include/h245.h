@@ -14,6 +14,7 @@
 #endif
 
 #include <ptclib/asner.h>
+#include "h323arena.h"
 
 //
 // MultimediaSystemControlMessage
@@ -29,6 +30,7 @@ class H245_MultimediaSystemControlMessage : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultimediaSystemControlMessage, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultimediaSystemControlMessage(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -95,6 +97,7 @@ class H245_RequestMessage : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestMessage, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestMessage(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -254,6 +257,7 @@ class H245_ResponseMessage : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ResponseMessage, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ResponseMessage(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -464,6 +468,7 @@ class H245_CommandMessage : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CommandMessage, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CommandMessage(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -601,6 +606,7 @@ class H245_IndicationMessage : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IndicationMessage, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IndicationMessage(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -790,6 +796,7 @@ class H245_SequenceNumber : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_SequenceNumber, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_SequenceNumber(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -810,6 +817,7 @@ class H245_NonStandardIdentifier : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NonStandardIdentifier, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NonStandardIdentifier(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -839,6 +847,7 @@ class H245_MasterSlaveDetermination : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MasterSlaveDetermination, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MasterSlaveDetermination(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -865,6 +874,7 @@ class H245_MasterSlaveDeterminationRelease : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MasterSlaveDeterminationRelease, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MasterSlaveDeterminationRelease(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -890,6 +900,7 @@ class H245_AlternativeCapabilitySet : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_AlternativeCapabilitySet, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_AlternativeCapabilitySet(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -908,6 +919,7 @@ class H245_CapabilityTableEntryNumber : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CapabilityTableEntryNumber, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CapabilityTableEntryNumber(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -926,6 +938,7 @@ class H245_CapabilityDescriptorNumber : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CapabilityDescriptorNumber, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CapabilityDescriptorNumber(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -962,6 +975,7 @@ class H245_Capability : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_Capability, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_Capability(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1121,6 +1135,7 @@ class H245_MultiplexCapability : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexCapability, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexCapability(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1184,6 +1199,7 @@ class H245_H223AnnexCCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AnnexCCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AnnexCCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1226,6 +1242,7 @@ class H245_V75Capability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_V75Capability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_V75Capability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1251,6 +1268,7 @@ class H245_QOSMode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_QOSMode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_QOSMode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1273,6 +1291,7 @@ class H245_ATMParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ATMParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ATMParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1303,6 +1322,7 @@ class H245_QOSType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_QOSType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_QOSType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1325,6 +1345,7 @@ class H245_QOSClass : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_QOSClass, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_QOSClass(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1353,6 +1374,7 @@ class H245_MediaTransportType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MediaTransportType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MediaTransportType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1385,6 +1407,7 @@ class H245_MediaChannelCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MediaChannelCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MediaChannelCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1417,6 +1440,7 @@ class H245_RedundancyEncodingMethod : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RedundancyEncodingMethod, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RedundancyEncodingMethod(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1461,6 +1485,7 @@ class H245_VideoCapability : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VideoCapability, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VideoCapability(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1531,6 +1556,7 @@ class H245_H261VideoCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H261VideoCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H261VideoCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1567,6 +1593,7 @@ class H245_H262VideoCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H262VideoCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H262VideoCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1619,6 +1646,7 @@ class H245_TransparencyParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TransparencyParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TransparencyParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1648,6 +1676,7 @@ class H245_CustomPictureClockFrequency : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CustomPictureClockFrequency, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CustomPictureClockFrequency(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1687,6 +1716,7 @@ class H245_H263Version3Options : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H263Version3Options, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H263Version3Options(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1719,6 +1749,7 @@ class H245_IS11172VideoCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IS11172VideoCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IS11172VideoCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1773,6 +1804,7 @@ class H245_AudioCapability : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_AudioCapability, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_AudioCapability(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -1888,6 +1920,7 @@ class H245_G729Extensions : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_G729Extensions, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_G729Extensions(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1924,6 +1957,7 @@ class H245_IS11172AudioCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IS11172AudioCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IS11172AudioCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -1957,6 +1991,7 @@ class H245_IS13818AudioCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IS13818AudioCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IS13818AudioCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2002,6 +2037,7 @@ class H245_GSMAudioCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_GSMAudioCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_GSMAudioCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2029,6 +2065,7 @@ class H245_VBDCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VBDCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VBDCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2057,6 +2094,7 @@ class H245_DataProtocolCapability : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DataProtocolCapability, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DataProtocolCapability(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2106,6 +2144,7 @@ class H245_CompressionType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CompressionType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CompressionType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2134,6 +2173,7 @@ class H245_V42bis : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_V42bis, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_V42bis(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2162,6 +2202,7 @@ class H245_T84Profile : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_T84Profile, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_T84Profile(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2191,6 +2232,7 @@ class H245_T38FaxRateManagement : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_T38FaxRateManagement, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_T38FaxRateManagement(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2213,6 +2255,7 @@ class H245_T38FaxTcpOptions : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_T38FaxTcpOptions, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_T38FaxTcpOptions(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2240,6 +2283,7 @@ class H245_EncryptionCapability : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EncryptionCapability, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EncryptionCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2260,6 +2304,7 @@ class H245_MediaEncryptionAlgorithm : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MediaEncryptionAlgorithm, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MediaEncryptionAlgorithm(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2292,6 +2337,7 @@ class H245_UserInputCapability : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UserInputCapability, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UserInputCapability(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2339,6 +2385,7 @@ class H245_CapabilityIdentifier : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CapabilityIdentifier, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CapabilityIdentifier(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2372,6 +2419,7 @@ class H245_ParameterIdentifier : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ParameterIdentifier, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ParameterIdentifier(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2405,6 +2453,7 @@ class H245_ParameterValue : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ParameterValue, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ParameterValue(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2444,6 +2493,7 @@ class H245_MultiplexFormat : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexFormat, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexFormat(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2486,6 +2536,7 @@ class H245_AudioTelephonyEventCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_AudioTelephonyEventCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_AudioTelephonyEventCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2512,6 +2563,7 @@ class H245_AudioToneCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_AudioToneCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_AudioToneCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2537,6 +2589,7 @@ class H245_NoPTAudioTelephonyEventCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NoPTAudioTelephonyEventCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NoPTAudioTelephonyEventCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2562,6 +2615,7 @@ class H245_NoPTAudioToneCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NoPTAudioToneCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NoPTAudioToneCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2587,6 +2641,7 @@ class H245_DepFECCapability : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECCapability, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECCapability(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2615,6 +2670,7 @@ class H245_MaxRedundancy : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MaxRedundancy, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MaxRedundancy(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -2633,6 +2689,7 @@ class H245_LogicalChannelNumber : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_LogicalChannelNumber, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_LogicalChannelNumber(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -2651,6 +2708,7 @@ class H245_V75Parameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_V75Parameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_V75Parameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2688,6 +2746,7 @@ class H245_DataType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DataType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DataType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2788,6 +2847,7 @@ class H245_MultiplexedStreamParameter : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexedStreamParameter, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexedStreamParameter(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2814,6 +2874,7 @@ class H245_H222LogicalChannelParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H222LogicalChannelParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H222LogicalChannelParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2849,6 +2910,7 @@ class H245_CRCLength : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CRCLength, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CRCLength(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2872,6 +2934,7 @@ class H245_RedundancyEncodingElement : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RedundancyEncodingElement, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RedundancyEncodingElement(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2902,6 +2965,7 @@ class H245_MultiplePayloadStreamElement : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplePayloadStreamElement, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplePayloadStreamElement(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -2934,6 +2998,7 @@ class H245_DepFECData : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECData, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECData(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2964,6 +3029,7 @@ class H245_FECData : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FECData, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FECData(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -2995,6 +3061,7 @@ class H245_TransportAddress : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TransportAddress, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TransportAddress(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3036,6 +3103,7 @@ class H245_UnicastAddress : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UnicastAddress, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UnicastAddress(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3098,6 +3166,7 @@ class H245_MulticastAddress : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MulticastAddress, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MulticastAddress(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3141,6 +3210,7 @@ class H245_EscrowData : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EscrowData, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EscrowData(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3167,6 +3237,7 @@ class H245_CloseLogicalChannelAck : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CloseLogicalChannelAck, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CloseLogicalChannelAck(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3192,6 +3263,7 @@ class H245_RequestChannelCloseAck : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestChannelCloseAck, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestChannelCloseAck(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3217,6 +3289,7 @@ class H245_RequestChannelCloseRelease : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestChannelCloseRelease, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestChannelCloseRelease(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3242,6 +3315,7 @@ class H245_MultiplexTableEntryNumber : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexTableEntryNumber, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexTableEntryNumber(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -3260,6 +3334,7 @@ class H245_RequestModeRelease : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestModeRelease, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestModeRelease(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3285,6 +3360,7 @@ class H245_ModeDescription : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ModeDescription, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ModeDescription(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -3315,6 +3391,7 @@ class H245_ModeElementType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ModeElementType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ModeElementType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3413,6 +3490,7 @@ class H245_MultiplexedStreamModeParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexedStreamModeParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexedStreamModeParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3438,6 +3516,7 @@ class H245_MultiplePayloadStreamElementMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplePayloadStreamElementMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplePayloadStreamElementMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3465,6 +3544,7 @@ class H245_DepFECMode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECMode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECMode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3493,6 +3573,7 @@ class H245_V76ModeParameters : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_V76ModeParameters, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_V76ModeParameters(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3522,6 +3603,7 @@ class H245_VideoMode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VideoMode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VideoMode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3585,6 +3667,7 @@ class H245_IS11172VideoMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IS11172VideoMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IS11172VideoMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3635,6 +3718,7 @@ class H245_AudioMode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_AudioMode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_AudioMode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3733,6 +3817,7 @@ class H245_VBDMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VBDMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VBDMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3760,6 +3845,7 @@ class H245_EncryptionMode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EncryptionMode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EncryptionMode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3789,6 +3875,7 @@ class H245_RoundTripDelayRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RoundTripDelayRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RoundTripDelayRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3814,6 +3901,7 @@ class H245_RoundTripDelayResponse : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RoundTripDelayResponse, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RoundTripDelayResponse(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3839,6 +3927,7 @@ class H245_MaintenanceLoopOffCommand : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MaintenanceLoopOffCommand, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MaintenanceLoopOffCommand(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3862,6 +3951,7 @@ class H245_CommunicationModeRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CommunicationModeRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CommunicationModeRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -3887,6 +3977,7 @@ class H245_CommunicationModeResponse : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CommunicationModeResponse, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CommunicationModeResponse(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3920,6 +4011,7 @@ class H245_ConferenceRequest : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceRequest, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceRequest(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -3983,6 +4075,7 @@ class H245_CertSelectionCriteria : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CertSelectionCriteria, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CertSelectionCriteria(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4001,6 +4094,7 @@ class H245_Criteria : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_Criteria, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_Criteria(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4027,6 +4121,7 @@ class H245_McuNumber : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_McuNumber, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_McuNumber(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -4045,6 +4140,7 @@ class H245_TerminalNumber : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TerminalNumber, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TerminalNumber(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -4078,6 +4174,7 @@ class H245_ConferenceResponse : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceResponse, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceResponse(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4199,6 +4296,7 @@ class H245_TerminalID : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TerminalID, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TerminalID(unsigned tag = UniversalOctetString, TagClass tagClass = UniversalTagClass);
 
@@ -4222,6 +4320,7 @@ class H245_ConferenceID : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceID, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceID(unsigned tag = UniversalOctetString, TagClass tagClass = UniversalTagClass);
 
@@ -4245,6 +4344,7 @@ class H245_Password : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_Password, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_Password(unsigned tag = UniversalOctetString, TagClass tagClass = UniversalTagClass);
 
@@ -4268,6 +4368,7 @@ class H245_RemoteMCRequest : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RemoteMCRequest, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RemoteMCRequest(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4293,6 +4394,7 @@ class H245_RemoteMCResponse : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RemoteMCResponse, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RemoteMCResponse(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4328,6 +4430,7 @@ class H245_MultilinkRequest : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkRequest, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkRequest(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4390,6 +4493,7 @@ class H245_MultilinkResponse : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkResponse, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkResponse(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4450,6 +4554,7 @@ class H245_MultilinkIndication : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkIndication, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkIndication(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4495,6 +4600,7 @@ class H245_DialingInformation : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DialingInformation, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DialingInformation(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4533,6 +4639,7 @@ class H245_DialingInformationNetworkType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DialingInformationNetworkType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DialingInformationNetworkType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4564,6 +4671,7 @@ class H245_ConnectionIdentifier : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConnectionIdentifier, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConnectionIdentifier(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4590,6 +4698,7 @@ class H245_MaximumBitRate : public PASN_Integer
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MaximumBitRate, PASN_Integer);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MaximumBitRate(unsigned tag = UniversalInteger, TagClass tagClass = UniversalTagClass);
 
@@ -4608,6 +4717,7 @@ class H245_LogicalChannelRateRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_LogicalChannelRateRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_LogicalChannelRateRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4635,6 +4745,7 @@ class H245_LogicalChannelRateAcknowledge : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_LogicalChannelRateAcknowledge, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_LogicalChannelRateAcknowledge(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4662,6 +4773,7 @@ class H245_LogicalChannelRateRejectReason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_LogicalChannelRateRejectReason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_LogicalChannelRateRejectReason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4684,6 +4796,7 @@ class H245_LogicalChannelRateRelease : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_LogicalChannelRateRelease, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_LogicalChannelRateRelease(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4709,6 +4822,7 @@ class H245_SendTerminalCapabilitySet : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_SendTerminalCapabilitySet, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_SendTerminalCapabilitySet(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4740,6 +4854,7 @@ class H245_EncryptionCommand : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EncryptionCommand, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EncryptionCommand(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4775,6 +4890,7 @@ class H245_EndSessionCommand : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EndSessionCommand, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EndSessionCommand(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4829,6 +4945,7 @@ class H245_ConferenceCommand : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceCommand, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceCommand(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4876,6 +4993,7 @@ class H245_SubstituteConferenceIDCommand : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_SubstituteConferenceIDCommand, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_SubstituteConferenceIDCommand(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4901,6 +5019,7 @@ class H245_EncryptionUpdateDirection : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EncryptionUpdateDirection, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EncryptionUpdateDirection(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -4923,6 +5042,7 @@ class H245_KeyProtectionMethod : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_KeyProtectionMethod, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_KeyProtectionMethod(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4950,6 +5070,7 @@ class H245_EncryptionUpdateRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EncryptionUpdateRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EncryptionUpdateRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -4981,6 +5102,7 @@ class H245_PictureReference : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_PictureReference, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_PictureReference(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -5006,6 +5128,7 @@ class H245_H223MultiplexReconfiguration : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223MultiplexReconfiguration, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223MultiplexReconfiguration(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -5045,6 +5168,7 @@ class H245_FunctionNotUnderstood : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FunctionNotUnderstood, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FunctionNotUnderstood(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -5091,6 +5215,7 @@ class H245_ConferenceIndication : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceIndication, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceIndication(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -5146,6 +5271,7 @@ class H245_TerminalYouAreSeeingInSubPictureNumber : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TerminalYouAreSeeingInSubPictureNumber, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TerminalYouAreSeeingInSubPictureNumber(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5177,6 +5303,7 @@ class H245_VideoIndicateCompose : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VideoIndicateCompose, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VideoIndicateCompose(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5202,6 +5329,7 @@ class H245_H223SkewIndication : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223SkewIndication, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223SkewIndication(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5229,6 +5357,7 @@ class H245_H2250MaximumSkewIndication : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H2250MaximumSkewIndication, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H2250MaximumSkewIndication(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5256,6 +5385,7 @@ class H245_MCLocationIndication : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MCLocationIndication, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MCLocationIndication(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5281,6 +5411,7 @@ class H245_VendorIdentification : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VendorIdentification, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VendorIdentification(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5313,6 +5444,7 @@ class H245_IV8 : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IV8, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IV8(unsigned tag = UniversalOctetString, TagClass tagClass = UniversalTagClass);
 
@@ -5336,6 +5468,7 @@ class H245_IV16 : public PASN_OctetString
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IV16, PASN_OctetString);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IV16(unsigned tag = UniversalOctetString, TagClass tagClass = UniversalTagClass);
 
@@ -5359,6 +5492,7 @@ class H245_Params : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_Params, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_Params(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5400,6 +5534,7 @@ class H245_UserInputIndication : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UserInputIndication, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UserInputIndication(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -5471,6 +5606,7 @@ class H245_MobileMultilinkReconfigurationIndication : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MobileMultilinkReconfigurationIndication, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MobileMultilinkReconfigurationIndication(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5499,6 +5635,7 @@ class H245_ArrayOf_GenericParameter : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_GenericParameter, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_GenericParameter(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5517,6 +5654,7 @@ class H245_NonStandardIdentifier_h221NonStandard : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NonStandardIdentifier_h221NonStandard, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NonStandardIdentifier_h221NonStandard(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5544,6 +5682,7 @@ class H245_MasterSlaveDeterminationAck_decision : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MasterSlaveDeterminationAck_decision, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MasterSlaveDeterminationAck_decision(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -5566,6 +5705,7 @@ class H245_MasterSlaveDeterminationReject_cause : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MasterSlaveDeterminationReject_cause, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MasterSlaveDeterminationReject_cause(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -5589,6 +5729,7 @@ class H245_ArrayOf_CapabilityTableEntry : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_CapabilityTableEntry, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_CapabilityTableEntry(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -5609,6 +5750,7 @@ class H245_ArrayOf_CapabilityDescriptor : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_CapabilityDescriptor, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_CapabilityDescriptor(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -5629,6 +5771,7 @@ class H245_ArrayOf_GenericInformation : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_GenericInformation, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_GenericInformation(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5649,6 +5792,7 @@ class H245_ArrayOf_AlternativeCapabilitySet : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_AlternativeCapabilitySet, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_AlternativeCapabilitySet(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -5669,6 +5813,7 @@ class H245_TerminalCapabilitySetReject_cause : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TerminalCapabilitySetReject_cause, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TerminalCapabilitySetReject_cause(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -5700,6 +5845,7 @@ class H245_Capability_h233EncryptionReceiveCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_Capability_h233EncryptionReceiveCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_Capability_h233EncryptionReceiveCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5727,6 +5873,7 @@ class H245_ArrayOf_VCCapability : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_VCCapability, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_VCCapability(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -5745,6 +5892,7 @@ class H245_VCCapability_aal1 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VCCapability_aal1, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VCCapability_aal1(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5778,6 +5926,7 @@ class H245_VCCapability_aal5 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VCCapability_aal5, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VCCapability_aal5(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5806,6 +5955,7 @@ class H245_H223Capability_h223MultiplexTableCapability : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223Capability_h223MultiplexTableCapability, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223Capability_h223MultiplexTableCapability(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -5835,6 +5985,7 @@ class H245_H223Capability_mobileOperationTransmitCapability : public PASN_Sequen
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223Capability_mobileOperationTransmitCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223Capability_mobileOperationTransmitCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5864,6 +6015,7 @@ class H245_H223Capability_mobileMultilinkFrameCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223Capability_mobileMultilinkFrameCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223Capability_mobileMultilinkFrameCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5890,6 +6042,7 @@ class H245_H2250Capability_mcCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H2250Capability_mcCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H2250Capability_mcCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5918,6 +6071,7 @@ class H245_ArrayOf_RedundancyEncodingCapability : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_RedundancyEncodingCapability, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_RedundancyEncodingCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5938,6 +6092,7 @@ class H245_ArrayOf_RTPPayloadType : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_RTPPayloadType, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_RTPPayloadType(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5956,6 +6111,7 @@ class H245_MediaTransportType_atm_AAL5_compressed : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MediaTransportType_atm_AAL5_compressed, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MediaTransportType_atm_AAL5_compressed(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -5983,6 +6139,7 @@ class H245_ArrayOf_QOSCapability : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_QOSCapability, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_QOSCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6003,6 +6160,7 @@ class H245_ArrayOf_MediaChannelCapability : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_MediaChannelCapability, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_MediaChannelCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6023,6 +6181,7 @@ class H245_ArrayOf_CapabilityTableEntryNumber : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_CapabilityTableEntryNumber, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_CapabilityTableEntryNumber(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6043,6 +6202,7 @@ class H245_RTPH263VideoRedundancyEncoding_frameToThreadMapping : public PASN_Cho
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RTPH263VideoRedundancyEncoding_frameToThreadMapping, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RTPH263VideoRedundancyEncoding_frameToThreadMapping(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6072,6 +6232,7 @@ class H245_RTPH263VideoRedundancyEncoding_containedThreads : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RTPH263VideoRedundancyEncoding_containedThreads, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RTPH263VideoRedundancyEncoding_containedThreads(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6090,6 +6251,7 @@ class H245_RTPH263VideoRedundancyFrameMapping_frameSequence : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RTPH263VideoRedundancyFrameMapping_frameSequence, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RTPH263VideoRedundancyFrameMapping_frameSequence(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6110,6 +6272,7 @@ class H245_ArrayOf_MediaDistributionCapability : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_MediaDistributionCapability, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_MediaDistributionCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6130,6 +6293,7 @@ class H245_ArrayOf_DataApplicationCapability : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_DataApplicationCapability, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_DataApplicationCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6150,6 +6314,7 @@ class H245_ArrayOf_VideoCapability : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_VideoCapability, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_VideoCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6170,6 +6335,7 @@ class H245_ArrayOf_GenericCapability : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_GenericCapability, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_GenericCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6190,6 +6356,7 @@ class H245_ArrayOf_EnhancementOptions : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_EnhancementOptions, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_EnhancementOptions(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -6210,6 +6377,7 @@ class H245_ArrayOf_BEnhancementParameters : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_BEnhancementParameters, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_BEnhancementParameters(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -6230,6 +6398,7 @@ class H245_ArrayOf_CustomPictureClockFrequency : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_CustomPictureClockFrequency, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_CustomPictureClockFrequency(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -6250,6 +6419,7 @@ class H245_ArrayOf_CustomPictureFormat : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_CustomPictureFormat, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_CustomPictureFormat(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -6270,6 +6440,7 @@ class H245_ArrayOf_H263VideoModeCombos : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_H263VideoModeCombos, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_H263VideoModeCombos(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -6288,6 +6459,7 @@ class H245_RefPictureSelection_additionalPictureMemory : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RefPictureSelection_additionalPictureMemory, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RefPictureSelection_additionalPictureMemory(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6327,6 +6499,7 @@ class H245_RefPictureSelection_videoBackChannelSend : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RefPictureSelection_videoBackChannelSend, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RefPictureSelection_videoBackChannelSend(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6355,6 +6528,7 @@ class H245_CustomPictureFormat_pixelAspectInformation : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CustomPictureFormat_pixelAspectInformation, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CustomPictureFormat_pixelAspectInformation(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6393,6 +6567,7 @@ class H245_ArrayOf_H263ModeComboFlags : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_H263ModeComboFlags, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_H263ModeComboFlags(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -6411,6 +6586,7 @@ class H245_AudioCapability_g7231 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_AudioCapability_g7231, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_AudioCapability_g7231(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6437,6 +6613,7 @@ class H245_G7231AnnexCCapability_g723AnnexCAudioMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_G7231AnnexCCapability_g723AnnexCAudioMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_G7231AnnexCCapability_g723AnnexCAudioMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6474,6 +6651,7 @@ class H245_DataApplicationCapability_application : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DataApplicationCapability_application, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DataApplicationCapability_application(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6547,6 +6725,7 @@ class H245_DataProtocolCapability_v76wCompression : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DataProtocolCapability_v76wCompression, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DataProtocolCapability_v76wCompression(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6577,6 +6756,7 @@ class H245_T84Profile_t84Restricted : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_T84Profile_t84Restricted, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_T84Profile_t84Restricted(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6620,6 +6800,7 @@ class H245_T38FaxUdpOptions_t38FaxUdpEC : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_T38FaxUdpOptions_t38FaxUdpEC, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_T38FaxUdpOptions_t38FaxUdpEC(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6644,6 +6825,7 @@ class H245_ArrayOf_NonStandardParameter : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_NonStandardParameter, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_NonStandardParameter(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6664,6 +6846,7 @@ class H245_ArrayOf_ParameterIdentifier : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_ParameterIdentifier, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_ParameterIdentifier(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -6684,6 +6867,7 @@ class H245_FECCapability_rfc2733Format : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FECCapability_rfc2733Format, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FECCapability_rfc2733Format(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6714,6 +6898,7 @@ class H245_NetworkAccessParameters_distribution : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NetworkAccessParameters_distribution, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NetworkAccessParameters_distribution(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6739,6 +6924,7 @@ class H245_NetworkAccessParameters_networkAddress : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NetworkAccessParameters_networkAddress, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NetworkAccessParameters_networkAddress(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6775,6 +6961,7 @@ class H245_NetworkAccessParameters_t120SetupProcedure : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NetworkAccessParameters_t120SetupProcedure, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NetworkAccessParameters_t120SetupProcedure(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6798,6 +6985,7 @@ class H245_Q2931Address_address : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_Q2931Address_address, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_Q2931Address_address(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6829,6 +7017,7 @@ class H245_H235Media_mediaType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H235Media_mediaType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H235Media_mediaType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6912,6 +7101,7 @@ class H245_H223LogicalChannelParameters_adaptationLayerType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223LogicalChannelParameters_adaptationLayerType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223LogicalChannelParameters_adaptationLayerType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6972,6 +7162,7 @@ class H245_H223AL1MParameters_transferMode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AL1MParameters_transferMode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AL1MParameters_transferMode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -6994,6 +7185,7 @@ class H245_H223AL1MParameters_headerFEC : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AL1MParameters_headerFEC, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AL1MParameters_headerFEC(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7016,6 +7208,7 @@ class H245_H223AL1MParameters_crcLength : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AL1MParameters_crcLength, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AL1MParameters_crcLength(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7046,6 +7239,7 @@ class H245_H223AL1MParameters_arqType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AL1MParameters_arqType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AL1MParameters_arqType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7076,6 +7270,7 @@ class H245_H223AL2MParameters_headerFEC : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AL2MParameters_headerFEC, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AL2MParameters_headerFEC(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7098,6 +7293,7 @@ class H245_H223AL3MParameters_headerFormat : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AL3MParameters_headerFormat, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AL3MParameters_headerFormat(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7120,6 +7316,7 @@ class H245_H223AL3MParameters_crcLength : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AL3MParameters_crcLength, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AL3MParameters_crcLength(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7150,6 +7347,7 @@ class H245_H223AL3MParameters_arqType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AL3MParameters_arqType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AL3MParameters_arqType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7180,6 +7378,7 @@ class H245_H223AnnexCArqParameters_numberOfRetransmissions : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AnnexCArqParameters_numberOfRetransmissions, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AnnexCArqParameters_numberOfRetransmissions(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7202,6 +7401,7 @@ class H245_V76LogicalChannelParameters_suspendResume : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_V76LogicalChannelParameters_suspendResume, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_V76LogicalChannelParameters_suspendResume(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7227,6 +7427,7 @@ class H245_V76LogicalChannelParameters_mode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_V76LogicalChannelParameters_mode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_V76LogicalChannelParameters_mode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7258,6 +7459,7 @@ class H245_H2250LogicalChannelParameters_mediaPacketization : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H2250LogicalChannelParameters_mediaPacketization, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H2250LogicalChannelParameters_mediaPacketization(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7289,6 +7491,7 @@ class H245_RTPPayloadType_payloadDescriptor : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RTPPayloadType_payloadDescriptor, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RTPPayloadType_payloadDescriptor(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7321,6 +7524,7 @@ class H245_ArrayOf_MultiplePayloadStreamElement : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_MultiplePayloadStreamElement, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_MultiplePayloadStreamElement(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7339,6 +7543,7 @@ class H245_UnicastAddress_iPAddress : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UnicastAddress_iPAddress, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UnicastAddress_iPAddress(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7365,6 +7570,7 @@ class H245_UnicastAddress_iPXAddress : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UnicastAddress_iPXAddress, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UnicastAddress_iPXAddress(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7392,6 +7598,7 @@ class H245_UnicastAddress_iP6Address : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UnicastAddress_iP6Address, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UnicastAddress_iP6Address(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7418,6 +7625,7 @@ class H245_MulticastAddress_iPAddress : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MulticastAddress_iPAddress, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MulticastAddress_iPAddress(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7444,6 +7652,7 @@ class H245_MulticastAddress_iP6Address : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MulticastAddress_iP6Address, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MulticastAddress_iP6Address(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7472,6 +7681,7 @@ class H245_ArrayOf_EscrowData : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_EscrowData, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_EscrowData(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7492,6 +7702,7 @@ class H245_OpenLogicalChannelAck_forwardMultiplexAckParameters : public PASN_Cho
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_OpenLogicalChannelAck_forwardMultiplexAckParameters, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_OpenLogicalChannelAck_forwardMultiplexAckParameters(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7520,6 +7731,7 @@ class H245_OpenLogicalChannelReject_cause : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_OpenLogicalChannelReject_cause, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_OpenLogicalChannelReject_cause(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7556,6 +7768,7 @@ class H245_CloseLogicalChannel_source : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CloseLogicalChannel_source, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CloseLogicalChannel_source(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7578,6 +7791,7 @@ class H245_CloseLogicalChannel_reason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CloseLogicalChannel_reason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CloseLogicalChannel_reason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7602,6 +7816,7 @@ class H245_RequestChannelClose_reason : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestChannelClose_reason, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestChannelClose_reason(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7627,6 +7842,7 @@ class H245_RequestChannelCloseReject_cause : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestChannelCloseReject_cause, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestChannelCloseReject_cause(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7650,6 +7866,7 @@ class H245_ArrayOf_MultiplexEntryDescriptor : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_MultiplexEntryDescriptor, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_MultiplexEntryDescriptor(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -7670,6 +7887,7 @@ class H245_ArrayOf_MultiplexElement : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_MultiplexElement, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_MultiplexElement(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7690,6 +7908,7 @@ class H245_MultiplexElement_type : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexElement_type, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexElement_type(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7719,6 +7938,7 @@ class H245_MultiplexElement_repeatCount : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexElement_repeatCount, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexElement_repeatCount(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7743,6 +7963,7 @@ class H245_ArrayOf_MultiplexTableEntryNumber : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_MultiplexTableEntryNumber, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_MultiplexTableEntryNumber(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -7763,6 +7984,7 @@ class H245_ArrayOf_MultiplexEntryRejectionDescriptions : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_MultiplexEntryRejectionDescriptions, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_MultiplexEntryRejectionDescriptions(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -7781,6 +8003,7 @@ class H245_MultiplexEntryRejectionDescriptions_cause : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexEntryRejectionDescriptions_cause, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexEntryRejectionDescriptions_cause(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7805,6 +8028,7 @@ class H245_ArrayOf_RequestMultiplexEntryRejectionDescriptions : public PASN_Arra
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_RequestMultiplexEntryRejectionDescriptions, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_RequestMultiplexEntryRejectionDescriptions(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -7823,6 +8047,7 @@ class H245_RequestMultiplexEntryRejectionDescriptions_cause : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestMultiplexEntryRejectionDescriptions_cause, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestMultiplexEntryRejectionDescriptions_cause(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7846,6 +8071,7 @@ class H245_ArrayOf_ModeDescription : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_ModeDescription, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_ModeDescription(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7864,6 +8090,7 @@ class H245_RequestModeAck_response : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestModeAck_response, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestModeAck_response(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7886,6 +8113,7 @@ class H245_RequestModeReject_cause : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestModeReject_cause, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestModeReject_cause(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7914,6 +8142,7 @@ class H245_H235Mode_mediaMode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H235Mode_mediaMode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H235Mode_mediaMode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -7965,6 +8194,7 @@ class H245_ArrayOf_RedundancyEncodingDTModeElement : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_RedundancyEncodingDTModeElement, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_RedundancyEncodingDTModeElement(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -7991,6 +8221,7 @@ class H245_RedundancyEncodingDTModeElement_type : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RedundancyEncodingDTModeElement_type, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RedundancyEncodingDTModeElement_type(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8063,6 +8294,7 @@ class H245_ArrayOf_MultiplePayloadStreamElementMode : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_MultiplePayloadStreamElementMode, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_MultiplePayloadStreamElementMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8083,6 +8315,7 @@ class H245_FECMode_rfc2733Format : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FECMode_rfc2733Format, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FECMode_rfc2733Format(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8119,6 +8352,7 @@ class H245_H223ModeParameters_adaptationLayerType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223ModeParameters_adaptationLayerType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223ModeParameters_adaptationLayerType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8182,6 +8416,7 @@ class H245_RedundancyEncodingMode_secondaryEncoding : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RedundancyEncodingMode_secondaryEncoding, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RedundancyEncodingMode_secondaryEncoding(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8217,6 +8452,7 @@ class H245_H261VideoMode_resolution : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H261VideoMode_resolution, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H261VideoMode_resolution(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8239,6 +8475,7 @@ class H245_H262VideoMode_profileAndLevel : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H262VideoMode_profileAndLevel, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H262VideoMode_profileAndLevel(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8270,6 +8507,7 @@ class H245_H263VideoMode_resolution : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H263VideoMode_resolution, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H263VideoMode_resolution(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8296,6 +8534,7 @@ class H245_AudioMode_g7231 : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_AudioMode_g7231, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_AudioMode_g7231(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8320,6 +8559,7 @@ class H245_IS11172AudioMode_audioLayer : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IS11172AudioMode_audioLayer, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IS11172AudioMode_audioLayer(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8343,6 +8583,7 @@ class H245_IS11172AudioMode_audioSampling : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IS11172AudioMode_audioSampling, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IS11172AudioMode_audioSampling(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8366,6 +8607,7 @@ class H245_IS11172AudioMode_multichannelType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IS11172AudioMode_multichannelType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IS11172AudioMode_multichannelType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8389,6 +8631,7 @@ class H245_IS13818AudioMode_audioLayer : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IS13818AudioMode_audioLayer, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IS13818AudioMode_audioLayer(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8412,6 +8655,7 @@ class H245_IS13818AudioMode_audioSampling : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IS13818AudioMode_audioSampling, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IS13818AudioMode_audioSampling(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8438,6 +8682,7 @@ class H245_IS13818AudioMode_multichannelType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IS13818AudioMode_multichannelType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IS13818AudioMode_multichannelType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8468,6 +8713,7 @@ class H245_G7231AnnexCMode_g723AnnexCAudioMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_G7231AnnexCMode_g723AnnexCAudioMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_G7231AnnexCMode_g723AnnexCAudioMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8504,6 +8750,7 @@ class H245_DataMode_application : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DataMode_application, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DataMode_application(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8571,6 +8818,7 @@ class H245_MaintenanceLoopRequest_type : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MaintenanceLoopRequest_type, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MaintenanceLoopRequest_type(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8603,6 +8851,7 @@ class H245_MaintenanceLoopAck_type : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MaintenanceLoopAck_type, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MaintenanceLoopAck_type(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8635,6 +8884,7 @@ class H245_MaintenanceLoopReject_type : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MaintenanceLoopReject_type, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MaintenanceLoopReject_type(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8665,6 +8915,7 @@ class H245_MaintenanceLoopReject_cause : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MaintenanceLoopReject_cause, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MaintenanceLoopReject_cause(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8688,6 +8939,7 @@ class H245_ArrayOf_CommunicationModeTableEntry : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_CommunicationModeTableEntry, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_CommunicationModeTableEntry(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -8710,6 +8962,7 @@ class H245_CommunicationModeTableEntry_dataType : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CommunicationModeTableEntry_dataType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CommunicationModeTableEntry_dataType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8754,6 +9007,7 @@ class H245_ArrayOf_TerminalLabel : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_TerminalLabel, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_TerminalLabel(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -8772,6 +9026,7 @@ class H245_ConferenceResponse_makeMeChairResponse : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceResponse_makeMeChairResponse, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceResponse_makeMeChairResponse(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8794,6 +9049,7 @@ class H245_ConferenceResponse_extensionAddressResponse : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceResponse_extensionAddressResponse, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceResponse_extensionAddressResponse(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8819,6 +9075,7 @@ class H245_ConferenceResponse_broadcastMyLogicalChannelResponse : public PASN_Ch
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceResponse_broadcastMyLogicalChannelResponse, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceResponse_broadcastMyLogicalChannelResponse(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8841,6 +9098,7 @@ class H245_ConferenceResponse_makeTerminalBroadcasterResponse : public PASN_Choi
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceResponse_makeTerminalBroadcasterResponse, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceResponse_makeTerminalBroadcasterResponse(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8863,6 +9121,7 @@ class H245_ConferenceResponse_sendThisSourceResponse : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceResponse_sendThisSourceResponse, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceResponse_sendThisSourceResponse(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8887,6 +9146,7 @@ class H245_ArrayOf_TerminalInformation : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_TerminalInformation, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_TerminalInformation(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8905,6 +9165,7 @@ class H245_RemoteMCResponse_reject : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RemoteMCResponse_reject, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RemoteMCResponse_reject(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -8927,6 +9188,7 @@ class H245_MultilinkRequest_callInformation : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkRequest_callInformation, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkRequest_callInformation(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8952,6 +9214,7 @@ class H245_MultilinkRequest_addConnection : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkRequest_addConnection, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkRequest_addConnection(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -8978,6 +9241,7 @@ class H245_MultilinkRequest_removeConnection : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkRequest_removeConnection, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkRequest_removeConnection(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -9003,6 +9267,7 @@ class H245_MultilinkResponse_callInformation : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkResponse_callInformation, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkResponse_callInformation(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -9029,6 +9294,7 @@ class H245_MultilinkResponse_removeConnection : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkResponse_removeConnection, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkResponse_removeConnection(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -9054,6 +9320,7 @@ class H245_MultilinkResponse_maximumHeaderInterval : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkResponse_maximumHeaderInterval, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkResponse_maximumHeaderInterval(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -9079,6 +9346,7 @@ class H245_MultilinkIndication_crcDesired : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkIndication_crcDesired, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkIndication_crcDesired(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -9102,6 +9370,7 @@ class H245_MultilinkIndication_excessiveError : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkIndication_excessiveError, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkIndication_excessiveError(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -9129,6 +9398,7 @@ class H245_ArrayOf_DialingInformationNumber : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_DialingInformationNumber, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_DialingInformationNumber(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -9149,6 +9419,7 @@ class H245_ArrayOf_DialingInformationNetworkType : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_DialingInformationNetworkType, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_DialingInformationNetworkType(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -9169,6 +9440,7 @@ class H245_FlowControlCommand_scope : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FlowControlCommand_scope, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FlowControlCommand_scope(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9199,6 +9471,7 @@ class H245_FlowControlCommand_restriction : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FlowControlCommand_restriction, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FlowControlCommand_restriction(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9221,6 +9494,7 @@ class H245_EndSessionCommand_gstnOptions : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EndSessionCommand_gstnOptions, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EndSessionCommand_gstnOptions(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9246,6 +9520,7 @@ class H245_EndSessionCommand_isdnOptions : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EndSessionCommand_isdnOptions, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EndSessionCommand_isdnOptions(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9280,6 +9555,7 @@ class H245_MiscellaneousCommand_type : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousCommand_type, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousCommand_type(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9386,6 +9662,7 @@ class H245_H223MultiplexReconfiguration_h223ModeChange : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223MultiplexReconfiguration_h223ModeChange, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223MultiplexReconfiguration_h223ModeChange(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9410,6 +9687,7 @@ class H245_H223MultiplexReconfiguration_h223AnnexADoubleFlag : public PASN_Choic
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223MultiplexReconfiguration_h223AnnexADoubleFlag, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223MultiplexReconfiguration_h223AnnexADoubleFlag(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9435,6 +9713,7 @@ class H245_NewATMVCCommand_aal : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCCommand_aal, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCCommand_aal(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9470,6 +9749,7 @@ class H245_NewATMVCCommand_multiplex : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCCommand_multiplex, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCCommand_multiplex(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9493,6 +9773,7 @@ class H245_MobileMultilinkReconfigurationCommand_status : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MobileMultilinkReconfigurationCommand_status, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MobileMultilinkReconfigurationCommand_status(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9515,6 +9796,7 @@ class H245_FunctionNotSupported_cause : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FunctionNotSupported_cause, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FunctionNotSupported_cause(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9541,6 +9823,7 @@ class H245_MiscellaneousIndication_type : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousIndication_type, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousIndication_type(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9588,6 +9871,7 @@ class H245_JitterIndication_scope : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_JitterIndication_scope, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_JitterIndication_scope(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9621,6 +9905,7 @@ class H245_NewATMVCIndication_aal : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCIndication_aal, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCIndication_aal(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9656,6 +9941,7 @@ class H245_NewATMVCIndication_multiplex : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCIndication_multiplex, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCIndication_multiplex(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9681,6 +9967,7 @@ class H245_UserInputIndication_userInputSupportIndication : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UserInputIndication_userInputSupportIndication, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UserInputIndication_userInputSupportIndication(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9715,6 +10002,7 @@ class H245_UserInputIndication_encryptedAlphanumeric : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UserInputIndication_encryptedAlphanumeric, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UserInputIndication_encryptedAlphanumeric(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -9748,6 +10036,7 @@ class H245_FlowControlIndication_scope : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FlowControlIndication_scope, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FlowControlIndication_scope(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9778,6 +10067,7 @@ class H245_FlowControlIndication_restriction : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FlowControlIndication_restriction, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FlowControlIndication_restriction(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9802,6 +10092,7 @@ class H245_TerminalCapabilitySetReject_cause_tableEntryCapacityExceeded : public
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TerminalCapabilitySetReject_cause_tableEntryCapacityExceeded, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TerminalCapabilitySetReject_cause_tableEntryCapacityExceeded(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9833,6 +10124,7 @@ class H245_VCCapability_availableBitRates_type : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VCCapability_availableBitRates_type, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VCCapability_availableBitRates_type(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -9864,6 +10156,7 @@ class H245_ArrayOf_Q2931Address : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_Q2931Address, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_Q2931Address(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -9882,6 +10175,7 @@ class H245_H223Capability_h223MultiplexTableCapability_enhanced : public PASN_Se
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223Capability_h223MultiplexTableCapability_enhanced, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223Capability_h223MultiplexTableCapability_enhanced(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -9911,6 +10205,7 @@ class H245_ArrayOf_RTPH263VideoRedundancyFrameMapping : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_RTPH263VideoRedundancyFrameMapping, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_RTPH263VideoRedundancyFrameMapping(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -9929,6 +10224,7 @@ class H245_RefPictureSelection_enhancedReferencePicSelect_subPictureRemovalParam
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RefPictureSelection_enhancedReferencePicSelect_subPictureRemovalParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RefPictureSelection_enhancedReferencePicSelect_subPictureRemovalParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -9958,6 +10254,7 @@ class H245_CustomPictureFormat_mPI_customPCF : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CustomPictureFormat_mPI_customPCF, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CustomPictureFormat_mPI_customPCF(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -9976,6 +10273,7 @@ class H245_CustomPictureFormat_pixelAspectInformation_pixelAspectCode : public P
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CustomPictureFormat_pixelAspectInformation_pixelAspectCode, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CustomPictureFormat_pixelAspectInformation_pixelAspectCode(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -9996,6 +10294,7 @@ class H245_CustomPictureFormat_pixelAspectInformation_extendedPAR : public PASN_
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CustomPictureFormat_pixelAspectInformation_extendedPAR, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CustomPictureFormat_pixelAspectInformation_extendedPAR(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -10014,6 +10313,7 @@ class H245_DataApplicationCapability_application_t84 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DataApplicationCapability_application_t84, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DataApplicationCapability_application_t84(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10040,6 +10340,7 @@ class H245_DataApplicationCapability_application_nlpid : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DataApplicationCapability_application_nlpid, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DataApplicationCapability_application_nlpid(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10066,6 +10367,7 @@ class H245_DepFECCapability_rfc2733_separateStream : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECCapability_rfc2733_separateStream, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECCapability_rfc2733_separateStream(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10097,6 +10399,7 @@ class H245_OpenLogicalChannel_forwardLogicalChannelParameters_multiplexParameter
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_OpenLogicalChannel_forwardLogicalChannelParameters_multiplexParameters, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_OpenLogicalChannel_forwardLogicalChannelParameters_multiplexParameters(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -10151,6 +10454,7 @@ class H245_OpenLogicalChannel_reverseLogicalChannelParameters_multiplexParameter
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_OpenLogicalChannel_reverseLogicalChannelParameters_multiplexParameters, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_OpenLogicalChannel_reverseLogicalChannelParameters_multiplexParameters(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -10193,6 +10497,7 @@ class H245_H223LogicalChannelParameters_adaptationLayerType_al3 : public PASN_Se
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223LogicalChannelParameters_adaptationLayerType_al3, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223LogicalChannelParameters_adaptationLayerType_al3(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10221,6 +10526,7 @@ class H245_ArrayOf_RedundancyEncodingElement : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_RedundancyEncodingElement, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_RedundancyEncodingElement(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10241,6 +10547,7 @@ class H245_DepFECData_rfc2733_mode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECData_rfc2733_mode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECData_rfc2733_mode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -10273,6 +10580,7 @@ class H245_FECData_rfc2733_pktMode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FECData_rfc2733_pktMode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FECData_rfc2733_pktMode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -10309,6 +10617,7 @@ class H245_UnicastAddress_iPSourceRouteAddress_routing : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UnicastAddress_iPSourceRouteAddress_routing, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UnicastAddress_iPSourceRouteAddress_routing(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -10331,6 +10640,7 @@ class H245_UnicastAddress_iPSourceRouteAddress_route : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UnicastAddress_iPSourceRouteAddress_route, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UnicastAddress_iPSourceRouteAddress_route(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10352,6 +10662,7 @@ class H245_OpenLogicalChannelAck_reverseLogicalChannelParameters_multiplexParame
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_OpenLogicalChannelAck_reverseLogicalChannelParameters_multiplexParameters, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_OpenLogicalChannelAck_reverseLogicalChannelParameters_multiplexParameters(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -10389,6 +10700,7 @@ class H245_DepFECMode_rfc2733Mode_mode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECMode_rfc2733Mode_mode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECMode_rfc2733Mode_mode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -10418,6 +10730,7 @@ class H245_H223ModeParameters_adaptationLayerType_al3 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223ModeParameters_adaptationLayerType_al3, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223ModeParameters_adaptationLayerType_al3(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10444,6 +10757,7 @@ class H245_DataMode_application_nlpid : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DataMode_application_nlpid, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DataMode_application_nlpid(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10470,6 +10784,7 @@ class H245_MultilinkRequest_maximumHeaderInterval_requestType : public PASN_Choi
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkRequest_maximumHeaderInterval_requestType, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkRequest_maximumHeaderInterval_requestType(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -10494,6 +10809,7 @@ class H245_MultilinkResponse_addConnection_responseCode : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkResponse_addConnection_responseCode, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkResponse_addConnection_responseCode(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -10525,6 +10841,7 @@ class H245_ArrayOf_CapabilityDescriptorNumber : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_CapabilityDescriptorNumber, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_CapabilityDescriptorNumber(unsigned tag = UniversalSet, TagClass tagClass = UniversalTagClass);
 
@@ -10543,6 +10860,7 @@ class H245_MiscellaneousCommand_type_videoFastUpdateGOB : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousCommand_type_videoFastUpdateGOB, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousCommand_type_videoFastUpdateGOB(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10569,6 +10887,7 @@ class H245_MiscellaneousCommand_type_videoFastUpdateMB : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousCommand_type_videoFastUpdateMB, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousCommand_type_videoFastUpdateMB(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10601,6 +10920,7 @@ class H245_MiscellaneousCommand_type_videoBadMBs : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousCommand_type_videoBadMBs, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousCommand_type_videoBadMBs(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10630,6 +10950,7 @@ class H245_ArrayOf_PictureReference : public PASN_Array
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ArrayOf_PictureReference, PASN_Array);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ArrayOf_PictureReference(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10648,6 +10969,7 @@ class H245_MiscellaneousCommand_type_lostPartialPicture : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousCommand_type_lostPartialPicture, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousCommand_type_lostPartialPicture(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10675,6 +10997,7 @@ class H245_MiscellaneousCommand_type_encryptionUpdateAck : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousCommand_type_encryptionUpdateAck, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousCommand_type_encryptionUpdateAck(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10700,6 +11023,7 @@ class H245_NewATMVCCommand_aal_aal5 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCCommand_aal_aal5, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCCommand_aal_aal5(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10726,6 +11050,7 @@ class H245_NewATMVCCommand_reverseParameters_multiplex : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCCommand_reverseParameters_multiplex, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCCommand_reverseParameters_multiplex(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -10749,6 +11074,7 @@ class H245_MiscellaneousIndication_type_videoNotDecodedMBs : public PASN_Sequenc
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousIndication_type_videoNotDecodedMBs, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousIndication_type_videoNotDecodedMBs(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10776,6 +11102,7 @@ class H245_NewATMVCIndication_aal_aal5 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCIndication_aal_aal5, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCIndication_aal_aal5(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10802,6 +11129,7 @@ class H245_NewATMVCIndication_reverseParameters_multiplex : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCIndication_reverseParameters_multiplex, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCIndication_reverseParameters_multiplex(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -10825,6 +11153,7 @@ class H245_UserInputIndication_signal_rtp : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UserInputIndication_signal_rtp, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UserInputIndication_signal_rtp(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10857,6 +11186,7 @@ class H245_UserInputIndication_signalUpdate_rtp : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UserInputIndication_signalUpdate_rtp, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UserInputIndication_signalUpdate_rtp(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10882,6 +11212,7 @@ class H245_UserInputIndication_extendedAlphanumeric_encryptedAlphanumeric : publ
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UserInputIndication_extendedAlphanumeric_encryptedAlphanumeric, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UserInputIndication_extendedAlphanumeric_encryptedAlphanumeric(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10913,6 +11244,7 @@ class H245_VCCapability_availableBitRates_type_rangeOfBitRates : public PASN_Seq
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VCCapability_availableBitRates_type_rangeOfBitRates, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VCCapability_availableBitRates_type_rangeOfBitRates(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10939,6 +11271,7 @@ class H245_CustomPictureFormat_mPI_customPCF_subtype : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CustomPictureFormat_mPI_customPCF_subtype, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CustomPictureFormat_mPI_customPCF_subtype(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10966,6 +11299,7 @@ class H245_CustomPictureFormat_pixelAspectInformation_extendedPAR_subtype : publ
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CustomPictureFormat_pixelAspectInformation_extendedPAR_subtype, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CustomPictureFormat_pixelAspectInformation_extendedPAR_subtype(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -10992,6 +11326,7 @@ class H245_V76LogicalChannelParameters_mode_eRM_recovery : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_V76LogicalChannelParameters_mode_eRM_recovery, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_V76LogicalChannelParameters_mode_eRM_recovery(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -11018,6 +11353,7 @@ class H245_DepFECData_rfc2733_mode_separateStream : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECData_rfc2733_mode_separateStream, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECData_rfc2733_mode_separateStream(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -11053,6 +11389,7 @@ class H245_FECData_rfc2733_pktMode_rfc2733sameport : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FECData_rfc2733_pktMode_rfc2733sameport, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FECData_rfc2733_pktMode_rfc2733sameport(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11076,6 +11413,7 @@ class H245_FECData_rfc2733_pktMode_rfc2733diffport : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FECData_rfc2733_pktMode_rfc2733diffport, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FECData_rfc2733_pktMode_rfc2733diffport(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11104,6 +11442,7 @@ class H245_DepFECMode_rfc2733Mode_mode_separateStream : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECMode_rfc2733Mode_mode_separateStream, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECMode_rfc2733Mode_mode_separateStream(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -11139,6 +11478,7 @@ class H245_MultilinkResponse_addConnection_responseCode_rejected : public PASN_C
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkResponse_addConnection_responseCode_rejected, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkResponse_addConnection_responseCode_rejected(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -11161,6 +11501,7 @@ class H245_MiscellaneousCommand_type_progressiveRefinementStart_repeatCount : pu
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousCommand_type_progressiveRefinementStart_repeatCount, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousCommand_type_progressiveRefinementStart_repeatCount(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -11185,6 +11526,7 @@ class H245_NewATMVCCommand_aal_aal1_clockRecovery : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCCommand_aal_aal1_clockRecovery, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCCommand_aal_aal1_clockRecovery(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -11208,6 +11550,7 @@ class H245_NewATMVCCommand_aal_aal1_errorCorrection : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCCommand_aal_aal1_errorCorrection, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCCommand_aal_aal1_errorCorrection(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -11232,6 +11575,7 @@ class H245_NewATMVCIndication_aal_aal1_clockRecovery : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCIndication_aal_aal1_clockRecovery, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCIndication_aal_aal1_clockRecovery(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -11255,6 +11599,7 @@ class H245_NewATMVCIndication_aal_aal1_errorCorrection : public PASN_Choice
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCIndication_aal_aal1_errorCorrection, PASN_Choice);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCIndication_aal_aal1_errorCorrection(unsigned tag = 0, TagClass tagClass = UniversalTagClass);
 
@@ -11279,6 +11624,7 @@ class H245_DepFECData_rfc2733_mode_separateStream_differentPort : public PASN_Se
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECData_rfc2733_mode_separateStream_differentPort, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECData_rfc2733_mode_separateStream_differentPort(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11309,6 +11655,7 @@ class H245_DepFECData_rfc2733_mode_separateStream_samePort : public PASN_Sequenc
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECData_rfc2733_mode_separateStream_samePort, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECData_rfc2733_mode_separateStream_samePort(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11334,6 +11681,7 @@ class H245_DepFECMode_rfc2733Mode_mode_separateStream_differentPort : public PAS
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECMode_rfc2733Mode_mode_separateStream_differentPort, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECMode_rfc2733Mode_mode_separateStream_differentPort(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11364,6 +11712,7 @@ class H245_DepFECMode_rfc2733Mode_mode_separateStream_samePort : public PASN_Seq
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECMode_rfc2733Mode_mode_separateStream_samePort, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECMode_rfc2733Mode_mode_separateStream_samePort(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11389,6 +11738,7 @@ class H245_GenericMessage : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_GenericMessage, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_GenericMessage(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11421,6 +11771,7 @@ class H245_GenericInformation : public H245_GenericMessage
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_GenericInformation, H245_GenericMessage);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_GenericInformation(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11437,6 +11788,7 @@ class H245_NonStandardParameter : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NonStandardParameter, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NonStandardParameter(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11463,6 +11815,7 @@ class H245_MasterSlaveDeterminationAck : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MasterSlaveDeterminationAck, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MasterSlaveDeterminationAck(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11488,6 +11841,7 @@ class H245_MasterSlaveDeterminationReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MasterSlaveDeterminationReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MasterSlaveDeterminationReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11513,6 +11867,7 @@ class H245_TerminalCapabilitySet : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TerminalCapabilitySet, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TerminalCapabilitySet(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11550,6 +11905,7 @@ class H245_CapabilityTableEntry : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CapabilityTableEntry, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CapabilityTableEntry(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11580,6 +11936,7 @@ class H245_CapabilityDescriptor : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CapabilityDescriptor, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CapabilityDescriptor(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11610,6 +11967,7 @@ class H245_TerminalCapabilitySetAck : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TerminalCapabilitySetAck, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TerminalCapabilitySetAck(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11640,6 +11998,7 @@ class H245_TerminalCapabilitySetReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TerminalCapabilitySetReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TerminalCapabilitySetReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11671,6 +12030,7 @@ class H245_TerminalCapabilitySetRelease : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TerminalCapabilitySetRelease, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TerminalCapabilitySetRelease(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11699,6 +12059,7 @@ class H245_H222Capability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H222Capability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H222Capability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11725,6 +12086,7 @@ class H245_H223Capability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223Capability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223Capability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11778,6 +12140,7 @@ class H245_V76Capability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_V76Capability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_V76Capability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11817,6 +12180,7 @@ class H245_MediaPacketizationCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MediaPacketizationCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MediaPacketizationCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11847,6 +12211,7 @@ class H245_RSVPParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RSVPParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RSVPParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11886,6 +12251,7 @@ class H245_ServicePriorityValue : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ServicePriorityValue, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ServicePriorityValue(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11917,6 +12283,7 @@ class H245_ServicePriority : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ServicePriority, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ServicePriority(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11953,6 +12320,7 @@ class H245_AuthorizationParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_AuthorizationParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_AuthorizationParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -11982,6 +12350,7 @@ class H245_QOSDescriptor : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_QOSDescriptor, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_QOSDescriptor(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12013,6 +12382,7 @@ class H245_GenericTransportParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_GenericTransportParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_GenericTransportParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12050,6 +12420,7 @@ class H245_QOSCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_QOSCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_QOSCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12095,6 +12466,7 @@ class H245_TransportCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TransportCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TransportCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12128,6 +12500,7 @@ class H245_RedundancyEncodingCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RedundancyEncodingCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RedundancyEncodingCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12159,6 +12532,7 @@ class H245_RTPH263VideoRedundancyEncoding : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RTPH263VideoRedundancyEncoding, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RTPH263VideoRedundancyEncoding(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12191,6 +12565,7 @@ class H245_RTPH263VideoRedundancyFrameMapping : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RTPH263VideoRedundancyFrameMapping, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RTPH263VideoRedundancyFrameMapping(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12217,6 +12592,7 @@ class H245_MultipointCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultipointCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultipointCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12244,6 +12620,7 @@ class H245_MediaDistributionCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MediaDistributionCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MediaDistributionCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12281,6 +12658,7 @@ class H245_ExtendedVideoCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ExtendedVideoCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ExtendedVideoCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12311,6 +12689,7 @@ class H245_EnhancementLayerInfo : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EnhancementLayerInfo, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EnhancementLayerInfo(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12345,6 +12724,7 @@ class H245_H263ModeComboFlags : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H263ModeComboFlags, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H263ModeComboFlags(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12397,6 +12777,7 @@ class H245_G7231AnnexCCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_G7231AnnexCCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_G7231AnnexCCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12428,6 +12809,7 @@ class H245_DataApplicationCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DataApplicationCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DataApplicationCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12454,6 +12836,7 @@ class H245_T38FaxUdpOptions : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_T38FaxUdpOptions, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_T38FaxUdpOptions(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12486,6 +12869,7 @@ class H245_AuthenticationCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_AuthenticationCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_AuthenticationCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12517,6 +12901,7 @@ class H245_IntegrityCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IntegrityCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IntegrityCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12546,6 +12931,7 @@ class H245_ConferenceCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12580,6 +12966,7 @@ class H245_GenericCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_GenericCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_GenericCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12618,6 +13005,7 @@ class H245_GenericParameter : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_GenericParameter, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_GenericParameter(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12649,6 +13037,7 @@ class H245_MultiplexedStreamCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexedStreamCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexedStreamCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12680,6 +13069,7 @@ class H245_MultiplePayloadStreamCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplePayloadStreamCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplePayloadStreamCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12705,6 +13095,7 @@ class H245_FECCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FECCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FECCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12737,6 +13128,7 @@ class H245_NetworkAccessParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NetworkAccessParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NetworkAccessParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12772,6 +13164,7 @@ class H245_Q2931Address : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_Q2931Address, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_Q2931Address(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12802,6 +13195,7 @@ class H245_H223LogicalChannelParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223LogicalChannelParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223LogicalChannelParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12828,6 +13222,7 @@ class H245_H223AL1MParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AL1MParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AL1MParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12864,6 +13259,7 @@ class H245_H223AL2MParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AL2MParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AL2MParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12890,6 +13286,7 @@ class H245_H223AL3MParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AL3MParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AL3MParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12924,6 +13321,7 @@ class H245_H223AnnexCArqParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223AnnexCArqParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223AnnexCArqParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12950,6 +13348,7 @@ class H245_V76HDLCParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_V76HDLCParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_V76HDLCParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -12977,6 +13376,7 @@ class H245_RTPPayloadType : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RTPPayloadType, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RTPPayloadType(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13007,6 +13407,7 @@ class H245_MultiplePayloadStream : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplePayloadStream, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplePayloadStream(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13032,6 +13433,7 @@ class H245_EncryptionSync : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EncryptionSync, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EncryptionSync(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13067,6 +13469,7 @@ class H245_OpenLogicalChannelReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_OpenLogicalChannelReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_OpenLogicalChannelReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13098,6 +13501,7 @@ class H245_OpenLogicalChannelConfirm : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_OpenLogicalChannelConfirm, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_OpenLogicalChannelConfirm(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13128,6 +13532,7 @@ class H245_H2250LogicalChannelAckParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H2250LogicalChannelAckParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H2250LogicalChannelAckParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13169,6 +13574,7 @@ class H245_CloseLogicalChannel : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CloseLogicalChannel, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CloseLogicalChannel(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13200,6 +13606,7 @@ class H245_RequestChannelClose : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestChannelClose, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestChannelClose(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13232,6 +13639,7 @@ class H245_RequestChannelCloseReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestChannelCloseReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestChannelCloseReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13258,6 +13666,7 @@ class H245_MultiplexEntrySend : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexEntrySend, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexEntrySend(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13284,6 +13693,7 @@ class H245_MultiplexEntryDescriptor : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexEntryDescriptor, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexEntryDescriptor(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13314,6 +13724,7 @@ class H245_MultiplexElement : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexElement, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexElement(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13340,6 +13751,7 @@ class H245_MultiplexEntrySendAck : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexEntrySendAck, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexEntrySendAck(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13366,6 +13778,7 @@ class H245_MultiplexEntrySendReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexEntrySendReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexEntrySendReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13392,6 +13805,7 @@ class H245_MultiplexEntryRejectionDescriptions : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexEntryRejectionDescriptions, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexEntryRejectionDescriptions(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13418,6 +13832,7 @@ class H245_MultiplexEntrySendRelease : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplexEntrySendRelease, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplexEntrySendRelease(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13443,6 +13858,7 @@ class H245_RequestMultiplexEntry : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestMultiplexEntry, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestMultiplexEntry(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13468,6 +13884,7 @@ class H245_RequestMultiplexEntryAck : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestMultiplexEntryAck, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestMultiplexEntryAck(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13493,6 +13910,7 @@ class H245_RequestMultiplexEntryReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestMultiplexEntryReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestMultiplexEntryReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13519,6 +13937,7 @@ class H245_RequestMultiplexEntryRejectionDescriptions : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestMultiplexEntryRejectionDescriptions, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestMultiplexEntryRejectionDescriptions(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13545,6 +13964,7 @@ class H245_RequestMultiplexEntryRelease : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestMultiplexEntryRelease, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestMultiplexEntryRelease(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13570,6 +13990,7 @@ class H245_RequestMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13596,6 +14017,7 @@ class H245_RequestModeAck : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestModeAck, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestModeAck(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13622,6 +14044,7 @@ class H245_RequestModeReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestModeReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestModeReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13648,6 +14071,7 @@ class H245_RedundancyEncodingDTModeElement : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RedundancyEncodingDTModeElement, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RedundancyEncodingDTModeElement(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13673,6 +14097,7 @@ class H245_MultiplePayloadStreamMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultiplePayloadStreamMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultiplePayloadStreamMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13698,6 +14123,7 @@ class H245_FECMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FECMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FECMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13730,6 +14156,7 @@ class H245_H223ModeParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H223ModeParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H223ModeParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13756,6 +14183,7 @@ class H245_RedundancyEncodingMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RedundancyEncodingMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RedundancyEncodingMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13786,6 +14214,7 @@ class H245_H261VideoMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H261VideoMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H261VideoMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13813,6 +14242,7 @@ class H245_H262VideoMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H262VideoMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H262VideoMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13853,6 +14283,7 @@ class H245_IS11172AudioMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IS11172AudioMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IS11172AudioMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13881,6 +14312,7 @@ class H245_IS13818AudioMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_IS13818AudioMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_IS13818AudioMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13911,6 +14343,7 @@ class H245_G7231AnnexCMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_G7231AnnexCMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_G7231AnnexCMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13938,6 +14371,7 @@ class H245_DataMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DataMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DataMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13964,6 +14398,7 @@ class H245_MaintenanceLoopRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MaintenanceLoopRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MaintenanceLoopRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -13989,6 +14424,7 @@ class H245_MaintenanceLoopAck : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MaintenanceLoopAck, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MaintenanceLoopAck(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14014,6 +14450,7 @@ class H245_MaintenanceLoopReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MaintenanceLoopReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MaintenanceLoopReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14040,6 +14477,7 @@ class H245_CommunicationModeCommand : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CommunicationModeCommand, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CommunicationModeCommand(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14065,6 +14503,7 @@ class H245_TerminalLabel : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TerminalLabel, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TerminalLabel(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14091,6 +14530,7 @@ class H245_RequestAllTerminalIDsResponse : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RequestAllTerminalIDsResponse, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RequestAllTerminalIDsResponse(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14116,6 +14556,7 @@ class H245_TerminalInformation : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_TerminalInformation, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_TerminalInformation(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14142,6 +14583,7 @@ class H245_DialingInformationNumber : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DialingInformationNumber, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DialingInformationNumber(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14173,6 +14615,7 @@ class H245_LogicalChannelRateReject : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_LogicalChannelRateReject, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_LogicalChannelRateReject(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14205,6 +14648,7 @@ class H245_FlowControlCommand : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FlowControlCommand, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FlowControlCommand(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14231,6 +14675,7 @@ class H245_MiscellaneousCommand : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousCommand, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousCommand(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14262,6 +14707,7 @@ class H245_MobileMultilinkReconfigurationCommand : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MobileMultilinkReconfigurationCommand, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MobileMultilinkReconfigurationCommand(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14289,6 +14735,7 @@ class H245_FunctionNotSupported : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FunctionNotSupported, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FunctionNotSupported(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14319,6 +14766,7 @@ class H245_MiscellaneousIndication : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousIndication, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousIndication(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14345,6 +14793,7 @@ class H245_JitterIndication : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_JitterIndication, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_JitterIndication(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14379,6 +14828,7 @@ class H245_FlowControlIndication : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FlowControlIndication, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FlowControlIndication(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14405,6 +14855,7 @@ class H245_VCCapability_availableBitRates : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VCCapability_availableBitRates, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VCCapability_availableBitRates(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14430,6 +14881,7 @@ class H245_VCCapability_aal1ViaGateway : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VCCapability_aal1ViaGateway, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VCCapability_aal1ViaGateway(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14464,6 +14916,7 @@ class H245_RefPictureSelection_enhancedReferencePicSelect : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RefPictureSelection_enhancedReferencePicSelect, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RefPictureSelection_enhancedReferencePicSelect(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14493,6 +14946,7 @@ class H245_CustomPictureFormat_mPI : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CustomPictureFormat_mPI, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CustomPictureFormat_mPI(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14524,6 +14978,7 @@ class H245_DepFECCapability_rfc2733 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECCapability_rfc2733, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECCapability_rfc2733(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14550,6 +15005,7 @@ class H245_OpenLogicalChannel_forwardLogicalChannelParameters : public PASN_Sequ
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_OpenLogicalChannel_forwardLogicalChannelParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_OpenLogicalChannel_forwardLogicalChannelParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14585,6 +15041,7 @@ class H245_OpenLogicalChannel_reverseLogicalChannelParameters : public PASN_Sequ
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_OpenLogicalChannel_reverseLogicalChannelParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_OpenLogicalChannel_reverseLogicalChannelParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14619,6 +15076,7 @@ class H245_RedundancyEncoding_rtpRedundancyEncoding : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RedundancyEncoding_rtpRedundancyEncoding, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RedundancyEncoding_rtpRedundancyEncoding(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14650,6 +15108,7 @@ class H245_DepFECData_rfc2733 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECData_rfc2733, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECData_rfc2733(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14675,6 +15134,7 @@ class H245_FECData_rfc2733 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_FECData_rfc2733, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_FECData_rfc2733(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14706,6 +15166,7 @@ class H245_UnicastAddress_iPSourceRouteAddress : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UnicastAddress_iPSourceRouteAddress, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UnicastAddress_iPSourceRouteAddress(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14734,6 +15195,7 @@ class H245_OpenLogicalChannelAck_reverseLogicalChannelParameters : public PASN_S
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_OpenLogicalChannelAck_reverseLogicalChannelParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_OpenLogicalChannelAck_reverseLogicalChannelParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14768,6 +15230,7 @@ class H245_DepFECMode_rfc2733Mode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DepFECMode_rfc2733Mode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DepFECMode_rfc2733Mode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14793,6 +15256,7 @@ class H245_ConferenceRequest_requestTerminalCertificate : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceRequest_requestTerminalCertificate, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceRequest_requestTerminalCertificate(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14826,6 +15290,7 @@ class H245_ConferenceResponse_mCTerminalIDResponse : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceResponse_mCTerminalIDResponse, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceResponse_mCTerminalIDResponse(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14852,6 +15317,7 @@ class H245_ConferenceResponse_terminalIDResponse : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceResponse_terminalIDResponse, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceResponse_terminalIDResponse(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14878,6 +15344,7 @@ class H245_ConferenceResponse_conferenceIDResponse : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceResponse_conferenceIDResponse, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceResponse_conferenceIDResponse(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14904,6 +15371,7 @@ class H245_ConferenceResponse_passwordResponse : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceResponse_passwordResponse, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceResponse_passwordResponse(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14930,6 +15398,7 @@ class H245_ConferenceResponse_chairTokenOwnerResponse : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceResponse_chairTokenOwnerResponse, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceResponse_chairTokenOwnerResponse(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14956,6 +15425,7 @@ class H245_ConferenceResponse_terminalCertificateResponse : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ConferenceResponse_terminalCertificateResponse, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ConferenceResponse_terminalCertificateResponse(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -14987,6 +15457,7 @@ class H245_MultilinkRequest_maximumHeaderInterval : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkRequest_maximumHeaderInterval, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkRequest_maximumHeaderInterval(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15012,6 +15483,7 @@ class H245_MultilinkResponse_addConnection : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MultilinkResponse_addConnection, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MultilinkResponse_addConnection(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15038,6 +15510,7 @@ class H245_SendTerminalCapabilitySet_specificRequest : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_SendTerminalCapabilitySet_specificRequest, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_SendTerminalCapabilitySet_specificRequest(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15070,6 +15543,7 @@ class H245_EncryptionCommand_encryptionAlgorithmID : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EncryptionCommand_encryptionAlgorithmID, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EncryptionCommand_encryptionAlgorithmID(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15096,6 +15570,7 @@ class H245_NewATMVCCommand_reverseParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCCommand_reverseParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCCommand_reverseParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15124,6 +15599,7 @@ class H245_NewATMVCIndication_reverseParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCIndication_reverseParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCIndication_reverseParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15152,6 +15628,7 @@ class H245_UserInputIndication_signal : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UserInputIndication_signal, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UserInputIndication_signal(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15192,6 +15669,7 @@ class H245_UserInputIndication_signalUpdate : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UserInputIndication_signalUpdate, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UserInputIndication_signalUpdate(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15222,6 +15700,7 @@ class H245_UserInputIndication_extendedAlphanumeric : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_UserInputIndication_extendedAlphanumeric, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_UserInputIndication_extendedAlphanumeric(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15254,6 +15733,7 @@ class H245_V76LogicalChannelParameters_mode_eRM : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_V76LogicalChannelParameters_mode_eRM, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_V76LogicalChannelParameters_mode_eRM(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15280,6 +15760,7 @@ class H245_MiscellaneousCommand_type_progressiveRefinementStart : public PASN_Se
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousCommand_type_progressiveRefinementStart, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousCommand_type_progressiveRefinementStart(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15305,6 +15786,7 @@ class H245_MiscellaneousCommand_type_encryptionUpdateCommand : public PASN_Seque
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_MiscellaneousCommand_type_encryptionUpdateCommand, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_MiscellaneousCommand_type_encryptionUpdateCommand(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15335,6 +15817,7 @@ class H245_NewATMVCCommand_aal_aal1 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCCommand_aal_aal1, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCCommand_aal_aal1(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15363,6 +15846,7 @@ class H245_NewATMVCIndication_aal_aal1 : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCIndication_aal_aal1, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCIndication_aal_aal1(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15391,6 +15875,7 @@ class H245_NonStandardMessage : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NonStandardMessage, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NonStandardMessage(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15416,6 +15901,7 @@ class H245_VCCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_VCCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_VCCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15452,6 +15938,7 @@ class H245_H2250Capability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H2250Capability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H2250Capability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15494,6 +15981,7 @@ class H245_RefPictureSelection : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RefPictureSelection, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RefPictureSelection(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15527,6 +16015,7 @@ class H245_CustomPictureFormat : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CustomPictureFormat, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CustomPictureFormat(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15557,6 +16046,7 @@ class H245_H263VideoModeCombos : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H263VideoModeCombos, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H263VideoModeCombos(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15583,6 +16073,7 @@ class H245_T38FaxProfile : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_T38FaxProfile, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_T38FaxProfile(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15621,6 +16112,7 @@ class H245_EncryptionAuthenticationAndIntegrity : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EncryptionAuthenticationAndIntegrity, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EncryptionAuthenticationAndIntegrity(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15656,6 +16148,7 @@ class H245_OpenLogicalChannel : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_OpenLogicalChannel, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_OpenLogicalChannel(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15693,6 +16186,7 @@ class H245_H235Media : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H235Media, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H235Media(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15719,6 +16213,7 @@ class H245_V76LogicalChannelParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_V76LogicalChannelParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_V76LogicalChannelParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15748,6 +16243,7 @@ class H245_RedundancyEncoding : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RedundancyEncoding, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RedundancyEncoding(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15780,6 +16276,7 @@ class H245_OpenLogicalChannelAck : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_OpenLogicalChannelAck, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_OpenLogicalChannelAck(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15818,6 +16315,7 @@ class H245_H235Mode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H235Mode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H235Mode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15844,6 +16342,7 @@ class H245_RedundancyEncodingDTMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_RedundancyEncodingDTMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_RedundancyEncodingDTMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15871,6 +16370,7 @@ class H245_H2250ModeParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H2250ModeParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H2250ModeParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15900,6 +16400,7 @@ class H245_CommunicationModeTableEntry : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_CommunicationModeTableEntry, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_CommunicationModeTableEntry(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15950,6 +16451,7 @@ class H245_NewATMVCCommand : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCCommand, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCCommand(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -15981,6 +16483,7 @@ class H245_NewATMVCIndication : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_NewATMVCIndication, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_NewATMVCIndication(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -16016,6 +16519,7 @@ class H245_DataApplicationCapability_application_t38fax : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DataApplicationCapability_application_t38fax, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DataApplicationCapability_application_t38fax(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -16042,6 +16546,7 @@ class H245_DataMode_application_t38fax : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_DataMode_application_t38fax, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_DataMode_application_t38fax(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -16068,6 +16573,7 @@ class H245_H235SecurityCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H235SecurityCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H235SecurityCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -16094,6 +16600,7 @@ class H245_H263Options : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H263Options, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H263Options(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -16159,6 +16666,7 @@ class H245_H2250LogicalChannelParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H2250LogicalChannelParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H2250LogicalChannelParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -16213,6 +16721,7 @@ class H245_ModeElement : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_ModeElement, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_ModeElement(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -16253,6 +16762,7 @@ class H245_H263VideoMode : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H263VideoMode, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H263VideoMode(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -16292,6 +16802,7 @@ class H245_H263VideoCapability : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_H263VideoCapability, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_H263VideoCapability(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -16355,6 +16866,7 @@ class H245_EnhancementOptions : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_EnhancementOptions, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_EnhancementOptions(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -16409,6 +16921,7 @@ class H245_BEnhancementParameters : public PASN_Sequence
 #ifndef PASN_LEANANDMEAN
     PCLASSINFO(H245_BEnhancementParameters, PASN_Sequence);
 #endif
+    H323_PDU_ARENA_ALLOCATOR
   public:
     H245_BEnhancementParameters(unsigned tag = UniversalSequence, TagClass tagClass = UniversalTagClass);
 
@@ -0,0 +1,138 @@
+/*
+ * h323arena.h
+ *
+ * H.323 protocol handler
+ *
+ * Open H323 Library
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See the
+ * License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Open H323 Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef __H323_ARENA_H
+#define __H323_ARENA_H
+
+#include <ptlib.h>
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**Per message arena for the generated ASN.1 classes.
+   While a H323PDUArenaScope is active on a thread every generated H.225,
+   H.235 and H.245 object created on that thread is carved out of the
+   scope's arena instead of being allocated individually. Deleting such an
+   object only drops a reference, the arena blocks are freed in one go when
+   the last object from the message has gone.
+
+   Leaf types owned by PTLib (PASN_Integer, PASN_Null etc) are not covered
+   and continue to use the normal heap.
+  */
+class H323PDUArena
+{
+  public:
+  /**@name Allocation */
+  //@{
+    /**Allocate memory for a generated ASN.1 object.
+       Uses the arena of the current scope if there is one, otherwise the heap.
+      */
+    static void * Allocate(
+      size_t size     ///<  Size of object
+    );
+
+    /**Free memory obtained from Allocate().
+      */
+    static void Deallocate(
+      void * ptr      ///<  Memory to free
+    );
+  //@}
+
+  /**@name Control */
+  //@{
+    /**Enable arena decoding in H323SignalPDU, H323ControlPDU and H323RasPDU.
+       Default is disabled.
+      */
+    static void SetEnabled(
+      PBoolean enable   ///<  Enable arena decoding
+    );
+
+    /**Get flag for arena decoding enabled.
+      */
+    static PBoolean IsEnabled();
+
+    /**Get the arena active on the calling thread, if any.
+      */
+    static H323PDUArena * GetCurrent();
+  //@}
+
+  protected:
+    H323PDUArena(PINDEX blockSize);
+    ~H323PDUArena();
+
+    void * Carve(size_t size);
+    void AddReference() { ++references; }
+    void RemoveReference();
+
+    PINDEX          blockSize;
+    BYTE          * blocks;
+    BYTE          * current;
+    size_t          remaining;
+    PAtomicInteger  references;
+
+    static PBoolean enabled;
+
+  friend class H323PDUArenaScope;
+};
+
+
+/**Make the generated ASN.1 objects created on this thread come from a per
+   message arena for the lifetime of this object. Does nothing if arena
+   decoding is disabled or a scope is already active on the thread.
+  */
+class H323PDUArenaScope
+{
+  public:
+    H323PDUArenaScope(
+      PINDEX blockSize = 4096   ///<  Size of arena blocks
+    );
+    ~H323PDUArenaScope();
+
+  protected:
+    H323PDUArena * arena;
+};
+
+
+/**Allocator functions placed in each generated ASN.1 class. Disabled when
+   PTLib memory checking is on as it supplies its own operator new.
+   The lines are added to h225.h, h235.h and h245.h by src/asn/arena.awk,
+   which must be run whenever those headers are regenerated by asnparser.
+  */
+#if PMEMORY_CHECK || defined(H323_NO_PDU_ARENA)
+#define H323_PDU_ARENA_ALLOCATOR
+#else
+#define H323_PDU_ARENA_ALLOCATOR \
+  public: \
+    void * operator new(size_t nSize) { return H323PDUArena::Allocate(nSize); } \
+    void operator delete(void * ptr) { H323PDUArena::Deallocate(ptr); }
+#endif
+
+
+#endif // __H323_ARENA_H
+
+
+/////////////////////////////////////////////////////////////////////////////
@@ -46,6 +46,9 @@
 #include "channels.h"
 #include "mediafmt.h"
 
+#include <map>
+#include <vector>
+
 
 /* The following classes have forward references to avoid including the VERY
    large header files for H225 and H245. If an application requires access
@@ -2045,6 +2048,70 @@ class H323CapabilitiesSet : public H323CapabilitiesSetArray
 };
 
 
+/**Encoded capability tables shared by every connection of an endpoint.
+   An entry is keyed on the version of the capability set it was built from
+   and the capabilities usable on the connection. Entries are never changed
+   once added, so the bytes can be handed out without copying.
+  */
+class H323CapabilityPDUCache : public PObject
+{
+  PCLASSINFO(H323CapabilityPDUCache, PObject);
+  public:
+  /**@name Construction */
+  //@{
+    /**Create an empty cache.
+      */
+    H323CapabilityPDUCache();
+  //@}
+
+  /**@name Operations */
+  //@{
+    /**Get a number identifying a new version of a capability set. Numbers
+       are never reused, so entries for older versions are no longer found.
+      */
+    unsigned NewGeneration();
+
+    /**Find the encoding built for the key. The bytes returned are shared
+       with the cache and must not be altered.
+      */
+    PBoolean Find(
+      const PString & key,          ///< Capability set version and usable capabilities
+      PBYTEArray & encoding,        ///< Encoded capabilityTable, rtpPayloadType and descriptors
+      PBoolean & packetization      ///< Encoding includes the rtpPayloadType
+    ) const;
+
+    /**Add the encoding built for the key. An existing entry is kept.
+      */
+    void Add(
+      const PString & key,          ///< Capability set version and usable capabilities
+      const PBYTEArray & encoding,  ///< Encoded capabilityTable, rtpPayloadType and descriptors
+      PBoolean packetization        ///< Encoding includes the rtpPayloadType
+    );
+
+    /**Get the number of encodings held.
+      */
+    PINDEX GetSize() const;
+
+    /**Get the number of times an encoding was found.
+      */
+    unsigned GetHits() const;
+  //@}
+
+  protected:
+    enum { MaxEntries = 256 };
+
+    struct Entry {
+      PBYTEArray encoding;
+      PBoolean   packetization;
+    };
+
+    std::map<PString, Entry> entries;
+    unsigned                 generation;
+    mutable unsigned         hits;
+    mutable PMutex           mutex;
+};
+
+
 /**This class contains all of the capabilities and their combinations.
   */
 class H323Capabilities : public PObject
@@ -2428,11 +2495,82 @@ class H323Capabilities : public PObject
     /**Access to Capabilities Set
       */
     const H323CapabilitiesSet & GetSet() const;
+
+    /**Set the cache of the capability table and descriptors produced by
+       BuildPDU(), NULL disables caching. The first build for a given set of
+       usable capabilities encodes them and later builds, by any copy of
+       this set, decode the cached bytes.
+
+       Changes made through the functions of this class start a new version
+       of the set automatically. Code that alters a capability in place, via
+       operator[] or a pointer returned by FindCapability(), must call
+       InvalidatePDUCache() afterwards.
+      */
+    void SetPDUCache(
+      H323CapabilityPDUCache * cache  ///< Endpoint wide cache, or NULL
+    );
+
+    /**Get the cache used by BuildPDU(), NULL if not caching.
+      */
+    H323CapabilityPDUCache * GetPDUCache() const { return pduCache; }
+
+    /**Stop using encodings cached for the current contents of the set.
+      */
+    void InvalidatePDUCache();
   //@}
 
   protected:
+    /**Discard the lookup index after the table has been rearranged.
+      */
+    void InvalidateIndex();
+
+    /**Rebuild the lookup index if it is out of date. The indexMutex must
+       be held.
+      */
+    void CheckIndex() const;
+
+    /**Rebuild the lookup index. The indexMutex must be held.
+      */
+    void BuildIndex() const;
+
+    /**Add the table entry at the index to the lookup index. The indexMutex
+       must be held.
+      */
+    void IndexCapability(PINDEX idx) const;
+
+    /**Find the first capability with the number without tracing.
+      */
+    H323Capability * LookupCapability(unsigned capabilityNumber) const;
+
+    /**Get a capability number, starting at the one supplied, not already
+       in use in the table.
+      */
+    unsigned MergeCapabilityNumber(unsigned capabilityNumber) const;
+
+    /**Get the number of this version of the set in the PDU cache.
+      */
+    unsigned GetPDUGeneration() const;
+
+    /**Append to the table, keeping the lookup index and PDU cache in step.
+       All additions to the table must be made through this function.
+      */
+    void AppendCapability(H323Capability * capability);
+
     H323CapabilitiesList table;
     H323CapabilitiesSet  set;
+
+    // Lookup index over table, positions are only valid while indexValid
+    typedef std::map<unsigned, PINDEX> NumberIndex;
+    typedef std::map<std::pair<unsigned, unsigned>, std::vector<PINDEX> > TypeIndex;
+    mutable PMutex  indexMutex;
+    mutable PBoolean indexValid;
+    mutable NumberIndex numberIndex;
+    mutable TypeIndex typeIndex;
+    mutable std::vector<PCaselessString> nameIndex;
+
+    // Encoded capabilityTable, rtpPayloadType and capabilityDescriptors
+    H323CapabilityPDUCache * pduCache;
+    mutable unsigned         pduGeneration;    // Zero until next needed
 };
 
 ///////////////////////////////////////////////////////////////////////////////
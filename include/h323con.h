@@ -55,6 +55,8 @@
 
 #include "h225.h"
 
+#include <set>
+
 #ifdef H323_SIGNAL_AGGREGATE
 #include <ptclib/sockagg.h>
 
@@ -202,6 +204,8 @@ class H323Connection : public PObject
 
   friend class AggregatedH225Handle;
   friend class AggregatedH245Handle;
+  friend class H225ReactorHandle;
+  friend class H245ReactorHandle;
   public:
   /**@name Construction */
   //@{
@@ -278,6 +282,24 @@ class H323Connection : public PObject
      */
     void Unlock();
 
+    /**Get the number of H323ConnectionHandle instances referring to this
+       connection. The endpoint does not delete the connection until this
+       has dropped to zero.
+     */
+    unsigned GetHandleReferences() const { return handleReferences; }
+
+    /**Determine if the thread created any of the H323ConnectionHandle
+       instances referring to this connection.
+     */
+    PBoolean IsHandleReferencedBy(
+      PThreadIdentifier thread    ///< Thread to check
+    ) const;
+
+    /**Wait until no H323ConnectionHandle refers to this connection. This is
+       used by the endpoint before it deletes the connection.
+     */
+    void WaitForHandleReferences();
+
     /**
       * called when an ARQ needs to be sent to a gatekeeper. This allows the connection
       * to change or check fields in the ARQ before it is sent.
@@ -2260,6 +2282,13 @@ class H323Connection : public PObject
         unsigned newSessionID
     );
 
+    /**Append a snapshot of the media timing histograms of every RTP session
+       of the connection to the list.
+      */
+    void GetMediaStatistics(
+      RTP_MediaStatisticsList & list    ///< List to append snapshots to
+    );
+
     /**Received OLC Generic Information. This is used to supply alternate RTP
        destination information in the generic information field in the OLC for the
        purpose of probing for an alternate route to the remote party.
@@ -3339,6 +3368,22 @@ class H323Connection : public PObject
     PBoolean HasVideoFrameBuffer();
 #endif
 
+#ifdef H323_VIDEO
+    /**Set the group of calls sending video from the same source, eg the
+       same camera or conference mix. When H323EndPoint::SetSharedVideoEncoding()
+       is enabled, transmit video channels of calls in one group whose media
+       formats are identical share one encoder. Calls not in a group, the
+       default, always keep their own encoder.
+      */
+    void SetSharedVideoGroup(
+      const PString & group   ///< Application defined video source group
+    ) { sharedVideoGroup = group; }
+
+    /**Get the group of calls sending video from the same source.
+      */
+    const PString & GetSharedVideoGroup() const { return sharedVideoGroup; }
+#endif
+
     /** Whether the current connection is a maintained Signalling connection
       */
     PBoolean IsMaintainedConnection() const;
@@ -3555,10 +3600,47 @@ class H323Connection : public PObject
     PTimedMutex outerMutex;
     PTimedMutex innerMutex;
 
+    void AddHandleReference(PThreadIdentifier owner);
+    void RemoveHandleReference(PThreadIdentifier owner);
+
+    PAtomicInteger handleReferences;
+    std::multiset<PThreadIdentifier> handleOwners;
+    mutable PMutex handleMutex;
+    PSyncPoint     handlesReleased;
+    friend class H323ConnectionHandle;
+
   public:
     PBoolean StartHandleControlChannel();
     virtual PBoolean OnStartHandleControlChannel();
     void EndHandleControlChannel();
+    void EndHandleSignallingChannel();
+
+    /**Hand the signalling channel over to the endpoint signalling reactor.
+       Returns FALSE if the reactor is disabled or cannot service the
+       transport, the calling thread must then read the channel itself.
+      */
+    PBoolean StartSignalChannelReactor(
+      H323Transport * transport,    ///< Signalling channel
+      PBoolean keepAlive = FALSE    ///< Send TPKT keep alives
+    );
+
+    /**Start the control channel and hand it over to the endpoint signalling
+       reactor. Returns FALSE if the reactor is disabled or cannot service
+       the transport, the calling thread must then call HandleControlChannel().
+      */
+    PBoolean StartControlChannelReactor(
+      H323Transport * transport,    ///< H.245 channel
+      PBoolean keepAlive = FALSE    ///< Send TPKT keep alives
+    );
+
+  protected:
+    void RemoveReactorHandle(H323SignalReactor::Handle * & handle);
+
+    H323SignalReactor         * signallingReactor;
+    H323SignalReactor::Handle * signalReactorHandle;
+    H323SignalReactor::Handle * controlReactorHandle;
+    PBoolean                    reactorClosed;
+    PMutex                      reactorMutex;
 
 #ifdef H323_RTP_AGGREGATE
   private:
@@ -3585,6 +3667,10 @@ class H323Connection : public PObject
 
     PBoolean m_maintainConnection;
 
+#ifdef H323_VIDEO
+    PString sharedVideoGroup;
+#endif
+
 #ifdef H323_H460
     PBoolean disableH460;
     H460_FeatureSet       * features;
@@ -3646,6 +3732,115 @@ H323DICTIONARY(H323ConnectionDict, PString, H323Connection);
 H323DICTIONARY(H323CallIdentityDict, PString, H323Connection);
 
 
+/**This class is a counted reference to a connection.
+   While any handle refers to a connection the endpoint will not delete it,
+   though it may still be cleared, so the handle can be kept and passed
+   between threads without holding the connection lock. Use
+   H323Connection::Lock() as usual before using the connection.
+
+   Handles are obtained from H323EndPoint::FindConnectionHandle().
+  */
+class H323ConnectionHandle
+{
+  public:
+    /**Create a handle to the connection.
+       The caller must guarantee the connection cannot be deleted during
+       this constructor, eg by holding another handle.
+      */
+    H323ConnectionHandle(
+      H323Connection * connection = NULL  ///< Connection to refer to
+    );
+    H323ConnectionHandle(
+      const H323ConnectionHandle & other
+    );
+    ~H323ConnectionHandle();
+
+    H323ConnectionHandle & operator=(
+      const H323ConnectionHandle & other
+    );
+
+    /**Get the connection, NULL if the handle is empty.
+      */
+    H323Connection * GetConnection() const { return connection; }
+    H323Connection * operator->() const { return connection; }
+
+    /**Determine if the handle is empty.
+      */
+    PBoolean IsNULL() const { return connection == NULL; }
+
+  protected:
+    H323Connection  * connection;
+    PThreadIdentifier owner;      // Thread that made the handle
+};
+
+
+/**This class is a registry of the active connections of an endpoint keyed
+   by call token. It is split into shards selected by a hash of the token,
+   each with its own read/write mutex, so lookups from many threads only
+   contend with registrations and removals of calls in the same shard and
+   never with the endpoint connectionsMutex.
+  */
+class H323ConnectionRegistry : public PObject
+{
+    PCLASSINFO(H323ConnectionRegistry, PObject);
+  public:
+  /**@name Construction */
+  //@{
+    H323ConnectionRegistry(
+      PINDEX shards = 32    ///< Number of independently locked shards
+    );
+    ~H323ConnectionRegistry();
+  //@}
+
+  /**@name Operations */
+  //@{
+    /**Register the connection under the token, replacing any previous one.
+      */
+    void Add(
+      const PString & token,        ///< Call token
+      H323Connection * connection   ///< Connection for token
+    );
+
+    /**Remove the token if it still refers to the connection. After this
+       returns no new handles to the connection can be obtained from the
+       registry.
+      */
+    void Remove(
+      const PString & token,        ///< Call token
+      H323Connection * connection   ///< Connection for token
+    );
+
+    /**Get a handle to the connection with the token.
+       The handle is empty if there is no such token.
+      */
+    H323ConnectionHandle Find(
+      const PString & token         ///< Call token
+    ) const;
+
+    /**Determine if the token is registered.
+      */
+    PBoolean Contains(
+      const PString & token         ///< Call token
+    ) const;
+
+    /**Get the number of registered connections.
+      */
+    PINDEX GetSize() const;
+  //@}
+
+  protected:
+    typedef std::map<PString, H323Connection *> ConnectionMap;
+    struct Shard {
+      mutable PReadWriteMutex mutex;
+      ConnectionMap connections;
+    };
+
+    Shard & GetShard(const PString & token) const;
+
+    std::vector<Shard *> shards;
+};
+
+
 #endif // __OPAL_H323CON_H
 
 
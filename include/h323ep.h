@@ -312,6 +312,26 @@ class H323EndPoint : public PObject
       const PStringArray & preferenceOrder
     );
 
+    /**Enable caching of the encoded capability table. Connections copy the
+       endpoint capabilities and share one endpoint wide cache of encoded
+       TerminalCapabilitySet tables, used until their copy is changed.
+       See H323Capabilities::SetPDUCache().
+      */
+    void SetCapabilityPDUCaching(
+      PBoolean enable   ///< Flag to enable the encoded PDU cache
+    );
+
+    /**Get the endpoint wide cache of encoded capability tables.
+      */
+    const H323CapabilityPDUCache & GetCapabilityPDUCache() const { return capabilityPDUCache; }
+
+    /**Enable arena decoding of received signalling, control and RAS PDUs.
+       This is process wide, see H323PDUArena.
+      */
+    void SetPDUArenaDecoding(
+      PBoolean enable   ///< Flag to enable arena decoding
+    );
+
     /**Find a capability that has been registered.
      */
     H323Capability * FindCapability(
@@ -841,7 +861,9 @@ class H323EndPoint : public PObject
 
     /**Clear a current connection.
        This hangs up the connection to a remote endpoint. Note that these functions
-       are synchronous
+       are synchronous. They return FALSE without clearing the call if the
+       calling thread holds an H323ConnectionHandle to it, as the connection
+       cannot be deleted until that is released.
       */
     virtual PBoolean ClearCallSynchronous(
       const PString & token,            ///< Token for identifying connection
@@ -891,10 +913,34 @@ class H323EndPoint : public PObject
       const PString & token     ///< Token to identify connection
     );
 
+    /**Find a connection as for FindConnectionWithLock() but return a counted
+       handle instead of locking it. The connection is not deleted while the
+       handle exists, so it may be kept while the connection is locked and
+       unlocked as required. Lookups by call token do not take the endpoint
+       connectionsMutex.
+
+       The handle is empty if no connection was found.
+      */
+    H323ConnectionHandle FindConnectionHandle(
+      const PString & token     ///< Token to identify connection
+    );
+
     /**Get all calls current on the endpoint.
       */
     PStringList GetAllConnections();
 
+    /**Get a snapshot of the media timing histograms of every RTP session
+       of every call current on the endpoint.
+      */
+    void GetMediaStatistics(
+      RTP_MediaStatisticsList & list    ///< List to append snapshots to
+    );
+
+    /**Get the media timing histograms of all calls in the Prometheus text
+       exposition format, suitable for serving from a scrape endpoint.
+      */
+    PString GetMediaStatisticsText();
+
     /**Call back for incoming call.
        This function is called from the OnReceivedSignalSetup() function
        before it sends the Alerting PDU. It gives an opportunity for an
@@ -1111,6 +1157,54 @@ class H323EndPoint : public PObject
        This would not normally be called by an application.
       */
     virtual void CleanUpConnections();
+
+    /**Wait until a pooled cleaner thread should look for connections.
+       Called by the cleaner threads added by SetCleanerThreads(), whichever
+       of them is idle takes the next wake up.
+
+       This would not normally be called by an application.
+      */
+    void WaitForCleanerPoolWakeup();
+
+    /**Set the number of threads tearing down cleared connections.
+       Cleared connections are shared between this many cleaner threads so
+       that when many calls clear at once, eg on a trunk failure, they are
+       torn down concurrently rather than one after the other. The default
+       is one. This must not be called from within a cleaner thread.
+      */
+    void SetCleanerThreads(
+      PINDEX threads         ///< Number of cleaner threads, minimum of one
+    );
+
+    /**Get the number of threads tearing down cleared connections.
+      */
+    PINDEX GetCleanerThreads() const
+    { return cleanerThreads; }
+
+    /**Get the number of cleared connections not yet deleted.
+       This includes connections currently being torn down.
+      */
+    PINDEX GetCleanUpQueueDepth() const;
+
+    /**Get the largest number of cleared connections waiting to be deleted.
+      */
+    PINDEX GetPeakCleanUpQueueDepth() const
+    { return cleanUpPeakDepth; }
+
+    /**Get the total number of connections cleaned up.
+      */
+    unsigned GetConnectionsCleanedUp() const
+    { return cleanUpCount; }
+
+    /**Get the average time taken to tear down and delete a connection.
+      */
+    PTimeInterval GetAverageCleanUpTime() const
+    { return cleanUpCount > 0 ? PTimeInterval(cleanUpTotalTime.GetMilliSeconds()/cleanUpCount) : PTimeInterval(0); }
+
+    /**Get the longest time taken to tear down and delete a connection.
+      */
+    PTimeInterval GetMaximumCleanUpTime() const
+    { return cleanUpMaxTime; }
   //@}
 
   /**@name Caller Authentication */
@@ -1211,6 +1305,20 @@ class H323EndPoint : public PObject
       */
     H235MediaCipher GetH235MediaCipher();
 
+    /** Encrypt outgoing media on a worker thread per channel.
+        The transmit thread queues each frame and returns, the worker
+        encrypts and sends everything queued in one batch. Frames beyond
+        maxQueuedFrames are dropped rather than blocking the transmit
+        thread. Zero (the default) encrypts on the transmit thread.
+      */
+    void SetH235MediaWorker(
+      unsigned maxQueuedFrames    ///< Frames queued per channel, 0 to disable
+    );
+
+    /** Get the maximum number of frames queued for the media encryption worker.
+      */
+    unsigned GetH235MediaWorker() const;
+
     /** H235SetDiffieHellmanFiles Set DH prameters from File (can be multiple file paths seperated by ;)
         Data must be stored in INI format with the section being the OID of the Algorith
         Parameter names are as below and all values are base64 encoded. eg:
@@ -1864,6 +1972,98 @@ class H323EndPoint : public PObject
     PHandleAggregator * GetRTPAggregator();
 #endif
 
+    /**Set the number of threads in the shared media reactor.
+       When non-zero, the sockets of new RTP sessions are serviced by this
+       many shared I/O threads rather than each session selecting on its
+       own sockets. Zero (the default) disables the media reactor unless
+       the shared jitter scheduler is used. This must be set before any
+       calls are made.
+      */
+    void SetMediaReactorThreads(
+      PINDEX threads         ///< Number of reactor I/O threads, zero disables
+    ) { mediaReactorThreads = threads; }
+
+    /**Get the number of threads in the shared media reactor.
+      */
+    PINDEX GetMediaReactorThreads() const
+    { return mediaReactorThreads; }
+
+    /**Get the shared media reactor used for RTP sessions.
+       Returns NULL if the media reactor is disabled.
+      */
+    RTP_MediaReactor * GetMediaReactor();
+
+    /**Set the number of threads in the shared signalling reactor.
+       When ioThreads is non-zero, once a call is set up its H.225 and H.245
+       TCP channels are read by the shared reactor rather than each by its
+       own thread. Received PDUs are dispatched by workerThreads threads,
+       the PDUs of one call in order and on one thread at a time. TLS and
+       tunnelled channels still use a thread each. Zero (the default)
+       disables the signalling reactor. This must be set before any calls
+       are made.
+      */
+    void SetSignallingReactorThreads(
+      PINDEX ioThreads,          ///< Number of socket I/O threads, zero disables
+      PINDEX workerThreads = 4   ///< Number of PDU dispatch threads
+    ) { signallingReactorThreads = ioThreads; signallingReactorWorkers = workerThreads; }
+
+    /**Get the number of I/O threads in the shared signalling reactor.
+      */
+    PINDEX GetSignallingReactorThreads() const
+    { return signallingReactorThreads; }
+
+    /**Get the shared reactor used for signalling channels.
+       Returns NULL if the signalling reactor is disabled.
+      */
+    H323SignalReactor * GetSignallingReactor();
+
+#ifdef H323_AUDIO_CODECS
+    /**Set the flag to service jitter buffers from a shared scheduler.
+       When TRUE, jitter buffers of new RTP sessions are polled from one
+       shared timer wheel thread rather than each having its own jitter
+       thread. The scheduler reads frames queued by the media reactor, so
+       this also starts the reactor, with one thread if
+       SetMediaReactorThreads() has not been called. This must be set before
+       any calls are made.
+      */
+    void UseSharedJitterScheduler(
+      PBoolean enable        ///< Flag to use shared jitter scheduler
+    ) { useJitterScheduler = enable; }
+
+    /**Get the flag to service jitter buffers from a shared scheduler.
+      */
+    PBoolean UsesSharedJitterScheduler() const
+    { return useJitterScheduler; }
+
+    /**Get the shared jitter buffer scheduler.
+       Returns NULL if the shared scheduler is disabled.
+      */
+    RTP_JitterScheduler * GetJitterScheduler();
+
+    /**Set the number of worker threads driven by the shared media clock.
+       When non-zero, audio transmit channels do not each run a thread paced
+       by its audio device. Instead a clock ticks once every packet time and
+       the workers encode and send a packet for every channel with that
+       packet time. The raw channels opened in OpenAudioChannel() for such
+       encoders must then return each frame without waiting, see
+       H323AudioCodec::IsMediaClocked(). Zero (the default) disables the
+       media clock. This must be set before any calls are made.
+      */
+    void SetMediaClockThreads(
+      PINDEX workerThreads   ///< Number of worker threads, zero disables
+    ) { mediaClockThreads = workerThreads; }
+
+    /**Get the number of worker threads driven by the shared media clock.
+      */
+    PINDEX GetMediaClockThreads() const
+    { return mediaClockThreads; }
+
+    /**Get the shared media clock for audio transmit channels.
+       Returns NULL if the media clock is disabled.
+      */
+    H323MediaClock * GetMediaClock();
+#endif
+
 #ifdef H323_SIGNAL_AGGREGATE
     /**Set the signalling aggregation size
       */
@@ -1994,6 +2194,47 @@ class H323EndPoint : public PObject
      */
     PBoolean CanAutoStartTransmitVideo() const { return autoStartTransmitVideo; }
 
+    /**Set the budget transmitted key frames may burst ahead of the video
+       bit rate, in milliseconds worth of the bit rate. Default 0.
+      */
+    void SetVideoKeyFrameBurst(unsigned ms) { videoKeyFrameBurst = ms; }
+
+    /**Get the budget transmitted key frames may burst ahead of the video
+       bit rate.
+      */
+    unsigned GetVideoKeyFrameBurst() const { return videoKeyFrameBurst; }
+
+    /**Set the largest backlog in milliseconds a transmitted video frame may
+       start with before it is dropped. A key frame is then requested from
+       the encoder, at most once a second. Default 0, never drop frames.
+      */
+    void SetVideoMaxPacingDelay(unsigned ms) { videoMaxPacingDelay = ms; }
+
+    /**Get the largest backlog a transmitted video frame may start with.
+      */
+    unsigned GetVideoMaxPacingDelay() const { return videoMaxPacingDelay; }
+
+    /**Set sharing of one plugin encoder between transmit video channels
+       of calls in the same H323Connection::SetSharedVideoGroup() whose
+       negotiated media formats are identical, so a frame is encoded once
+       however many calls view it. Key frame requests from the viewers
+       are merged and forced no more often than the interval. A channel
+       asked to apply flow control goes back to its own encoder.
+       Default FALSE.
+      */
+    void SetSharedVideoEncoding(
+      PBoolean enable,                ///< Share encoders
+      unsigned keyFrameInterval = 1000  ///< Minimum ms between forced key frames
+    ) { sharedVideoEncoding = enable; sharedVideoKeyFrameInterval = keyFrameInterval; }
+
+    /**See if transmit video channels share encoders.
+      */
+    PBoolean UsesSharedVideoEncoding() const { return sharedVideoEncoding; }
+
+    /**Get the minimum interval between key frames forced on a shared encoder.
+      */
+    unsigned GetSharedVideoKeyFrameInterval() const { return sharedVideoKeyFrameInterval; }
+
 #ifdef H323_H239
     /**See if should auto-start receive extended Video channels on connection.
      */
@@ -2715,6 +2956,27 @@ class H323EndPoint : public PObject
       Each call indexes the counter by 1;
      */
     unsigned GetMultiplexID();
+
+   /**Set the number of datagrams read or written per system call on the
+      Multiplex RTP/RTCP sockets. 1 (the default) disables batching.
+      This must be set before any calls are made.
+     */
+    void SetMultiplexBatchSize(PINDEX size) { m_h46019MbatchSize = size; }
+
+   /**Get the number of datagrams read or written per system call on the
+      Multiplex RTP/RTCP sockets.
+     */
+    PINDEX GetMultiplexBatchSize() const { return m_h46019MbatchSize; }
+
+   /**Set the number of reader threads sharing the Multiplex RTP/RTCP ports
+      using SO_REUSEPORT. 1 (the default) uses a single reader thread.
+      This must be set before any calls are made.
+     */
+    void SetMultiplexReaderThreads(PINDEX threads) { m_h46019Mreaders = threads; }
+
+   /**Get the number of reader threads sharing the Multiplex RTP/RTCP ports.
+     */
+    PINDEX GetMultiplexReaderThreads() const { return m_h46019Mreaders; }
 #endif
 
     /**Get the IP Type Of Service byte for RTP channels.
@@ -2958,6 +3220,10 @@ class H323EndPoint : public PObject
     PString     videoChannelRecordDevice;
     PBoolean        autoStartReceiveVideo;
     PBoolean        autoStartTransmitVideo;
+    unsigned        videoKeyFrameBurst;
+    unsigned        videoMaxPacingDelay;
+    PBoolean        sharedVideoEncoding;
+    unsigned        sharedVideoKeyFrameInterval;
 
 #ifdef H323_H239
     PBoolean        autoStartReceiveExtVideo;
@@ -3108,22 +3374,51 @@ class H323EndPoint : public PObject
     PHandleAggregator * signallingAggregator;
 #endif
 
+    PINDEX mediaReactorThreads;
+    RTP_MediaReactor * mediaReactor;
+
+    PINDEX signallingReactorThreads;
+    PINDEX signallingReactorWorkers;
+    H323SignalReactor * signallingReactor;
+
+#ifdef H323_AUDIO_CODECS
+    PBoolean useJitterScheduler;
+    RTP_JitterScheduler * jitterScheduler;
+
+    PINDEX mediaClockThreads;
+    H323MediaClock * mediaClock;
+#endif
+
     PThread::Priority channelThreadPriority;
 
     // Dynamic variables
     H323ListenerList listeners;
     H323Capabilities capabilities;
+    H323CapabilityPDUCache capabilityPDUCache;
     H323Gatekeeper * gatekeeper;
     PString          gatekeeperPassword;
     PStringList      gkAuthenticatorOrder;
 
     H323ConnectionDict       connectionsActive;
+    H323ConnectionRegistry   connectionsRegistry;  // Sharded token lookup of connectionsActive
 
-    PMutex                   connectionsMutex;
+    mutable PMutex           connectionsMutex;
     PMutex                   noMediaMutex;
     PStringSet               connectionsToBeCleaned;
+    PStringSet               connectionsBeingCleaned;
     H323ConnectionsCleaner * connectionsCleaner;
+    std::vector<H323ConnectionsCleaner *> cleanerPool;  // Threads beyond connectionsCleaner
+    PSemaphore               cleanerPoolWakeup;   // Taken by whichever pool thread is idle
+    PINDEX                   cleanerPoolWakeups;  // Posted to cleanerPoolWakeup but not yet taken
+    PINDEX                   cleanerThreads;
     PSyncPoint               connectionsAreCleaned;
+    PINDEX                   cleanUpPeakDepth;
+    unsigned                 cleanUpCount;
+    PTimeInterval            cleanUpTotalTime;
+    PTimeInterval            cleanUpMaxTime;
+
+    void SignalConnectionsCleaner();
+    PBoolean IsConnectionsCleanerThread();
 
     // Call Authentication
     PString EPSecurityUserName;       /// Local UserName Authenticated Call
@@ -3132,6 +3427,9 @@ class H323EndPoint : public PObject
     EPSecurityPolicy CallAuthPolicy;   /// Incoming Call Authentication acceptance level
     H235AuthenticatorList EPAuthList;  /// List of Usernames & Password to check incoming call Against
     PBoolean m_disableMD5Authenticators; /// Disable MD5 based authenticatos (MD5 + CAT)
+#ifdef H323_H235
+    unsigned h235MediaWorkerQueue;     /// Frames queued per channel for the encryption worker, 0 for none
+#endif
 
 #ifdef H323_H460
     H460_FeatureSet features;
@@ -3150,6 +3448,8 @@ class H323EndPoint : public PObject
 #ifdef H323_H46019M
     PBoolean m_h46019Menabled;
     PBoolean m_h46019Msend;
+    PINDEX   m_h46019MbatchSize;
+    PINDEX   m_h46019Mreaders;
 #endif
 
 #ifdef H323_H46023
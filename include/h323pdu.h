@@ -168,6 +168,13 @@ class H323SignalPDU : public H225_H323_UserInformation
       ostream & strm
     ) const;
 
+    /**Decode the PDU, using a per message arena if enabled.
+       See H323PDUArena.
+      */
+    virtual PBoolean Decode(
+      PASN_Stream & strm    ///< Stream to decode from
+    );
+
     /**Read PDU from the specified transport.
       */
     PBoolean Read(
@@ -206,6 +213,59 @@ class H323SignalPDU : public H225_H323_UserInformation
       */
     void BuildQ931();
 
+    /**Set lazy decoding of the H.225 User-User IE.
+       When set, Read() and ProcessReadData() only decode the Q.931 message
+       and the h323_message_body tag, the rest of the H.225 part is decoded
+       on the first call to DecodeUUIE(). Until then Write() and BuildQ931()
+       keep the received User-User IE unchanged, so a forwarded PDU costs no
+       PER decode or encode. The H.225 fields are left empty until then, and
+       setting any of them before DecodeUUIE() asserts in Write() and
+       BuildQ931(), as the change would not be sent. Note fastStart and
+       h245Control elements are always left encoded as octet strings until
+       the connection uses them.
+      */
+    void SetLazyDecode(
+      PBoolean lazy   ///< Flag to defer the User-User IE decode
+    ) { lazyDecode = lazy; }
+
+    /**Get flag for lazy decoding of the H.225 User-User IE.
+      */
+    PBoolean IsLazyDecode() const { return lazyDecode; }
+
+    /**Decode the H.225 User-User IE if it was deferred by lazy decoding.
+       This must be called before accessing the H.225 fields of a lazily
+       read PDU. Returns FALSE if the decode failed.
+      */
+    PBoolean DecodeUUIE();
+
+    /**Indicate the H.225 fields of the PDU are decoded.
+      */
+    PBoolean IsUUIEDecoded() const { return uuieDecoded; }
+
+    /**Get the h323_message_body tag.
+       This is available before the User-User IE is decoded.
+      */
+    unsigned GetUUIETag() const;
+
+    /**Get the call identifier of the message.
+       If the User-User IE has not been decoded, the message body alone is
+       decoded and the PDU is left as received, so it can be routed on the
+       call and still forwarded without a PER encode. The body is decoded
+       once and kept for later peeks and for DecodeUUIE().
+       Returns FALSE if the message has no call identifier.
+      */
+    PBoolean PeekCallIdentifier(
+      H225_CallIdentifier & callIdentifier    ///< Call identifier of message
+    ) const;
+
+    /**Get the conference identifier of the message.
+       This decodes as for PeekCallIdentifier(). Returns FALSE if the message
+       has no conference identifier.
+      */
+    PBoolean PeekConferenceID(
+      H225_ConferenceIdentifier & conferenceID  ///< Conference identifier of message
+    ) const;
+
     /**Get the source alias names for the remote endpoint.
        This returns a human readable set of names that was provided by the
        remote endpoint to identify it, eg phone number, display name etc etc
@@ -296,6 +356,21 @@ class H323SignalPDU : public H225_H323_UserInformation
     // Even though we generally deal with the H323 protocol (H225) it is
     // actually contained within a field of the Q931 protocol.
     Q931 q931pdu;
+
+    PBoolean PeekUUIETag();
+    PBoolean PeekMessageBody() const;
+    PBoolean DecodePeekedUUIE(PPER_Stream & strm);
+    PBoolean KeepReceivedUUIE() const;
+
+    PBoolean lazyDecode;
+    PBoolean uuieDecoded;
+    unsigned uuieTag;
+
+    // Body decoded by the first peek, and the User-User IE stream left just
+    // after it, so DecodeUUIE() only decodes the fields that follow.
+    mutable PBoolean bodyPeeked;
+    mutable H225_H323_UU_PDU_h323_message_body peekedBody;
+    mutable PPER_Stream peekedStrm;
 };
 
 
@@ -308,6 +383,13 @@ class H323ControlPDU : public H245_MultimediaSystemControlMessage
   PCLASSINFO(H323ControlPDU, H245_MultimediaSystemControlMessage);
 
   public:
+    /**Decode the PDU, using a per message arena if enabled.
+       See H323PDUArena.
+      */
+    virtual PBoolean Decode(
+      PASN_Stream & strm    ///< Stream to decode from
+    );
+
     H245_RequestMessage    & Build(H245_RequestMessage   ::Choices request);
     H245_ResponseMessage   & Build(H245_ResponseMessage  ::Choices response);
     H245_CommandMessage    & Build(H245_CommandMessage   ::Choices command);
@@ -429,6 +511,9 @@ class H323RasPDU : public H225_RasMessage, public H323TransactionPDU
     // overrides from PObject
     virtual PObject * Clone() const;
 
+    // overrides from PASN_Object, uses a per message arena if enabled
+    virtual PBoolean Decode(PASN_Stream & strm);
+
     // overrides from H323TransactionPDU
     virtual PASN_Object & GetPDU();
     virtual PASN_Choice & GetChoice();
@@ -64,6 +64,73 @@ class H323PluginCodecManager : public PPluginModuleManager
 
     static void CodecListing(const PString & matchStr, PStringList & listing);
 
+  /**@name Codec context pool */
+  //@{
+    /**Get a context for the plugin codec, reusing an idle one from the pool
+       if there is one. The caller applies its own media format options.
+      */
+    static void * AcquireContext(
+      PluginCodec_Definition * codec   ///< Plugin codec definition
+    );
+
+    /**Return a context obtained from AcquireContext(). If pooling is enabled
+       for the codec and its free list is not full, the context is reset with
+       the reset_codec control and kept for the next call, otherwise it is
+       destroyed.
+      */
+    static void ReleaseContext(
+      PluginCodec_Definition * codec,  ///< Plugin codec definition
+      void * context                   ///< Context to return
+    );
+
+    /**Set the codec context pool. Up to maxIdle contexts of each codec
+       enabled with SetContextPooling() are kept for reuse. A timer destroys
+       them once they have been idle for longer than the timeout. A maxIdle
+       of 0, the default, keeps only pre-warmed contexts.
+      */
+    static void SetContextPool(
+      PINDEX maxIdle,                                        ///< Idle contexts kept per codec
+      const PTimeInterval & idleTimeout = PTimeInterval(0, 60) ///< Time before an idle context is destroyed
+    );
+
+    /**Enable or disable pooling of the encoder and decoder contexts of the
+       media format. Pooling is off for every codec until enabled here. It
+       is only possible for plugins that provide the reset_codec control,
+       which returns a used context to its just created state. Returns FALSE
+       if the media format is not from a plugin codec, or when enabling if
+       neither of its codecs can be reset.
+      */
+    static PBoolean SetContextPooling(
+      const PString & mediaFormat,     ///< Media format name
+      PBoolean enable = TRUE           ///< Pool contexts of the format
+    );
+
+    /**Create idle contexts for the encoder and decoder of the media format,
+       so early calls do not pay for creating them. The pre-warmed count is
+       also kept as the minimum the idle timeout evicts down to. Returns
+       FALSE if pooling is not enabled for the media format.
+      */
+    static PBoolean PrewarmContexts(
+      const PString & mediaFormat,     ///< Media format name
+      PINDEX count                     ///< Contexts to create for each direction
+    );
+
+    /**Destroy the idle contexts that have timed out, or all of them.
+      */
+    static void EvictIdleContexts(
+      PBoolean all = FALSE             ///< Ignore the timeout and pre-warm minimum
+    );
+
+    /**Get the number of idle contexts and how many acquisitions were served
+       from the pool and how many had to create a context.
+      */
+    static void GetContextPoolStatistics(
+      PINDEX & idle,                   ///< Idle contexts over all codecs
+      unsigned & hits,                 ///< Acquisitions reusing a context
+      unsigned & misses                ///< Acquisitions creating a context
+    );
+  //@}
+
     virtual void OnShutdown();
 
     static void Bootstrap();
@@ -39,6 +39,13 @@
 
 #include <ptclib/asner.h>
 
+#include <deque>
+#include <map>
+#include <vector>
+
+
+class H323Transaction;
+
 
 class H323TransactionPDU {
   public:
@@ -179,6 +186,60 @@ class H323Transactor : public PObject
       const H323TransportAddressArray & addresses,
       PBoolean callback = TRUE
     );
+
+    /**Set the number of threads used to handle received requests.
+       By default every PDU is read and handled on the single listener
+       thread. With dispatch threads, PDUs for which GetDispatchKey() returns
+       TRUE are handed to the thread selected by a hash of the key, so PDUs
+       with the same key are still handled in the order received. Responses
+       to requests made by this transactor are always handled on the
+       listener thread.
+
+       With slow handler threads, transactions that have sent a RIP are
+       queued to a fixed pool rather than starting a thread each.
+
+       Setting both to zero returns to the single threaded behaviour.
+      */
+    void SetDispatchThreads(
+      unsigned threads,           ///<  Number of threads handling requests
+      unsigned slowThreads = 4    ///<  Number of threads handling slow requests
+    );
+
+    /**Get the number of threads used to handle received requests.
+      */
+    unsigned GetDispatchThreads() const { return dispatchThreadCount; }
+
+    /**Get the number of threads used to handle slow requests.
+      */
+    unsigned GetSlowHandlerThreads() const { return slowThreadCount; }
+
+    /**Determine if the PDU may be handled on a dispatch thread.
+       The key selects the thread, PDUs with the same key are handled in
+       order. The default behaviour returns FALSE, handling all PDUs on the
+       listener thread.
+      */
+    virtual PBoolean GetDispatchKey(
+      const H323TransactionPDU & pdu,   ///<  PDU received
+      PString & key                     ///<  Key to dispatch PDU on
+    ) const;
+
+    /**Get the address the PDU being handled was received from.
+       On a dispatch thread this is the source of the PDU given to that
+       thread, otherwise it is the last address read by the transport.
+      */
+    H323TransportAddress GetLastReceivedAddress() const;
+
+    /**Queue a transaction to the slow handler thread pool.
+       Returns FALSE if there is no pool, the caller must then start its own
+       thread. The transaction is deleted when it is complete.
+      */
+    PBoolean QueueSlowTransaction(
+      H323Transaction * transaction
+    );
+
+    /**Get the number of responses held for retransmission.
+      */
+    PINDEX GetCachedResponseCount() const;
   //@}
 
   /**@name Member variable access */
@@ -296,7 +357,51 @@ class H323Transactor : public PObject
         PTime                lastUsedTime;
         PTimeInterval        retirementAge;
         H323TransactionPDU * replyPDU;
+
+        // Maintained by the ResponseCache
+        unsigned   hash;
+        time_t     retireTime;
+        Response * next;
+    };
+
+    // Chained hash table of cached responses, retired from one second
+    // buckets of expiry time so aging only looks at what is due.
+    class ResponseCache {
+      public:
+        ResponseCache();
+        ~ResponseCache();
+        Response * Find(const PString & key) const;
+        void Add(Response * response);
+        void Touch(Response * response);
+        PINDEX Age(const PTime & now);
+        PINDEX GetSize() const { return count; }
+        static unsigned Hash(const PString & key);
+      protected:
+        void Remove(Response * response);
+        void Grow();
+        std::vector<Response *> buckets;
+        std::map<time_t, std::vector<PString> > retirements;
+        PINDEX count;
+    };
+
+    struct DispatchJob {
+      H323TransactionPDU   * pdu;
+      H323TransportAddress   address;
+      H323Transaction      * transaction;
     };
+    class DispatchQueue;
+    class DispatchThread;
+    friend class DispatchThread;
+
+    void StartDispatchThreads();
+    void StopDispatchThreads();
+    PBoolean QueueDispatch(
+      H323TransactionPDU * pdu,
+      const PString & key
+    );
+    void HandleDispatch(
+      DispatchJob & job
+    );
 
     // Configuration variables
     H323EndPoint  & endpoint;
@@ -312,8 +417,15 @@ class H323Transactor : public PObject
     PMutex                            requestsMutex;
     Request                         * lastRequest;
 
-    PMutex                pduWriteMutex;
-    PSortedList<Response> responses;
+    mutable PMutex        pduWriteMutex;
+    ResponseCache         responses;
+
+    unsigned                      dispatchThreadCount;
+    unsigned                      slowThreadCount;
+    std::vector<DispatchQueue *>  dispatchQueues;
+    DispatchQueue               * slowQueue;
+    std::vector<DispatchThread *> dispatchThreads;
+    PMutex                        dispatchMutex;
 };
 
 
@@ -369,6 +481,7 @@ class H323Transaction : public PObject
     PBoolean IsFastResponseRequired() const { return fastResponseRequired && canSendRIP; }
     PBoolean CanSendRIP() const { return canSendRIP; }
     H323TransportAddress GetReplyAddress() const { return replyAddresses[0]; }
+    const H323TransportAddress & GetReceivedAddress() const { return receivedAddress; }
     const H323TransportAddressArray & GetReplyAddresses() const { return replyAddresses; }
     PBoolean IsBehindNAT() const { return isBehindNAT; }
     H323Transactor & GetTransactor() const { return transactor; }
@@ -379,6 +492,7 @@ class H323Transaction : public PObject
     PDECLARE_NOTIFIER(PThread, H323Transaction, SlowHandler);
 
     H323Transactor         & transactor;
+    H323TransportAddress      receivedAddress;
     H323TransportAddressArray replyAddresses;
     PBoolean                     fastResponseRequired;
     H323TransactionPDU     * request;
@@ -389,6 +503,8 @@ class H323Transaction : public PObject
     H235Authenticator::ValidationResult authenticatorResult;
     PBoolean                                isBehindNAT;
     PBoolean                                canSendRIP;
+
+  friend class H323Transactor;
 };
 
 
@@ -483,11 +599,23 @@ class H323TransactionServer : public PObject
     );
 
     PBoolean SetUpCallSignalAddresses(H225_ArrayOf_TransportAddress & addresses);
+
+    /**Set the number of request dispatch and slow handler threads used by
+       each listener, see H323Transactor::SetDispatchThreads().
+       Applies to existing listeners and those added later.
+      */
+    void SetDispatchThreads(
+      unsigned threads,           ///<  Number of threads handling requests
+      unsigned slowThreads = 4    ///<  Number of threads handling slow requests
+    );
   //@}
 
   protected:
     H323EndPoint & ownerEndPoint;
 
+    unsigned dispatchThreads;
+    unsigned slowHandlerThreads;
+
     PThread      * monitorThread;
     PSyncPoint     monitorExit;
 
@@ -49,6 +49,8 @@
 #endif // _MSC_VER > 1000
 
 #include "h323pdu.h"
+#include <list>
+#include <vector>
 
 class H46018SignalPDU  : public H323SignalPDU
 {
@@ -227,6 +229,47 @@ typedef std::map<unsigned, PUDPSocket*> muxSocketMap;
 typedef std::map<PString, unsigned> muxPortMap;
 
 class H46019MultiplexSocket;
+
+/** Flat multiplexID to socket lookup table.
+    Built from a socket map each time a socket is registered or removed and
+    never changed afterwards, so the multiplex reader threads can use it
+    without taking the multiplex mutex.
+  */
+class H46019MultiplexTable
+{
+  public:
+    H46019MultiplexTable(const muxSocketMap & socMap);
+    ~H46019MultiplexTable();
+
+    /** Find the socket for the multiplexID, NULL if not registered
+      */
+    PUDPSocket * Find(unsigned id) const;
+
+  protected:
+    struct Slot {
+      unsigned     id;
+      PUDPSocket * socket;
+    };
+    Slot *   m_slots;
+    unsigned m_mask;
+
+  private:
+    H46019MultiplexTable(const H46019MultiplexTable &);
+    H46019MultiplexTable & operator=(const H46019MultiplexTable &);
+};
+
+/** Datagram received on a multiplex socket
+  */
+struct H46019MultiplexDatagram {
+  H46019MultiplexDatagram() : length(0), port(0) { }
+
+  enum { MaxSize = 2000 };
+
+  RTP_FrameSlice     frame;     ///< Pooled receive buffer, handed on to the session without copying
+  PINDEX             length;
+  PIPSocket::Address addr;
+  WORD               port;
+};
 #endif
 
 class PNatMethod_H46019  : public H323NatMethod
@@ -335,6 +378,10 @@ class PNatMethod_H46019  : public H323NatMethod
       */
     void StartMultiplexListener();
 
+    /** Maximum number of multiplex reader threads
+      */
+    enum { MaxMultiplexReaders = 16 };
+
 #endif
 
     /**  OpenSocket
@@ -430,6 +477,28 @@ protected:
     static PMutex                        muxMutex;
     PThread *                            m_readThread;
     PDECLARE_NOTIFIER(PThread, PNatMethod_H46019, ReadThread);
+
+    static void OnMultiplexPacket(bool rtp, H46019MultiplexDatagram & datagram, const H46019MultiplexTable * table);
+
+    // Batched and sharded multiplex reading
+    static PINDEX                        muxBatchSize;
+    static PINDEX                        muxReaders;
+    static std::vector<H323Connection::NAT_Sockets> muxShards;
+    static std::vector<PThread *>        muxReadThreads;
+
+    static PBoolean OpenMultiplexShards(const PIPSocket::Address & binding);
+    static void CloseMultiplexSockets();
+    static PUDPSocket * GetShardReadSocket(PINDEX shard, bool rtp);
+
+    // Lock free multiplexID lookup, see H46019MultiplexTable
+    static H46019MultiplexTable * volatile rtpMuxTable;
+    static H46019MultiplexTable * volatile rtcpMuxTable;
+    static H46019MultiplexTable * volatile muxHazards[MaxMultiplexReaders*2];
+    static std::list<H46019MultiplexTable *> muxRetired;
+
+    static void PublishMultiplexTable(bool rtp);
+    static const H46019MultiplexTable * AcquireMultiplexTable(bool rtp, PINDEX shard);
+    static void ReleaseMultiplexTable(bool rtp, PINDEX shard);
 #endif
 
 };
@@ -447,7 +516,7 @@ protected:
 struct  H46019MultiPacket {
   PIPSocket::Address fromAddr;
   WORD               fromPort;
-  PBYTEArray         frame;
+  RTP_FrameSlice     frame;
 };
 
 typedef std::queue<H46019MultiPacket> H46019MultiQueue;
@@ -493,6 +562,15 @@ class H46019MultiplexSocket : public H323UDPSocket
       WORD port           ///< Port to which the datagram is sent.
     );
 
+    /**Write a pooled frame to a remote computer.
+       When batching the frame is queued by reference rather than copied.
+     */
+    PBoolean WriteFrame(
+      const RTP_FrameSlice & frame, ///< Frame to send
+      const Address & addr,         ///< Address to which the datagram is sent.
+      WORD port                     ///< Port to which the datagram is sent.
+    );
+
     virtual PBoolean Close();
 
     PString GetLocalAddress();
@@ -500,12 +578,54 @@ class H46019MultiplexSocket : public H323UDPSocket
 
     PUDPSocket * & GetSubSocket()  { return m_subSocket; }
 
+    /**Set the socket to be bound with SO_REUSEPORT so several sockets, each
+       serviced by its own reader thread, can share the multiplex port.
+       Must be called before the socket is opened.
+      */
+    void SetReusePort(PBoolean reuse) { m_reusePort = reuse; }
+
+    /**Set the number of datagrams combined into one system call by the
+       multiplex reader and by WriteTo(). A size of 1 disables batching.
+      */
+    void SetBatchSize(PINDEX size);
+
+    /**Get the number of datagrams combined into one system call.
+      */
+    PINDEX GetBatchSize() const { return m_batchSize; }
+
+    /**Maximum number of datagrams in one batch
+      */
+    enum { MaxBatchSize = 64 };
+
+    /**Read the datagrams waiting on a multiplex socket, up to count, with
+       one system call where batching is available. Returns the number read,
+       zero if none were waiting or -1 on error with the error number set.
+      */
+    static PINDEX ReadBatch(
+      PUDPSocket & socket,                 ///< Socket to read from
+      H46019MultiplexDatagram * datagrams, ///< Datagrams to read into
+      PINDEX count,                        ///< Number of datagrams
+      int & error                          ///< Error number on failure
+    );
+
+  protected:
+    virtual PBoolean OpenSocket();
+    virtual PBoolean OpenSocket(int ipAdressFamily);
+    PBoolean ApplyReusePort();
+
+    PBoolean WriteQueued();
+
   private:
 
     PUDPSocket              *  m_subSocket;
     MuxType                    m_plexType;
     PMutex                     m_mutex;
 
+    PBoolean                   m_reusePort;
+    PINDEX                     m_batchSize;
+    PMutex                     m_queueMutex;
+    H46019MultiQueue           m_writeQueue;   ///< Packets waiting to be sent, fromAddr is the destination
+
 };
 #endif
 
@@ -595,6 +715,12 @@ class H46019UDPSocket : public H323UDPSocket
               WORD port             ///< Port to which the datagram is sent.
            );
 
+    PBoolean WriteMultiplexBuffer(
+              const RTP_FrameSlice & frame, ///< Data to be queued, shared not copied.
+              const Address & addr,         ///< Address to which the datagram is sent.
+              WORD port                     ///< Port to which the datagram is sent.
+           );
+
     PBoolean ReadMultiplexBuffer(
               void * buf,     ///< Data to be written.
               PINDEX & len,   ///< Number of bytes pointed to by #buf#.
@@ -40,6 +40,7 @@
 
 #include <h460/h46026.h>
 #include <queue>
+#include <deque>
 #include <vector>
 #include <map>
 
@@ -57,10 +58,19 @@ public:
     PINDEX GetSize();
     PINDEX GetPacketCount();
 
+    /* Media type of the frames, used when flushed on the latency budget */
+    void SetType(int type) { m_type = type; }
+    int GetType() const { return m_type; }
+
+    /* Tick time in ms of the first frame in the buffer */
+    PInt64 GetFirstFrameTime() const { return m_firstTime; }
+
 protected:
     PINDEX m_size;
     H46026_UDPFrame m_data;
     PBoolean m_rtp;
+    int m_type;
+    PInt64 m_firstTime;
 };
 
 
@@ -94,6 +104,8 @@ public:
 typedef std::priority_queue< std::pair<PBYTEArray, socketOrder::MessageHeader >, 
         std::vector< std::pair<PBYTEArray, socketOrder::MessageHeader> >, socketOrder > H46026SocketQueue;
 
+typedef std::deque< std::pair<PBYTEArray, socketOrder::MessageHeader> > H46026SocketFifo;
+
 typedef std::map<int,H46026UDPBuffer*> H46026CallMap;
 typedef std::map<unsigned, H46026CallMap >  H46026RTPBuffer;
 
@@ -131,6 +143,14 @@ public:
     /* Set the pipe bandwidth Default is 384k */
     void SetPipeBandwidth(unsigned bps);
 
+    /* Set the latency budget in ms for packing the RTP frames of a session
+       into one message. The frames are sent when the first has waited this
+       long, or earlier when the audio frame count, video picture end or
+       payload size rules apply. Default 0 uses those rules only.
+     */
+    void SetLatencyBudget(unsigned ms);
+    unsigned GetLatencyBudget() const { return m_latencyBudget; }
+
     /** Clear Buffers */
     /* Call this is clear the channel buffers at the end of a call */
     /* This MUST be called at the end of a call */
@@ -169,11 +189,18 @@ public:
             True: data has been copied and ready to send on the wire.
             False: there is no data or data is not ready.
         WARNING: This function does not block and returns immediately if false.
-        Best practise would be to call from a threaded loop and use PThread::Sleep
+        A writer thread should use WaitSocketOut() instead.
      */
     PBoolean SocketOut(BYTE * data, PINDEX & len);
     PBoolean SocketOut(PBYTEArray & data, PINDEX & len);
 
+    /* Wait up to the timeout for a message to send to the socket.
+        Unlike SocketOut() this blocks until a message has been queued and
+        the pipe bandwidth allows it to be sent. The queued buffer is
+        returned without copying, already framed with a RFC1006 TPKT header.
+     */
+    PBoolean WaitSocketOut(PBYTEArray & packet, const PTimeInterval & timeout);
+
     /* Receiving from the socket */
     /* Process an incoming message from the socket.
         Returns false if message could not be handled or decoded into Q931.
@@ -191,19 +218,32 @@ protected:
 
     PBoolean ProcessQueue();
 
+    /* Send the RTP buffers whose latency budget has expired, returns the
+       ms until the next one expires or -1 if none is waiting.
+     */
+    PInt64 FlushExpired(PInt64 nowTime);
+
+    /* Take the next message from the queues if the pipe allows, returns
+       the ms to wait in wait when the pipe is busy.
+     */
+    PBoolean PopPacket(PInt64 nowTime, PBYTEArray & packet, PInt64 & wait);
+
     unsigned NextPacketCounter();
 
 private:
     double                     m_mbps;
     PBoolean                   m_socketPacketReady;
-    PInt64                     m_currentPacketTime;
+    double                     m_currentPacketTime;
     unsigned                   m_pktCounter;
+    unsigned                   m_latencyBudget;
 
     H225_H323_UserInformation  m_uuie;
     H46026RTPBuffer            m_rtpBuffer;
     PMutex                     m_writeMutex;
-    H46026SocketQueue          m_socketQueue;
+    H46026SocketFifo           m_socketQueue[socketOrder::Priority_Low+1];  // Indexed by priority
+    PINDEX                     m_socketQueueSize;
     PMutex                     m_queueMutex;
+    PSyncPoint                 m_socketReady;
 };
 
 
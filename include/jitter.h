@@ -40,17 +40,31 @@
 
 #include "rtp.h"
 
+#include <list>
+
 class RTP_JitterBufferAnalyser;
 class RTP_AggregatedHandle;
+class RTP_JitterScheduler;
 
 ///////////////////////////////////////////////////////////////////////////////
 
+/**Jitter buffer between the RTP transport and the codec.
+
+   All frames are allocated when the buffer is created. Frames read from the
+   transport are handed to the codec side through a lock free single
+   producer, single consumer queue and returned the same way, so the reading
+   side never waits on ReadData() while media is flowing.
+
+   The reading side is either a dedicated thread per buffer, an RTP handle
+   aggregator, or a shared RTP_JitterScheduler polling many buffers.
+  */
 class RTP_JitterBuffer : public PObject
 {
   PCLASSINFO(RTP_JitterBuffer, PObject);
 
   public:
     friend class RTP_AggregatedHandle;
+    friend class RTP_JitterScheduler;
 
     RTP_JitterBuffer(
       RTP_Session & session,   ///<  Associated RTP session tor ead data from
@@ -95,7 +109,7 @@ class RTP_JitterBuffer : public PObject
 
     /**Get total number received packets that overran the jitter buffer.
       */
-    DWORD GetBufferOverruns() const { return bufferOverruns; }
+    DWORD GetBufferOverruns() const { return bufferOverruns + readerOverruns; }
 
     /**Get maximum consecutive marker bits before buffer starts to ignore them.
       */
@@ -113,17 +127,29 @@ class RTP_JitterBuffer : public PObject
 #endif
       );
 
+    /**Have the reading side of the buffer serviced by a shared scheduler
+       rather than a thread of its own. The session must be able to read
+       without blocking, see RTP_Session::CanReadDataNoWait().
+      */
+    PBoolean Schedule(
+      RTP_JitterScheduler & scheduler,  ///<  Scheduler to service buffer
+      unsigned pollPeriod               ///<  Milliseconds between polls
+    );
+
     PDECLARE_NOTIFIER(PThread, RTP_JitterBuffer, JitterThreadMain);
 
   protected:
     //virtual void Main();
 
-    class Entry : public RTP_DataFrame
+    // Frame memory comes from RTP_FramePool::Default() so buffers are
+    // reused as calls come and go.
+    class Entry : public RTP_PooledDataFrame
     {
       public:
         Entry * next;
         Entry * prev;
         PTimeInterval tick;
+        PInt64   received;  // RTP_MediaStatistics::GetTime() when queued
     };
 
     RTP_Session & session;
@@ -147,13 +173,27 @@ class RTP_JitterBuffer : public PObject
     PBoolean     doJitterReductionImmediately;
     PBoolean     doneFreeTrash;
 
+    // Frame pool, all frames are allocated up front
+    Entry  * framePool;
+    PINDEX   framePoolSize;
+    Entry  * overrunFrame;
+
+    // Frames passed from the reading side to ReadData() and back again
+    H323SPSCQueue<Entry *> receivedFrames;
+    H323SPSCQueue<Entry *> freeFrames;
+
+    // Owned by ReadData()
     Entry * oldestFrame;
     Entry * newestFrame;
-    Entry * freeFrames;
     Entry * currentWriteFrame;
 
+    // Owned by the reading side
+    unsigned readerOverruns;
+    unsigned consecutiveReaderOverruns;
+    volatile PBoolean flushRequested;
+
     PMutex bufferMutex;
-    PBoolean   shuttingDown;
+    volatile PBoolean shuttingDown;
     PBoolean   preBuffering;
     PBoolean   doneFirstWrite;
 
@@ -162,14 +202,96 @@ class RTP_JitterBuffer : public PObject
     PThread * jitterThread;
     PINDEX    jitterStackSize;
 
+    RTP_JitterScheduler * scheduler;
+    unsigned schedulePeriod;
+    volatile PBoolean scheduled;
+    Entry * scheduledReadFrame;
+    PBoolean scheduledMarkerWarning;
+
 #ifdef H323_RTP_AGGREGATE
     RTP_AggregatedHandle * aggregratedHandle;
 #endif
 
+    void AllocateFrames(PINDEX size);
+    void ReleaseFrame(Entry * frame);
+    void ReceiveFrames();
+    PBoolean IsReaderRunning() const;
+
     PBoolean Init(Entry * & currentReadFrame, PBoolean & markerWarning);
     PBoolean PreRead(Entry * & currentReadFrame, PBoolean & markerWarning);
     PBoolean OnRead(Entry * & currentReadFrame, PBoolean & markerWarning, PBoolean loop);
     void DeInit(Entry * & currentReadFrame, PBoolean & markerWarning);
+    void QueueFrame(Entry * & currentReadFrame, PBoolean & markerWarning);
+    void PlayFrame(RTP_DataFrame & frame);
+    PBoolean OnPoll();
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**Shared playout scheduler for jitter buffers.
+   A single thread runs a hashed timer wheel, polling the transport side of
+   every registered jitter buffer at its own period, instead of each receive
+   stream having a jitter thread blocked on its sockets.
+
+   The scheduler only takes frames already queued by the RTP_MediaReactor,
+   it never selects on a session's sockets itself. Sessions that cannot be
+   attached to the reactor (tunnelled media, NAT method sockets) keep a
+   jitter thread of their own.
+  */
+class RTP_JitterScheduler : public PObject
+{
+  PCLASSINFO(RTP_JitterScheduler, PObject);
+
+  public:
+    RTP_JitterScheduler(
+      unsigned tickTime = 5,   ///<  Timer wheel resolution in milliseconds
+      PINDEX stackSize = 30000 ///<  Stack size for scheduler thread
+    );
+    ~RTP_JitterScheduler();
+
+    /**Add a jitter buffer to be polled every period milliseconds.
+      */
+    void Add(
+      RTP_JitterBuffer & buffer,   ///<  Jitter buffer to poll
+      unsigned period              ///<  Poll period in milliseconds
+    );
+
+    /**Remove a jitter buffer. On return the buffer is not being polled.
+      */
+    void Remove(
+      RTP_JitterBuffer & buffer    ///<  Jitter buffer to remove
+    );
+
+    /**Get the number of jitter buffers being serviced.
+      */
+    PINDEX GetBufferCount() const;
+
+  protected:
+    PDECLARE_NOTIFIER(PThread, RTP_JitterScheduler, SchedulerMain);
+
+    void Insert(RTP_JitterBuffer * buffer, unsigned periodTicks, unsigned fromSlot);
+
+    enum { WheelSlots = 64 };
+
+    struct Timer {
+      RTP_JitterBuffer * buffer;
+      unsigned           periodTicks;
+      unsigned           rounds;
+    };
+    typedef std::list<Timer> TimerList;
+
+    PBoolean Unlink(TimerList * lists, PINDEX count, RTP_JitterBuffer & buffer);
+
+    TimerList  wheel[WheelSlots];
+    TimerList  polling;
+    unsigned   currentSlot;
+    unsigned   tickTime;
+    PINDEX     bufferCount;
+    PMutex     mutex;
+    PMutex     pollMutex;
+    PThread  * thread;
+    PBoolean   shutdown;
 };
 
 #endif // __OPAL_JITTER_H
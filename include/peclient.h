@@ -41,6 +41,9 @@
 
 #include <ptlib/safecoll.h>
 
+#include <map>
+#include <vector>
+
 
 class H323PeerElement;
 
@@ -211,6 +214,111 @@ class H323PeerElementDescriptor : public PSafeObject
 };
 
 
+////////////////////////////////////////////////////////////////
+
+/**Compiled index of the patterns in the descriptor address templates.
+   E.164 patterns are kept in a digit trie: specific and wildcard patterns
+   on the node for their digits, ranges on the node for the common prefix
+   of both ends, so a lookup only visits the nodes along the dialled number.
+   Other aliases are matched exactly. The index has its own lock, lookups do
+   not lock the descriptor list.
+  */
+class H323PeerElementPatternIndex : public PObject
+{
+  PCLASSINFO(H323PeerElementPatternIndex, PObject);
+  public:
+    H323PeerElementPatternIndex();
+    ~H323PeerElementPatternIndex();
+
+    enum MatchTypes {
+      SpecificMatch,
+      RangeMatch,
+      WildcardMatch
+    };
+
+    struct Match {
+      Match(const OpalGloballyUniqueID & _id, PINDEX _pos, MatchTypes _type)
+        : id(_id), pos(_pos), type(_type) { }
+
+      OpalGloballyUniqueID id;   ///< Descriptor ID
+      PINDEX pos;                ///< Address template in descriptor
+      MatchTypes type;           ///< Kind of pattern matched
+    };
+    typedef std::vector<Match> MatchList;
+
+    /**Add the patterns of a descriptor's address templates.
+      */
+    void Add(
+      const OpalGloballyUniqueID & id,                  ///< Descriptor ID
+      const H501_ArrayOf_AddressTemplate & templates    ///< Address templates
+    );
+
+    /**Remove the patterns of a descriptor's address templates.
+      */
+    void Remove(
+      const OpalGloballyUniqueID & id,                  ///< Descriptor ID
+      const H501_ArrayOf_AddressTemplate & templates    ///< Address templates
+    );
+
+    /**Remove all patterns.
+      */
+    void RemoveAll();
+
+    /**Find the descriptors with a pattern matching the alias.
+       Matches are returned specific first, then ranges and then wildcards,
+       each from the longest prefix to the shortest.
+       Returns FALSE if nothing matched.
+      */
+    PBoolean Lookup(
+      const H225_AliasAddress & alias,   ///< Alias to find
+      MatchList & matches                ///< Matching descriptors
+    ) const;
+
+    /**Get the number of patterns in the index.
+      */
+    PINDEX GetSize() const { return patternCount; }
+
+  protected:
+    enum { NumDigits = 13 };   // 0-9 * # ,
+
+    struct Range {
+      Range(const PString & _start, const PString & _end, const Match & _match)
+        : start(_start), end(_end), match(_match) { }
+
+      PString start;
+      PString end;
+      Match match;
+    };
+
+    struct Node {
+      Node();
+      ~Node();
+      PBoolean IsEmpty() const;
+
+      Node * children[NumDigits];
+      MatchList specific;
+      MatchList wildcard;
+      std::vector<Range> ranges;
+    };
+
+    static int DigitIndex(char c);
+    static PString GetE164(const H225_PartyNumber & number);
+    static PString GetKey(const H225_AliasAddress & alias);
+    static void RemoveMatch(MatchList & list, const OpalGloballyUniqueID & id, PINDEX pos);
+
+    Node * GetNode(const PString & digits, PBoolean create);
+    void PruneNode(const PString & digits);
+    void AddPattern(const H501_Pattern & pattern, const Match & match);
+    void RemovePattern(const H501_Pattern & pattern, const OpalGloballyUniqueID & id, PINDEX pos);
+
+    mutable PReadWriteMutex mutex;
+    Node root;
+    std::map<PString, MatchList> specificAliases;
+    std::map<PString, MatchList> wildcardAliases;
+    PINDEX patternCount;
+};
+
+
 ////////////////////////////////////////////////////////////////
 
 class H323PeerElementServiceRelationship : public PSafeObject
@@ -377,6 +485,19 @@ class H323PeerElement : public H323_AnnexG
     PBoolean DeleteDescriptor(const H225_AliasAddress & alias, PBoolean now = FALSE);
     PBoolean DeleteDescriptor(const OpalGloballyUniqueID & descriptorID, PBoolean now = FALSE);
 
+    /**Find the descriptors whose patterns match an alias using the compiled
+       pattern index, without walking or locking the descriptor list.
+       Returns FALSE if no descriptor matches.
+     */
+    PBoolean LookupDescriptors(
+      const H225_AliasAddress & alias,
+      H323PeerElementPatternIndex::MatchList & matches
+    ) const { return patternIndex.Lookup(alias, matches); }
+
+    /**Get the compiled pattern index of the local descriptors.
+     */
+    const H323PeerElementPatternIndex & GetPatternIndex() const { return patternIndex; }
+
     /** Request access to an alias
     */
     PBoolean AccessRequest(
@@ -524,6 +645,8 @@ class H323PeerElement : public H323_AnnexG
     AliasKeyList transportAddressToDescriptorID;
     AliasKeyList specificAliasToDescriptorID;
     AliasKeyList wildcardAliasToDescriptorID;
+
+    H323PeerElementPatternIndex patternIndex;
 };
 
 
@@ -745,6 +745,158 @@ template <class D> class PSTLList : public PObject,
       { return PNEW cls(0, this); } \
 
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+// Single producer, single consumer lock free queue
+
+#if defined(_MSC_VER)
+#define H323_MEMORY_BARRIER()  MemoryBarrier()
+#elif defined(__GNUC__)
+#define H323_MEMORY_BARRIER()  __sync_synchronize()
+#else
+#define H323_MEMORY_BARRIER()
+#endif
+
+/** Fixed capacity queue that may be pushed from exactly one thread and
+    popped from exactly one other thread without any locking. The storage
+    is allocated up front, so neither side allocates memory.
+  */
+template <class T> class H323SPSCQueue
+{
+public:
+    H323SPSCQueue(unsigned capacity = 0)
+    : m_buffer(NULL), m_size(0), m_head(0), m_tail(0)
+    { SetCapacity(capacity); }
+
+    ~H323SPSCQueue()
+    { delete [] m_buffer; }
+
+    /** Resize and empty the queue. Neither side may be active. */
+    void SetCapacity(unsigned capacity)
+    {
+        delete [] m_buffer;
+        m_size = capacity+1;
+        m_buffer = new T[m_size];
+        m_head = m_tail = 0;
+    }
+
+    unsigned GetCapacity() const { return m_size-1; }
+
+    /** Called by the producer. Returns false if the queue is full. */
+    bool Push(const T & item)
+    {
+        unsigned tail = m_tail;
+        unsigned next = (tail+1)%m_size;
+        if (next == m_head)
+            return false;
+        m_buffer[tail] = item;
+        H323_MEMORY_BARRIER();
+        m_tail = next;
+        return true;
+    }
+
+    /** Called by the consumer. Returns false if the queue is empty. */
+    bool Pop(T & item)
+    {
+        unsigned head = m_head;
+        if (head == m_tail)
+            return false;
+        H323_MEMORY_BARRIER();
+        item = m_buffer[head];
+        H323_MEMORY_BARRIER();
+        m_head = (head+1)%m_size;
+        return true;
+    }
+
+    bool IsEmpty() const { return m_head == m_tail; }
+
+    unsigned GetCount() const
+    {
+        unsigned head = m_head;
+        unsigned tail = m_tail;
+        return tail >= head ? tail - head : m_size - head + tail;
+    }
+
+protected:
+    T * m_buffer;
+    unsigned m_size;
+    volatile unsigned m_head;
+    volatile unsigned m_tail;
+
+private:
+    H323SPSCQueue(const H323SPSCQueue &);
+    H323SPSCQueue & operator=(const H323SPSCQueue &);
+};
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+// 64 bit counter for statistics
+
+/** 64 bit integer that may be updated and read from any thread without
+    locking. PAtomicInteger is only a long, which is 32 bits on Windows.
+  */
+class H323AtomicInt64
+{
+public:
+    H323AtomicInt64(PInt64 value = 0)
+    : m_value(value) { }
+
+    /** Add to the value, returning the new value. */
+    PInt64 Add(PInt64 delta)
+    {
+#if defined(_MSC_VER)
+        return InterlockedExchangeAdd64(&m_value, delta) + delta;
+#elif defined(__GNUC__)
+        return __sync_add_and_fetch(&m_value, delta);
+#else
+        return m_value += delta;
+#endif
+    }
+
+    /** Get the value. */
+    PInt64 Get() const
+    {
+#if defined(_MSC_VER)
+        return InterlockedCompareExchange64(const_cast<volatile LONGLONG *>(&m_value), 0, 0);
+#elif defined(__GNUC__)
+        return __sync_add_and_fetch(const_cast<volatile PInt64 *>(&m_value), 0);
+#else
+        return m_value;
+#endif
+    }
+
+    /** Raise the value to at least the given value. */
+    void SetMaximum(PInt64 value)
+    {
+        PInt64 current = Get();
+        while (value > current) {
+#if defined(_MSC_VER)
+            PInt64 previous = InterlockedCompareExchange64(&m_value, value, current);
+#elif defined(__GNUC__)
+            PInt64 previous = __sync_val_compare_and_swap(&m_value, current, value);
+#else
+            PInt64 previous = m_value;
+            if (previous == current)
+                m_value = value;
+#endif
+            if (previous == current)
+                break;
+            current = previous;
+        }
+    }
+
+protected:
+#if defined(_MSC_VER)
+    volatile LONGLONG m_value;
+#else
+    volatile PInt64 m_value;
+#endif
+
+private:
+    H323AtomicInt64(const H323AtomicInt64 &);
+    H323AtomicInt64 & operator=(const H323AtomicInt64 &);
+};
+
+
 #ifdef H323_FRAMEBUFFER
 
 class H323FRAME {
@@ -42,7 +42,12 @@
 
 #include "ptlib_extras.h"
 
+#include <map>
+#include <vector>
+
 class RTP_JitterBuffer;
+class RTP_MediaReactor;
+class RTP_JitterScheduler;
 class PHandleAggregator;
 
 #ifdef P_STUN
@@ -81,6 +86,16 @@ class RTP_DataFrame : public PBYTEArray
   public:
     RTP_DataFrame(PINDEX payloadSize = 2048, PBoolean dynamicAllocation = TRUE);
 
+    /**Create a frame over memory owned by the caller, eg a pooled buffer.
+       The memory is used in place and must outlive the frame and any frame
+       assigned from it.
+      */
+    RTP_DataFrame(
+      BYTE * data,              ///< Memory for header and payload
+      PINDEX size,              ///< Bytes of memory, at least MinHeaderSize
+      PBoolean dynamicAllocation  ///< FALSE to use the memory in place
+    );
+
     enum {
       ProtocolVersion = 2,
       MinHeaderSize = 12
@@ -214,6 +229,232 @@ class RTP_MultiDataFrame : public PBYTEArray
 H323LIST(RTP_MultiDataFrameList, RTP_MultiDataFrame);
 
 
+class RTP_FramePool;
+
+/**Reference counted block of memory holding a media frame.
+   Blocks are owned by an RTP_FramePool and are only accessed through
+   RTP_FrameSlice instances. Head room is reserved in front of the data so
+   headers, eg the H.460.19 multiplex ID, may be prepended in place.
+  */
+class RTP_FrameBuffer
+{
+  public:
+    RTP_FrameBuffer(RTP_FramePool & pool, PINDEX sizeClass, PINDEX capacity);
+    ~RTP_FrameBuffer();
+
+    RTP_FramePool  & pool;
+    PINDEX           sizeClass;       ///< Size class index, NumSizeClasses if not pooled
+    PINDEX           capacity;        ///< Bytes available including head room
+    BYTE           * memory;
+    PAtomicInteger   referenceCount;
+    RTP_FrameBuffer * next;           ///< Free list link
+
+  private:
+    RTP_FrameBuffer(const RTP_FrameBuffer &);
+    RTP_FrameBuffer & operator=(const RTP_FrameBuffer &);
+};
+
+
+/**A view of part of a pooled frame buffer.
+   Copying a slice shares the underlying buffer, no data is copied, and the
+   buffer is returned to its pool when the last slice referencing it goes.
+   Slices sharing a buffer see each others writes.
+  */
+class RTP_FrameSlice
+{
+  public:
+  /**@name Construction */
+  //@{
+    /**Create an empty slice.
+      */
+    RTP_FrameSlice();
+
+    /**Create a slice sharing the buffer of another.
+      */
+    RTP_FrameSlice(
+      const RTP_FrameSlice & other
+    );
+
+    RTP_FrameSlice & operator=(
+      const RTP_FrameSlice & other
+    );
+
+    /**Release the reference to the buffer.
+      */
+    ~RTP_FrameSlice();
+  //@}
+
+  /**@name Operations */
+  //@{
+    /**Get the start of the slice data.
+      */
+    BYTE * GetPointer() const;
+
+    /**Get the number of bytes in the slice.
+      */
+    PINDEX GetSize() const { return length; }
+
+    /**Indicate the slice has no buffer or is zero length.
+      */
+    PBoolean IsEmpty() const { return buffer == NULL || length == 0; }
+
+    /**Set the size of the slice. The buffer is never reallocated, FALSE is
+       returned if the size exceeds the space after the start of the slice.
+      */
+    PBoolean SetSize(
+      PINDEX len            ///< New length of slice
+    );
+
+    /**Get the bytes available in the buffer after the start of the slice.
+      */
+    PINDEX GetCapacity() const;
+
+    /**Extend the slice backwards into the buffer head room, eg to add a
+       header in front of the data without moving it. Returns a pointer to
+       the new start or NULL if there is no room or the buffer is shared.
+      */
+    BYTE * Prepend(
+      PINDEX len            ///< Bytes to add in front of the data
+    );
+
+    /**Drop bytes from the front of the slice, eg to skip a header.
+      */
+    PBoolean Advance(
+      PINDEX len            ///< Bytes to drop
+    );
+
+    /**Get a new slice sharing part of this one.
+      */
+    RTP_FrameSlice GetSlice(
+      PINDEX start,         ///< Offset from start of this slice
+      PINDEX len            ///< Length of new slice
+    ) const;
+
+    /**Release the buffer, leaving an empty slice.
+      */
+    void Release();
+  //@}
+
+  protected:
+    RTP_FrameBuffer * buffer;
+    PINDEX            offset;     ///< Start of slice from start of buffer memory
+    PINDEX            length;
+
+  friend class RTP_FramePool;
+};
+
+
+/**Pool of size classed frame buffers.
+   Buffers released by the last slice referencing them are kept on per size
+   class free lists and reused, so the steady state media path does not go
+   to the heap. Buffers larger than the biggest size class are allocated
+   and freed each time.
+  */
+class RTP_FramePool : public PObject
+{
+  PCLASSINFO(RTP_FramePool, PObject);
+
+  public:
+    enum {
+      HeadRoom = 16,
+      NumSizeClasses = 4,
+      DefaultMaxFree = 512,
+      FrameSize = 2048     ///< Size of an RTP_PooledDataFrame, one size class
+    };
+
+  /**@name Construction */
+  //@{
+    RTP_FramePool(
+      PINDEX maxFree = DefaultMaxFree  ///< Maximum free buffers kept per size class
+    );
+    ~RTP_FramePool();
+
+    /**Get the pool shared by the media code.
+      */
+    static RTP_FramePool & Default();
+  //@}
+
+  /**@name Operations */
+  //@{
+    /**Allocate a slice of at least the size, after the head room.
+      */
+    RTP_FrameSlice Allocate(
+      PINDEX size
+    );
+
+    /**Allocate a slice and copy the data into it.
+       The copy is counted in the pool statistics.
+      */
+    RTP_FrameSlice Copy(
+      const void * data,
+      PINDEX len
+    );
+
+    /**Count a payload copy made outside the pool, eg from a pooled frame
+       into a caller's frame, in the pool statistics.
+      */
+    void CountCopy(
+      PINDEX len
+    );
+
+    /**Return a buffer, called by the last slice referencing it.
+      */
+    void Release(
+      RTP_FrameBuffer * buffer
+    );
+
+    struct Statistics {
+      unsigned heapAllocations;   ///< Buffers taken from the heap
+      unsigned poolAllocations;   ///< Buffers reused from a free list
+      unsigned releases;          ///< Buffers given back
+      unsigned inUse;             ///< Buffers still referenced
+      unsigned copies;            ///< Payload copies made by Copy()
+      PUInt64  bytesCopied;       ///< Bytes copied by Copy()
+    };
+
+    /**Get the allocation and copy counters of the pool.
+      */
+    void GetStatistics(
+      Statistics & stats
+    ) const;
+  //@}
+
+  protected:
+    static PINDEX GetSizeClass(PINDEX size);
+
+    PINDEX            maxFree;
+    RTP_FrameBuffer * freeList[NumSizeClasses];
+    PINDEX            freeCount[NumSizeClasses];
+    mutable PMutex    mutex[NumSizeClasses+1];   // Last is for unpooled buffers and copies
+    Statistics        counters[NumSizeClasses+1];
+};
+
+
+/**An RTP data frame whose memory is taken from an RTP_FramePool.
+   Used for frames that are created with each session, eg the jitter buffer
+   and media reactor queues, so calls starting and stopping reuse the same
+   buffers rather than going to the heap. A frame assigned from this one
+   shares the pooled memory, so it is only valid until this frame is
+   reused or destroyed.
+  */
+class RTP_PooledDataFrame : public RTP_DataFrame
+{
+  PCLASSINFO(RTP_PooledDataFrame, RTP_DataFrame);
+
+  public:
+    RTP_PooledDataFrame(
+      const RTP_FrameSlice & slice = RTP_FramePool::Default().Allocate(RTP_FramePool::FrameSize)
+    );
+
+  protected:
+    RTP_FrameSlice buffer;   // Holds the memory the frame is using
+
+  private:
+    RTP_PooledDataFrame(const RTP_PooledDataFrame &);
+    RTP_PooledDataFrame & operator=(const RTP_PooledDataFrame &);
+};
+
+
 /**An RTP control frame encapsulation.
   */
 class RTP_ControlFrame : public PBYTEArray
@@ -340,6 +581,121 @@ class RTP_MultiControlFrame : public PBYTEArray
 };
 
 
+/**This class is a histogram of durations in microseconds with power of two
+   buckets. It is written by a single thread (the media thread that owns the
+   measurement) without locks or atomic operations, and may be read at any
+   time by other threads through GetSnapshot(), which may be a sample or so
+   behind the writer.
+ */
+class RTP_MediaHistogram
+{
+  public:
+    enum {
+      NumBuckets = 24   ///< Bucket n counts values below 2^n us, the last everything else
+    };
+
+    RTP_MediaHistogram();
+
+    /**Record a duration in microseconds, negative values count as zero.
+       May be called from any thread while others take snapshots.
+     */
+    void Record(PInt64 microseconds);
+
+    class Snapshot {
+      public:
+        Snapshot();
+
+        /**Get the upper limit of a bucket in microseconds, zero for the last.
+         */
+        static PInt64 GetBucketLimit(PINDEX bucket);
+
+        /**Get the bucket limit at or below which the percentage of values fall.
+         */
+        PInt64 GetPercentile(unsigned percent) const;
+
+        PInt64 GetAverage() const { return count > 0 ? sum/(PInt64)count : 0; }
+
+        PUInt64 buckets[NumBuckets];
+        PUInt64 count;
+        PInt64  sum;
+        PInt64  maximum;
+    };
+
+    /**Copy the current values. Each value is read atomically, a value
+       recorded during the copy may be in the buckets but not yet the sum.
+     */
+    void GetSnapshot(Snapshot & snapshot) const;
+
+  protected:
+    H323AtomicInt64 buckets[NumBuckets];
+    H323AtomicInt64 sum;
+    H323AtomicInt64 maximum;
+};
+
+
+/**This class holds the media timing histograms of an RTP session.
+ */
+class RTP_MediaStatistics
+{
+  public:
+    enum Histograms {
+      EncodeTime,             ///< Codec encode time of a frame
+      DecodeTime,             ///< Codec decode time of a frame
+      JitterBufferResidence,  ///< Time from socket read to leaving the jitter buffer
+      ReadToPlayout,          ///< Time from socket read to the frame written to the codec
+      TransmitOverrun,        ///< Lateness of each audio frame read against the frame clock
+      PacingDelay,            ///< Send side delay added by the video pacer
+      NumHistograms
+    };
+
+    RTP_MediaHistogram & operator[](Histograms h) { return histograms[h]; }
+    const RTP_MediaHistogram & operator[](Histograms h) const { return histograms[h]; }
+
+    /**Get the name of a histogram, as used for exported metrics.
+     */
+    static const char * GetName(Histograms h);
+
+    /**Get a monotonic time in microseconds for timing intervals.
+     */
+    static PInt64 GetTime();
+
+  protected:
+    RTP_MediaHistogram histograms[NumHistograms];
+};
+
+
+/**This class is a copy of the media statistics of an RTP session at one
+   point in time, as returned by H323EndPoint::GetMediaStatistics().
+ */
+class RTP_MediaStatisticsSnapshot : public PObject
+{
+  PCLASSINFO(RTP_MediaStatisticsSnapshot, PObject);
+
+  public:
+    RTP_MediaStatisticsSnapshot(
+      const PString & callToken,          ///< Call the session belongs to
+      unsigned sessionID,                 ///< RTP session ID
+      const RTP_MediaStatistics & stats   ///< Statistics to copy
+    );
+
+    /**Print the count, average, 99th percentile and maximum of each histogram.
+     */
+    void PrintOn(ostream & strm) const;
+
+    PString callToken;
+    unsigned sessionID;
+    RTP_MediaHistogram::Snapshot histograms[RTP_MediaStatistics::NumHistograms];
+};
+
+H323LIST(RTP_MediaStatisticsList, RTP_MediaStatisticsSnapshot);
+
+/**Write a list of media statistics in the Prometheus text exposition format.
+   Each histogram becomes a metric h323_media_<name>_seconds with call and
+   session labels.
+ */
+void RTP_PrintMediaStatistics(ostream & strm, const RTP_MediaStatisticsList & list);
+
+
 /**This class is for encpsulating the IETF Real Time Protocol interface.
  */
 class RTP_UDP;
@@ -390,7 +746,9 @@ class RTP_Session : public PObject
     void SetJitterBufferSize(
       unsigned minJitterDelay, ///<  Minimum jitter buffer delay in RTP timestamp units
       unsigned maxJitterDelay, ///<  Maximum jitter buffer delay in RTP timestamp units
-      PINDEX stackSize = 30000 ///<  Stack size for jitter thread
+      PINDEX stackSize = 30000, ///<  Stack size for jitter thread
+      RTP_JitterScheduler * scheduler = NULL, ///<  Shared scheduler to read with, if any
+      unsigned pollPeriod = 10  ///<  Scheduler poll period in milliseconds
     );
 
     /**Get current size of the jitter buffer.
@@ -431,6 +789,21 @@ class RTP_Session : public PObject
         int & selectStatus
      );
 
+    /**Read a data frame from the RTP channel if one is already waiting.
+       Control frames are dispatched as for ReadData(). The available flag
+       indicates a data frame was returned, FALSE is returned only if the
+       session is shutting down or in error.
+      */
+    virtual PBoolean ReadDataNoWait(
+      RTP_DataFrame & frame,   ///<  Frame read from the RTP session
+      PBoolean & available     ///<  Set to TRUE if frame was read
+    ) { available = FALSE; return TRUE; }
+
+    /**Indicate ReadDataNoWait() is supported, allowing the jitter buffer
+       to be serviced by a shared RTP_JitterScheduler.
+      */
+    virtual PBoolean CanReadDataNoWait() const { return FALSE; }
+
     /**Check the data before sending to the RTP Channel
       */
     virtual PBoolean PreWriteData(
@@ -718,6 +1091,21 @@ class RTP_Session : public PObject
       */
     PTime GetFirstDataReceivedTime() const { return firstDataReceivedTime; }
 
+    /**Get the media timing histograms for the session.
+      */
+    RTP_MediaStatistics & GetMediaStatistics() { return mediaStatistics; }
+    const RTP_MediaStatistics & GetMediaStatistics() const { return mediaStatistics; }
+
+    /**Get the time, from RTP_MediaStatistics::GetTime(), at which the last
+       frame returned by ReadBufferedData() was read from the socket.
+      */
+    PInt64 GetLastReadTime() const { return lastReadTime; }
+
+    /**Set the time at which the frame about to be returned by
+       ReadBufferedData() was read from the socket.
+      */
+    void SetLastReadTime(PInt64 t) { lastReadTime = t; }
+
 	/**
 	  * return the local Transport Address
 	  */
@@ -784,6 +1172,9 @@ class RTP_Session : public PObject
     DWORD jitterLevel;
     DWORD maximumJitterLevel;
 
+    RTP_MediaStatistics mediaStatistics;
+    PInt64              lastReadTime;
+
 	// Socket information
     PString locAddress;
     PString remAddress;
@@ -970,12 +1361,27 @@ class RTP_SessionManager : public PObject
     void Exit();
   //@}
 
+  /**@name Media reactor */
+  //@{
+    /**Set the shared media reactor sessions are attached to when added.
+       If NULL (the default) each session reads its own sockets.
+      */
+    void SetMediaReactor(
+      RTP_MediaReactor * reactor    ///<  Reactor to use, or NULL
+    ) { mediaReactor = reactor; }
+
+    /**Get the shared media reactor sessions are attached to when added.
+      */
+    RTP_MediaReactor * GetMediaReactor() const { return mediaReactor; }
+  //@}
+
 
   protected:
     H323DICTIONARY(SessionDict, POrdinalKey, RTP_Session);
     SessionDict sessions;
     PMutex      mutex;
     PINDEX      enumerationIndex;
+    RTP_MediaReactor * mediaReactor;
 };
 
 
@@ -1019,6 +1425,16 @@ class RTP_UDP : public RTP_Session
       */
     virtual PBoolean PseudoRead(int & selectStatus);
 
+    /**Read a data frame from the RTP channel if one is already waiting.
+      */
+    virtual PBoolean ReadDataNoWait(RTP_DataFrame & frame, PBoolean & available);
+
+    /**Indicate ReadDataNoWait() is supported. This is only so once the
+       session is attached to a media reactor, otherwise every poll would
+       select on the session's own sockets.
+      */
+    virtual PBoolean CanReadDataNoWait() const;
+
     /**Check the data before sending to the RTP Channel
       */
     PBoolean PreWriteData(RTP_DataFrame & frame);
@@ -1152,7 +1568,54 @@ class RTP_UDP : public RTP_Session
     PINDEX GetControlSocketHandle() const
     { return controlSocket != NULL ? controlSocket->GetHandle() : -1; }
 
+  /**@name Media reactor */
+  //@{
+    /**Hand the data and control sockets of the session over to a shared
+       media reactor. Once attached, ReadData() no longer selects on the
+       sockets itself but returns frames the reactor threads have already
+       read and passed through OnReceiveData().
+
+       Sessions with tunneled media or sockets created by a NAT method are
+       not attached and continue to read their own sockets.
+      */
+    PBoolean AttachReactor(
+      RTP_MediaReactor * reactor   ///<  Reactor to service the sockets
+    );
+
+    /**Remove the session from its media reactor, if any.
+      */
+    void DetachReactor();
+
+    /**Get the media reactor servicing the session, if any.
+      */
+    RTP_MediaReactor * GetReactor() const { return reactor; }
+
+    /**Indicate the session sockets can be serviced by a media reactor.
+      */
+    PBoolean CanUseReactor() const;
+
+    /**Called from a reactor thread when the data or control socket has
+       something to read. Returns FALSE if the transport was aborted and
+       the session should no longer be polled.
+      */
+    PBoolean OnReactorRead(
+      PBoolean fromDataChannel   ///<  Data socket is readable (else control)
+    );
+
+    /**Called periodically from a reactor thread to send RTCP reports.
+      */
+    void OnReactorTimeout();
+
+    /**Get number of received frames discarded as the reader fell behind
+       the reactor.
+      */
+    DWORD GetReactorOverruns() const { return reactorOverruns; }
+  //@}
+
   protected:
+    PBoolean PopReactorFrame(RTP_DataFrame & frame);
+    PBoolean ReadReactorData(RTP_DataFrame & frame);
+
     SendReceiveStatus ReadDataPDU(RTP_DataFrame & frame);
     SendReceiveStatus ReadControlPDU();
     SendReceiveStatus ReadDataOrControlPDU(
@@ -1184,6 +1647,76 @@ class RTP_UDP : public RTP_Session
     unsigned successiveWrongAddresses;
 
     PBoolean mediaIsTunneled;
+    PBoolean natMethodSockets;
+
+    // Media reactor receive queue
+    enum { ReactorQueueSize = 32 };
+    RTP_MediaReactor * reactor;
+    RTP_PooledDataFrame * reactorFrames;
+    PINDEX             reactorHead;
+    PINDEX             reactorCount;
+    DWORD              reactorOverruns;
+    PBoolean           reactorAborted;
+    PMutex             reactorMutex;
+    PSyncPoint         reactorSignal;
+};
+
+
+/**This class is a small, fixed pool of I/O threads shared by many RTP_UDP
+   sessions. Each thread waits on the data and control sockets of the
+   sessions assigned to it (using epoll where available) and dispatches
+   received packets to RTP_UDP::OnReactorRead(), so a session no longer
+   needs a thread blocked in PSocket::Select() to receive media.
+ */
+class RTP_MediaReactor : public PObject
+{
+  PCLASSINFO(RTP_MediaReactor, PObject);
+
+  public:
+  /**@name Construction */
+  //@{
+    /**Create the reactor and start its I/O threads.
+      */
+    RTP_MediaReactor(
+      PINDEX threadCount = 2,    ///<  Number of I/O threads
+      PINDEX stackSize = 30000   ///<  Stack size for each I/O thread
+    );
+
+    /**Stop the I/O threads. All sessions should have been removed.
+      */
+    ~RTP_MediaReactor();
+  //@}
+
+  /**@name Operations */
+  //@{
+    /**Add a session to the least loaded I/O thread.
+      */
+    PBoolean AddSession(
+      RTP_UDP & session    ///<  Session to service
+    );
+
+    /**Remove a session. On return no I/O thread is referencing the session
+       or its sockets.
+      */
+    void RemoveSession(
+      RTP_UDP & session    ///<  Session to remove
+    );
+
+    /**Get the number of I/O threads.
+      */
+    PINDEX GetThreadCount() const { return (PINDEX)workers.size(); }
+
+    /**Get the number of sessions being serviced.
+      */
+    PINDEX GetSessionCount() const;
+  //@}
+
+  class Worker;
+
+  protected:
+    std::vector<Worker *>          workers;
+    std::map<RTP_UDP *, Worker *>  sessionWorkers;
+    PMutex                         mutex;
 };
 
 
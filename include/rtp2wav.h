@@ -38,8 +38,83 @@
 #include "rtp.h"
 
 
+class OpalRtpToWavFile;
+
+
 ///////////////////////////////////////////////////////////////////////////////
 
+/**This class is a pool of threads writing recordings for OpalRtpToWavFile,
+   so the media receive threads never wait for the disk. Each recording
+   captures payloads into blocks of its own and queues the full blocks,
+   a writer thread writes all the blocks queued for a file in one go. When
+   a recording has queued as many blocks as it may the block being captured
+   is dropped and counted, capture never waits for the writer.
+   The writer must outlive the recordings using it. Destroying it waits for
+   each writer thread to finish its current write, a recording closed after
+   that is written out on the thread closing it.
+  */
+class OpalRecordingWriter : public PObject
+{
+    PCLASSINFO(OpalRecordingWriter, PObject);
+  public:
+    OpalRecordingWriter(
+      PINDEX threads = 2,             ///< Writer threads
+      PINDEX blockSize = 32768,       ///< Bytes captured in each block
+      PINDEX blocksPerFile = 8,       ///< Blocks a recording may have queued
+      unsigned syncInterval = 5000    ///< ms between fdatasync() of a file, 0 for never
+    );
+    ~OpalRecordingWriter();
+
+    /**Set the disk space reserved when a recording is opened, so the file
+       does not fragment as it grows. Only supported on Linux. Default 0.
+      */
+    void SetPreallocation(PINDEX bytes) { preallocation = bytes; }
+
+    /**Set the time a partly filled block is held before it is queued.
+       Default 1000ms.
+      */
+    void SetFlushInterval(unsigned ms) { flushInterval = ms; }
+
+    PINDEX GetBlockSize() const { return blockSize; }
+    PINDEX GetBlocksPerFile() const { return blocksPerFile; }
+    unsigned GetFlushInterval() const { return flushInterval; }
+
+    /**Get the totals of recordings that have been closed.
+      */
+    void GetStatistics(
+      PUInt64 & bytesWritten,    ///< Bytes written to disk
+      PUInt64 & bytesDropped,    ///< Bytes dropped as the writers fell behind
+      unsigned & writes,         ///< Write calls made
+      unsigned & syncs           ///< fdatasync() calls made
+    );
+
+  protected:
+    class Worker;
+
+    void Attach(OpalRtpToWavFile & file);
+    void Detach(OpalRtpToWavFile & file);
+    void Wake(OpalRtpToWavFile & file);
+    void AddStatistics(PUInt64 written, PUInt64 dropped, unsigned writeCount, unsigned syncCount);
+
+    PINDEX   blockSize;
+    PINDEX   blocksPerFile;
+    unsigned syncInterval;
+    unsigned flushInterval;
+    PINDEX   preallocation;
+
+    std::vector<Worker *> workers;
+    PAtomicInteger nextWorker;
+
+    PMutex   statisticsMutex;
+    PUInt64  bytesWritten;
+    PUInt64  bytesDropped;
+    unsigned writes;
+    unsigned syncs;
+
+  friend class OpalRtpToWavFile;
+};
+
+
 /**This class encapsulates a WAV file that can be used to intercept RTP data
    in the standard H323_RTPChannel class.
   */
@@ -52,17 +127,67 @@ class OpalRtpToWavFile : public PWAVFile
       const PString & filename
     );
 
+    /**Create a recording written by the writer pool instead of on the
+       thread receiving the media.
+      */
+    OpalRtpToWavFile(
+      const PString & filename,
+      OpalRecordingWriter & writer
+    );
+
+    ~OpalRtpToWavFile();
+
     virtual PBoolean OnFirstPacket(RTP_DataFrame & frame);
 
+    /**Queue what has been captured, wait for the writer to write it and
+       close the file.
+      */
+    virtual PBoolean Close();
+
     const PNotifier & GetReceiveHandler() const { return receiveHandler; }
 
+    /**Get the bytes of payload dropped because the writer fell behind.
+      */
+    PUInt64 GetBytesDropped() const { return bytesDropped + bytesLost; }
+
   protected:
     PDECLARE_NOTIFIER(RTP_DataFrame, OpalRtpToWavFile, ReceivedPacket);
 
+    // Called on the receiving thread, never waits
+    void Capture(const BYTE * data, PINDEX size);
+    void QueueBlock();
+
+    // Called by the writer, returns bytes written. The final drain also
+    // writes the partly filled block and syncs the file.
+    PINDEX WriteQueued(PBYTEArray & batch, PBoolean closing);
+
     PNotifier                   receiveHandler;
     RTP_DataFrame::PayloadTypes payloadType;
     PBYTEArray                  lastFrame;
     PINDEX                      lastPayloadSize;
+
+    struct Block {
+      Block() : data(NULL), length(0) { }
+      BYTE * data;
+      PINDEX length;
+    };
+
+    OpalRecordingWriter       * writer;
+    OpalRecordingWriter::Worker * worker;
+    std::vector<Block>          blocks;        // Ring of blocksPerFile
+    PAtomicInteger              head;          // Blocks queued by the receiving thread
+    PAtomicInteger              tail;          // Blocks written by the writer
+    PTimeInterval               blockStarted;
+    PBoolean                    attached;
+    PBoolean                    draining;      // Set by Close(), under the worker mutex
+    PSyncPoint                  drained;       // Signalled by the writer after the final drain
+    volatile PBoolean           failed;
+    PUInt64                     bytesDropped;  // By the receiving thread
+    PUInt64                     bytesLost;     // By the writer after a write failed
+    PTimeInterval               lastSync;
+    PBoolean                    unsynced;
+
+  friend class OpalRecordingWriter;
 };
 
 
@@ -45,6 +45,10 @@
 #include <ptclib/pssl.h>
 #endif
 
+#include <deque>
+#include <map>
+#include <vector>
+
 class H225_Setup_UUIE;
 class H225_TransportAddress;
 class H225_ArrayOf_TransportAddress;
@@ -59,6 +63,7 @@ class H323Connection;
 class H323Listener;
 class H323Transport;
 class H323Gatekeeper;
+class H323SignalReactor;
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -658,6 +663,15 @@ class H323Transport : public PIndirectChannel
       PThread * thread
     );
 
+    /**Detach a thread from the transport, typically because the channel is
+       now being serviced by the signalling reactor and the thread is about
+       to end. Returns FALSE if the thread is not (or no longer) attached,
+       for example because CleanUpOnTermination() is already waiting on it.
+      */
+    PBoolean DetachThread(
+      PThread * thread
+    );
+
     /**Wait for associated thread to terminate.
       */
     virtual void CleanUpOnTermination();
@@ -682,10 +696,14 @@ class H323Transport : public PIndirectChannel
 
     H323EndPoint & endpoint;    /// Endpoint that owns the listener.
     PThread      * thread;      /// Thread handling the transport
+    PMutex         threadMutex; /// Mutex on thread pointer
     PBoolean canGetInterface;
+    H323SignalReactor * signalReactor; /// Reactor servicing the socket, if any
 
     PBoolean    m_secured;     /// Whether the channel is secure.
     PBoolean    m_established; /// Whether the call is established.
+
+  friend class H323SignalReactor;
 };
 
 
@@ -1119,6 +1137,218 @@ class H323TransportUDP : public H323TransportIP
 };
 
 
+///////////////////////////////////////////////////////////////////////////////
+// Shared signalling reactor
+
+/**This class services the H.225 and H.245 TCP channels of many calls from a
+   small fixed set of threads, instead of a thread blocked in a read on each
+   channel.
+
+   I/O threads wait on all registered sockets (epoll on Linux), read whatever
+   data is available without blocking and reassemble TPKT frames
+   incrementally. Each complete PDU is queued on the strand of its handle and
+   run on one of a bounded pool of worker threads. All handles sharing a
+   strand (typically the H.225 and H.245 channels of one call) are dispatched
+   strictly in arrival order and never concurrently, while different strands
+   run in parallel.
+
+   Read timeouts set on the transport are honoured: if no data arrives within
+   the timeout the handle is given a PChannel::Timeout error, exactly as a
+   blocking read would have returned.
+ */
+class H323SignalReactor : public PObject
+{
+  PCLASSINFO(H323SignalReactor, PObject);
+
+  public:
+    class Strand;
+
+    /**A TCP channel serviced by the reactor.
+      */
+    class Handle : public PObject
+    {
+      PCLASSINFO(Handle, PObject);
+
+      public:
+        /**Create a handle for the transport. All handles created with the
+           same strand key are dispatched one at a time, in order.
+          */
+        Handle(
+          H323Transport & transport,    ///<  Transport to service
+          const void * strandKey        ///<  Key identifying the strand
+        );
+
+        /**Called on a worker thread for every complete PDU received, with
+           the TPKT header removed. Empty keep alive PDUs are not passed on.
+           Return FALSE to stop servicing the channel.
+          */
+        virtual PBoolean OnReceivePDU(
+          const PBYTEArray & pdu        ///<  PDU data
+        ) = 0;
+
+        /**Called on a worker thread if the transport read timeout expired
+           without data, or the channel was closed or had an error. The error
+           is also set as the transports last read error. Return FALSE to
+           stop servicing the channel; if TRUE is returned after an error and
+           the transport has been reopened, the new socket is serviced.
+          */
+        virtual PBoolean OnReadError(
+          PChannel::Errors error        ///<  Timeout, NotOpen or Miscellaneous
+        ) = 0;
+
+        /**Called on a worker thread after OnReceivePDU() or OnReadError()
+           returned FALSE and the handle is no longer serviced. It is not
+           called when the handle is removed with RemoveHandle().
+          */
+        virtual void OnDetached() { }
+
+        /**Called on a worker thread every monitor interval while serviced,
+           whether or not data is arriving. See SetMonitorInterval().
+          */
+        virtual void OnMonitor() { }
+
+        /**Send an empty TPKT every few seconds while serviced, replacing the
+           keep alive timer of the per channel threads. The TPKT is written
+           on a worker thread, never by the socket I/O thread.
+          */
+        void SetKeepAlive(
+          PBoolean enable               ///<  Enable keep alive
+        ) { keepAlive = enable; }
+
+        /**Call OnMonitor() periodically while serviced, replacing the checks
+           the per channel threads made between reads. Zero disables it.
+          */
+        void SetMonitorInterval(
+          const PTimeInterval & interval ///<  Time between OnMonitor() calls
+        ) { monitorInterval = interval; }
+
+        H323Transport & GetTransport() const { return transport; }
+
+      protected:
+        H323Transport & transport;
+        const void    * strandKey;
+
+        // Owned by the reactor
+        Strand        * strand;
+        unsigned        id;
+        int             fd;
+        PINDEX          ioThread;
+        PBoolean        attached;
+        PBoolean        keepAlive;
+        PBYTEArray      buffer;
+        PINDEX          bufferLen;
+        PTimeInterval   lastRead;
+        PTimeInterval   lastKeepAlive;
+        PTimeInterval   monitorInterval;
+        PTimeInterval   lastMonitor;
+
+      friend class H323SignalReactor;
+    };
+
+  /**@name Construction */
+  //@{
+    /**Create the reactor and start its threads.
+      */
+    H323SignalReactor(
+      PINDEX ioThreads = 1,         ///<  Number of socket I/O threads
+      PINDEX workerThreads = 4,     ///<  Number of PDU dispatch threads
+      PINDEX stackSize = 0          ///<  Stack size of each thread
+    );
+
+    /**Stop all threads. All handles should have been removed.
+      */
+    ~H323SignalReactor();
+  //@}
+
+  /**@name Operations */
+  //@{
+    /**Indicate whether the transport can be serviced by the reactor. Only
+       plain (not TLS or tunnelled) TCP transports are supported.
+      */
+    static PBoolean CanService(
+      H323Transport & transport     ///<  Transport to check
+    );
+
+    /**Start servicing a handle. The transport must be open. Returns FALSE if
+       the handle could not be added, the caller must then read the channel
+       itself.
+      */
+    PBoolean AddHandle(
+      Handle * handle               ///<  Handle to service
+    );
+
+    /**Stop servicing a handle. On return no thread is referencing the
+       handle, any PDUs still queued for it are discarded. This must not be
+       called from within a callback of a handle on the same strand.
+      */
+    void RemoveHandle(
+      Handle * handle               ///<  Handle to remove
+    );
+
+    /**Stop reading a transport that is being closed. The reactor reads a
+       duplicate of the socket, so this must be called before the transport
+       closes it or the connection stays open. The handle is given a
+       PChannel::NotOpen error, as a blocking read would have returned.
+       This is done by H323Transport::Close().
+      */
+    void OnTransportClosed(
+      H323Transport & transport     ///<  Transport being closed
+    );
+
+    /**Get the number of handles being serviced.
+      */
+    PINDEX GetHandleCount() const;
+
+    /**Get the number of PDUs queued but not yet dispatched.
+      */
+    PINDEX GetQueuedPDUs() const;
+
+    /**Get the total number of reactor threads.
+      */
+    PINDEX GetThreadCount() const { return (PINDEX)(ioThreads.size() + workerThreads.size()); }
+  //@}
+
+    class IOThread;
+    class WorkerThread;
+
+  protected:
+    enum EventKinds {
+      ReceivedPDU,
+      ReadError,
+      KeepAliveDue,
+      MonitorDue
+    };
+
+    struct Event {
+      Handle         * handle;
+      EventKinds       kind;
+      PBYTEArray     * pdu;       // Only for ReceivedPDU
+      PChannel::Errors error;     // Only for ReadError
+    };
+
+    PBoolean Attach(Handle & handle);
+    void Detach(Handle & handle);
+    void Queue(Handle & handle, EventKinds kind, PBYTEArray * pdu = NULL, PChannel::Errors error = PChannel::NoError);
+    void Purge(Handle & handle);
+    PBoolean ReleaseStrand(Strand * strand);
+    void RunStrand(Strand & strand);
+    Strand * NextStrand();
+
+    friend class IOThread;
+    friend class WorkerThread;
+
+    std::vector<IOThread *>             ioThreads;
+    std::vector<WorkerThread *>         workerThreads;
+    std::map<const void *, Strand *>    strands;
+    std::deque<Strand *>                runQueue;
+    PSemaphore                          runAvailable;
+    PINDEX                              handleCount;
+    PINDEX                              queuedPDUs;
+    PBoolean                            shutdown;
+    mutable PMutex                      mutex;
+};
+
+
 #endif // __TRANSPORTS_H
 
 
@@ -317,16 +317,60 @@ static int decoder_set_vbr(
   return speex_decoder_ctl(context->coderState, SPEEX_SET_VBR, parm);
 }
 
+static int encoder_reset(
+      const PluginCodec_Definition * codec, 
+      void * _context, 
+      const char * , 
+      void * , 
+      unsigned * )
+{
+  if (_context == NULL)
+    return 0;
+
+  struct PluginSpeexContext * context = (struct PluginSpeexContext *)_context;
+
+  // back to the settings of create_encoder, set_vbr may have changed them
+  int mode = (int)(long)(codec->userData);
+  int vbr = 0;
+  speex_encoder_ctl(context->coderState, SPEEX_RESET_STATE, NULL);
+  speex_encoder_ctl(context->coderState, SPEEX_SET_QUALITY, &mode);
+  speex_encoder_ctl(context->coderState, SPEEX_SET_VBR,     &vbr);
+  return 1;
+}
+
+static int decoder_reset(
+      const PluginCodec_Definition * codec, 
+      void * _context, 
+      const char * , 
+      void * , 
+      unsigned * )
+{
+  if (_context == NULL)
+    return 0;
+
+  struct PluginSpeexContext * context = (struct PluginSpeexContext *)_context;
+
+  // back to the settings of create_decoder, set_vbr may have changed them
+  int enh = 1;
+  int vbr = 0;
+  speex_decoder_ctl(context->coderState, SPEEX_RESET_STATE, NULL);
+  speex_decoder_ctl(context->coderState, SPEEX_SET_ENH, &enh);
+  speex_decoder_ctl(context->coderState, SPEEX_SET_VBR, &vbr);
+  return 1;
+}
+
 static PluginCodec_ControlDefn sipDecoderControls[] = {
   { "valid_for_protocol",       valid_for_sip },
   { "get_codec_options",        coder_get_sip_options },
   { "set_vbr",                  decoder_set_vbr },
+  { "reset_codec",              decoder_reset },
   { NULL }
 };
 
 static PluginCodec_ControlDefn h323DecoderControls[] = {
   { "valid_for_protocol",       valid_for_h323 },
   { "set_vbr",                  decoder_set_vbr },
+  { "reset_codec",              decoder_reset },
   { NULL }
 };
 
@@ -334,12 +378,14 @@ static PluginCodec_ControlDefn sipEncoderControls[] = {
   { "valid_for_protocol",       valid_for_sip },
   { "get_codec_options",        coder_get_sip_options },
   { "set_vbr",                  encoder_set_vbr },
+  { "reset_codec",              encoder_reset },
   { NULL }
 };
 
 static PluginCodec_ControlDefn h323EncoderControls[] = {
   { "valid_for_protocol",       valid_for_h323 },
   { "set_vbr",                  encoder_set_vbr },
+  { "reset_codec",              encoder_reset },
   { NULL }
 };
 
@@ -22,8 +22,12 @@
 #include "plugin-config.h"
 
 #include "shared/pipes.h"
+#include "shared/shmring.h"
 #include "enc-ctx.h"
 #include <sys/stat.h>
+#ifdef H264_SHM_SUPPORT
+#include <sys/mman.h>
+#endif
 #include <fstream>
 #include "trace.h"
 #include <stdlib.h> 
@@ -80,6 +84,125 @@ void flushStream (std::ofstream & stream)
   if (stream.bad())  { TRACE (1, "H264\tIPC\tCP: Bad flag set on flushing - terminating"); closeAndExit(); }
 }
 
+#ifdef H264_SHM_SUPPORT
+H264ShmControl * attachShm()
+{
+  char * fdString = getenv(H264_SHM_FD_ENV);
+  if (fdString == NULL)
+    return NULL;
+
+  int fd = atoi(fdString);
+  void * region = mmap(NULL, H264_SHM_REGION_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (region == MAP_FAILED) {
+    TRACE (1, "H264\tIPC\tCP: Could not map shared memory - using pipes");
+    return NULL;
+  }
+
+  H264ShmControl * shm = (H264ShmControl *)region;
+  if (shm->magic != H264_SHM_MAGIC || shm->version != H264_SHM_VERSION) {
+    TRACE (1, "H264\tIPC\tCP: Shared memory version mismatch - using pipes");
+    munmap(region, H264_SHM_REGION_SIZE);
+    return NULL;
+  }
+
+  return shm;
+}
+
+void shmLoop(H264ShmControl * shm)
+{
+  pid_t parent = getppid();
+  const unsigned char * shmSrc = NULL;
+  int seen = 0;   // no requests are made before the INIT reply
+
+  while (1) {
+    if (!H264ShmWait(&shm->request, seen, H264_SHM_TIMEOUT)) {
+      // the pipes are not read in this mode, so watch for the plugin going away
+      if (getppid() != parent) {
+        TRACE (1, "H264\tIPC\tCP: Plugin process gone - terminating");
+        closeAndExit();
+      }
+      continue;
+    }
+    seen = shm->request;
+
+    msg = shm->msg;
+    val = shm->value;
+
+  switch (msg) {
+    case H264ENCODERCONTEXT_CREATE:
+        x264 = new X264EncoderContext();
+      break;
+    case H264ENCODERCONTEXT_DELETE:
+        delete x264;
+        x264 = NULL;
+      break;
+    case APPLY_OPTIONS:
+        if (x264) x264->ApplyOptions ();
+      break;
+    case SET_TARGET_BITRATE:
+        if (x264) x264->SetTargetBitrate (val);
+      break;
+    case SET_FRAME_RATE:
+        if (x264) x264->SetFrameRate (val);
+      break;
+    case SET_FRAME_WIDTH:
+        if (x264) x264->SetFrameWidth (val);
+      break;
+    case SET_FRAME_HEIGHT:
+        if (x264) x264->SetFrameHeight (val);
+      break;
+    case SET_MAX_KEY_FRAME_PERIOD:
+        if (x264) x264->SetMaxKeyFramePeriod (val);
+      break;
+    case SET_TSTO:
+        if (x264) x264->SetTSTO (val);
+      break;
+    case SET_PROFILE_LEVEL:
+        if (x264) x264->SetProfileLevel (val);
+      break;
+    case ENCODE_FRAMES:
+        // the frame and RTP header are already in place, encode straight from the ring
+        shmSrc = H264ShmFrame(shm, shm->slot);
+        srcLen = shm->srcLen;
+        flags  = shm->flags;
+        // fall through intended
+    case ENCODE_FRAMES_BUFFERED:
+        if (x264 && shmSrc) {
+          dstLen = shm->dstLen;
+          shm->ret    = x264->EncodeFrames(shmSrc, srcLen, H264ShmDst(shm), dstLen, flags);
+          shm->dstLen = dstLen;
+          shm->flags  = flags;
+        } else {
+          shm->ret    = 0;
+          shm->dstLen = 0;
+        }
+      break;
+    case SET_MAX_FRAME_SIZE:
+        if (x264) x264->SetMaxRTPFrameSize (val);
+      break;
+    case FASTUPDATE_REQUESTED:
+        if (x264) x264->fastUpdateRequested();
+      break;
+    case SET_MAX_NALSIZE:
+        if (x264) x264->SetMaxNALSize (val);
+      break;
+    case H264_SHM_EXIT:
+        TRACE (1, "H264\tIPC\tCP: Plugin detached - terminating");
+        closeAndExit();
+      break;
+    default:
+      break;
+    }
+
+    if (!x264 && msg != H264ENCODERCONTEXT_DELETE)
+      TRACE (1, "H264\tIPC\tCodec not created, yet");
+
+    H264ShmSignal(&shm->response);
+  }
+}
+#endif
+
 
 int main(int argc, char *argv[])
 {
@@ -118,6 +241,12 @@ int main(int argc, char *argv[])
   status = 1;
 #endif
 
+#ifdef H264_SHM_SUPPORT
+  H264ShmControl * shm = attachShm();
+  if (shm != NULL && status != 0)
+    status |= H264_SHM_STATUS;
+#endif
+
   readStream(dlStream, (char*)&msg, sizeof(msg));
   writeStream(ulStream,(char*)&msg, sizeof(msg)); 
   writeStream(ulStream,(char*)&status, sizeof(status)); 
@@ -128,6 +257,13 @@ int main(int argc, char *argv[])
     closeAndExit();
   }
 
+#ifdef H264_SHM_SUPPORT
+  if (status & H264_SHM_STATUS) {
+    TRACE (1, "H264\tIPC\tCP: Using shared memory transport");
+    shmLoop(shm);
+  }
+#endif
+
   while (1) {
     readStream(dlStream, (char*)&msg, sizeof(msg));
 
@@ -0,0 +1,147 @@
+/*
+ * H.264 Plugin codec for OpenH323/OPAL
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Open H323 Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ */
+
+/*
+  Notes
+  -----
+
+  Encode throughput of the GPL helper over the named pipes and over the
+  shared memory transport, at CIF, 720p and 1080p. The helper is located
+  the same way as by the plugin, set PTLIBPLUGINDIR if it is not installed.
+
+  Usage: h264ipc_bench [frames]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "trace.h"
+#include "rtpframe.h"
+#include "h264pipe_unix.h"
+
+#define BENCH_PAYLOAD_TYPE 96
+#define BENCH_MAX_PACKET   1400
+#define BENCH_FRAMES       8
+
+static double now()
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec/1000000.0;
+}
+
+static bool runBenchmark(const char * transport, unsigned width, unsigned height, unsigned frames)
+{
+  setenv("H264_IPC_TRANSPORT", transport, 1);
+
+  H264EncCtx ctx;
+  if (!ctx.Load()) {
+    fprintf(stderr, "Could not start the GPL helper process\n");
+    return false;
+  }
+
+  ctx.call(H264ENCODERCONTEXT_CREATE);
+  ctx.call(SET_FRAME_WIDTH, width);
+  ctx.call(SET_FRAME_HEIGHT, height);
+  ctx.call(SET_FRAME_RATE, 30);
+  ctx.call(SET_TARGET_BITRATE, width*height*30/20);
+  ctx.call(SET_MAX_FRAME_SIZE, BENCH_MAX_PACKET);
+  ctx.call(APPLY_OPTIONS);
+
+  unsigned yuvSize = width*height*3/2;
+  unsigned srcSize = yuvSize + sizeof(frameHeader) + 64;
+  unsigned srcLen = 0;
+  unsigned char * src[BENCH_FRAMES];
+  unsigned char dst[BENCH_MAX_PACKET + 100];
+
+  // moving diagonal bars keep the encoder doing real work
+  for (unsigned i = 0; i < BENCH_FRAMES; i++) {
+    src[i] = (unsigned char *)calloc(1, srcSize);
+    RTPFrame srcRTP(src[i], srcSize, BENCH_PAYLOAD_TYPE);
+    srcRTP.SetPayloadSize(sizeof(frameHeader) + yuvSize);
+    srcLen = srcRTP.GetFrameLen();
+
+    frameHeader * header = (frameHeader *)srcRTP.GetPayloadPtr();
+    header->x = header->y = 0;
+    header->width = width;
+    header->height = height;
+
+    unsigned char * yuv = srcRTP.GetPayloadPtr() + sizeof(frameHeader);
+    for (unsigned y = 0; y < height; y++)
+      for (unsigned x = 0; x < width; x++)
+        yuv[y*width + x] = (unsigned char)((x + y + i*4) & 0xff);
+    memset(yuv + width*height, 128, width*height/2);
+  }
+
+  RTPFrame dstRTP(dst, sizeof(dst), BENCH_PAYLOAD_TYPE);
+  unsigned headerLen = dstRTP.GetHeaderSize();
+
+  unsigned packets = 0;
+  unsigned long bytes = 0;
+  double start = now();
+
+  for (unsigned frame = 0; frame < frames; frame++) {
+    unsigned flags = 0;
+    int ret;
+    do {
+      unsigned len = srcLen;
+      unsigned dstLen = sizeof(dst);
+      ctx.call(ENCODE_FRAMES, src[frame%BENCH_FRAMES], len, dst, dstLen, headerLen, flags, ret);
+      packets++;
+      bytes += dstLen;
+    } while (ret != 0 && (flags & 1) == 0);
+
+    if (ret == 0) {
+      fprintf(stderr, "Encoding failed at frame %u\n", frame);
+      break;
+    }
+  }
+
+  double elapsed = now() - start;
+  ctx.call(H264ENCODERCONTEXT_DELETE);
+  for (unsigned i = 0; i < BENCH_FRAMES; i++)
+    free(src[i]);
+
+  printf("%-6s %5ux%-5u %8.1f fps %8.2f ms/frame %8.1f MB/s raw %6u packets %8lu bytes\n",
+         transport, width, height,
+         frames/elapsed, elapsed*1000/frames, (double)yuvSize*frames/elapsed/1000000,
+         packets, bytes);
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned frames = argc > 1 ? atoi(argv[1]) : 300;
+  if (frames == 0)
+    frames = 1;
+
+  char * debug_level = getenv ("PTLIB_TRACE_CODECS");
+  Trace::SetLevel(debug_level != NULL ? atoi(debug_level) : 0);
+  Trace::SetLevelUserPlane(0);
+
+  static const unsigned sizes[3][2] = { { 352, 288 }, { 1280, 720 }, { 1920, 1080 } };
+  for (unsigned i = 0; i < 3; i++) {
+    if (!runBenchmark("pipe", sizes[i][0], sizes[i][1], frames) ||
+        !runBenchmark("shm",  sizes[i][0], sizes[i][1], frames))
+      return 1;
+  }
+
+  return 0;
+}
@@ -29,12 +29,23 @@
 #include <errno.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/wait.h>
+#include <signal.h>
 #include <unistd.h>
 #include "trace.h"
 #include "rtpframe.h"
 #include "h264pipe_unix.h"
+#include "shared/shmring.h"
 #include <string.h>
 
+#ifdef H264_SHM_SUPPORT
+#include <sys/mman.h>
+#include <fcntl.h>
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+#endif
+
 #define HAVE_MKFIFO 1
 #define GPL_PROCESS_FILENAME "h264_video_pwplugin_helper"
 #define DIR_SEPERATOR "/"
@@ -51,11 +62,17 @@ H264EncCtx::H264EncCtx()
   loaded = false;  
   pipesCreated = false;
   pipesOpened = false;
+  shmFd = -1;
+  shm = NULL;
+  shmActive = false;
+  shmSlot = 0;
+  helperPid = -1;
   instances++;
 }
 
 H264EncCtx::~H264EncCtx()
 {
+  closeShm();
   closeAndRemovePipes();
 }
 
@@ -71,6 +88,9 @@ H264EncCtx::Load()
   }
   pipesCreated = true;  
 
+  // optional, the pipes are used if this fails
+  createShm();
+
   if (!findGplProcess()) { 
 
     TRACE(1, "H264\tIPC\tPP: Couldn't find GPL process executable: " << GPL_PROCESS_FILENAME)
@@ -90,9 +110,11 @@ H264EncCtx::Load()
   else if(pid < 0) {
 
     TRACE(1, "H264\tIPC\tPP: Error when trying to fork");
+    closeShm();
     closeAndRemovePipes(); 
     return false;
   }
+  helperPid = pid;
 
   dlStream.open(dlName, std::ios::binary);
   if (dlStream.fail()) { 
@@ -122,10 +144,18 @@ H264EncCtx::Load()
 #ifndef _WIN32
 	fprintf(stderr, "ERROR: H.264 plugin failure on initialization - plugin disabled");
 #endif
+    closeShm();
     closeAndRemovePipes(); 
     return false;
   }
 
+  if (shm != NULL && (status & H264_SHM_STATUS) != 0) {
+    TRACE(1, "H264\tIPC\tPP: Using shared memory transport")
+    shmActive = true;
+  }
+  else
+    closeShm();
+
   TRACE(1, "H264\tIPC\tPP: Successfully forked child process "<<  pid << " and established communication")
   loaded = true;  
   return true;
@@ -135,6 +165,13 @@ void H264EncCtx::call(unsigned msg)
 {
   if (msg == H264ENCODERCONTEXT_CREATE) 
     startNewFrame = true;
+
+  if (shmActive) {
+    shm->msg = msg;
+    shmTransact();
+    return;
+  }
+
   writeStream((char*) &msg, sizeof(msg));
   flushStream();
   readStream((char*) &msg, sizeof(msg));
@@ -146,6 +183,13 @@ void H264EncCtx::call(unsigned msg, unsigned value)
     case SET_FRAME_WIDTH:  width  = value; size = (unsigned) (width * height * 1.5) + sizeof(frameHeader) + 40; break;
     case SET_FRAME_HEIGHT: height = value; size = (unsigned) (width * height * 1.5) + sizeof(frameHeader) + 40; break;
    }
+
+  if (shmActive) {
+    shm->msg = msg;
+    shm->value = value;
+    shmTransact();
+    return;
+  }
   
   writeStream((char*) &msg, sizeof(msg));
   writeStream((char*) &value, sizeof(value));
@@ -155,6 +199,11 @@ void H264EncCtx::call(unsigned msg, unsigned value)
      
 void H264EncCtx::call(unsigned msg , const u_char * src, unsigned & srcLen, u_char * dst, unsigned & dstLen, unsigned & headerLen, unsigned int & flags, int & ret)
 {
+  if (shmActive) {
+    shmEncode(msg, src, srcLen, dst, dstLen, headerLen, flags, ret);
+    return;
+  }
+
   if (startNewFrame) {
 
     writeStream((char*) &msg, sizeof(msg));
@@ -222,6 +271,139 @@ bool H264EncCtx::createPipes()
   return true;
 }
 
+bool H264EncCtx::createShm()
+{
+#ifdef H264_SHM_SUPPORT
+  const char * transport = ::getenv("H264_IPC_TRANSPORT");
+  if (transport != NULL && strcmp(transport, "pipe") == 0) {
+    TRACE(4, "H264\tIPC\tPP: Shared memory transport disabled");
+    return false;
+  }
+
+#ifdef SYS_memfd_create
+  // close on exec, so helpers of later contexts do not keep this region alive
+  shmFd = syscall(SYS_memfd_create, "x264-shm", MFD_CLOEXEC);
+#endif
+  if (shmFd < 0) {
+    // no memfd, use an unlinked file on the shm file system
+    char shmName[512];
+    snprintf(shmName, sizeof(shmName), "/dev/shm/x264-shm-%d-%u-XXXXXX", getpid(), GetInstanceNumber());
+    shmFd = mkostemp(shmName, O_CLOEXEC);
+    if (shmFd < 0) {
+      TRACE(2, "H264\tIPC\tPP: Error when trying to create shared memory - " << strerror(errno));
+      return false;
+    }
+    unlink(shmName);
+  }
+
+  if (ftruncate(shmFd, H264_SHM_REGION_SIZE) != 0) {
+    TRACE(2, "H264\tIPC\tPP: Error when trying to size shared memory - " << strerror(errno));
+    closeShm();
+    return false;
+  }
+
+  // pages of the frame ring are only allocated once touched
+  void * region = mmap(NULL, H264_SHM_REGION_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, shmFd, 0);
+  if (region == MAP_FAILED) {
+    TRACE(2, "H264\tIPC\tPP: Error when trying to map shared memory - " << strerror(errno));
+    closeShm();
+    return false;
+  }
+
+  shm = (H264ShmControl *)region;
+  memset(shm, 0, sizeof(H264ShmControl));
+  shm->magic = H264_SHM_MAGIC;
+  shm->version = H264_SHM_VERSION;
+  return true;
+#else
+  return false;
+#endif
+}
+
+void H264EncCtx::closeShm()
+{
+#ifdef H264_SHM_SUPPORT
+  if (shmActive) {
+    // the helper does not read the pipes in this mode, tell it to go
+    shm->msg = H264_SHM_EXIT;
+    H264ShmSignal(&shm->request);
+  }
+  if (shm != NULL) {
+    munmap(shm, H264_SHM_REGION_SIZE);
+    shm = NULL;
+  }
+  if (shmFd >= 0) {
+    close(shmFd);
+    shmFd = -1;
+  }
+  shmActive = false;
+#endif
+}
+
+bool H264EncCtx::shmTransact()
+{
+#ifdef H264_SHM_SUPPORT
+  int seen = shm->response;
+  H264ShmSignal(&shm->request);
+
+  while (!H264ShmWait(&shm->response, seen, H264_SHM_TIMEOUT)) {
+    if (waitpid(helperPid, NULL, WNOHANG) == helperPid || kill(helperPid, 0) != 0) {
+      TRACE(1, "H264\tIPC\tPP: GPL process gone - terminating");
+      closeShm();
+      closeAndRemovePipes();
+      return false;
+    }
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+void H264EncCtx::shmEncode(unsigned msg, const u_char * src, unsigned & srcLen, u_char * dst, unsigned & dstLen, unsigned & headerLen, unsigned int & flags, int & ret)
+{
+#ifdef H264_SHM_SUPPORT
+  if (startNewFrame) {
+    unsigned len = size ? size : srcLen;
+    if (len > H264_SHM_FRAME_SIZE || headerLen > H264_SHM_DST_SIZE) {
+      TRACE(1, "H264\tIPC\tPP: Frame of " << len << " bytes too large for shared memory");
+      dstLen = 0;
+      ret = 0;
+      return;
+    }
+
+    // the helper encodes straight out of the slot
+    shmSlot = (shmSlot + 1) % H264_SHM_FRAMES;
+    memcpy(H264ShmFrame(shm, shmSlot), src, len);
+    memcpy(H264ShmDst(shm), dst, headerLen);
+    shm->msg = msg;
+    shm->slot = shmSlot;
+    shm->srcLen = len;
+    shm->headerLen = headerLen;
+    shm->flags = flags;
+  }
+  else
+    shm->msg = ENCODE_FRAMES_BUFFERED;
+
+  shm->dstLen = dstLen < H264_SHM_DST_SIZE ? dstLen : H264_SHM_DST_SIZE;
+  if (!shmTransact()) {
+    dstLen = 0;
+    ret = 0;
+    return;
+  }
+
+  dstLen = shm->dstLen;
+  memcpy(dst, H264ShmDst(shm), dstLen);
+  flags = shm->flags;
+  ret = shm->ret;
+
+  if (flags & 1) 
+    startNewFrame = true;
+   else
+    startNewFrame = false;
+#endif
+}
+
 void H264EncCtx::closeAndRemovePipes()
 {
   if (pipesOpened) {
@@ -317,6 +499,17 @@ void H264EncCtx::execGplProcess()
 {
   unsigned msg;
   unsigned status = 0;
+
+#ifdef H264_SHM_SUPPORT
+  if (shmFd >= 0) {
+    // only the region of this context is passed on to its helper
+    fcntl(shmFd, F_SETFD, fcntl(shmFd, F_GETFD) & ~FD_CLOEXEC);
+    char fdString[16];
+    snprintf(fdString, sizeof(fdString), "%d", shmFd);
+    setenv(H264_SHM_FD_ENV, fdString, 1);
+  }
+#endif
+
   if (execl(gplProcess,"h264_video_pwplugin_helper", dlName,ulName, NULL) == -1) {
 
     TRACE(1, "H264\tIPC\tPP: Error when trying to execute GPL process  " << gplProcess << " - " << strerror(errno));
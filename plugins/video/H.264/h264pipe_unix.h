@@ -29,9 +29,12 @@
 #define __H264PIPE_H__ 1
 #include "shared/pipes.h"
 #include <fstream>
+#include <sys/types.h>
 
 typedef unsigned char u_char;
 
+struct H264ShmControl;
+
 class H264EncCtx
 {
   public:
@@ -54,6 +57,10 @@ class H264EncCtx
      bool checkGplProcessExists (const char * dir);
      void execGplProcess();
      void cpCloseAndExit();
+     bool createShm();
+     void closeShm();
+     bool shmTransact();
+     void shmEncode(unsigned msg, const u_char * src, unsigned & srcLen, u_char * dst, unsigned & dstLen, unsigned & headerLen, unsigned int & flags, int & ret);
 
      char dlName [512];
      char ulName [512];
@@ -67,6 +74,13 @@ class H264EncCtx
      bool loaded;
      bool pipesCreated;
      bool pipesOpened;
+
+     // shared memory transport, preferred over the pipes when available
+     int shmFd;
+     H264ShmControl * shm;
+     bool shmActive;
+     unsigned shmSlot;
+     pid_t helperPid;
      
      // only for signaling failed execution of helper process
      std::ifstream cpDLStream;
@@ -0,0 +1,132 @@
+/*****************************************************************************/
+/* The contents of this file are subject to the Mozilla Public License       */
+/* Version 1.0 (the "License"); you may not use this file except in          */
+/* compliance with the License.  You may obtain a copy of the License at     */
+/* http://www.mozilla.org/MPL/                                               */
+/*                                                                           */
+/* Software distributed under the License is distributed on an "AS IS"       */
+/* basis, WITHOUT WARRANTY OF ANY KIND, either express or implied.  See the  */
+/* License for the specific language governing rights and limitations under  */
+/* the License.                                                              */
+/*                                                                           */
+/* The Original Code is the Open H323 Library.                               */
+/*                                                                           */
+/* Contributor(s): ______________________________________.                   */
+/*                                                                           */
+/* Alternatively, the contents of this file may be used under the terms of   */
+/* the GNU General Public License Version 2 or later (the "GPL"), in which   */
+/* case the provisions of the GPL are applicable instead of those above.  If */
+/* you wish to allow use of your version of this file only under the terms   */
+/* of the GPL and not to allow others to use your version of this file under */
+/* the MPL, indicate your decision by deleting the provisions above and      */
+/* replace them with the notice and other provisions required by the GPL.    */
+/* If you do not delete the provisions above, a recipient may use your       */
+/* version of this file under either the MPL or the GPL.                     */
+/*****************************************************************************/
+
+/*
+  Notes
+  -----
+
+  Shared memory transport between the H.264 plugin and the GPL helper.
+  The plugin creates the region before forking the helper and passes the
+  file descriptor in the H264_SHM_FD_ENV environment variable. The helper
+  reports a successful attach with H264_SHM_STATUS in the INIT reply, after
+  which all messages go through the region and the named pipes are only
+  kept open. Helpers or plugins without shared memory support simply keep
+  using the pipes.
+
+  Layout: control block, encoded output area, then a ring of input frames.
+  The plugin fills the next frame slot and the request fields, then bumps
+  the request counter. The helper encodes straight from the slot into the
+  output area and bumps the response counter. Both counters are futex
+  words, so an idle side sleeps in the kernel.
+ */
+
+#ifndef __SHMRING_H__
+#define __SHMRING_H__ 1
+
+#if defined(__linux__)
+
+#define H264_SHM_SUPPORT 1
+
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#define H264_SHM_MAGIC         0x78323634   /* "x264" */
+#define H264_SHM_VERSION       1
+#define H264_SHM_FD_ENV        "H264_HELPER_SHM_FD"
+#define H264_SHM_STATUS        2            /* INIT status bit, helper attached */
+#define H264_SHM_EXIT          0x7fffffff   /* plugin detaching, no reply */
+
+#define H264_SHM_FRAMES        2            /* input frames in the ring */
+#define H264_SHM_CONTROL_SIZE  4096
+#define H264_SHM_DST_SIZE      65536
+#define H264_SHM_FRAME_SIZE    (4096*2304*3/2 + 4096)   /* up to 4K plus RTP and frame headers */
+#define H264_SHM_REGION_SIZE   (H264_SHM_CONTROL_SIZE + H264_SHM_DST_SIZE + H264_SHM_FRAMES*H264_SHM_FRAME_SIZE)
+
+#define H264_SHM_TIMEOUT       1000         /* ms between liveness checks */
+
+struct H264ShmControl {
+  unsigned magic;
+  unsigned version;
+
+  volatile int request;    /* futex, bumped by the plugin */
+  volatile int response;   /* futex, bumped by the helper */
+
+  unsigned msg;
+  unsigned value;
+  unsigned slot;           /* frame slot holding the input */
+  unsigned srcLen;
+  unsigned headerLen;      /* RTP header already placed in the output area */
+  unsigned dstLen;         /* in: output capacity, out: output length */
+  unsigned flags;
+  int      ret;
+};
+
+static inline unsigned char * H264ShmDst(H264ShmControl * shm)
+{
+  return (unsigned char *)shm + H264_SHM_CONTROL_SIZE;
+}
+
+static inline unsigned char * H264ShmFrame(H264ShmControl * shm, unsigned slot)
+{
+  return (unsigned char *)shm + H264_SHM_CONTROL_SIZE + H264_SHM_DST_SIZE + (slot % H264_SHM_FRAMES)*H264_SHM_FRAME_SIZE;
+}
+
+/* Publish the fields written so far and wake the other side */
+static inline void H264ShmSignal(volatile int * word)
+{
+  __sync_fetch_and_add(word, 1);
+  syscall(SYS_futex, word, FUTEX_WAKE, 1, NULL, NULL, 0);
+}
+
+/* Wait for the word to move on from seen, false on timeout */
+static inline bool H264ShmWait(volatile int * word, int seen, int timeoutMs)
+{
+  // The answer to a small request is often back within a few microseconds
+  for (int spin = 0; spin < 1000; spin++) {
+    if (*word != seen) {
+      __sync_synchronize();
+      return true;
+    }
+  }
+
+  while (*word == seen) {
+    struct timespec timeout;
+    timeout.tv_sec  = timeoutMs/1000;
+    timeout.tv_nsec = (timeoutMs%1000)*1000000L;
+    if (syscall(SYS_futex, word, FUTEX_WAIT, seen, &timeout, NULL, 0) == -1 && errno == ETIMEDOUT)
+      return false;
+  }
+
+  __sync_synchronize();
+  return true;
+}
+
+#endif /* __linux__ */
+
+#endif /* __SHMRING_H__ */
@@ -0,0 +1,138 @@
+/*
+ * aging.cxx
+ *
+ * Gatekeeper aging benchmark: timer wheel against a full sweep.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#include <gkserver.h>
+
+#include <map>
+#include <vector>
+
+#define new PNEW
+
+
+// One simulated second of the monitor thread: RRQ keep alives refresh a
+// share of the endpoints, then whatever is due is aged out.
+static void TimeAging(PINDEX registrations, unsigned seconds)
+{
+  static const unsigned TimeToLive = 60;
+  static const unsigned Grace = 10;     // As the gatekeeper adds to the TTL
+
+  std::vector<PString> identifiers;
+  PINDEX i;
+  for (i = 0; i < registrations; i++)
+    identifiers.push_back(psprintf("%u:callload", (unsigned)i));
+
+  // Endpoint i refreshes in second i%TimeToLive of each period, so starts
+  // with the deadline of its refresh a period ago. Every hundredth endpoint
+  // goes silent and must be aged out.
+  PInt64 base = PTime().GetTimeInSeconds();
+  std::vector<PInt64> initial;
+  for (i = 0; i < registrations; i++)
+    initial.push_back(base + (i%TimeToLive != 0 ? i%TimeToLive : TimeToLive) + Grace);
+
+  std::map<PString, PInt64> deadlines;
+  H323GatekeeperTimerWheel wheel;
+  PInt64 start = PTime().GetTimestamp();
+  for (i = 0; i < registrations; i++)
+    wheel.Schedule(identifiers[i], PTime((time_t)initial[i]));
+  PInt64 scheduleTime = PTime().GetTimestamp() - start;
+  for (i = 0; i < registrations; i++)
+    deadlines[identifiers[i]] = initial[i];
+
+  // The per second walk of every registration the monitor did before
+  PINDEX scanExpired = 0;
+  start = PTime().GetTimestamp();
+  unsigned second;
+  for (second = 1; second <= seconds; second++) {
+    PInt64 now = base + second;
+    for (i = second%TimeToLive; i < registrations; i += TimeToLive) {
+      if (i%100 != 0)
+        deadlines[identifiers[i]] = now + TimeToLive + Grace;
+    }
+    std::map<PString, PInt64>::iterator it = deadlines.begin();
+    while (it != deadlines.end()) {
+      if (it->second < now) {
+        deadlines.erase(it++);
+        scanExpired++;
+      }
+      else
+        ++it;
+    }
+  }
+  PInt64 scanTime = PTime().GetTimestamp() - start;
+
+  PINDEX wheelExpired = 0;
+  std::vector<PString> due;
+  start = PTime().GetTimestamp();
+  for (second = 1; second <= seconds; second++) {
+    PTime now((time_t)(base + second));
+    PTime deadline((time_t)(base + second + TimeToLive + Grace));
+    for (i = second%TimeToLive; i < registrations; i += TimeToLive) {
+      if (i%100 != 0)
+        wheel.Schedule(identifiers[i], deadline);
+    }
+    due.clear();
+    // Stop one second short of now, as the scan only ages what is overdue
+    wheelExpired += wheel.Expire(PTime((time_t)(base + second - 1)), due);
+  }
+  PInt64 wheelTime = PTime().GetTimestamp() - start;
+
+  cout << setw(10) << registrations
+       << setw(10) << (unsigned)(scheduleTime*1000/registrations) << " ns/schedule"
+       << setw(12) << setprecision(4) << (double)scanTime/1000/seconds << " ms/s scan"
+       << setw(12) << setprecision(4) << (double)wheelTime/1000/seconds << " ms/s wheel"
+       << setw(8) << wheelExpired << " aged"
+       << (wheelExpired != scanExpired || wheel.GetSize() != registrations - wheelExpired ? "  MISMATCH" : "")
+       << endl;
+}
+
+
+void CallLoadProcess::RunAgingBenchmark(PINDEX registrations)
+{
+  static const unsigned Seconds = 120;
+
+  cout << "Registration aging benchmark, " << Seconds << " simulated seconds, 60s TTL, 1% silent" << endl;
+
+  if (registrations > 0)
+    TimeAging(registrations, Seconds);
+  else {
+    TimeAging(10000, Seconds);
+    TimeAging(100000, Seconds);
+    TimeAging(1000000, Seconds);
+  }
+
+  cout << endl;
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
@@ -0,0 +1,218 @@
+/*
+ * bench.cxx
+ *
+ * Helpers shared by the callload micro benchmarks.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "bench.h"
+
+#include <new>
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+
+///////////////////////////////////////////////////////////////
+// Count heap allocations so the benchmarks can report allocations per
+// message. PTLib supplies its own operator new when memory checking is on.
+
+#ifdef CALLLOAD_COUNT_ALLOCATIONS
+
+#if defined(_MSC_VER)
+static volatile long AllocationCount = 0;
+#define CountAllocation() InterlockedIncrement(&AllocationCount)
+#else
+static volatile long AllocationCount = 0;
+#define CountAllocation() __sync_fetch_and_add(&AllocationCount, 1)
+#endif
+
+#if __cplusplus >= 201103L
+#define CALLLOAD_THROW_BAD_ALLOC
+#define CALLLOAD_NO_THROW noexcept
+#else
+#define CALLLOAD_THROW_BAD_ALLOC throw(std::bad_alloc)
+#define CALLLOAD_NO_THROW throw()
+#endif
+
+void * operator new(size_t size) CALLLOAD_THROW_BAD_ALLOC
+{
+  CountAllocation();
+  void * ptr = malloc(size != 0 ? size : 1);
+  if (ptr == NULL)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void * operator new[](size_t size) CALLLOAD_THROW_BAD_ALLOC
+{
+  return operator new(size);
+}
+
+void * operator new(size_t size, const std::nothrow_t &) CALLLOAD_NO_THROW
+{
+  CountAllocation();
+  return malloc(size != 0 ? size : 1);
+}
+
+void * operator new[](size_t size, const std::nothrow_t &) CALLLOAD_NO_THROW
+{
+  CountAllocation();
+  return malloc(size != 0 ? size : 1);
+}
+
+void operator delete(void * ptr) CALLLOAD_NO_THROW
+{
+  free(ptr);
+}
+
+void operator delete[](void * ptr) CALLLOAD_NO_THROW
+{
+  free(ptr);
+}
+
+void operator delete(void * ptr, const std::nothrow_t &) CALLLOAD_NO_THROW
+{
+  free(ptr);
+}
+
+void operator delete[](void * ptr, const std::nothrow_t &) CALLLOAD_NO_THROW
+{
+  free(ptr);
+}
+
+#endif // CALLLOAD_COUNT_ALLOCATIONS
+
+
+#define new PNEW
+
+
+///////////////////////////////////////////////////////////////
+
+PBoolean GetProcessUsage(double & cpuSeconds, unsigned & threads, PUInt64 & rss)
+{
+  threads = 0;
+  rss = 0;
+
+#ifdef _WIN32
+  FILETIME created, exited, kernel, user;
+  if (!GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user))
+    return FALSE;
+
+  ULARGE_INTEGER kernelTime, userTime;
+  kernelTime.LowPart  = kernel.dwLowDateTime;
+  kernelTime.HighPart = kernel.dwHighDateTime;
+  userTime.LowPart    = user.dwLowDateTime;
+  userTime.HighPart   = user.dwHighDateTime;
+  cpuSeconds = (double)(PInt64)(kernelTime.QuadPart + userTime.QuadPart)/10000000.0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return FALSE;
+
+  cpuSeconds = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+               (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec)/1000000.0;
+#endif
+
+#ifdef P_LINUX
+  PTextFile status;
+  if (status.Open("/proc/self/status", PFile::ReadOnly)) {
+    PString line;
+    while (status.ReadLine(line)) {
+      if (line.Left(8) == "Threads:")
+        threads = line.Mid(8).Trim().AsUnsigned();
+      else if (line.Left(6) == "VmRSS:")
+        rss = (PUInt64)line.Mid(6).Trim().AsUnsigned()*1024;
+    }
+  }
+#endif
+
+  return TRUE;
+}
+
+
+long GetAllocationCount()
+{
+#ifdef CALLLOAD_COUNT_ALLOCATIONS
+  return AllocationCount;
+#else
+  return 0;
+#endif
+}
+
+
+unsigned NextRandom(unsigned & seed)
+{
+  seed = seed*1103515245 + 12345;
+  return seed >> 8;
+}
+
+
+PString RandomNumber(unsigned & seed)
+{
+  unsigned high = NextRandom(seed)%10000;
+  unsigned low = NextRandom(seed)%100000;
+  return psprintf("44%04u%05u", high, low);
+}
+
+
+void TimeBenchmark(const char * name,
+                   CallLoadBenchFunction function,
+                   const PBYTEArray & raw,
+                   H323Transport & transport,
+                   PINDEX iterations)
+{
+  PINDEX i;
+  for (i = 0; i < 100; i++) {
+    if (!function(raw, transport)) {
+      cout << setw(28) << name << "  failed" << endl;
+      return;
+    }
+  }
+
+  long allocations = GetAllocationCount();
+  PInt64 start = PTime().GetTimestamp();
+
+  for (i = 0; i < iterations; i++)
+    function(raw, transport);
+
+  PInt64 elapsed = PTime().GetTimestamp() - start;
+  allocations = GetAllocationCount() - allocations;
+
+  cout << setw(28) << name
+       << setw(10) << (unsigned)(elapsed*1000/iterations) << " ns/msg";
+#ifdef CALLLOAD_COUNT_ALLOCATIONS
+  cout << setw(10) << setprecision(4) << (double)allocations/iterations << " allocs/msg";
+#endif
+  cout << endl;
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
@@ -0,0 +1,80 @@
+/*
+ * bench.h
+ *
+ * Helpers shared by the callload micro benchmarks.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef _CallLoad_BENCH_H
+#define _CallLoad_BENCH_H
+
+#include <h323.h>
+
+#if !PMEMORY_CHECK
+// bench.cxx replaces the global operator new to count allocations
+#define CALLLOAD_COUNT_ALLOCATIONS 1
+#endif
+
+
+/**Get the CPU time, thread count and resident memory of the process.
+   The thread count and memory are only available on Linux, zero elsewhere.
+  */
+PBoolean GetProcessUsage(double & cpuSeconds, unsigned & threads, PUInt64 & rss);
+
+/**Get the number of heap allocations made so far, zero when not counted.
+  */
+long GetAllocationCount();
+
+/**Step a simple linear congruential generator, repeatable across runs.
+  */
+unsigned NextRandom(unsigned & seed);
+
+/**Get a random eleven digit E.164 number.
+  */
+PString RandomNumber(unsigned & seed);
+
+
+typedef PBoolean (*CallLoadBenchFunction)(const PBYTEArray & raw, H323Transport & transport);
+
+/**Time a function over an encoded message, printing ns and allocations
+   per message.
+  */
+void TimeBenchmark(
+  const char * name,
+  CallLoadBenchFunction function,
+  const PBYTEArray & raw,
+  H323Transport & transport,
+  PINDEX iterations
+);
+
+/**Encode a signalling PDU as it would be sent.
+  */
+PBYTEArray EncodeSignalPDU(H323SignalPDU & pdu);
+
+/**Get a Setup with two fast start proposals, as a typical audio call sends.
+  */
+PBYTEArray BuildSetupPDU(const H323Connection & connection);
+
+
+#endif  // _CallLoad_BENCH_H
+
+
+// End of File ///////////////////////////////////////////////////////////////
@@ -0,0 +1,188 @@
+/*
+ * buffers.cxx
+ *
+ * Media buffer benchmark: allocations on the packet path.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#include <vector>
+
+#define new PNEW
+
+
+static RTP_UDP * OpenLoopbackSession(H323EndPoint & endpoint, H323Connection & connection)
+{
+#ifdef H323_RTP_AGGREGATE
+  RTP_UDP * session = new RTP_UDP(NULL, 1);
+#else
+  RTP_UDP * session = new RTP_UDP(1);
+#endif
+  WORD port = endpoint.GetRtpIpPortPair();
+  if (session->Open(PIPSocket::Address(127, 0, 0, 1), port, port, 0, connection))
+    return session;
+
+  delete session;
+  return NULL;
+}
+
+
+static void PrintPoolCounters(const RTP_FramePool::Statistics & before, PINDEX count, const char * unit)
+{
+  RTP_FramePool::Statistics after;
+  RTP_FramePool::Default().GetStatistics(after);
+
+  cout << setw(10) << setprecision(4) << (double)(after.heapAllocations - before.heapAllocations)/count << " pool new/" << unit
+       << setw(10) << setprecision(4) << (double)(after.poolAllocations - before.poolAllocations)/count << " reused/" << unit
+       << setw(10) << setprecision(4) << (double)(after.copies - before.copies)/count << " copies/" << unit;
+}
+
+
+static void TimePacketPath(const char * name, PINDEX reactorThreads, PINDEX packets)
+{
+  H323EndPoint endpoint;
+  H323Connection * connection = new H323Connection(endpoint, 1);
+  RTP_MediaReactor * reactor = reactorThreads > 0 ? new RTP_MediaReactor(reactorThreads) : NULL;
+
+  RTP_UDP * session = OpenLoopbackSession(endpoint, *connection);
+  if (session == NULL) {
+    cout << setw(28) << name << "  could not open session" << endl;
+    delete reactor;
+    delete connection;
+    return;
+  }
+  if (reactor != NULL)
+    session->AttachReactor(reactor);
+
+  PIPSocket::Address localhost(127, 0, 0, 1);
+  PUDPSocket sender;
+  sender.Listen(localhost);
+  WORD port = session->GetLocalDataPort();
+
+  RTP_DataFrame packet(160);
+  packet.SetPayloadType(RTP_DataFrame::PCMU);
+  memset(packet.GetPayloadPtr(), 0xff, 160);
+
+  RTP_DataFrame frame;
+  PINDEX i;
+  for (i = 0; i < 100; i++) {
+    packet.SetSequenceNumber((WORD)i);
+    sender.WriteTo(packet.GetPointer(), packet.GetHeaderSize()+160, localhost, port);
+    session->ReadData(frame, TRUE);
+  }
+
+  RTP_FramePool::Statistics before;
+  RTP_FramePool::Default().GetStatistics(before);
+  long allocations = GetAllocationCount();
+  PInt64 start = PTime().GetTimestamp();
+
+  PINDEX received = 0;
+  for (i = 0; i < packets; i++) {
+    packet.SetSequenceNumber((WORD)(i+100));
+    packet.SetTimestamp((DWORD)i*160);
+    sender.WriteTo(packet.GetPointer(), packet.GetHeaderSize()+160, localhost, port);
+    if (!session->ReadData(frame, TRUE))
+      break;
+    received++;
+  }
+
+  PInt64 elapsed = PTime().GetTimestamp() - start;
+  allocations = GetAllocationCount() - allocations;
+
+  if (received == 0)
+    received = 1;
+  cout << setw(28) << name
+       << setw(10) << (unsigned)(elapsed*1000/received) << " ns/pkt";
+#ifdef CALLLOAD_COUNT_ALLOCATIONS
+  cout << setw(10) << setprecision(4) << (double)allocations/received << " allocs/pkt";
+#endif
+  PrintPoolCounters(before, received, "pkt");
+  cout << endl;
+
+  session->Close(TRUE);
+  delete session;
+  delete reactor;
+  delete connection;
+}
+
+
+static void TimeSessionBuffers(const char * name, PINDEX count)
+{
+  H323EndPoint endpoint;
+  H323Connection * connection = new H323Connection(endpoint, 1);
+
+  RTP_FramePool::Statistics before;
+  RTP_FramePool::Default().GetStatistics(before);
+  long allocations = GetAllocationCount();
+
+  std::vector<RTP_UDP *> sessions;
+  PINDEX i;
+  for (i = 0; i < count; i++) {
+    RTP_UDP * session = OpenLoopbackSession(endpoint, *connection);
+    if (session == NULL)
+      break;
+    // 20 to 100ms of G.711, as an audio receive channel sets up
+    session->SetJitterBufferSize(160, 800, endpoint.GetJitterThreadStackSize());
+    sessions.push_back(session);
+  }
+
+  for (i = 0; i < (PINDEX)sessions.size(); i++)
+    sessions[i]->Close(TRUE);
+  for (i = 0; i < (PINDEX)sessions.size(); i++)
+    delete sessions[i];
+
+  allocations = GetAllocationCount() - allocations;
+  PINDEX opened = sessions.empty() ? 1 : sessions.size();
+
+  cout << setw(28) << name;
+#ifdef CALLLOAD_COUNT_ALLOCATIONS
+  cout << setw(10) << allocations/opened << " allocs/ses";
+#endif
+  PrintPoolCounters(before, opened, "ses");
+  cout << endl;
+
+  delete connection;
+}
+
+
+void CallLoadProcess::RunBufferBenchmark(PINDEX packets)
+{
+  cout << "Receive buffer benchmark, " << packets << " loopback G.711 packets" << endl;
+
+  TimePacketPath("Direct socket read", 0, packets);
+  TimePacketPath("Media reactor", 1, packets);
+
+  // The second round shows the jitter buffer frames coming back from the pool
+  TimeSessionBuffers("Jitter buffers, first 100", 100);
+  TimeSessionBuffers("Jitter buffers, next 100", 100);
+  cout << endl;
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
@@ -0,0 +1,91 @@
+/*
+ * codecs.cxx
+ *
+ * Codec setup benchmark: created against pooled contexts.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#define new PNEW
+
+
+static PInt64 TimeCodecSetup(const H323Capability & capability, PINDEX iterations)
+{
+  PInt64 start = PTime().GetTimestamp();
+  for (PINDEX i = 0; i < iterations; i++) {
+    delete capability.CreateCodec(H323Codec::Encoder);
+    delete capability.CreateCodec(H323Codec::Decoder);
+  }
+  return PTime().GetTimestamp() - start;
+}
+
+
+void CallLoadProcess::RunCodecBenchmark(PINDEX iterations)
+{
+  H323EndPoint endpoint;
+  endpoint.AddAllCapabilities(0, P_MAX_INDEX, "*");
+
+  // Heavy codecs start helper processes, a few hundred calls is plenty
+  iterations = PMIN(iterations, 200);
+
+  cout << "Codec setup benchmark, " << iterations << " encoder and decoder pairs\n"
+       << setw(28) << "Capability" << setw(14) << "created us" << setw(14) << "pooled us" << endl;
+
+  const H323Capabilities & capabilities = endpoint.GetCapabilities();
+  for (PINDEX i = 0; i < capabilities.GetSize(); i++) {
+    const H323Capability & capability = capabilities[i];
+    if (capability.GetMainType() != H323Capability::e_Audio && capability.GetMainType() != H323Capability::e_Video)
+      continue;
+
+    H323PluginCodecManager::SetContextPool(0);
+    PInt64 created = TimeCodecSetup(capability, iterations);
+
+    cout << setw(28) << capability.GetFormatName()
+         << setw(14) << (unsigned)(created/iterations);
+
+    // Only codecs that can reset a used context are pooled
+    if (!H323PluginCodecManager::SetContextPooling(capability.GetFormatName())) {
+      cout << setw(14) << "not poolable" << endl;
+      continue;
+    }
+
+    H323PluginCodecManager::SetContextPool(1);
+    TimeCodecSetup(capability, 1);    // leave a context of each direction in the pool
+    PInt64 pooled = TimeCodecSetup(capability, iterations);
+    H323PluginCodecManager::SetContextPooling(capability.GetFormatName(), FALSE);
+
+    cout << setw(14) << (unsigned)(pooled/iterations) << endl;
+  }
+
+  H323PluginCodecManager::SetContextPool(0);
+  cout << endl;
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
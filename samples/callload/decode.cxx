@@ -0,0 +1,176 @@
+/*
+ * decode.cxx
+ *
+ * PDU decode benchmark.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#include <h323arena.h>
+
+#define new PNEW
+
+
+PBYTEArray EncodeSignalPDU(H323SignalPDU & pdu)
+{
+  pdu.BuildQ931();
+  PBYTEArray raw;
+  pdu.GetQ931().Encode(raw);
+  return raw;
+}
+
+
+PBYTEArray BuildSetupPDU(const H323Connection & connection)
+{
+  H323SignalPDU pdu;
+  H225_Setup_UUIE & setup = pdu.BuildSetup(connection, H323TransportAddress("ip$127.0.0.1:1720"));
+
+  // Two fast start proposals, as a typical audio call carries
+  setup.IncludeOptionalField(H225_Setup_UUIE::e_fastStart);
+  setup.m_fastStart.SetSize(2);
+  for (PINDEX i = 0; i < 2; i++) {
+    H245_OpenLogicalChannel olc;
+    olc.m_forwardLogicalChannelNumber = 101+i;
+
+    H245_OpenLogicalChannel_forwardLogicalChannelParameters & fwd = olc.m_forwardLogicalChannelParameters;
+    fwd.m_dataType.SetTag(H245_DataType::e_audioData);
+    H245_AudioCapability & audio = fwd.m_dataType;
+    audio.SetTag(H245_AudioCapability::e_g711Ulaw64k);
+    (PASN_Integer &)audio = 20;
+
+    fwd.m_multiplexParameters.SetTag(H245_OpenLogicalChannel_forwardLogicalChannelParameters_multiplexParameters::e_h2250LogicalChannelParameters);
+    H245_H2250LogicalChannelParameters & param = fwd.m_multiplexParameters;
+    param.m_sessionID = 1;
+    param.IncludeOptionalField(H245_H2250LogicalChannelParameters::e_mediaControlChannel);
+    H323TransportAddress("ip$127.0.0.1:5001").SetPDU(param.m_mediaControlChannel);
+
+    setup.m_fastStart[i].EncodeSubType(olc);
+  }
+
+  return EncodeSignalPDU(pdu);
+}
+
+
+static PBYTEArray BuildTCSPDU(const H323Connection & connection)
+{
+  H323ControlPDU pdu;
+  pdu.BuildTerminalCapabilitySet(connection, 1, FALSE);
+
+  PPER_Stream strm;
+  pdu.Encode(strm);
+  strm.CompleteEncoding();
+  return strm;
+}
+
+
+static PBYTEArray BuildARQPDU(const H323Connection & connection)
+{
+  H323RasPDU pdu;
+  H225_AdmissionRequest & arq = pdu.BuildAdmissionRequest(1);
+
+  arq.m_callType.SetTag(H225_CallType::e_pointToPoint);
+  arq.m_endpointIdentifier = "callload-endpoint";
+  arq.IncludeOptionalField(H225_AdmissionRequest::e_destinationInfo);
+  arq.m_destinationInfo.SetSize(1);
+  H323SetAliasAddress("callee", arq.m_destinationInfo[0]);
+  arq.m_srcInfo.SetSize(1);
+  H323SetAliasAddress("caller", arq.m_srcInfo[0]);
+  arq.IncludeOptionalField(H225_AdmissionRequest::e_srcCallSignalAddress);
+  H323TransportAddress("ip$127.0.0.1:1721").SetPDU(arq.m_srcCallSignalAddress);
+  arq.m_bandWidth = 1280;
+  arq.m_callReferenceValue = connection.GetCallReference();
+  arq.m_conferenceID = connection.GetConferenceIdentifier();
+  arq.IncludeOptionalField(H225_AdmissionRequest::e_callIdentifier);
+  arq.m_callIdentifier.m_guid = connection.GetCallIdentifier();
+
+  PPER_Stream strm;
+  pdu.Encode(strm);
+  strm.CompleteEncoding();
+  return strm;
+}
+
+
+static PBoolean DecodeSignalPDU(const PBYTEArray & raw, H323Transport & transport)
+{
+  H323SignalPDU pdu;
+  return pdu.ProcessReadData(transport, raw);
+}
+
+
+static PBoolean DecodeControlPDU(const PBYTEArray & raw, H323Transport &)
+{
+  H323ControlPDU pdu;
+  PPER_Stream strm(raw);
+  return pdu.Decode(strm);
+}
+
+
+static PBoolean DecodeRasPDU(const PBYTEArray & raw, H323Transport &)
+{
+  H323RasPDU pdu;
+  PPER_Stream strm(raw);
+  return pdu.Decode(strm);
+}
+
+
+void CallLoadProcess::RunDecodeBenchmark(PINDEX iterations)
+{
+  H323EndPoint endpoint;
+  endpoint.SetLocalUserName("caller");
+  endpoint.AddAllCapabilities(0, P_MAX_INDEX, "*");
+  endpoint.AddAllUserInputCapabilities(0, P_MAX_INDEX);
+
+  H323Connection * connection = new H323Connection(endpoint, 1);
+  connection->SetRemotePartyName("callee");
+
+  PBYTEArray setup = BuildSetupPDU(*connection);
+  PBYTEArray tcs = BuildTCSPDU(*connection);
+  PBYTEArray arq = BuildARQPDU(*connection);
+  H323TransportTCP transport(endpoint);
+
+  cout << "Decode benchmark, " << iterations << " iterations\n"
+          "  Setup " << setup.GetSize() << " bytes, TCS " << tcs.GetSize()
+       << " bytes, ARQ " << arq.GetSize() << " bytes" << endl;
+
+  PBoolean wasEnabled = H323PDUArena::IsEnabled();
+  for (int arena = 0; arena < 2; arena++) {
+    H323PDUArena::SetEnabled(arena != 0);
+    cout << (arena != 0 ? "Arena decoding:" : "Heap decoding:") << endl;
+    TimeBenchmark("Setup", DecodeSignalPDU, setup, transport, iterations);
+    TimeBenchmark("TerminalCapabilitySet", DecodeControlPDU, tcs, transport, iterations);
+    TimeBenchmark("AdmissionRequest", DecodeRasPDU, arq, transport, iterations);
+  }
+  H323PDUArena::SetEnabled(wasEnabled);
+
+  cout << endl;
+  delete connection;
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
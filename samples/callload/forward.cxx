@@ -0,0 +1,130 @@
+/*
+ * forward.cxx
+ *
+ * Signalling forward benchmark: full against lazy decoding.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#define new PNEW
+
+
+static PBYTEArray BuildTunnelledTCSPDU(const H323Connection & connection)
+{
+  H323ControlPDU tcs;
+  tcs.BuildTerminalCapabilitySet(connection, 1, FALSE);
+
+  H323SignalPDU pdu;
+  pdu.BuildFacility(connection, TRUE);
+  pdu.m_h323_uu_pdu.m_h245Tunneling = TRUE;
+  pdu.m_h323_uu_pdu.IncludeOptionalField(H225_H323_UU_PDU::e_h245Control);
+  pdu.m_h323_uu_pdu.m_h245Control.SetSize(1);
+  pdu.m_h323_uu_pdu.m_h245Control[0].EncodeSubType(tcs);
+
+  return EncodeSignalPDU(pdu);
+}
+
+
+static PBoolean ForwardSignalPDU(const PBYTEArray & raw, H323Transport & transport, PBoolean lazy)
+{
+  H323SignalPDU pdu;
+  pdu.SetLazyDecode(lazy);
+  if (!pdu.ProcessReadData(transport, raw))
+    return FALSE;
+
+  // A forwarding element only looks at the message type before passing it on
+  if (pdu.GetUUIETag() == H225_H323_UU_PDU_h323_message_body::e_releaseComplete)
+    return TRUE;
+
+  pdu.BuildQ931();
+  PBYTEArray out;
+  return pdu.GetQ931().Encode(out);
+}
+
+
+static PBoolean ForwardRouted(const PBYTEArray & raw, H323Transport & transport)
+{
+  H323SignalPDU pdu;
+  pdu.SetLazyDecode(TRUE);
+  if (!pdu.ProcessReadData(transport, raw))
+    return FALSE;
+
+  // A routing element also finds the call the message belongs to, an empty
+  // body has no call identifier and is routed on the call reference.
+  H225_CallIdentifier callIdentifier;
+  if (!pdu.PeekCallIdentifier(callIdentifier) &&
+      pdu.GetUUIETag() != H225_H323_UU_PDU_h323_message_body::e_empty)
+    return FALSE;
+
+  pdu.BuildQ931();
+  PBYTEArray out;
+  return pdu.GetQ931().Encode(out);
+}
+
+
+static PBoolean ForwardFull(const PBYTEArray & raw, H323Transport & transport)
+{
+  return ForwardSignalPDU(raw, transport, FALSE);
+}
+
+
+static PBoolean ForwardLazy(const PBYTEArray & raw, H323Transport & transport)
+{
+  return ForwardSignalPDU(raw, transport, TRUE);
+}
+
+
+void CallLoadProcess::RunForwardBenchmark(PINDEX iterations)
+{
+  H323EndPoint endpoint;
+  endpoint.SetLocalUserName("caller");
+  endpoint.AddAllCapabilities(0, P_MAX_INDEX, "*");
+  endpoint.AddAllUserInputCapabilities(0, P_MAX_INDEX);
+
+  H323Connection * connection = new H323Connection(endpoint, 1);
+  connection->SetRemotePartyName("callee");
+
+  PBYTEArray setup = BuildSetupPDU(*connection);
+  PBYTEArray facility = BuildTunnelledTCSPDU(*connection);
+  H323TransportTCP transport(endpoint);
+
+  cout << "Forward benchmark, " << iterations << " iterations" << endl;
+  TimeBenchmark("Setup full decode", ForwardFull, setup, transport, iterations);
+  TimeBenchmark("Setup lazy decode", ForwardLazy, setup, transport, iterations);
+  TimeBenchmark("Setup lazy, peek call id", ForwardRouted, setup, transport, iterations);
+  TimeBenchmark("Facility (TCS) full decode", ForwardFull, facility, transport, iterations);
+  TimeBenchmark("Facility (TCS) lazy decode", ForwardLazy, facility, transport, iterations);
+  TimeBenchmark("Facility lazy, peek call id", ForwardRouted, facility, transport, iterations);
+
+  cout << endl;
+  delete connection;
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
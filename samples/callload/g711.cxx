@@ -0,0 +1,155 @@
+/*
+ * g711.cxx
+ *
+ * G.711 benchmark: batch kernels against per sample conversion.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#include <vector>
+
+#define new PNEW
+
+
+#ifdef H323_AUDIO_CODECS
+
+/* Converts 20ms G.711 frames over and over until stopped, as the media
+   threads of that many calls would. */
+class CallLoadG711Worker : public PThread
+{
+    PCLASSINFO(CallLoadG711Worker, PThread);
+  public:
+    enum Modes {
+      ALawEncode,
+      uLawEncode,
+      ALawDecode,
+      uLawDecode,
+      PerSampleEncode
+    };
+
+    CallLoadG711Worker(Modes _mode)
+      : PThread(10000, NoAutoDeleteThread, NormalPriority, "G.711 Worker"),
+        mode(_mode), samples(0), running(TRUE)
+    { Resume(); }
+
+    PUInt64 Stop() { running = FALSE; WaitForTermination(); return samples; }
+
+    void Main()
+    {
+      short linear[160];
+      BYTE encoded[160];
+      unsigned i;
+      for (i = 0; i < 160; i++) {
+        linear[i] = (short)(i*397 - 32000);
+        encoded[i] = (BYTE)i;
+      }
+
+      while (running) {
+        switch (mode) {
+          case ALawEncode :
+            H323G711ALawEncode(linear, encoded, 160);
+            break;
+          case uLawEncode :
+            H323G711uLawEncode(linear, encoded, 160);
+            break;
+          case ALawDecode :
+            H323G711ALawDecode(encoded, linear, 160);
+            break;
+          case uLawDecode :
+            H323G711uLawDecode(encoded, linear, 160);
+            break;
+          default :
+            for (i = 0; i < 160; i++)
+              H323G711ALawEncode(&linear[i], &encoded[i], 1);
+        }
+        samples += 160;
+      }
+    }
+
+  protected:
+    Modes             mode;
+    PUInt64           samples;
+    volatile PBoolean running;
+};
+
+
+static void TimeG711(const char * name, CallLoadG711Worker::Modes mode, PINDEX threads)
+{
+  double startCPU, cpu;
+  unsigned processThreads;
+  PUInt64 rss;
+  GetProcessUsage(startCPU, processThreads, rss);
+  PInt64 start = PTime().GetTimestamp();
+
+  std::vector<CallLoadG711Worker *> workers;
+  PINDEX i;
+  for (i = 0; i < threads; i++)
+    workers.push_back(new CallLoadG711Worker(mode));
+
+  PThread::Sleep(2000);
+
+  PUInt64 samples = 0;
+  for (i = 0; i < threads; i++) {
+    samples += workers[i]->Stop();
+    delete workers[i];
+  }
+
+  PInt64 elapsed = PTime().GetTimestamp() - start;
+  GetProcessUsage(cpu, processThreads, rss);
+  cpu -= startCPU;
+  if (cpu <= 0)
+    cpu = elapsed/1000000.0;
+
+  double perCore = (PInt64)samples/cpu;
+  cout << setw(28) << name
+       << setw(10) << setprecision(4) << (PInt64)samples/(elapsed/1000000.0)/1e6 << " Msamples/s"
+       << setw(10) << setprecision(4) << perCore/1e6 << " per core"
+       << setw(10) << (unsigned)(perCore/8000) << " channels/core" << endl;
+}
+
+
+void CallLoadProcess::RunG711Benchmark(PINDEX threads)
+{
+  if (threads == 0)
+    threads = 1;
+
+  cout << "G.711 benchmark, 20ms frames on " << threads << " threads" << endl;
+
+  TimeG711("A-Law per sample calls", CallLoadG711Worker::PerSampleEncode, threads);
+  TimeG711("A-Law encode", CallLoadG711Worker::ALawEncode, threads);
+  TimeG711("u-Law encode", CallLoadG711Worker::uLawEncode, threads);
+  TimeG711("A-Law decode", CallLoadG711Worker::ALawDecode, threads);
+  TimeG711("u-Law decode", CallLoadG711Worker::uLawDecode, threads);
+  cout << endl;
+}
+
+#endif // H323_AUDIO_CODECS
+
+
+// End of File ///////////////////////////////////////////////////////////////
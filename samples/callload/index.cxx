@@ -0,0 +1,195 @@
+/*
+ * index.cxx
+ *
+ * Gatekeeper registration index benchmark.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#include <gkserver.h>
+
+#include <vector>
+
+#define new PNEW
+
+
+/* Looks up random dialled numbers by longest voice prefix until stopped,
+   standing in for the ARQ/LRQ handling threads of a gatekeeper. */
+class CallLoadIndexReader : public PThread
+{
+    PCLASSINFO(CallLoadIndexReader, PThread);
+  public:
+    CallLoadIndexReader(const H323RegistrationIndex & _index, const std::vector<PString> & _numbers, unsigned _seed)
+      : PThread(10000, NoAutoDeleteThread, NormalPriority, "Index Reader"),
+        index(_index), numbers(_numbers), seed(_seed), lookups(0), running(TRUE)
+    { Resume(); }
+
+    PINDEX Stop() { running = FALSE; WaitForTermination(); return lookups; }
+
+    void Main()
+    {
+      while (running) {
+        index.FindLongestPrefix(numbers[NextRandom(seed)%numbers.size()]);
+        lookups++;
+      }
+    }
+
+  protected:
+    const H323RegistrationIndex & index;
+    const std::vector<PString> & numbers;
+    unsigned          seed;
+    PINDEX            lookups;
+    volatile PBoolean running;
+};
+
+
+static unsigned TimeIndexReaders(const H323RegistrationIndex & index,
+                                 const std::vector<PString> & numbers,
+                                 H323RegistrationIndex * writer)
+{
+  std::vector<CallLoadIndexReader *> readers;
+  PINDEX i;
+  for (i = 0; i < 4; i++)
+    readers.push_back(new CallLoadIndexReader(index, numbers, (unsigned)i+1));
+
+  // Re-register one endpoint as fast as possible, as RRQ/URQ would
+  PTimeInterval finish = PTimer::Tick() + PTimeInterval(2000);
+  while (PTimer::Tick() < finish) {
+    if (writer != NULL) {
+      writer->Add(H323RegistrationIndex::VoicePrefix, "99999", "churn");
+      writer->RemoveAll("churn");
+    }
+    else
+      PThread::Sleep(10);
+  }
+
+  PINDEX lookups = 0;
+  for (i = 0; i < (PINDEX)readers.size(); i++) {
+    lookups += readers[i]->Stop();
+    delete readers[i];
+  }
+  return (unsigned)(lookups/2);
+}
+
+
+void CallLoadProcess::RunIndexBenchmark(PINDEX endpoints, PINDEX lookups)
+{
+  if (endpoints == 0)
+    endpoints = 1;
+
+  cout << "Registration index benchmark, " << endpoints << " endpoints, " << lookups << " lookups" << endl;
+
+  std::vector<PString> identifiers, aliases, addresses, prefixes, numbers;
+  PINDEX i;
+  for (i = 0; i < endpoints; i++) {
+    unsigned n = (unsigned)i;
+    identifiers.push_back(psprintf("%u:callload", n));
+    aliases.push_back(psprintf("endpoint%u", n));
+    addresses.push_back(psprintf("ip$10.%u.%u.%u:1720", (n>>16)&255, (n>>8)&255, n&255));
+    prefixes.push_back(psprintf("44%07u", n));
+    numbers.push_back(prefixes.back() + "123");
+  }
+
+  // The sorted lists and per length prefix search the server used before
+  PInt64 start = PTime().GetTimestamp();
+  PSortedStringList byAlias, byAddress, byVoicePrefix;
+  for (i = 0; i < endpoints; i++) {
+    byAlias.AppendString(aliases[i]);
+    byAddress.AppendString(addresses[i]);
+    byVoicePrefix.AppendString(prefixes[i]);
+  }
+  PInt64 listBuild = PTime().GetTimestamp() - start;
+
+  start = PTime().GetTimestamp();
+  H323RegistrationIndex index;
+  for (i = 0; i < endpoints; i++) {
+    index.Add(H323RegistrationIndex::Alias, aliases[i], identifiers[i]);
+    index.Add(H323RegistrationIndex::SignalAddress, addresses[i], identifiers[i]);
+    index.Add(H323RegistrationIndex::VoicePrefix, prefixes[i], identifiers[i]);
+  }
+  PInt64 indexBuild = PTime().GetTimestamp() - start;
+
+  cout << setw(28) << "Build sorted lists" << setw(10) << (unsigned)(listBuild*1000/endpoints) << " ns/endpoint\n"
+       << setw(28) << "Build index" << setw(10) << (unsigned)(indexBuild*1000/endpoints) << " ns/endpoint" << endl;
+
+  static const char * const names[3] = { "alias", "address", "prefix" };
+  for (int kind = 0; kind < 3; kind++) {
+    unsigned seed = 1;
+    PINDEX hits = 0;
+    start = PTime().GetTimestamp();
+    for (i = 0; i < lookups; i++) {
+      PINDEX j = NextRandom(seed)%endpoints;
+      switch (kind) {
+        case 0 :
+          hits += byAlias.GetValuesIndex(aliases[j]) != P_MAX_INDEX;
+          break;
+        case 1 :
+          hits += byAddress.GetValuesIndex(addresses[j]) != P_MAX_INDEX;
+          break;
+        default :
+          for (PINDEX len = numbers[j].GetLength(); len > 0; len--) {
+            if (byVoicePrefix.GetValuesIndex(numbers[j].Left(len)) != P_MAX_INDEX) {
+              hits++;
+              break;
+            }
+          }
+      }
+    }
+    PInt64 listTime = PTime().GetTimestamp() - start;
+
+    seed = 1;
+    start = PTime().GetTimestamp();
+    for (i = 0; i < lookups; i++) {
+      PINDEX j = NextRandom(seed)%endpoints;
+      switch (kind) {
+        case 0 :
+          hits -= !index.Find(H323RegistrationIndex::Alias, aliases[j]).IsEmpty();
+          break;
+        case 1 :
+          hits -= !index.Find(H323RegistrationIndex::SignalAddress, addresses[j]).IsEmpty();
+          break;
+        default :
+          hits -= !index.FindLongestPrefix(numbers[j]).IsEmpty();
+      }
+    }
+    PInt64 indexTime = PTime().GetTimestamp() - start;
+
+    cout << setw(20) << names[kind] << " lookup"
+         << setw(10) << (unsigned)(listTime*1000/lookups) << " ns list"
+         << setw(10) << (unsigned)(indexTime*1000/lookups) << " ns index"
+         << (hits != 0 ? "  MISMATCH" : "") << endl;
+  }
+
+  cout << setw(28) << "4 prefix readers" << setw(10) << TimeIndexReaders(index, numbers, NULL) << " lookups/s\n"
+       << setw(28) << "4 readers and a writer" << setw(10) << TimeIndexReaders(index, numbers, &index) << " lookups/s\n"
+       << endl;
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
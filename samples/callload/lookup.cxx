@@ -0,0 +1,165 @@
+/*
+ * lookup.cxx
+ *
+ * Connection lookup benchmark.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#include <vector>
+
+#define new PNEW
+
+
+class CallLoadLookupEndPoint : public H323EndPoint
+{
+    PCLASSINFO(CallLoadLookupEndPoint, H323EndPoint);
+  public:
+    void AddConnection(const PString & token, H323Connection * connection)
+    {
+      PWaitAndSignal wait(connectionsMutex);
+      connectionsActive.SetAt(token, connection);
+      connectionsRegistry.Add(token, connection);
+    }
+
+    H323Connection * RemoveConnection(const PString & token)
+    {
+      PWaitAndSignal wait(connectionsMutex);
+      H323Connection * connection = connectionsActive.RemoveAt(token);
+      connectionsRegistry.Remove(token, connection);
+      return connection;
+    }
+
+    // The lookup every caller made before the sharded registry
+    PBoolean FindLocked(const PString & token)
+    {
+      PWaitAndSignal wait(connectionsMutex);
+      return FindConnectionWithoutLocks(token) != NULL;
+    }
+};
+
+
+class CallLoadLookupReader : public PThread
+{
+    PCLASSINFO(CallLoadLookupReader, PThread);
+  public:
+    CallLoadLookupReader(CallLoadLookupEndPoint & ep, const std::vector<PString> & t, unsigned s, PBoolean h)
+      : PThread(10000, NoAutoDeleteThread, NormalPriority, "Lookup Reader"),
+        endpoint(ep), tokens(t), seed(s), useHandles(h), lookups(0), misses(0), running(TRUE)
+    { Resume(); }
+
+    PINDEX Stop() { running = FALSE; WaitForTermination(); return lookups; }
+    PINDEX GetMisses() const { return misses; }
+
+    void Main()
+    {
+      while (running) {
+        const PString & token = tokens[NextRandom(seed)%tokens.size()];
+        if (useHandles ? endpoint.FindConnectionHandle(token).IsNULL() : !endpoint.FindLocked(token))
+          misses++;
+        lookups++;
+      }
+    }
+
+  protected:
+    CallLoadLookupEndPoint & endpoint;
+    const std::vector<PString> & tokens;
+    unsigned          seed;
+    PBoolean          useHandles;
+    PINDEX            lookups;
+    PINDEX            misses;
+    volatile PBoolean running;
+};
+
+
+static unsigned TimeLookupReaders(CallLoadLookupEndPoint & endpoint,
+                                  const std::vector<PString> & tokens,
+                                  PINDEX threads,
+                                  PBoolean useHandles,
+                                  PINDEX & misses)
+{
+  std::vector<CallLoadLookupReader *> readers;
+  PINDEX i;
+  for (i = 0; i < threads; i++)
+    readers.push_back(new CallLoadLookupReader(endpoint, tokens, (unsigned)i+1, useHandles));
+
+  PThread::Sleep(1000);
+
+  PINDEX lookups = 0;
+  for (i = 0; i < (PINDEX)readers.size(); i++) {
+    lookups += readers[i]->Stop();
+    misses += readers[i]->GetMisses();
+    delete readers[i];
+  }
+  return (unsigned)lookups;
+}
+
+
+void CallLoadProcess::RunLookupBenchmark(PINDEX connections)
+{
+  if (connections == 0)
+    connections = 1;
+
+  cout << "Connection lookup benchmark, " << connections << " calls" << endl;
+
+  CallLoadLookupEndPoint endpoint;
+  std::vector<PString> tokens;
+  PINDEX i;
+  for (i = 0; i < connections; i++) {
+    tokens.push_back(psprintf("callload%u", (unsigned)i));
+    endpoint.AddConnection(tokens.back(), new H323Connection(endpoint, (unsigned)i+1));
+  }
+
+  PINDEX misses = 0;
+  static const PINDEX ThreadCounts[] = { 1, 2, 4, 8, 16 };
+  for (i = 0; i < (PINDEX)PARRAYSIZE(ThreadCounts); i++) {
+    cout << setw(10) << ThreadCounts[i] << " threads"
+         << setw(10) << TimeLookupReaders(endpoint, tokens, ThreadCounts[i], FALSE, misses) << " lookups/s locked"
+         << setw(10) << TimeLookupReaders(endpoint, tokens, ThreadCounts[i], TRUE, misses) << " lookups/s handle"
+         << endl;
+  }
+
+  // Clearing synchronously while holding a handle would never return
+  PBoolean refused;
+  {
+    H323ConnectionHandle handle = endpoint.FindConnectionHandle(tokens[0]);
+    PSyncPoint sync;
+    refused = !endpoint.ClearCallSynchronous(tokens[0], H323Connection::EndedByLocalUser, &sync);
+  }
+
+  cout << setw(28) << "Synchronous clear with handle" << setw(10) << (refused ? "refused" : "FAILED") << '\n'
+       << (misses != 0 ? "  MISMATCH\n" : "")
+       << endl;
+
+  for (i = 0; i < connections; i++)
+    delete endpoint.RemoveConnection(tokens[i]);
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
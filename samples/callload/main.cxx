@@ -0,0 +1,836 @@
+/*
+ * main.cxx
+ *
+ * Headless H.323 call load generator and benchmark suite.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+#include <ptlib/video.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+#include "../../version.h"
+
+#include <h323arena.h>
+
+#include <algorithm>
+#include <math.h>
+
+#define new PNEW
+
+PCREATE_PROCESS(CallLoadProcess);
+
+
+///////////////////////////////////////////////////////////////
+
+CallLoadStatistics::CallLoadStatistics()
+{
+  setupTimesSorted = TRUE;
+  active = 0;
+  maxActive = 0;
+  started = 0;
+  established = 0;
+  failed = 0;
+  jitterTotal = 0;
+  jitterMaximum = 0;
+  jitterCount = 0;
+}
+
+
+void CallLoadStatistics::OnCallStarted()
+{
+  PWaitAndSignal m(mutex);
+  started++;
+}
+
+
+void CallLoadStatistics::OnCallEstablished(const PString & token, const PTimeInterval & setupTime)
+{
+  PWaitAndSignal m(mutex);
+
+  established++;
+  if (++active > maxActive)
+    maxActive = active;
+
+  establishedCalls[token] = PTime();
+  setupTimes.push_back((unsigned)setupTime.GetMilliSeconds());
+  setupTimesSorted = FALSE;
+}
+
+
+void CallLoadStatistics::OnCallCleared(const PString & token, PBoolean wasEstablished)
+{
+  PWaitAndSignal m(mutex);
+
+  if (wasEstablished) {
+    active--;
+    establishedCalls.erase(token);
+  }
+  else
+    failed++;
+}
+
+
+PStringList CallLoadStatistics::GetExpiredCalls(const PTimeInterval & duration)
+{
+  PWaitAndSignal m(mutex);
+
+  PStringList tokens;
+  PTime now;
+
+  std::map<PString, PTime>::iterator it = establishedCalls.begin();
+  while (it != establishedCalls.end()) {
+    if ((now - it->second) < duration)
+      ++it;
+    else {
+      // Only hand out each call once, the clear happens asynchronously
+      tokens.AppendString(it->first);
+      establishedCalls.erase(it++);
+    }
+  }
+
+  return tokens;
+}
+
+
+unsigned CallLoadStatistics::GetSetupPercentile(unsigned percentile)
+{
+  PWaitAndSignal m(mutex);
+
+  if (setupTimes.empty())
+    return 0;
+
+  if (!setupTimesSorted) {
+    std::sort(setupTimes.begin(), setupTimes.end());
+    setupTimesSorted = TRUE;
+  }
+
+  return setupTimes[(setupTimes.size()-1)*PMIN(percentile, 100)/100];
+}
+
+
+void CallLoadStatistics::OnAudioClosed(const RTP_Session & session, PBoolean transmitter)
+{
+  PWaitAndSignal m(mutex);
+
+  if (transmitter) {
+    RTP_MediaHistogram::Snapshot lateness;
+    session.GetMediaStatistics()[RTP_MediaStatistics::TransmitOverrun].GetSnapshot(lateness);
+    for (PINDEX i = 0; i < RTP_MediaHistogram::NumBuckets; i++)
+      transmitLateness.buckets[i] += lateness.buckets[i];
+    transmitLateness.count += lateness.count;
+    transmitLateness.sum += lateness.sum;
+    if (lateness.maximum > transmitLateness.maximum)
+      transmitLateness.maximum = lateness.maximum;
+  }
+  else if (session.GetPacketsReceived() > 0) {
+    jitterTotal += session.GetAvgJitterTime();
+    if (session.GetMaxJitterTime() > jitterMaximum)
+      jitterMaximum = session.GetMaxJitterTime();
+    jitterCount++;
+  }
+}
+
+
+RTP_MediaHistogram::Snapshot CallLoadStatistics::GetTransmitLateness()
+{
+  PWaitAndSignal m(mutex);
+  return transmitLateness;
+}
+
+
+void CallLoadStatistics::GetReceiveJitter(unsigned & average, unsigned & maximum)
+{
+  PWaitAndSignal m(mutex);
+  average = jitterCount > 0 ? (unsigned)(jitterTotal/jitterCount) : 0;
+  maximum = jitterMaximum;
+}
+
+
+///////////////////////////////////////////////////////////////
+
+CallLoadAudioChannel::CallLoadAudioChannel(const PBYTEArray & _samples, PINDEX _bytesPerMs, PBoolean _paced)
+  : samples(_samples), position(0), bytesPerMs(_bytesPerMs > 0 ? _bytesPerMs : 16), paced(_paced)
+{
+  os_handle = 0;
+}
+
+
+PBoolean CallLoadAudioChannel::Read(void * buf, PINDEX len)
+{
+  if (!IsOpen())
+    return FALSE;
+
+  BYTE * ptr = (BYTE *)buf;
+  PINDEX remaining = len;
+  while (remaining > 0) {
+    if (samples.IsEmpty()) {
+      memset(ptr, 0, remaining);
+      break;
+    }
+    if (position >= samples.GetSize())
+      position = 0;
+    PINDEX count = PMIN(remaining, samples.GetSize() - position);
+    memcpy(ptr, (const BYTE *)samples + position, count);
+    position += count;
+    ptr += count;
+    remaining -= count;
+  }
+
+  lastReadCount = len;
+  if (paced)
+    delay.Delay(len/bytesPerMs);
+  return TRUE;
+}
+
+
+PBoolean CallLoadAudioChannel::Write(const void *, PINDEX len)
+{
+  if (!IsOpen())
+    return FALSE;
+
+  lastWriteCount = len;
+  delay.Delay(len/bytesPerMs);
+  return TRUE;
+}
+
+
+PBoolean CallLoadAudioChannel::Close()
+{
+  os_handle = -1;
+  return TRUE;
+}
+
+
+///////////////////////////////////////////////////////////////
+
+CallLoadEndPoint::CallLoadEndPoint(CallLoadStatistics & _stats, PBoolean _isCaller)
+  : stats(_stats), isCaller(_isCaller), hasVideo(FALSE)
+{
+}
+
+
+PBoolean CallLoadEndPoint::Initialise(PArgList & args, const PBYTEArray & samples)
+{
+  audioSamples = samples;
+
+  SetLocalUserName(isCaller ? "caller" : "callee");
+
+  // Keep the media flowing for the whole call
+  SetSilenceDetectionMode(H323AudioCodec::NoSilenceDetection);
+  DisableFastStart(!args.HasOption('f'));
+  DisableH245Tunneling(args.HasOption('T'));
+  SetMediaClockThreads(args.GetOptionString('M', "0").AsUnsigned());
+  SetMediaReactorThreads(args.GetOptionString("reactor", "0").AsUnsigned());
+
+  // Separate media port ranges so caller and callee never collide
+  if (isCaller)
+    SetRtpIpPorts(20000, 29999);
+  else
+    SetRtpIpPorts(30000, 39999);
+
+#ifdef H323_VIDEO
+  hasVideo = args.HasOption('v');
+  SetSharedVideoEncoding(args.HasOption('S'));
+#endif
+
+  AddAllCapabilities(0, P_MAX_INDEX, "*");
+  if (!hasVideo)
+    RemoveCapability(H323Capability::e_Video);
+
+  AddAllUserInputCapabilities(0, P_MAX_INDEX);
+
+  RemoveCapabilities(args.GetOptionString('D').Tokenise(','));
+  ReorderCapabilities(args.GetOptionString('P').Tokenise(','));
+
+  return TRUE;
+}
+
+
+H323Connection * CallLoadEndPoint::CreateConnection(unsigned callReference, void * userData)
+{
+  // MakeCall() passes the time the call was initiated
+  return new CallLoadConnection(*this, callReference, userData != NULL ? *(const PTime *)userData : PTime());
+}
+
+
+H323Connection::AnswerCallResponse
+                   CallLoadEndPoint::OnAnswerCall(H323Connection &,
+                                                  const PString &,
+                                                  const H323SignalPDU &,
+                                                  H323SignalPDU &)
+{
+  return H323Connection::AnswerCallNow;
+}
+
+
+void CallLoadEndPoint::OnConnectionEstablished(H323Connection & connection,
+                                               const PString & token)
+{
+  CallLoadConnection & conn = (CallLoadConnection &)connection;
+  conn.wasEstablished = TRUE;
+
+  // Only the calling side contributes to the statistics
+  if (isCaller)
+    stats.OnCallEstablished(token, PTime() - conn.GetCallStart());
+}
+
+
+void CallLoadEndPoint::OnConnectionCleared(H323Connection & connection,
+                                           const PString & clearedCallToken)
+{
+  if (!isCaller)
+    return;
+
+  CallLoadConnection & conn = (CallLoadConnection &)connection;
+  PTRACE_IF(2, !conn.wasEstablished, "CallLoad\tCall " << clearedCallToken
+            << " failed: " << connection.GetCallEndReason());
+  stats.OnCallCleared(clearedCallToken, conn.wasEstablished);
+}
+
+
+PBoolean CallLoadEndPoint::OpenAudioChannel(H323Connection &,
+                                            PBoolean,
+                                            unsigned,
+                                            H323AudioCodec & codec)
+{
+  // Time units are samples per millisecond, PCM is 16 bit
+  PINDEX bytesPerMs = codec.GetMediaFormat().GetTimeUnits()*2;
+  return codec.AttachChannel(new CallLoadAudioChannel(audioSamples, bytesPerMs, !codec.IsMediaClocked()), TRUE);
+}
+
+
+#ifdef H323_VIDEO
+PBoolean CallLoadEndPoint::OpenVideoChannel(H323Connection &,
+                                            PBoolean isEncoding,
+                                            H323VideoCodec & codec)
+{
+  PString deviceName = isEncoding ? "fake" : "NULL";
+
+  PVideoDevice * device = isEncoding ? (PVideoDevice *)PVideoInputDevice::CreateDeviceByName(deviceName)
+                                     : (PVideoDevice *)PVideoOutputDevice::CreateDeviceByName(deviceName);
+  if (device == NULL) {
+    PTRACE(1, "CallLoad\tCould not create the video device \"" << deviceName << '"');
+    return FALSE;
+  }
+
+  if (isEncoding) {
+    PVideoInputDevice::Capabilities caps;
+    PVideoFrameInfo cap;
+    cap.SetColourFormat("YUV420P");
+    cap.SetFrameRate(30);
+    cap.SetFrameSize(704, 576);
+    caps.framesizes.push_back(cap);
+    cap.SetFrameSize(352, 288);
+    caps.framesizes.push_back(cap);
+    codec.SetSupportedFormats(caps.framesizes);
+  }
+
+  if (!device->SetFrameSize(codec.GetWidth(), codec.GetHeight()) ||
+      !device->SetFrameRate(codec.GetFrameRate()) ||
+      !device->SetColourFormatConverter("YUV420P") ||
+      !device->Open(deviceName, TRUE)) {
+    PTRACE(1, "CallLoad\tFailed to open the video device \"" << deviceName << '"');
+    delete device;
+    return FALSE;
+  }
+
+  PVideoChannel * channel = new PVideoChannel;
+
+  if (isEncoding)
+    channel->AttachVideoReader((PVideoInputDevice *)device);
+  else
+    channel->AttachVideoPlayer((PVideoOutputDevice *)device);
+
+  return codec.AttachChannel(channel, TRUE);
+}
+#endif
+
+
+///////////////////////////////////////////////////////////////
+
+CallLoadConnection::CallLoadConnection(CallLoadEndPoint & ep, unsigned callReference, const PTime & _callStart)
+  : H323Connection(ep, callReference), wasEstablished(FALSE), callStart(_callStart)
+{
+#ifdef H323_VIDEO
+  // Every call sends the same fake grabber pattern
+  if (ep.UsesSharedVideoEncoding())
+    SetSharedVideoGroup("callload");
+#endif
+}
+
+
+void CallLoadConnection::OnClosedLogicalChannel(const H323Channel & channel)
+{
+  // The session outlives its channels, so the statistics are still there
+  RTP_Session * session = GetSession(channel.GetSessionID());
+  if (session != NULL && channel.GetSessionID() == RTP_Session::DefaultAudioSessionID)
+    ((CallLoadEndPoint &)GetEndPoint()).GetStatistics().OnAudioClosed(*session, channel.GetDirection() == H323Channel::IsTransmitter);
+
+  H323Connection::OnClosedLogicalChannel(channel);
+}
+
+
+///////////////////////////////////////////////////////////////
+
+CallLoadProcess::CallLoadProcess()
+  : PProcess("H323Plus", "callload", MAJOR_VERSION, MINOR_VERSION, BUILD_TYPE, BUILD_NUMBER)
+{
+  caller = NULL;
+  callee = NULL;
+  gkEndpoint = NULL;
+  gatekeeper = NULL;
+
+  baseCPU = 0;
+  baseThreads = 0;
+  baseRSS = 0;
+  peakThreads = 0;
+  peakRSS = 0;
+  callSeconds = 0;
+}
+
+
+CallLoadProcess::~CallLoadProcess()
+{
+  delete caller;
+  delete callee;
+  delete gatekeeper;
+  delete gkEndpoint;
+}
+
+
+void CallLoadProcess::Main()
+{
+  cout << GetName()
+       << " Version " << GetVersion(TRUE)
+       << " by " << GetManufacturer()
+       << " on " << GetOSClass() << ' ' << GetOSName()
+       << " (" << GetOSVersion() << '-' << GetOSHardware() << ")\n\n";
+
+  // Get and parse all of the command line arguments.
+  PArgList & args = GetArguments();
+  args.Parse(
+             "a-audio-file:"
+             "-arena."
+             "b-bench:"
+             "-batch:"
+             "c-calls:"
+             "-context-pool:"
+             "-reactor:"
+             "-recordings:"
+             "-registrations:"
+             "d-duration:"
+             "D-disable:"
+             "-descriptors:"
+             "-dispatch:"
+             "-endpoints:"
+             "-threads:"
+             "f-fast-enable."
+             "-idle-calls:"
+             "-tunnel-calls:"
+             "g-gatekeeper."
+             "h-help."
+             "i-iterations:"
+             "m-max-concurrent:"
+             "M-media-clock:"
+#if PTRACING
+             "o-output:"
+#endif
+             "P-prefer:"
+             "r-rate:"
+             "-ramp:"
+             "s-seconds:"
+             "-streams:"
+#ifdef H323_VIDEO
+             "S-shared-video."
+#endif
+             "T-h245tunneldisable."
+#if PTRACING
+             "t-trace."
+#endif
+#ifdef H323_VIDEO
+             "v-video."
+#endif
+             "x-listenport:"
+          , FALSE);
+
+  if (args.HasOption('h')) {
+    cout << "Usage : " << GetName() << " [options]\n"
+            "      : " << GetName() << " [options] --bench decode|forward|codecs|g711|cipher|record|streams|buffers|multiplex|tunnel|tcs|index|lookup|ras|aging|soak|patterns|all\n"
+            "Load options:\n"
+            "  -c --calls n            : Total number of calls to make (default 100).\n"
+            "  -r --rate cps[-max]     : Calls per second, ramping up to max (default 5).\n"
+            "     --ramp secs          : Time to ramp from cps to max (default run time).\n"
+            "  -s --seconds secs       : Stop starting calls after secs (default 60).\n"
+            "  -d --duration secs      : Hold time of each call (default 10).\n"
+            "  -m --max-concurrent n   : Limit on calls in progress (default none).\n"
+            "  -g --gatekeeper         : Route calls through a local gatekeeper.\n"
+            "  -x --listenport port    : Callee listening port (default 1820).\n"
+            "  -a --audio-file file    : Raw 8kHz 16 bit mono PCM to send (default tone).\n"
+            "  -M --media-clock n      : Send audio from the shared media clock with n workers.\n"
+            "     --reactor n          : Receive media on n shared reactor threads\n"
+            "                            (default none, 2 in the stream benchmark).\n"
+#ifdef H323_VIDEO
+            "  -v --video              : Add video using the fake grabber.\n"
+            "  -S --shared-video       : Encode identical outgoing video once for all calls.\n"
+            "                            For CPU against viewers run -v -c n -m n -r n\n"
+            "                            for several n, with and without -S.\n"
+#endif
+            "  -f --fast-enable        : Enable fast start.\n"
+            "  -T --h245tunneldisable  : Disable H245 tunnelling.\n"
+            "  -D --disable codec      : Disable the specified codec (may be used multiple times)\n"
+            "  -P --prefer codec       : Prefer the specified codec (may be used multiple times)\n"
+            "     --arena              : Decode PDUs using the per message arena.\n"
+            "     --context-pool n     : Pool and pre-warm n codec contexts per codec.\n"
+            "Benchmark options:\n"
+            "  -b --bench name         : Run a micro benchmark instead of a load test.\n"
+            "  -i --iterations n       : Iterations per benchmark (default 100000).\n"
+            "     --descriptors n      : Descriptors in the pattern benchmark (default 100000).\n"
+            "     --recordings n       : Concurrent calls in the record benchmark (default 1000).\n"
+            "     --streams n          : Receive streams in the stream benchmark (default 1000).\n"
+            "     --batch n            : Datagrams per read in the multiplex benchmark (default 16).\n"
+            "     --endpoints n        : Registrations in the index benchmark (default 100000)\n"
+            "                            and the RAS benchmark (default 10000).\n"
+            "     --dispatch n         : Gatekeeper RAS dispatch threads compared with none\n"
+            "                            in the RAS benchmark (default 4).\n"
+            "     --registrations n    : Registrations in the aging benchmark\n"
+            "                            (default 10000, 100000 and 1000000).\n"
+            "     --threads n          : Threads in the G.711 benchmark (default 1).\n"
+            "     --idle-calls n       : Calls in the signalling soak (default 10000), run\n"
+            "                            for --seconds, each call uses two descriptors.\n"
+            "  -c --calls n            : Calls in the lookup benchmark (default 1000).\n"
+            "     --tunnel-calls n     : Audio calls in the H.460.26 tunnel benchmark (default 10),\n"
+            "                            run for --seconds (default 5) with each writer.\n"
+#if PTRACING
+            "  -t --trace              : Enable trace, use multiple times for more detail.\n"
+            "  -o --output             : File for trace output, default is stderr.\n"
+#endif
+            "  -h --help               : This help message.\n"
+            << endl;
+    return;
+  }
+
+#if PTRACING
+  PTrace::Initialise(args.GetOptionCount('t'),
+                     args.HasOption('o') ? (const char *)args.GetOptionString('o') : NULL,
+                     PTrace::DateAndTime | PTrace::TraceLevel | PTrace::FileAndLine);
+#endif
+
+  if (args.HasOption('b')) {
+    PCaselessString bench = args.GetOptionString('b');
+    PINDEX iterations = args.GetOptionString('i', "100000").AsUnsigned();
+    if (iterations == 0)
+      iterations = 1;
+
+    if (bench == "decode" || bench == "all")
+      RunDecodeBenchmark(iterations);
+    if (bench == "forward" || bench == "all")
+      RunForwardBenchmark(iterations);
+    if (bench == "codecs" || bench == "all")
+      RunCodecBenchmark(iterations);
+    if (bench == "tcs" || bench == "all")
+      RunCapabilityBenchmark(iterations);
+    if (bench == "record" || bench == "all")
+      RunRecordBenchmark(args.GetOptionString("recordings", "1000").AsUnsigned(), iterations);
+    if (bench == "streams" || bench == "all")
+      RunStreamBenchmark(args.GetOptionString("streams", "1000").AsUnsigned(),
+                         args.GetOptionString("reactor", "2").AsUnsigned());
+#ifdef H323_AUDIO_CODECS
+    if (bench == "g711" || bench == "all")
+      RunG711Benchmark(args.GetOptionString("threads", "1").AsUnsigned());
+#endif
+#ifdef H323_H235
+    if (bench == "cipher" || bench == "all")
+      RunCipherBenchmark(iterations);
+#endif
+    if (bench == "buffers" || bench == "all")
+      RunBufferBenchmark(iterations);
+    if (bench == "index" || bench == "all")
+      RunIndexBenchmark(args.GetOptionString("endpoints", "100000").AsUnsigned(), iterations);
+    if (bench == "lookup" || bench == "all")
+      RunLookupBenchmark(args.GetOptionString('c', "1000").AsUnsigned());
+    if (bench == "ras" || bench == "all")
+      RunRasBenchmark(args.GetOptionString("endpoints", "10000").AsUnsigned(),
+                      args.GetOptionString("dispatch", "4").AsUnsigned(),
+                      (WORD)(args.GetOptionString('x', "1820").AsUnsigned()+2));
+    if (bench == "aging" || bench == "all")
+      RunAgingBenchmark(args.GetOptionString("registrations", "0").AsUnsigned());
+    if (bench == "soak" || bench == "all")
+      RunSoakBenchmark(args.GetOptionString("idle-calls", "10000").AsUnsigned(),
+                       args.GetOptionString('s', "60").AsUnsigned());
+#ifdef H323_H46019M
+    if (bench == "multiplex" || bench == "all")
+      RunMultiplexBenchmark(args.GetOptionString("batch", "16").AsUnsigned());
+#endif
+#ifdef H323_H46026
+    if (bench == "tunnel" || bench == "all")
+      RunTunnelBenchmark(args.GetOptionString("tunnel-calls", "10").AsUnsigned(),
+                         args.GetOptionString("seconds", "5").AsUnsigned());
+#endif
+#ifdef H323_H501
+    if (bench == "patterns" || bench == "all")
+      RunPatternBenchmark(args.GetOptionString("descriptors", "100000").AsUnsigned(), iterations);
+#endif
+    return;
+  }
+
+  if (RunLoad(args))
+    ReportLoad(args);
+
+  cout << "Exiting " << GetName() << endl;
+}
+
+
+PBoolean CallLoadProcess::LoadSamples(PArgList & args, PBYTEArray & samples)
+{
+  if (args.HasOption('a')) {
+    PFile file;
+    if (!file.Open(args.GetOptionString('a'), PFile::ReadOnly)) {
+      cerr << "Could not open audio file \"" << args.GetOptionString('a') << '"' << endl;
+      return FALSE;
+    }
+    PINDEX size = (PINDEX)file.GetLength() & ~1;
+    if (size == 0 || !file.Read(samples.GetPointer(size), size)) {
+      cerr << "Could not read audio file \"" << args.GetOptionString('a') << '"' << endl;
+      return FALSE;
+    }
+    return TRUE;
+  }
+
+  // One second of a 440Hz tone at 8kHz
+  short * pcm = (short *)samples.GetPointer(8000*sizeof(short));
+  for (PINDEX i = 0; i < 8000; i++)
+    pcm[i] = (short)(8000*sin(i*2*3.14159265358979*440/8000));
+
+  return TRUE;
+}
+
+
+PBoolean CallLoadProcess::RunLoad(PArgList & args)
+{
+  PBYTEArray samples;
+  if (!LoadSamples(args, samples))
+    return FALSE;
+
+  if (args.HasOption("arena"))
+    H323PDUArena::SetEnabled(TRUE);
+
+  // Compare setup latency with and without to see what pooling saves
+  if (args.HasOption("context-pool")) {
+    PINDEX poolSize = args.GetOptionString("context-pool").AsUnsigned();
+    H323PluginCodecManager::SetContextPool(poolSize);
+    OpalMediaFormat::List formats = H323PluginCodecManager::GetMediaFormats();
+    for (PINDEX i = 0; i < formats.GetSize(); i++) {
+      if (H323PluginCodecManager::SetContextPooling(formats[i]))
+        H323PluginCodecManager::PrewarmContexts(formats[i], poolSize);
+    }
+  }
+
+  PINDEX totalCalls = args.GetOptionString('c', "100").AsUnsigned();
+  PINDEX maxConcurrent = args.GetOptionString('m', "0").AsUnsigned();
+  double runSeconds = args.GetOptionString('s', "60").AsReal();
+  PTimeInterval duration(0, args.GetOptionString('d', "10").AsUnsigned());
+
+  PStringArray rates = args.GetOptionString('r', "5").Tokenise("-");
+  double startRate = rates[0].AsReal();
+  double maxRate = rates.GetSize() > 1 ? rates[1].AsReal() : startRate;
+  double rampSeconds = args.GetOptionString("ramp", PString(PString::Unsigned, (long)runSeconds)).AsReal();
+  if (startRate <= 0 || maxRate < startRate) {
+    cerr << "Illegal call rate specified." << endl;
+    return FALSE;
+  }
+
+  WORD port = (WORD)args.GetOptionString('x', "1820").AsUnsigned();
+  PIPSocket::Address loopback("127.0.0.1");
+
+  callee = new CallLoadEndPoint(stats, FALSE);
+  if (!callee->Initialise(args, samples))
+    return FALSE;
+  if (!callee->StartListener(new H323ListenerTCP(*callee, loopback, port))) {
+    cerr << "Could not open H.323 listener port " << port << endl;
+    return FALSE;
+  }
+
+  caller = new CallLoadEndPoint(stats, TRUE);
+  if (!caller->Initialise(args, samples))
+    return FALSE;
+  if (!caller->StartListener(new H323ListenerTCP(*caller, loopback, (WORD)(port+1)))) {
+    cerr << "Could not open H.323 listener port " << port+1 << endl;
+    return FALSE;
+  }
+
+  PString destination = psprintf("127.0.0.1:%u", port);
+
+  if (args.HasOption('g')) {
+    gkEndpoint = new H323EndPoint;
+    gatekeeper = new H323GatekeeperServer(*gkEndpoint);
+
+    H323TransportAddress gkAddress(loopback, (WORD)(port+2));
+    if (!gatekeeper->AddListener(gkAddress)) {
+      cerr << "Could not open gatekeeper on " << gkAddress << endl;
+      return FALSE;
+    }
+
+    if (!callee->UseGatekeeper(gkAddress, PString::Empty(), "127.0.0.1") ||
+        !caller->UseGatekeeper(gkAddress, PString::Empty(), "127.0.0.1")) {
+      cerr << "Could not register with gatekeeper on " << gkAddress << endl;
+      return FALSE;
+    }
+
+    destination = callee->GetLocalUserName();
+  }
+
+  cout << "Calling " << destination << ": " << totalCalls << " calls at "
+       << startRate << '-' << maxRate << " cps, holding " << duration << 's' << endl;
+
+  GetProcessUsage(baseCPU, baseThreads, baseRSS);
+  peakThreads = baseThreads;
+  peakRSS = baseRSS;
+
+  PTime runStart;
+  PTime lastPace = runStart;
+  PTime lastSample = runStart;
+  double callCredit = 1;
+
+  for (;;) {
+    PTime now;
+    double elapsed = (now - runStart).GetMilliSeconds()/1000.0;
+
+    if (elapsed < runSeconds && stats.GetStarted() < totalCalls) {
+      double rate = maxRate;
+      if (rampSeconds > 0 && elapsed < rampSeconds)
+        rate = startRate + (maxRate - startRate)*elapsed/rampSeconds;
+      callCredit += rate*(now - lastPace).GetMilliSeconds()/1000.0;
+
+      while (callCredit >= 1 && stats.GetStarted() < totalCalls &&
+             (maxConcurrent == 0 || stats.GetActive() + stats.GetPending() < maxConcurrent)) {
+        PTime callStart;
+        PString token;
+        stats.OnCallStarted();
+        if (caller->MakeCall(destination, token, &callStart) == NULL)
+          stats.OnCallCleared(token, FALSE);
+        callCredit -= 1;
+      }
+    }
+    else if (stats.GetActive() == 0 && stats.GetPending() == 0)
+      break;
+    else if (elapsed > runSeconds + duration.GetSeconds() + 60) {
+      cerr << "Timed out waiting for calls to clear." << endl;
+      break;
+    }
+    lastPace = now;
+
+    PStringList expired = stats.GetExpiredCalls(duration);
+    for (PINDEX i = 0; i < expired.GetSize(); i++)
+      caller->ClearCall(expired[i]);
+
+    PTimeInterval sinceSample = now - lastSample;
+    if (sinceSample >= 1000) {
+      double cpu;
+      unsigned threads;
+      PUInt64 rss;
+      if (GetProcessUsage(cpu, threads, rss)) {
+        if (threads > peakThreads)
+          peakThreads = threads;
+        if (rss > peakRSS)
+          peakRSS = rss;
+      }
+      callSeconds += stats.GetActive()*sinceSample.GetMilliSeconds()/1000.0;
+      lastSample = now;
+
+      cout << setw(6) << (unsigned)elapsed << "s"
+           << " started " << setw(6) << stats.GetStarted()
+           << " active " << setw(5) << stats.GetActive()
+           << " pending " << setw(5) << stats.GetPending()
+           << " failed " << setw(5) << stats.GetFailed()
+           << " threads " << setw(5) << threads << endl;
+    }
+
+    PThread::Sleep(10);
+  }
+
+  caller->ClearAllCalls();
+  callee->ClearAllCalls();
+  return TRUE;
+}
+
+
+void CallLoadProcess::ReportLoad(PArgList &)
+{
+  double cpu;
+  unsigned threads;
+  PUInt64 rss;
+  GetProcessUsage(cpu, threads, rss);
+  cpu -= baseCPU;
+
+  PINDEX established = stats.GetEstablished();
+  PINDEX maxActive = stats.GetMaxActive();
+
+  cout << "\nCalls started " << stats.GetStarted()
+       << ", established " << established
+       << ", failed " << stats.GetFailed() << "\n"
+          "Setup latency ms: p50 " << stats.GetSetupPercentile(50)
+       << " p90 " << stats.GetSetupPercentile(90)
+       << " p99 " << stats.GetSetupPercentile(99)
+       << " max " << stats.GetSetupPercentile(100) << "\n"
+          "Max concurrent calls " << maxActive << "\n"
+       << setprecision(3)
+       << "CPU seconds " << cpu;
+  if (established > 0)
+    cout << ", per call " << cpu*1000/established << " ms";
+  if (callSeconds > 0)
+    cout << ", per concurrent call " << cpu*100/callSeconds << '%';
+  cout << '\n';
+
+  if (maxActive > 0 && peakThreads > 0)
+    cout << "Threads per call " << (double)(peakThreads - baseThreads)/maxActive << '\n';
+  if (maxActive > 0 && peakRSS > 0)
+    cout << "RSS per call " << (double)(PInt64)(peakRSS - baseRSS)/1024/maxActive << " kB\n";
+
+  RTP_MediaHistogram::Snapshot lateness = stats.GetTransmitLateness();
+  if (lateness.count > 0)
+    cout << "Audio send lateness us: avg " << lateness.GetAverage()
+         << " p50 " << lateness.GetPercentile(50)
+         << " p99 " << lateness.GetPercentile(99)
+         << " max " << lateness.maximum << '\n';
+
+  unsigned averageJitter, maximumJitter;
+  stats.GetReceiveJitter(averageJitter, maximumJitter);
+  if (averageJitter > 0 || maximumJitter > 0)
+    cout << "Audio receive jitter ms: avg " << averageJitter << " max " << maximumJitter << '\n';
+
+  PINDEX idleContexts;
+  unsigned poolHits, poolMisses;
+  H323PluginCodecManager::GetContextPoolStatistics(idleContexts, poolHits, poolMisses);
+  if (poolHits > 0)
+    cout << "Codec contexts reused " << poolHits << " of " << poolHits + poolMisses
+         << ", " << idleContexts << " idle\n";
+
+  cout << endl;
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
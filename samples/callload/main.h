@@ -0,0 +1,243 @@
+/*
+ * main.h
+ *
+ * Headless H.323 call load generator and benchmark suite.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#ifndef _CallLoad_MAIN_H
+#define _CallLoad_MAIN_H
+
+#include <h323.h>
+#include <gkserver.h>
+
+#include <map>
+#include <vector>
+
+#if PTLIB_VER < 2130
+#if !defined(P_USE_STANDARD_CXX_BOOL) && !defined(P_USE_INTEGER_BOOL)
+    typedef int PBoolean;
+#endif
+#endif
+
+
+/**Counters shared by the two endpoints of a load run.
+  */
+class CallLoadStatistics : public PObject
+{
+  PCLASSINFO(CallLoadStatistics, PObject);
+
+  public:
+    CallLoadStatistics();
+
+    void OnCallStarted();
+    void OnCallEstablished(const PString & token, const PTimeInterval & setupTime);
+    void OnCallCleared(const PString & token, PBoolean wasEstablished);
+
+    /**Get tokens of established calls older than the duration.
+      */
+    PStringList GetExpiredCalls(const PTimeInterval & duration);
+
+    PINDEX GetActive() const { return active; }
+    PINDEX GetMaxActive() const { return maxActive; }
+    PINDEX GetStarted() const { return started; }
+    PINDEX GetEstablished() const { return established; }
+    PINDEX GetFailed() const { return failed; }
+    PINDEX GetPending() const { return started - established - failed; }
+
+    /**Get the setup latency at the percentile (0-100) in milliseconds.
+      */
+    unsigned GetSetupPercentile(unsigned percentile);
+
+    /**Add the media timing of an audio channel as it closes.
+      */
+    void OnAudioClosed(const RTP_Session & session, PBoolean transmitter);
+
+    /**Get the lateness of transmitted audio packets against their clock.
+      */
+    RTP_MediaHistogram::Snapshot GetTransmitLateness();
+
+    /**Get the average and worst receive jitter in milliseconds.
+      */
+    void GetReceiveJitter(unsigned & average, unsigned & maximum);
+
+  protected:
+    PMutex mutex;
+    std::map<PString, PTime> establishedCalls;
+    std::vector<unsigned> setupTimes;
+    PBoolean setupTimesSorted;
+
+    RTP_MediaHistogram::Snapshot transmitLateness;
+    PUInt64  jitterTotal;
+    unsigned jitterMaximum;
+    PINDEX   jitterCount;
+
+    PINDEX active;
+    PINDEX maxActive;
+    PINDEX started;
+    PINDEX established;
+    PINDEX failed;
+};
+
+
+/**Synthetic PCM source or sink paced in real time, standing in for a sound
+   device. The source loops over a shared buffer of samples.
+  */
+class CallLoadAudioChannel : public PChannel
+{
+  PCLASSINFO(CallLoadAudioChannel, PChannel);
+
+  public:
+    CallLoadAudioChannel(
+      const PBYTEArray & samples,   ///< Samples to loop over when read
+      PINDEX bytesPerMs,            ///< Bytes of PCM per millisecond
+      PBoolean paced = TRUE         ///< Delay reads, off when the media clock paces them
+    );
+
+    virtual PBoolean Read(void * buf, PINDEX len);
+    virtual PBoolean Write(const void * buf, PINDEX len);
+    virtual PBoolean Close();
+
+  protected:
+    PBYTEArray     samples;
+    PINDEX         position;
+    PINDEX         bytesPerMs;
+    PBoolean       paced;
+    PAdaptiveDelay delay;
+};
+
+
+class CallLoadConnection;
+
+class CallLoadEndPoint : public H323EndPoint
+{
+  PCLASSINFO(CallLoadEndPoint, H323EndPoint);
+
+  public:
+    CallLoadEndPoint(
+      CallLoadStatistics & stats,
+      PBoolean isCaller
+    );
+
+    // overrides from H323EndPoint
+    virtual H323Connection * CreateConnection(unsigned callReference, void * userData);
+    virtual H323Connection::AnswerCallResponse OnAnswerCall(H323Connection &, const PString &, const H323SignalPDU &, H323SignalPDU &);
+    virtual void OnConnectionEstablished(H323Connection & connection, const PString & token);
+    virtual void OnConnectionCleared(H323Connection & connection, const PString & clearedCallToken);
+    virtual PBoolean OpenAudioChannel(H323Connection & connection, PBoolean isEncoding, unsigned bufferSize, H323AudioCodec & codec);
+#ifdef H323_VIDEO
+    virtual PBoolean OpenVideoChannel(H323Connection & connection, PBoolean isEncoding, H323VideoCodec & codec);
+#endif
+
+    // New functions
+    PBoolean Initialise(PArgList & args, const PBYTEArray & samples);
+
+    CallLoadStatistics & GetStatistics() { return stats; }
+
+  protected:
+    CallLoadStatistics & stats;
+    PBoolean             isCaller;
+    PBoolean             hasVideo;
+    PBYTEArray           audioSamples;
+};
+
+
+class CallLoadConnection : public H323Connection
+{
+  PCLASSINFO(CallLoadConnection, H323Connection);
+
+  public:
+    CallLoadConnection(CallLoadEndPoint & endpoint, unsigned callReference, const PTime & callStart);
+
+    const PTime & GetCallStart() const { return callStart; }
+
+    // overrides from H323Connection
+    virtual void OnClosedLogicalChannel(const H323Channel & channel);
+
+    PBoolean wasEstablished;
+
+  protected:
+    PTime callStart;
+};
+
+
+class CallLoadProcess : public PProcess
+{
+  PCLASSINFO(CallLoadProcess, PProcess)
+
+  public:
+    CallLoadProcess();
+    ~CallLoadProcess();
+
+    void Main();
+
+  protected:
+    PBoolean RunLoad(PArgList & args);
+    PBoolean LoadSamples(PArgList & args, PBYTEArray & samples);
+    void ReportLoad(PArgList & args);
+
+    void RunStreamBenchmark(PINDEX streams, PINDEX reactorThreads);
+#ifdef H323_H46019M
+    void RunMultiplexBenchmark(PINDEX batchSize);
+#endif
+    void RunIndexBenchmark(PINDEX endpoints, PINDEX lookups);
+    void RunBufferBenchmark(PINDEX packets);
+#ifdef H323_AUDIO_CODECS
+    void RunG711Benchmark(PINDEX threads);
+#endif
+#ifdef H323_H235
+    void RunCipherBenchmark(PINDEX iterations);
+#endif
+    void RunSoakBenchmark(PINDEX calls, unsigned seconds);
+    void RunAgingBenchmark(PINDEX registrations);
+    void RunRasBenchmark(PINDEX endpoints, unsigned dispatchThreads, WORD port);
+    void RunCapabilityBenchmark(PINDEX iterations);
+    void RunLookupBenchmark(PINDEX connections);
+#ifdef H323_H46026
+    void RunTunnelBenchmark(PINDEX calls, unsigned seconds);
+#endif
+    void RunDecodeBenchmark(PINDEX iterations);
+    void RunForwardBenchmark(PINDEX iterations);
+#ifdef H323_H501
+    void RunPatternBenchmark(PINDEX descriptors, PINDEX lookups);
+#endif
+    void RunCodecBenchmark(PINDEX iterations);
+    void RunRecordBenchmark(PINDEX calls, PINDEX packets);
+
+    CallLoadStatistics      stats;
+    CallLoadEndPoint      * caller;
+    CallLoadEndPoint      * callee;
+    H323EndPoint          * gkEndpoint;
+    H323GatekeeperServer  * gatekeeper;
+
+    double   baseCPU;
+    unsigned baseThreads;
+    PUInt64  baseRSS;
+    unsigned peakThreads;
+    PUInt64  peakRSS;
+    double   callSeconds;
+};
+
+
+#endif  // _CallLoad_MAIN_H
+
+
+// End of File ///////////////////////////////////////////////////////////////
@@ -0,0 +1,177 @@
+/*
+ * multiplex.cxx
+ *
+ * H.460.19 multiplex benchmark: single against batched datagram reads.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#ifdef H323_H46018
+#include <h460/h46018_h225.h>
+#endif
+
+#include <vector>
+
+#define new PNEW
+
+
+#ifdef H323_H46019M
+
+/* Sends multiplexed G.711 packets as fast as the socket allows, cycling
+   through the multiplex IDs of the registered sessions. Several senders
+   share one socket so the batched writes have something to combine. */
+class CallLoadMultiplexSender : public PThread
+{
+    PCLASSINFO(CallLoadMultiplexSender, PThread);
+  public:
+    CallLoadMultiplexSender(H46019MultiplexSocket & _socket, WORD _port, unsigned _sessions, PAtomicInteger & _sent)
+      : PThread(10000, NoAutoDeleteThread, NormalPriority, "Mux Sender"),
+        socket(_socket), port(_port), sessions(_sessions), sent(_sent), running(TRUE)
+    { Resume(); }
+
+    void Stop() { running = FALSE; WaitForTermination(); }
+
+    void Main()
+    {
+      PIPSocket::Address localhost(127, 0, 0, 1);
+      RTP_DataFrame frame(160);
+      frame.SetPayloadType(RTP_DataFrame::PCMU);
+      memset(frame.GetPayloadPtr(), 0xff, 160);
+
+      PBYTEArray packet(4 + frame.GetHeaderSize() + 160);
+      memcpy(packet.GetPointer()+4, frame.GetPointer(), frame.GetHeaderSize() + 160);
+
+      for (unsigned id = 1; running; id = id % sessions + 1) {
+        *(PUInt32b *)packet.GetPointer() = id;
+        if (socket.WriteTo(packet, packet.GetSize(), localhost, port))
+          ++sent;
+      }
+    }
+
+  protected:
+    H46019MultiplexSocket & socket;
+    WORD             port;
+    unsigned         sessions;
+    PAtomicInteger & sent;
+    volatile PBoolean running;
+};
+
+
+static void TimeMultiplex(const char * name, PINDEX batchSize, PINDEX senderCount, unsigned seconds)
+{
+  static const unsigned Sessions = 1000;
+
+  PIPSocket::Address localhost(127, 0, 0, 1);
+  H46019MultiplexSocket receiver(true);
+  receiver.SetBatchSize(batchSize);
+  H46019MultiplexSocket transmitter(true);
+  transmitter.SetBatchSize(batchSize);
+  if (!receiver.Listen(localhost) || !transmitter.Listen(localhost)) {
+    cout << setw(14) << name << "  could not open multiplex sockets" << endl;
+    return;
+  }
+  receiver.SetReadTimeout(100);
+
+  // The receiver stands in for every session socket, only the lookup matters
+  muxSocketMap sockets;
+  for (unsigned id = 1; id <= Sessions; id++)
+    sockets[id] = &receiver;
+  H46019MultiplexTable table(sockets);
+
+  PAtomicInteger sent(0);
+  std::vector<CallLoadMultiplexSender *> senders;
+  PINDEX i;
+  for (i = 0; i < senderCount; i++)
+    senders.push_back(new CallLoadMultiplexSender(transmitter, receiver.GetPort(), Sessions, sent));
+
+  H46019MultiplexDatagram * datagrams = new H46019MultiplexDatagram[batchSize];
+  PINDEX received = 0;
+  PINDEX matched = 0;
+  PINDEX reads = 0;
+
+  double startCPU, cpu;
+  unsigned threads;
+  PUInt64 rss;
+  GetProcessUsage(startCPU, threads, rss);
+  PINDEX startSent = sent;
+
+  PTimeInterval finish = PTimer::Tick() + PTimeInterval(0, seconds);
+  while (PTimer::Tick() < finish) {
+    PSocket::SelectList readList;
+    readList += receiver;
+    if (PSocket::Select(readList, PTimeInterval(100)) != PChannel::NoError || readList.IsEmpty())
+      continue;
+
+    int error = 0;
+    PINDEX count = H46019MultiplexSocket::ReadBatch(receiver, datagrams, batchSize, error);
+    if (count < 0)
+      break;
+
+    reads++;
+    for (PINDEX d = 0; d < count; d++) {
+      datagrams[d].frame.SetSize(datagrams[d].length);
+      received++;
+      if (datagrams[d].length >= 4 && table.Find(*(const PUInt32b *)datagrams[d].frame.GetPointer()) != NULL)
+        matched++;
+    }
+  }
+
+  GetProcessUsage(cpu, threads, rss);
+  cpu -= startCPU;
+  PINDEX transmitted = sent - startSent;
+
+  for (i = 0; i < (PINDEX)senders.size(); i++) {
+    senders[i]->Stop();
+    delete senders[i];
+  }
+  delete [] datagrams;
+
+  cout << setw(14) << name
+       << setw(10) << received/seconds << " pkt/s"
+       << setw(10) << setprecision(4) << (reads > 0 ? (double)received/reads : 0) << " pkt/read"
+       << setw(10) << setprecision(4) << cpu*100/seconds << " % CPU"
+       << setw(8) << (transmitted > 0 ? (unsigned)((PInt64)received*100/transmitted) : 0) << " % received"
+       << setw(8) << (received > 0 ? (unsigned)((PInt64)matched*100/received) : 0) << " % matched" << endl;
+}
+
+
+void CallLoadProcess::RunMultiplexBenchmark(PINDEX batchSize)
+{
+  batchSize = PMAX(2, PMIN(batchSize, (PINDEX)H46019MultiplexSocket::MaxBatchSize));
+
+  cout << "Multiplex benchmark, loopback H.460.19 media port, 1000 sessions, 4 senders" << endl;
+  TimeMultiplex("Single", 1, 4, 5);
+  TimeMultiplex(psprintf("Batch of %u", (unsigned)batchSize), batchSize, 4, 5);
+  cout << endl;
+}
+
+#endif // H323_H46019M
+
+
+// End of File ///////////////////////////////////////////////////////////////
@@ -0,0 +1,205 @@
+/*
+ * patterns.cxx
+ *
+ * Peer element pattern benchmark.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#ifdef H323_H501
+#include <peclient.h>
+#endif
+
+#include <vector>
+
+#define new PNEW
+
+
+#ifdef H323_H501
+
+static void SetE164Number(H225_PartyNumber & party, const PString & digits)
+{
+  party.SetTag(H225_PartyNumber::e_e164Number);
+  H225_PublicPartyNumber & number = party;
+  number.m_publicTypeOfNumber.SetTag(H225_PublicTypeOfNumber::e_unknown);
+  number.m_publicNumberDigits = digits;
+}
+
+
+static PString GetE164Number(const H225_PartyNumber & party)
+{
+  H225_AliasAddress alias;
+  alias.SetTag(H225_AliasAddress::e_partyNumber);
+  (H225_PartyNumber &)alias = party;
+  return H323GetAliasAddressE164(alias);
+}
+
+
+// The per descriptor scan that H323PeerElement did before the index
+static PBoolean LinearMatch(const H501_Pattern & pattern, const PString & number)
+{
+  switch (pattern.GetTag()) {
+    case H501_Pattern::e_specific :
+      return H323GetAliasAddressE164((const H225_AliasAddress &)pattern) == number;
+
+    case H501_Pattern::e_wildcard : {
+      PString prefix = H323GetAliasAddressE164((const H225_AliasAddress &)pattern);
+      return !prefix.IsEmpty() && number.Left(prefix.GetLength()) == prefix;
+    }
+
+    case H501_Pattern::e_range : {
+      const H501_Pattern_range & range = pattern;
+      return GetE164Number(range.m_startOfRange) <= number && number <= GetE164Number(range.m_endOfRange);
+    }
+  }
+
+  return FALSE;
+}
+
+
+void CallLoadProcess::RunPatternBenchmark(PINDEX descriptors, PINDEX lookups)
+{
+  if (descriptors == 0)
+    descriptors = 1;
+
+  cout << "Pattern benchmark, " << descriptors << " descriptors, " << lookups << " lookups" << endl;
+
+  H323PeerElementPatternIndex index;
+  std::vector<H501_Pattern> patterns;
+  std::vector<OpalGloballyUniqueID> ids;
+  PStringArray numbers;
+  patterns.reserve(descriptors);
+  ids.reserve(descriptors);
+
+  unsigned seed = 1;
+  PINDEX i;
+  PInt64 addTime = 0;
+
+  for (i = 0; i < descriptors; i++) {
+    PString number = RandomNumber(seed);
+
+    H501_ArrayOf_AddressTemplate templates;
+    templates.SetSize(1);
+    templates[0].m_pattern.SetSize(1);
+    H501_Pattern & pattern = templates[0].m_pattern[0];
+
+    // One in ten a range, two in ten a wildcard, the rest specific numbers
+    switch (i%10) {
+      case 0 : {
+        pattern.SetTag(H501_Pattern::e_range);
+        H501_Pattern_range & range = pattern;
+        SetE164Number(range.m_startOfRange, number.Left(8) + "000");
+        SetE164Number(range.m_endOfRange, number.Left(8) + "999");
+        break;
+      }
+
+      case 1 :
+      case 2 :
+        pattern.SetTag(H501_Pattern::e_wildcard);
+        H323SetAliasAddress(number.Left(7), (H225_AliasAddress &)pattern);
+        break;
+
+      default :
+        pattern.SetTag(H501_Pattern::e_specific);
+        H323SetAliasAddress(number, (H225_AliasAddress &)pattern);
+        numbers.AppendString(number);
+    }
+
+    ids.push_back(OpalGloballyUniqueID());
+    patterns.push_back(pattern);
+
+    PInt64 start = PTime().GetTimestamp();
+    index.Add(ids.back(), templates);
+    addTime += PTime().GetTimestamp() - start;
+  }
+
+  cout << setw(28) << "Index add"
+       << setw(10) << (unsigned)(addTime*1000/descriptors) << " ns/descriptor" << endl;
+
+  // Half the lookups for numbers known to be present
+  PStringArray targets;
+  for (i = 0; i < lookups; i++) {
+    if ((i & 1) != 0 && numbers.GetSize() > 0)
+      targets.AppendString(numbers[NextRandom(seed)%numbers.GetSize()]);
+    else
+      targets.AppendString(RandomNumber(seed));
+  }
+
+  H225_AliasAddress alias;
+  PINDEX hits = 0;
+  PInt64 start = PTime().GetTimestamp();
+  for (i = 0; i < lookups; i++) {
+    H323PeerElementPatternIndex::MatchList matches;
+    H323SetAliasAddress(targets[i], alias);
+    if (index.Lookup(alias, matches))
+      hits++;
+  }
+  PInt64 elapsed = PTime().GetTimestamp() - start;
+
+  cout << setw(28) << "Index lookup"
+       << setw(10) << (unsigned)(elapsed*1000/PMAX(lookups, 1)) << " ns/lookup, "
+       << hits << " hits" << endl;
+
+  // The linear scan is slow enough that a sample of the lookups will do
+  PINDEX linearLookups = PMIN(lookups, PMAX(lookups/1000, 10));
+  hits = 0;
+  start = PTime().GetTimestamp();
+  for (i = 0; i < linearLookups; i++) {
+    for (size_t j = 0; j < patterns.size(); j++) {
+      if (LinearMatch(patterns[j], targets[i])) {
+        hits++;
+        break;
+      }
+    }
+  }
+  elapsed = PTime().GetTimestamp() - start;
+
+  cout << setw(28) << "Linear scan"
+       << setw(10) << (unsigned)(elapsed*1000/PMAX(linearLookups, 1)) << " ns/lookup, "
+       << hits << '/' << linearLookups << " hits" << endl;
+
+  start = PTime().GetTimestamp();
+  for (i = 0; i < descriptors; i++) {
+    H501_ArrayOf_AddressTemplate templates;
+    templates.SetSize(1);
+    templates[0].m_pattern.SetSize(1);
+    templates[0].m_pattern[0] = patterns[i];
+    index.Remove(ids[i], templates);
+  }
+  elapsed = PTime().GetTimestamp() - start;
+
+  cout << setw(28) << "Index remove"
+       << setw(10) << (unsigned)(elapsed*1000/descriptors) << " ns/descriptor, "
+       << index.GetSize() << " left" << endl << endl;
+}
+
+#endif // H323_H501
+
+
+// End of File ///////////////////////////////////////////////////////////////
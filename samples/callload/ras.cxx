@@ -0,0 +1,249 @@
+/*
+ * ras.cxx
+ *
+ * Gatekeeper RAS benchmark: RRQ and ARQ throughput.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#include <gkserver.h>
+
+#include <algorithm>
+#include <vector>
+
+#define new PNEW
+
+
+// Plays a share of the endpoints, one request at a time
+class CallLoadRasClient : public PThread
+{
+    PCLASSINFO(CallLoadRasClient, PThread);
+  public:
+    CallLoadRasClient(const H323TransportAddress & gk, std::vector<PString> & ids, PINDEX f, PINDEX c, PBoolean a)
+      : PThread(10000, NoAutoDeleteThread, NormalPriority, "RAS Client:%x"),
+        gatekeeper(gk), identifiers(ids), first(f), count(c), admit(a),
+        confirmed(0), rejected(0), lost(0)
+    {
+      Resume();
+    }
+
+    PINDEX confirmed;
+    PINDEX rejected;
+    PINDEX lost;
+    std::vector<unsigned> latencies;    // Microseconds
+
+  protected:
+    void Main()
+    {
+      PIPSocket::Address localhost(127, 0, 0, 1);
+      PUDPSocket socket;
+      PIPSocket::Address gkIP;
+      WORD gkPort;
+      if (!socket.Listen(localhost) || !gatekeeper.GetIpAndPort(gkIP, gkPort)) {
+        lost = count;
+        return;
+      }
+      socket.SetReadTimeout(2000);
+      H323TransportAddress rasAddress(localhost, socket.GetPort());
+
+      BYTE reply[4096];
+      for (PINDEX i = first; i < first+count; i++) {
+        unsigned seq = (unsigned)(i%65535) + 1;
+        H323RasPDU pdu;
+        if (admit) {
+          if (identifiers[i].IsEmpty()) {
+            lost++;
+            continue;
+          }
+          H225_AdmissionRequest & arq = pdu.BuildAdmissionRequest(seq);
+          arq.m_callType.SetTag(H225_CallType::e_pointToPoint);
+          arq.m_endpointIdentifier = identifiers[i];
+          arq.IncludeOptionalField(H225_AdmissionRequest::e_destinationInfo);
+          arq.m_destinationInfo.SetSize(1);
+          H323SetAliasAddress(psprintf("ep%u", (unsigned)((i+1)%identifiers.size())), arq.m_destinationInfo[0]);
+          arq.m_srcInfo.SetSize(1);
+          H323SetAliasAddress(psprintf("ep%u", (unsigned)i), arq.m_srcInfo[0]);
+          arq.m_bandWidth = 1280;
+          arq.m_callReferenceValue = seq;
+          arq.m_conferenceID = OpalGloballyUniqueID();
+          arq.m_callIdentifier.m_guid = OpalGloballyUniqueID();
+          arq.m_answerCall = FALSE;
+        }
+        else {
+          H225_RegistrationRequest & rrq = pdu.BuildRegistrationRequest(seq);
+          rrq.m_discoveryComplete = FALSE;
+          rrq.m_rasAddress.SetSize(1);
+          rasAddress.SetPDU(rrq.m_rasAddress[0]);
+          rrq.m_callSignalAddress.SetSize(1);
+          unsigned n = (unsigned)i;
+          H323TransportAddress(PIPSocket::Address(10, (BYTE)(n>>16), (BYTE)(n>>8), (BYTE)n), 1720).SetPDU(rrq.m_callSignalAddress[0]);
+          rrq.m_terminalType.IncludeOptionalField(H225_EndpointType::e_terminal);
+          rrq.IncludeOptionalField(H225_RegistrationRequest::e_terminalAlias);
+          rrq.m_terminalAlias.SetSize(1);
+          H323SetAliasAddress(psprintf("ep%u", n), rrq.m_terminalAlias[0]);
+        }
+
+        PPER_Stream strm;
+        pdu.Encode(strm);
+        strm.CompleteEncoding();
+
+        PInt64 start = PTime().GetTimestamp();
+        socket.WriteTo(strm.GetPointer(), strm.GetSize(), gkIP, gkPort);
+
+        // Wait for the answer to this request, RIPs and stale replies are skipped
+        for (;;) {
+          if (!socket.Read(reply, sizeof(reply))) {
+            lost++;
+            break;
+          }
+
+          PPER_Stream in(reply, socket.GetLastReadCount());
+          H225_RasMessage answer;
+          if (!answer.Decode(in))
+            continue;
+
+          PBoolean ok;
+          unsigned answerSeq;
+          switch (answer.GetTag()) {
+            case H225_RasMessage::e_registrationConfirm : {
+              H225_RegistrationConfirm & rcf = answer;
+              answerSeq = rcf.m_requestSeqNum;
+              if (answerSeq == seq)
+                identifiers[i] = rcf.m_endpointIdentifier.GetValue();
+              ok = TRUE;
+              break;
+            }
+            case H225_RasMessage::e_registrationReject :
+              answerSeq = ((H225_RegistrationReject &)answer).m_requestSeqNum;
+              ok = FALSE;
+              break;
+            case H225_RasMessage::e_admissionConfirm :
+              answerSeq = ((H225_AdmissionConfirm &)answer).m_requestSeqNum;
+              ok = TRUE;
+              break;
+            case H225_RasMessage::e_admissionReject :
+              answerSeq = ((H225_AdmissionReject &)answer).m_requestSeqNum;
+              ok = FALSE;
+              break;
+            default :
+              continue;
+          }
+          if (answerSeq != seq)
+            continue;
+
+          latencies.push_back((unsigned)(PTime().GetTimestamp() - start));
+          if (ok)
+            confirmed++;
+          else
+            rejected++;
+          break;
+        }
+      }
+    }
+
+    H323TransportAddress    gatekeeper;
+    std::vector<PString>  & identifiers;
+    PINDEX                  first;
+    PINDEX                  count;
+    PBoolean                admit;
+};
+
+
+static void TimeRasPhase(const char * name, const H323TransportAddress & gkAddress,
+                         std::vector<PString> & identifiers, PINDEX clients, PBoolean admit)
+{
+  PINDEX endpoints = identifiers.size();
+  std::vector<CallLoadRasClient *> threads;
+  PInt64 start = PTime().GetTimestamp();
+  PINDEX i;
+  for (i = 0; i < clients; i++) {
+    PINDEX first = endpoints*i/clients;
+    threads.push_back(new CallLoadRasClient(gkAddress, identifiers, first, endpoints*(i+1)/clients - first, admit));
+  }
+
+  PINDEX confirmed = 0, rejected = 0, lost = 0;
+  std::vector<unsigned> latencies;
+  for (i = 0; i < clients; i++) {
+    threads[i]->WaitForTermination();
+    confirmed += threads[i]->confirmed;
+    rejected += threads[i]->rejected;
+    lost += threads[i]->lost;
+    latencies.insert(latencies.end(), threads[i]->latencies.begin(), threads[i]->latencies.end());
+    delete threads[i];
+  }
+  PInt64 elapsed = PTime().GetTimestamp() - start;
+
+  std::sort(latencies.begin(), latencies.end());
+  PInt64 total = 0;
+  for (i = 0; i < (PINDEX)latencies.size(); i++)
+    total += latencies[i];
+
+  cout << setw(24) << name
+       << setw(10) << (unsigned)(elapsed > 0 ? (PInt64)latencies.size()*1000000/elapsed : 0) << " req/s"
+       << setw(8) << (unsigned)(latencies.empty() ? 0 : total/(PInt64)latencies.size()) << " us avg"
+       << setw(8) << (latencies.empty() ? 0 : latencies[latencies.size()*99/100]) << " us p99"
+       << setw(8) << confirmed << " confirmed"
+       << setw(6) << rejected << " rejected"
+       << setw(6) << lost << " lost" << endl;
+}
+
+
+void CallLoadProcess::RunRasBenchmark(PINDEX endpoints, unsigned dispatchThreads, WORD port)
+{
+  static const PINDEX Clients = 16;
+
+  if (endpoints == 0)
+    endpoints = 1;
+
+  cout << "RAS load benchmark, " << endpoints << " endpoints from " << Clients << " clients" << endl;
+
+  PIPSocket::Address localhost(127, 0, 0, 1);
+  unsigned runs[2] = { 0, dispatchThreads };
+  for (PINDEX run = 0; run < (dispatchThreads > 0 ? 2 : 1); run++) {
+    H323EndPoint endpoint;
+    H323GatekeeperServer gatekeeper(endpoint);
+    gatekeeper.SetDispatchThreads(runs[run], runs[run] > 0 ? 4 : 0);
+
+    H323TransportAddress gkAddress(localhost, (WORD)(port+run));
+    if (!gatekeeper.AddListener(gkAddress)) {
+      cout << "Could not open gatekeeper on " << gkAddress << endl;
+      return;
+    }
+
+    cout << "  " << runs[run] << " dispatch threads" << endl;
+    std::vector<PString> identifiers(endpoints);
+    TimeRasPhase("RRQ", gkAddress, identifiers, Clients, FALSE);
+    TimeRasPhase("ARQ", gkAddress, identifiers, Clients, TRUE);
+  }
+
+  cout << endl;
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
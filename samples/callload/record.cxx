@@ -0,0 +1,126 @@
+/*
+ * record.cxx
+ *
+ * Call recording benchmark: inline against pooled writers.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#include <rtp2wav.h>
+
+#include <vector>
+
+#define new PNEW
+
+
+static void TimeRecording(const char * name,
+                          const PDirectory & directory,
+                          OpalRecordingWriter * writer,
+                          PINDEX calls,
+                          PINDEX packets)
+{
+  std::vector<OpalRtpToWavFile *> recordings(calls);
+  PINDEX i;
+  for (i = 0; i < calls; i++) {
+    PFilePath path = directory + psprintf("call%u.wav", (unsigned)i);
+    if (writer != NULL)
+      recordings[i] = new OpalRtpToWavFile(path, *writer);
+    else
+      recordings[i] = new OpalRtpToWavFile(path);
+  }
+
+  // 20ms of G.711 from every call each tick, as the receive threads would
+  RTP_DataFrame frame(160);
+  frame.SetPayloadType(RTP_DataFrame::PCMU);
+  memset(frame.GetPayloadPtr(), 0xff, 160);
+
+  RTP_MediaHistogram handlerTime;
+  PAdaptiveDelay delay;
+  for (PINDEX packet = 0; packet < packets; packet++) {
+    for (i = 0; i < calls; i++) {
+      PInt64 start = RTP_MediaStatistics::GetTime();
+      recordings[i]->GetReceiveHandler()(frame, 0);
+      handlerTime.Record(RTP_MediaStatistics::GetTime() - start);
+    }
+    delay.Delay(20);
+  }
+
+  PInt64 start = RTP_MediaStatistics::GetTime();
+  PUInt64 dropped = 0;
+  for (i = 0; i < calls; i++) {
+    dropped += recordings[i]->GetBytesDropped();
+    delete recordings[i];
+    PFile::Remove(directory + psprintf("call%u.wav", (unsigned)i));
+  }
+  PInt64 closeTime = RTP_MediaStatistics::GetTime() - start;
+
+  RTP_MediaHistogram::Snapshot snapshot;
+  handlerTime.GetSnapshot(snapshot);
+  cout << setw(14) << name
+       << " packet us: avg " << snapshot.GetAverage()
+       << " p50 " << snapshot.GetPercentile(50)
+       << " p99 " << snapshot.GetPercentile(99)
+       << " max " << snapshot.maximum
+       << ", close " << closeTime/1000 << " ms, dropped " << dropped << " bytes" << endl;
+}
+
+
+void CallLoadProcess::RunRecordBenchmark(PINDEX calls, PINDEX packets)
+{
+  if (calls == 0)
+    calls = 1;
+
+  // Paced in real time, ten seconds of audio is enough to see the stalls
+  packets = PMIN(packets, 500);
+
+  PDirectory directory("callload-recordings");
+  if (!directory.Exists() && !directory.Create()) {
+    cerr << "Could not create " << directory << endl;
+    return;
+  }
+
+  cout << "Record benchmark, " << calls << " concurrent calls, " << packets << " packets each" << endl;
+
+  TimeRecording("Synchronous", directory, NULL, calls, packets);
+
+  OpalRecordingWriter writer;
+  writer.SetPreallocation(packets*160);
+  TimeRecording("Writer pool", directory, &writer, calls, packets);
+
+  PUInt64 written, dropped;
+  unsigned writes, syncs;
+  writer.GetStatistics(written, dropped, writes, syncs);
+  cout << setw(14) << "" << " " << written << " bytes in " << writes << " writes, "
+       << syncs << " syncs" << endl << endl;
+
+  PDirectory::Remove(directory);
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
@@ -0,0 +1,182 @@
+/*
+ * soak.cxx
+ *
+ * Signalling soak: idle calls served by the signal reactor.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#include <vector>
+
+#define new PNEW
+
+
+class CallLoadSoakHandle : public H323SignalReactor::Handle
+{
+  PCLASSINFO(CallLoadSoakHandle, H323SignalReactor::Handle);
+  public:
+    CallLoadSoakHandle(H323Transport & transport, PAtomicInteger & m, PAtomicInteger & d)
+      : H323SignalReactor::Handle(transport, &transport), monitors(m), detached(d)
+    {
+      SetKeepAlive(TRUE);
+      SetMonitorInterval(PTimeInterval(0, 10));
+    }
+
+    PBoolean OnReceivePDU(const PBYTEArray &) { return TRUE; }
+    PBoolean OnReadError(PChannel::Errors error) { return error == PChannel::Timeout; }
+    void OnMonitor() { ++monitors; }
+    void OnDetached() { ++detached; }
+
+  protected:
+    PAtomicInteger & monitors;
+    PAtomicInteger & detached;
+};
+
+
+// Count the keep alive TPKTs waiting on the remote end, FALSE if it was closed
+static PBoolean DrainSoakRemote(PTCPSocket & remote, PINDEX & keepAlives)
+{
+  BYTE data[256];
+  remote.SetReadTimeout(0);
+  while (remote.Read(data, sizeof(data)))
+    keepAlives += remote.GetLastReadCount()/4;
+  return remote.GetErrorCode(PChannel::LastReadError) == PChannel::Timeout;
+}
+
+
+void CallLoadProcess::RunSoakBenchmark(PINDEX calls, unsigned seconds)
+{
+  cout << "Idle signalling soak, " << calls << " calls for " << seconds << " seconds" << endl;
+
+  H323EndPoint endpoint;
+  H323SignalReactor * reactor = new H323SignalReactor;
+
+  double startCPU, cpu;
+  unsigned baseThreads, threads;
+  PUInt64 baseRSS, rss;
+  GetProcessUsage(startCPU, baseThreads, baseRSS);
+
+  PIPSocket::Address localhost(127, 0, 0, 1);
+  PTCPSocket listener;
+  if (!listener.Listen(localhost, 100)) {
+    cout << "Could not listen on " << localhost << endl;
+    delete reactor;
+    return;
+  }
+
+  PAtomicInteger monitors(0), detached(0);
+  std::vector<H323TransportTCP *> transports;
+  std::vector<CallLoadSoakHandle *> handles;
+  std::vector<PTCPSocket *> remotes;
+  H323TransportAddress address(localhost, listener.GetPort());
+  PINDEX i;
+  for (i = 0; i < calls; i++) {
+    H323TransportTCP * transport = new H323TransportTCP(endpoint, localhost);
+    PTCPSocket * remote = new PTCPSocket;
+    if (!transport->ConnectTo(address) || !remote->Accept(listener)) {
+      // Usually the descriptor limit, two are used per call (ulimit -n)
+      cout << "Could not open call " << i << endl;
+      delete remote;
+      delete transport;
+      break;
+    }
+    transport->SetReadTimeout(PMaxTimeInterval);
+
+    CallLoadSoakHandle * handle = new CallLoadSoakHandle(*transport, monitors, detached);
+    if (!reactor->AddHandle(handle)) {
+      cout << "Reactor could not service call " << i << endl;
+      delete handle;
+      delete remote;
+      delete transport;
+      break;
+    }
+    transports.push_back(transport);
+    handles.push_back(handle);
+    remotes.push_back(remote);
+  }
+
+  if (transports.empty()) {
+    delete reactor;
+    return;
+  }
+
+  GetProcessUsage(startCPU, threads, rss);
+  PUInt64 openRSS = rss;
+  cout << setw(28) << "Calls open" << setw(10) << transports.size() << '\n'
+       << setw(28) << "Threads" << setw(10) << (threads - baseThreads) << '\n'
+       << setw(28) << "Memory per call" << setw(10) << (unsigned)((rss - baseRSS)/transports.size()) << " bytes" << endl;
+
+  // The remote ends are drained every second so keep alives never back up
+  PINDEX keepAlives = 0;
+  for (unsigned second = 0; second < seconds; second++) {
+    PThread::Sleep(1000);
+    for (i = 0; i < (PINDEX)remotes.size(); i++)
+      DrainSoakRemote(*remotes[i], keepAlives);
+  }
+
+  GetProcessUsage(cpu, threads, rss);
+  cpu -= startCPU;
+  PINDEX open = transports.size();
+  cout << setw(28) << "CPU" << setw(10) << setprecision(4) << cpu*100/seconds << " %\n"
+       << setw(28) << "Memory growth" << setw(10) << (PInt64)(rss - openRSS)/1024 << " kB\n"
+       << setw(28) << "Keep alives received" << setw(10) << keepAlives
+       << " (" << (PINDEX)(open*(seconds/19)) << " due)\n"
+       << setw(28) << "Monitor ticks" << setw(10) << (PINDEX)monitors
+       << " (" << (PINDEX)(open*(seconds/10)) << " due)" << endl;
+
+  // Closing the transports must close the connection the reactor is reading
+  PTime closeStart;
+  for (i = 0; i < (PINDEX)transports.size(); i++)
+    transports[i]->Close();
+  for (PINDEX wait = 0; detached < (int)open && wait < 500; wait++)
+    PThread::Sleep(10);
+  PINDEX closedTime = (PINDEX)(PTime() - closeStart).GetMilliSeconds();
+
+  PThread::Sleep(100);
+  PINDEX remoteClosed = 0;
+  for (i = 0; i < (PINDEX)remotes.size(); i++) {
+    if (!DrainSoakRemote(*remotes[i], keepAlives))
+      remoteClosed++;
+  }
+
+  cout << setw(28) << "Close" << setw(10) << closedTime << " ms, "
+       << (PINDEX)detached << " detached, " << remoteClosed << " seen by remote"
+       << (remoteClosed != open || detached != (int)open ? "  FAILED" : "") << '\n' << endl;
+
+  for (i = 0; i < (PINDEX)handles.size(); i++) {
+    reactor->RemoveHandle(handles[i]);
+    delete handles[i];
+    delete transports[i];
+    delete remotes[i];
+  }
+  delete reactor;
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
@@ -0,0 +1,181 @@
+/*
+ * streams.cxx
+ *
+ * Receive stream benchmark: jitter buffer threads against the media reactor.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#include <jitter.h>
+
+#include <vector>
+
+#define new PNEW
+
+
+/* Codec side of the stream benchmark, taking 20ms from the jitter buffer of
+   every stream each tick as the receive channel threads would. */
+class CallLoadStreamReader : public PThread
+{
+    PCLASSINFO(CallLoadStreamReader, PThread);
+  public:
+    CallLoadStreamReader(std::vector<RTP_UDP *> & _sessions, PAtomicInteger & _received)
+      : PThread(10000, NoAutoDeleteThread, NormalPriority, "Stream Reader"),
+        sessions(_sessions), received(_received), running(TRUE)
+    { Resume(); }
+
+    void Stop() { running = FALSE; WaitForTermination(); }
+
+    void Main()
+    {
+      RTP_DataFrame frame;
+      PAdaptiveDelay delay;
+      for (DWORD timestamp = 0; running; timestamp += 160) {
+        for (PINDEX i = 0; i < (PINDEX)sessions.size(); i++) {
+          if (sessions[i]->ReadBufferedData(timestamp, frame) && frame.GetPayloadSize() > 0)
+            ++received;
+        }
+        delay.Delay(20);
+      }
+    }
+
+  protected:
+    std::vector<RTP_UDP *> & sessions;
+    PAtomicInteger & received;
+    volatile PBoolean running;
+};
+
+
+static void TimeStreams(const char * name, PINDEX streams, PINDEX reactorThreads, PBoolean scheduled, unsigned seconds)
+{
+  H323EndPoint endpoint;
+  H323Connection * connection = new H323Connection(endpoint, 1);
+  RTP_MediaReactor * reactor = reactorThreads > 0 ? new RTP_MediaReactor(reactorThreads) : NULL;
+  RTP_JitterScheduler * scheduler = scheduled ? new RTP_JitterScheduler : NULL;
+
+  double cpu;
+  unsigned baseThreads;
+  PUInt64 rss;
+  GetProcessUsage(cpu, baseThreads, rss);
+
+  PIPSocket::Address localhost(127, 0, 0, 1);
+  std::vector<RTP_UDP *> sessions;
+  std::vector<WORD> ports;
+  PINDEX i;
+  for (i = 0; i < streams; i++) {
+#ifdef H323_RTP_AGGREGATE
+    RTP_UDP * session = new RTP_UDP(NULL, 1);
+#else
+    RTP_UDP * session = new RTP_UDP(1);
+#endif
+    WORD port = endpoint.GetRtpIpPortPair();
+    if (!session->Open(localhost, port, port, 0, *connection)) {
+      cout << setw(20) << name << "  could not open stream " << i << endl;
+      delete session;
+      break;
+    }
+    if (reactor != NULL)
+      session->AttachReactor(reactor);
+    // 20 to 100ms of G.711, as an audio receive channel sets up
+    session->SetJitterBufferSize(160, 800, endpoint.GetJitterThreadStackSize(), scheduler, 20);
+    sessions.push_back(session);
+    ports.push_back(session->GetLocalDataPort());
+  }
+
+  PAtomicInteger received(0);
+  CallLoadStreamReader * reader = new CallLoadStreamReader(sessions, received);
+
+  // 20ms of G.711 to every stream each tick
+  PUDPSocket sender;
+  sender.Listen(localhost);
+  RTP_DataFrame frame(160);
+  frame.SetPayloadType(RTP_DataFrame::PCMU);
+  memset(frame.GetPayloadPtr(), 0xff, 160);
+
+  double startCPU = 0;
+  unsigned threads = 0;
+  PINDEX startReceived = 0;
+  PINDEX sent = 0;
+  PINDEX ticks = (seconds+1)*50;
+  PAdaptiveDelay delay;
+  for (PINDEX tick = 0; tick < ticks; tick++) {
+    if (tick == 50) {   // one second to settle
+      GetProcessUsage(startCPU, threads, rss);
+      startReceived = received;
+      sent = 0;
+    }
+    frame.SetSequenceNumber((WORD)tick);
+    frame.SetTimestamp(tick*160);
+    for (i = 0; i < (PINDEX)ports.size(); i++) {
+      sender.WriteTo(frame.GetPointer(), frame.GetHeaderSize()+160, localhost, ports[i]);
+      sent++;
+    }
+    delay.Delay(20);
+  }
+
+  GetProcessUsage(cpu, threads, rss);
+  cpu -= startCPU;
+  PINDEX delivered = received - startReceived;
+
+  reader->Stop();
+  delete reader;
+  for (i = 0; i < (PINDEX)sessions.size(); i++)
+    sessions[i]->Close(TRUE);
+  for (i = 0; i < (PINDEX)sessions.size(); i++)
+    delete sessions[i];
+  delete scheduler;
+  delete reactor;
+  delete connection;
+
+  double perThousand = sessions.empty() ? 0 : 1000.0/sessions.size();
+  cout << setw(20) << name
+       << setw(10) << setprecision(4) << (threads - baseThreads)*perThousand << " threads"
+       << setw(10) << setprecision(4) << cpu*100/seconds*perThousand << " % CPU"
+       << setw(10) << (sent > 0 ? (unsigned)((PInt64)delivered*100/sent) : 0) << " % played" << endl;
+}
+
+
+void CallLoadProcess::RunStreamBenchmark(PINDEX streams, PINDEX reactorThreads)
+{
+  if (streams == 0)
+    streams = 1;
+  if (reactorThreads == 0)
+    reactorThreads = 1;
+
+  cout << "Stream benchmark, " << streams << " receive streams at 50 packets/s, per 1000 streams\n"
+          "  Each stream uses two sockets, raise the descriptor limit for large runs" << endl;
+
+  TimeStreams("Jitter threads", streams, 0, FALSE, 10);
+  TimeStreams("Media reactor", streams, reactorThreads, FALSE, 10);
+  TimeStreams("Reactor and scheduler", streams, reactorThreads, TRUE, 10);
+  cout << endl;
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
@@ -0,0 +1,178 @@
+/*
+ * tcs.cxx
+ *
+ * Capability benchmark: capability set setup and encoding.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#ifdef H323_H235
+#include <h235/h235caps.h>
+#endif
+
+#define new PNEW
+
+
+// Pad the set to the size of a well stocked endpoint with copies of what is there
+static void FillCapabilities(H323EndPoint & endpoint, PINDEX size)
+{
+  endpoint.AddAllCapabilities(0, P_MAX_INDEX, "*");
+  endpoint.AddAllUserInputCapabilities(0, P_MAX_INDEX);
+
+  const H323Capabilities & capabilities = endpoint.GetCapabilities();
+  PINDEX original = capabilities.GetSize();
+  for (PINDEX i = 0; original > 0 && capabilities.GetSize() < size; i++)
+    endpoint.SetCapability(0, P_MAX_INDEX, (H323Capability *)capabilities[i%original].Clone());
+}
+
+
+static PBYTEArray EncodeCapabilitySet(const H323Capabilities & capabilities, const H323Connection & connection)
+{
+  H245_TerminalCapabilitySet tcs;
+  capabilities.BuildPDU(connection, tcs);
+
+  PPER_Stream strm;
+  tcs.Encode(strm);
+  strm.CompleteEncoding();
+  return strm;
+}
+
+
+// What each call does with the set: copy it, send it, and look codecs up
+static PInt64 TimeCapabilitySetup(const H323Capabilities & endpointCapabilities,
+                                  const H323Connection & connection, PINDEX iterations)
+{
+  PINDEX size = endpointCapabilities.GetSize();
+  PInt64 start = PTime().GetTimestamp();
+
+  for (PINDEX i = 0; i < iterations; i++) {
+    H323Capabilities capabilities(endpointCapabilities);
+    EncodeCapabilitySet(capabilities, connection);
+
+    PINDEX j;
+    for (j = 0; j < size; j++)
+      capabilities.FindCapability(capabilities[j].GetCapabilityNumber());
+    for (j = 0; j < 5; j++)
+      capabilities.FindCapability(capabilities[j%size].GetFormatName());
+  }
+
+  return PTime().GetTimestamp() - start;
+}
+
+
+#ifdef H323_H235
+
+// Wrapping a set appends the H.235 security capabilities to the table as
+// well, every entry must still be found by name and number afterwards.
+static PBoolean CheckSecureCapabilityLookups(const H323Capabilities & capabilities)
+{
+  H235Capabilities secure;
+  for (PINDEX i = 0; i < capabilities.GetSize(); i++)
+    secure.WrapCapability(0, P_MAX_INDEX, capabilities[i]);
+
+  H235Capabilities copy((const H323Capabilities &)secure);
+  if (copy.GetSize() == 0)
+    return FALSE;
+
+  for (PINDEX i = 0; i < copy.GetSize(); i++) {
+    PString name = copy[i].GetFormatName();
+    H323Capability * byName = copy.FindCapability(name);
+    if (byName == NULL || byName->GetFormatName() != name) {
+      cout << "  " << name << " not found by name" << endl;
+      return FALSE;
+    }
+
+    unsigned number = copy[i].GetCapabilityNumber();
+    H323Capability * byNumber = copy.FindCapability(number);
+    if (byNumber == NULL || byNumber->GetCapabilityNumber() != number) {
+      cout << "  " << name << " not found by number " << number << endl;
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+#endif
+
+
+void CallLoadProcess::RunCapabilityBenchmark(PINDEX iterations)
+{
+  H323EndPoint endpoint;
+  FillCapabilities(endpoint, 40);
+
+  const H323Capabilities & capabilities = endpoint.GetCapabilities();
+  PINDEX size = capabilities.GetSize();
+  if (size == 0) {
+    cout << "Capability set benchmark, no capabilities available\n" << endl;
+    return;
+  }
+
+  H323Connection * connection = new H323Connection(endpoint, 1);
+  iterations = PMIN(iterations, 10000);
+
+  cout << "Capability set benchmark, " << size << " capabilities, " << iterations << " call setups" << endl;
+
+  PInt64 start = PTime().GetTimestamp();
+  PINDEX i;
+  for (i = 0; i < iterations; i++)
+    capabilities.FindCapability(capabilities[i%size].GetCapabilityNumber());
+  PInt64 byNumber = PTime().GetTimestamp() - start;
+
+  start = PTime().GetTimestamp();
+  for (i = 0; i < iterations; i++)
+    capabilities.FindCapability(capabilities[i%size].GetFormatName());
+  PInt64 byName = PTime().GetTimestamp() - start;
+
+  PBYTEArray uncachedPDU = EncodeCapabilitySet(capabilities, *connection);
+  PInt64 uncached = TimeCapabilitySetup(capabilities, *connection, iterations);
+
+  endpoint.SetCapabilityPDUCaching(TRUE);
+  EncodeCapabilitySet(capabilities, *connection);
+  PBYTEArray cachedPDU = EncodeCapabilitySet(capabilities, *connection);
+  PInt64 cached = TimeCapabilitySetup(capabilities, *connection, iterations);
+  endpoint.SetCapabilityPDUCaching(FALSE);
+
+  cout << setw(28) << "Find by number" << setw(10) << (unsigned)(byNumber*1000/iterations) << " ns\n"
+       << setw(28) << "Find by name" << setw(10) << (unsigned)(byName*1000/iterations) << " ns\n"
+       << setw(28) << "Setup, encoded each call" << setw(10) << (unsigned)(uncached/iterations) << " us\n"
+       << setw(28) << "Setup, endpoint PDU cache" << setw(10) << (unsigned)(cached/iterations) << " us, "
+       << endpoint.GetCapabilityPDUCache().GetHits() << " hits"
+       << (cachedPDU != uncachedPDU ? "  MISMATCH" : "") << endl;
+
+#ifdef H323_H235
+  cout << setw(28) << "Secure lookups" << setw(10) << (CheckSecureCapabilityLookups(capabilities) ? "OK" : "FAILED") << endl;
+#endif
+
+  delete connection;
+  cout << endl;
+}
+
+
+// End of File ///////////////////////////////////////////////////////////////
@@ -0,0 +1,185 @@
+/*
+ * tunnel.cxx
+ *
+ * H.460.26 tunnel benchmark: polled against woken writers.
+ *
+ * Copyright (c) 2013 H323plus
+ *
+ * The contents of this file are subject to the Mozilla Public License
+ * Version 1.0 (the "License"); you may not use this file except in
+ * compliance with the License. You may obtain a copy of the License at
+ * http://www.mozilla.org/MPL/
+ *
+ * Software distributed under the License is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTY OF ANY KIND, either express or implied. See
+ * the License for the specific language governing rights and limitations
+ * under the License.
+ *
+ * The Original Code is Portable Windows Library.
+ *
+ * Contributor(s): ______________________________________.
+ *
+ * $Id$
+ *
+ */
+
+#include <ptlib.h>
+
+#ifdef __GNUC__
+#define H323_STATIC_LIB
+#endif
+
+#include "main.h"
+#include "bench.h"
+
+#ifdef H323_H46026
+#include <h460/h46026mgr.h>
+#endif
+
+#include <algorithm>
+#include <vector>
+
+#define new PNEW
+
+
+#ifdef H323_H46026
+
+/* The far end of the tunnel, records the time each RTP frame spent between
+   RTPFrameOut() on the sending manager and arriving here. */
+class CallLoadTunnelReceiver : public H46026ChannelManager
+{
+    PCLASSINFO(CallLoadTunnelReceiver, H46026ChannelManager);
+  public:
+    virtual void RTPFrameIn(unsigned, PINDEX, PBoolean, const BYTE * data, PINDEX len)
+    {
+      if (len < 12 + (PINDEX)sizeof(PInt64))
+        return;
+      PInt64 sent;
+      memcpy(&sent, data+12, sizeof(sent));
+      latencies.push_back((unsigned)(PTime().GetTimestamp() - sent));
+    }
+
+    std::vector<unsigned> latencies;    // Microseconds
+};
+
+
+/* The H.460.17 tunnel writer, either polling SocketOut() every 2ms as it
+   did before or blocking in WaitSocketOut(). */
+class CallLoadTunnelWriter : public PThread
+{
+    PCLASSINFO(CallLoadTunnelWriter, PThread);
+  public:
+    CallLoadTunnelWriter(H46026ChannelManager & s, CallLoadTunnelReceiver & r, PBoolean p)
+      : PThread(10000, NoAutoDeleteThread, HighPriority, "Tunnel Writer"),
+        sender(s), receiver(r), poll(p), running(TRUE)
+    { Resume(); }
+
+    void Stop() { running = FALSE; WaitForTermination(); }
+
+    void Main()
+    {
+      if (poll) {
+        PBYTEArray buffer(10000);
+        PINDEX len = 0;
+        while (running) {
+          if (sender.SocketOut(buffer.GetPointer(), len))
+            receiver.SocketIn((const BYTE *)buffer, len);
+          else
+            PThread::Sleep(2);
+        }
+      }
+      else {
+        PBYTEArray tpkt;
+        while (running) {
+          if (sender.WaitSocketOut(tpkt, 100))
+            receiver.SocketIn((const BYTE *)tpkt + 4, tpkt.GetSize() - 4);
+        }
+      }
+    }
+
+  protected:
+    H46026ChannelManager   & sender;
+    CallLoadTunnelReceiver & receiver;
+    PBoolean                 poll;
+    volatile PBoolean        running;
+};
+
+
+static void TimeTunnel(const char * name, PINDEX calls, PBoolean poll, unsigned budget, unsigned seconds)
+{
+  H46026ChannelManager sender;
+  CallLoadTunnelReceiver receiver;
+  sender.SetPipeBandwidth((unsigned)(calls*120000+384000));
+  sender.SetLatencyBudget(budget);
+
+  double startCPU, cpu;
+  unsigned threads;
+  PUInt64 rss;
+  GetProcessUsage(startCPU, threads, rss);
+
+  CallLoadTunnelWriter writer(sender, receiver, poll);
+
+  // One 20ms G.711 frame per call, stamped with the time it was queued
+  BYTE frame[12+160];
+  memset(frame, 0, sizeof(frame));
+  frame[0] = 0x80;
+  PINDEX sent = 0;
+  PTimeInterval next = PTimer::Tick();
+  PTimeInterval finish = next + PTimeInterval(0, seconds);
+  while (next < finish) {
+    for (PINDEX i = 0; i < calls; i++) {
+      PInt64 now = PTime().GetTimestamp();
+      memcpy(frame+12, &now, sizeof(now));
+      sender.RTPFrameOut((unsigned)i+1, H46026ChannelManager::e_Audio, 1, TRUE, frame, sizeof(frame));
+      sent++;
+    }
+    next += PTimeInterval(20);
+    PTimeInterval delay = next - PTimer::Tick();
+    if (delay > 0)
+      PThread::Sleep(delay);
+  }
+
+  // Let the last partly packed messages drain
+  PThread::Sleep(200);
+  writer.Stop();
+
+  GetProcessUsage(cpu, threads, rss);
+  cpu -= startCPU;
+
+  for (PINDEX i = 0; i < calls; i++)
+    sender.BufferRelease((unsigned)i+1);
+
+  std::vector<unsigned> & latencies = receiver.latencies;
+  std::sort(latencies.begin(), latencies.end());
+  PInt64 total = 0;
+  for (PINDEX j = 0; j < (PINDEX)latencies.size(); j++)
+    total += latencies[j];
+
+  cout << setw(24) << name
+       << setw(8) << setprecision(3) << (latencies.empty() ? 0.0 : (double)total/latencies.size()/1000) << " ms avg"
+       << setw(8) << setprecision(3) << (latencies.empty() ? 0.0 : latencies[latencies.size()*99/100]/1000.0) << " ms p99"
+       << setw(8) << setprecision(3) << cpu*100/seconds << " % CPU"
+       << setw(8) << (PINDEX)latencies.size() << '/' << sent << " frames"
+       << (sent - (PINDEX)latencies.size() > 3*calls ? "  MISMATCH" : "")
+       << endl;
+}
+
+
+void CallLoadProcess::RunTunnelBenchmark(PINDEX calls, unsigned seconds)
+{
+  if (calls == 0)
+    calls = 1;
+  if (seconds == 0)
+    seconds = 1;
+
+  cout << "Tunnel benchmark, " << calls << " G.711 calls through H.460.26, " << seconds << " seconds per run" << endl;
+  TimeTunnel("Poll every 2ms", calls, TRUE, 0, seconds);
+  TimeTunnel("Wait", calls, FALSE, 0, seconds);
+  TimeTunnel("Wait, 10ms budget", calls, FALSE, 10, seconds);
+  cout << endl;
+}
+
+#endif // H323_H46026
+
+
+// End of File ///////////////////////////////////////////////////////////////
@@ -0,0 +1,32 @@
+#
+# arena.awk
+#
+# Post processes a header generated by asnparser so the generated classes
+# allocate from the per message PDU arena, see include/h323arena.h.
+#
+# Run it on h225.h, h235.h and h245.h each time they are regenerated:
+#
+#   awk -f src/asn/arena.awk include/h245.h > h245.tmp && mv h245.tmp include/h245.h
+#
+# It adds the h323arena.h include after the asner.h include, and an
+# H323_PDU_ARENA_ALLOCATOR line after the PCLASSINFO block of each class.
+# Running it again on a processed header leaves it unchanged.
+#
+
+# Drop what a previous run added so the output is always the same
+/^#include "h323arena.h"$/ { next }
+/^    H323_PDU_ARENA_ALLOCATOR$/ { next }
+
+{ print }
+
+/^#include <ptclib\/asner.h>$/ { print "#include \"h323arena.h\"" }
+
+/^    PCLASSINFO\(/ { inClassInfo = 1; next }
+
+inClassInfo && /^#endif/ {
+  print "    H323_PDU_ARENA_ALLOCATOR"
+  inClassInfo = 0
+  next
+}
+
+{ inClassInfo = 0 }
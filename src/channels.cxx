@@ -671,6 +671,17 @@ H323_RTPChannel::H323_RTPChannel(H323Connection & conn,
     rtpCallbacks(*(H323_RTP_Session *)r.GetUserData()), silenceStartTick(0),
     rec_written(0), rec_ok(false)
 {
+#ifdef H323_AUDIO_CODECS
+  mediaClock = NULL;
+  clockStopping = FALSE;
+  clockFramesInPacket = 1;
+  clockMaxFrameSize = 0;
+  clockSilent = TRUE;
+  clockTimestamp = 0;
+  clockPeriod = 0;
+  clockNextDue = 0;
+#endif
+
   PTRACE(3, "H323RTP\t" << (receiver ? "Receiver" : "Transmitter")
          << " created using session " << GetSessionID());
 }
@@ -696,6 +707,17 @@ void H323_RTPChannel::CleanUpOnTermination()
   if ((receiver ? receiveThread : transmitThread) != NULL)
     rtpSession.Close(receiver);
 
+#ifdef H323_AUDIO_CODECS
+  // Likewise break a tick out of the codec and wait for it to finish
+  if (mediaClock != NULL) {
+    clockStopping = TRUE;
+    if (codec != NULL)
+      codec->Close();
+    mediaClock->Remove(*this);
+    mediaClock = NULL;
+  }
+#endif
+
   H323Channel::CleanUpOnTermination();
 }
 
@@ -712,6 +734,69 @@ void H323_RTPChannel::SetSessionID(unsigned id)
 }
 
 
+PBoolean H323_RTPChannel::Start()
+{
+#ifdef H323_AUDIO_CODECS
+  H323MediaClock * clock = (receiver || opened) ? NULL : endpoint.GetMediaClock();
+  unsigned packetTime = 0;
+
+  if (clock != NULL && GetCodec() != NULL &&
+      codec->GetMediaFormat().NeedsJitterBuffer() && PIsDescendant(codec, H323FramedAudioCodec)) {
+    const OpalMediaFormat & mediaFormat = codec->GetMediaFormat();
+    clockFramesInPacket = capability->GetTxFramesInPacket();
+    if (clockFramesInPacket > 8 || clockFramesInPacket == 0)
+      clockFramesInPacket = 1;  // As for Transmit()
+    clockMaxFrameSize = mediaFormat.GetFrameSize()*mediaFormat.GetFrameTime();
+    packetTime = clockFramesInPacket*codec->GetFrameRate()/PMAX(mediaFormat.GetTimeUnits(), 1U);
+
+    // Tell the codec before it opens its raw channel that it is not paced by it
+    if (packetTime > 0 && clockMaxFrameSize > 0)
+      ((H323AudioCodec *)codec)->SetMediaClocked(TRUE);
+    else
+      packetTime = 0;
+  }
+
+  if (packetTime > 0) {
+    if (!Open())
+      return FALSE;
+
+    rtpPayloadType = GetRTPPayloadType();
+    if (rtpPayloadType == RTP_DataFrame::IllegalPayloadType) {
+      PTRACE(1, "H323RTP\tTransmit " << codec->GetMediaFormat() << " not clocked (illegal payload type)");
+      return FALSE;
+    }
+
+    clockFrame.SetPayloadSize(clockFramesInPacket*clockMaxFrameSize);
+    clockFrame.SetPayloadType(rtpPayloadType);
+    clockFrame.SetMarker(FALSE);
+    clockSilent = TRUE;
+    clockTimestamp = PRandom();
+    clockPeriod = (PInt64)packetTime*1000;
+    clockNextDue = 0;
+    codec->AttachMediaStatistics(&rtpSession.GetMediaStatistics());
+
+    PTRACE(2, "H323RTP\tTransmit " << codec->GetMediaFormat() << " clocked every " << packetTime << "ms");
+    mediaClock = clock;
+    mediaClock->Add(*this, packetTime);
+    return TRUE;
+  }
+#endif
+
+  return H323_RealTimeChannel::Start();
+}
+
+
+PBoolean H323_RTPChannel::IsRunning() const
+{
+#ifdef H323_AUDIO_CODECS
+  if (mediaClock != NULL)
+    return opened;
+#endif
+
+  return H323_RealTimeChannel::IsRunning();
+}
+
+
 PBoolean H323_RTPChannel::Open()
 {
   if (opened)
@@ -884,6 +969,14 @@ void H323_RTPChannel::Transmit()
   PInt64 lastFrameTime = 0;
 #endif
 
+#ifdef H323_VIDEO
+  PBoolean videoFrameStart = TRUE;
+  if (!isAudio) {
+    videoPacer.SetKeyFrameBurst(endpoint.GetVideoKeyFrameBurst());
+    videoPacer.SetMaxDelay(endpoint.GetVideoMaxPacingDelay());
+  }
+#endif
+
 #if PTRACING
   DWORD lastDisplayedTimestamp = 0;
   CodecReadAnalyser * codecReadAnalysis = NULL;
@@ -891,6 +984,13 @@ void H323_RTPChannel::Transmit()
     codecReadAnalysis = new CodecReadAnalyser;
 #endif
 
+  // Expected interval between audio frames, used to measure how late the
+  // codec hands each frame over relative to the media clock.
+  RTP_MediaStatistics & statistics = rtpSession.GetMediaStatistics();
+  codec->AttachMediaStatistics(&statistics);
+  PInt64 framePeriod = isAudio ? (PInt64)codec->GetFrameRate()*1000/PMAX(mediaFormat.GetTimeUnits(), 1U) : 0;
+  PInt64 nextFrameDue = 0;
+
 
   /* Now keep getting encoded frames from the codec, it is expected that the
      Read() function will maintain the Real Time aspects of the transmission.
@@ -901,6 +1001,12 @@ void H323_RTPChannel::Transmit()
     // Calculate the timestamp and real time to take in processing
     if(isAudio)
     {
+        PInt64 now = RTP_MediaStatistics::GetTime();
+        if (nextFrameDue == 0 || now - nextFrameDue > framePeriod*8)
+          nextFrameDue = now;   // first frame or resync after a long stall
+        statistics[RTP_MediaStatistics::TransmitOverrun].Record(now > nextFrameDue ? now - nextFrameDue : 0);
+        nextFrameDue += framePeriod;
+
         rtpTimestamp += codec->GetFrameRate();
     }
     else
@@ -1001,19 +1107,42 @@ void H323_RTPChannel::Transmit()
     }
 
     if (sendPacket || (silent && frame.GetPayloadSize() > 0)) {
-      // Send the frame of coded data we have so far to RTP transport
-      if (!WriteFrame(frame))
-         break;
+      PBoolean writePacket = TRUE;
 
       // video frames produce many packets per frame especially at
       // higher resolutions and can easily overload the link if sent
-      // without delay
+      // without pacing
       if (!isAudio) {
-         PThread::Sleep(5);
-         if (frame.GetMarker())
-             rtpTimestamp = nextTimestamp;
+#ifdef H323_VIDEO
+        H323VideoCodec * videoCodec = (H323VideoCodec *)codec;
+        if (videoFrameStart) {
+          unsigned bitRate = videoCodec->GetMaxBitRate();
+          videoPacer.SetBitRate(bitRate > 0 ? bitRate : mediaFormat.GetBandwidth());
+        }
+        videoFrameStart = frame.GetMarker();
+
+        PInt64 paceStart = RTP_MediaStatistics::GetTime();
+        writePacket = videoPacer.Pace(frame.GetHeaderSize()+frame.GetPayloadSize(),
+                                      frame.GetMarker(), videoCodec->IsKeyFrame(),
+                                      frame.GetTimestamp());
+        statistics[RTP_MediaStatistics::PacingDelay].Record(RTP_MediaStatistics::GetTime() - paceStart);
+
+        // A dropped frame leaves the decoder without its reference, but do
+        // not have the encoder send key frames back to back while behind
+        if (!writePacket && frame.GetMarker() && videoPacer.TakeKeyFrameRequest())
+          videoCodec->OnFastUpdatePicture();
+#else
+        PThread::Sleep(5);
+#endif
       }
 
+      // Send the frame of coded data we have so far to RTP transport
+      if (writePacket && !WriteFrame(frame))
+         break;
+
+      if (!isAudio && frame.GetMarker())
+         rtpTimestamp = nextTimestamp;
+
       // Reset flag for in talk burst
       if (isAudio)
         frame.SetMarker(FALSE);
@@ -1040,6 +1169,105 @@ void H323_RTPChannel::Transmit()
   PTRACE(2, "H323RTP\tTransmit " << mediaFormat << " thread ended");
 }
 
+#ifdef H323_AUDIO_CODECS
+PBoolean H323_RTPChannel::OnMediaClockTick(PBoolean & failed)
+{
+  if (terminating || clockStopping)
+    return FALSE;
+
+  PInt64 now = RTP_MediaStatistics::GetTime();
+  if (clockNextDue == 0 || now - clockNextDue > clockPeriod*8)
+    clockNextDue = now;   // first tick or resync after a long stall
+  rtpSession.GetMediaStatistics()[RTP_MediaStatistics::TransmitOverrun].Record(now > clockNextDue ? now - clockNextDue : 0);
+  clockNextDue += clockPeriod;
+
+  /* Read a packet time worth of frames from the codec. The clock does the
+     pacing so these come back without waiting. A frame of silence ends the
+     packet, the rest of the tick is still read to keep up with the source.
+   */
+  unsigned frameOffset = 0;
+  unsigned frameCount = 0;
+  PBoolean packetEnded = FALSE;
+  PBoolean ok = TRUE;
+
+  clockFrame.SetPayloadSize(clockFramesInPacket*clockMaxFrameSize);
+  while (frameCount < clockFramesInPacket) {
+    unsigned length = 0;
+    if (!codec->Read(clockFrame.GetPayloadPtr()+frameOffset, length, clockFrame)) {
+      ok = FALSE;
+      break;
+    }
+
+    DWORD frameTimestamp = clockTimestamp;
+    clockTimestamp += codec->GetFrameRate();
+
+    if (paused)
+      length = 0; // Act as though silent
+
+    if (length == 0) {
+      frameCount++;
+      if (!clockSilent) {
+        clockSilent = TRUE;
+        PTRACE(3, "H323RTP\tTransmit  end  of talk burst: " << frameTimestamp);
+      }
+      packetEnded = frameOffset > 0;
+      continue;
+    }
+
+    frameCount += (length + clockMaxFrameSize - 1)/clockMaxFrameSize;
+    if (packetEnded)
+      continue;
+
+    silenceStartTick = PTimer::Tick().GetMilliSeconds();
+
+    // If switching from silence to signal
+    if (clockSilent) {
+      clockSilent = FALSE;
+      clockFrame.SetMarker(TRUE);
+      PTRACE(3, "H323RTP\tTransmit start of talk burst: " << frameTimestamp);
+    }
+
+    if (frameOffset == 0)
+      clockFrame.SetTimestamp(frameTimestamp);
+    frameOffset += length;
+
+    // A G.729 SID frame must be the last in the packet
+    if (rtpPayloadType == RTP_DataFrame::G729 && length == 2)
+      packetEnded = TRUE;
+  }
+
+  if (ok) {
+    if (frameOffset == 0)
+      clockFrame.SetTimestamp(clockTimestamp);
+    clockFrame.SetPayloadSize(frameOffset);
+    clockFrame.SetPayloadType(rtpPayloadType);
+
+    PBoolean sendPacket = frameOffset > 0;
+
+    filterMutex.Wait();
+    for (PINDEX i = 0; i < filters.GetSize(); i++)
+      filters[i](clockFrame, (H323_INT)&sendPacket);
+    filterMutex.Signal();
+
+    if (sendPacket || (clockSilent && clockFrame.GetPayloadSize() > 0)) {
+      ok = WriteFrame(clockFrame);
+      clockFrame.SetMarker(FALSE);
+    }
+  }
+
+  if (ok)
+    return TRUE;
+
+  if (!terminating && !clockStopping) {
+    PTRACE(2, "H323RTP\tTransmit " << codec->GetMediaFormat() << " clock stopped");
+    failed = TRUE;
+  }
+
+  return FALSE;
+}
+#endif
+
+
 void H323_RTPChannel::SendUniChannelBackProbe()
 {
   // When we are receiving media on a unidirectional Channel
@@ -1087,10 +1315,22 @@ void H323_RTPChannel::Receive()
   PTRACE(2, "H323RTP\tReceive " << mediaFormat << " thread started.");
 
   // if jitter buffer required, start the thread that is on the other end of it
-  if (mediaFormat.NeedsJitterBuffer() && endpoint.UseJitterBuffer())
+  if (mediaFormat.NeedsJitterBuffer() && endpoint.UseJitterBuffer()) {
+#ifdef H323_AUDIO_CODECS
+    // Poll the transport about once per frame when using the shared scheduler
+    unsigned pollPeriod = mediaFormat.GetFrameTime()/PMAX(mediaFormat.GetTimeUnits(), 1U);
+    pollPeriod = PMAX(5U, PMIN(pollPeriod, 20U));
+    rtpSession.SetJitterBufferSize(connection.GetMinAudioJitterDelay()*mediaFormat.GetTimeUnits(),
+                                   connection.GetMaxAudioJitterDelay()*mediaFormat.GetTimeUnits(),
+                                   endpoint.GetJitterThreadStackSize(),
+                                   endpoint.GetJitterScheduler(),
+                                   pollPeriod);
+#else
     rtpSession.SetJitterBufferSize(connection.GetMinAudioJitterDelay()*mediaFormat.GetTimeUnits(),
                                    connection.GetMaxAudioJitterDelay()*mediaFormat.GetTimeUnits(),
                                    endpoint.GetJitterThreadStackSize());
+#endif
+  }
 
   rtpPayloadType = GetRTPPayloadType();
   if (rtpPayloadType == RTP_DataFrame::IllegalPayloadType) {
@@ -1113,6 +1353,9 @@ void H323_RTPChannel::Receive()
   // UniDirectional Channel NAT support
   SendUniChannelBackProbe();
 
+  RTP_MediaStatistics & statistics = rtpSession.GetMediaStatistics();
+  codec->AttachMediaStatistics(&statistics);
+
   RTP_DataFrame frame;
   while (ReadFrame(rtpTimestamp, frame)) {
 
@@ -1179,6 +1422,11 @@ void H323_RTPChannel::Receive()
           ptr += rec_written;
         }
         PTRACE_IF(1, payloadSize < 0, "H323RTP\tPayload size too small, short " << -payloadSize << " bytes.");
+
+        // Time from the frame leaving the socket to the codec consuming it
+        PInt64 readTime = rtpSession.GetLastReadTime();
+        if (readTime != 0)
+          statistics[RTP_MediaStatistics::ReadToPlayout].Record(RTP_MediaStatistics::GetTime() - readTime);
       }
     }
 
@@ -1221,6 +1469,477 @@ PInt64 H323_RTPChannel::GetSilenceDuration() const
   return PTimer::Tick().GetMilliSeconds() - silenceStartTick;
 }
 
+#ifdef H323_VIDEO
+void H323_RTPChannel::OnFlowControl(long bitRateRestriction)
+{
+  H323_RealTimeChannel::OnFlowControl(bitRateRestriction);
+
+  // H.245 flow control is in units of 100 bits/sec
+  if (!receiver)
+    videoPacer.SetFlowControlLimit(bitRateRestriction > 0 ? (unsigned)bitRateRestriction*100 : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+/* Frame interval assumed until two frames have been timestamped, and the
+   range accepted from the timestamps, in milliseconds. */
+#define VIDEO_PACER_DEFAULT_INTERVAL 33
+#define VIDEO_PACER_MIN_INTERVAL     5
+#define VIDEO_PACER_MAX_INTERVAL     500
+
+/* Default shortest time between key frame requests after dropping frames */
+#define VIDEO_PACER_KEY_FRAME_REQUEST_INTERVAL 1000
+
+H323VideoPacer::H323VideoPacer()
+  : bitRate(0), flowControlLimit(0), keyFrameBurst(0), maxDelay(0),
+    keyFrameRequestInterval(VIDEO_PACER_KEY_FRAME_REQUEST_INTERVAL),
+    frameInterval(VIDEO_PACER_DEFAULT_INTERVAL), lastTimestamp(0), haveTimestamp(FALSE),
+    frameStart(TRUE), frameIsKey(FALSE), dropping(FALSE),
+    frameBits(0), expectedBits(0), keyFrameBits(0), deltaFrameBits(0),
+    frameSpread(0), nextSend(0), keyFrameWanted(FALSE), lastKeyFrameRequest(0),
+    queueDepth(0), packetsPaced(0), totalPacingDelay(0),
+    maximumPacingDelay(0), framesDropped(0)
+{
+}
+
+
+void H323VideoPacer::SetBitRate(unsigned rate)
+{
+  PWaitAndSignal m(mutex);
+  PTRACE_IF(4, rate != bitRate, "H323RTP\tVideo pacing bit rate set to " << rate);
+  bitRate = rate;
+}
+
+
+void H323VideoPacer::SetFlowControlLimit(unsigned rate)
+{
+  PWaitAndSignal m(mutex);
+  PTRACE(4, "H323RTP\tVideo pacing flow control limit set to " << rate);
+  flowControlLimit = rate;
+}
+
+
+unsigned H323VideoPacer::GetBitRate() const
+{
+  if (flowControlLimit > 0 && (bitRate == 0 || flowControlLimit < bitRate))
+    return flowControlLimit;
+  return bitRate;
+}
+
+
+DWORD H323VideoPacer::GetAveragePacingDelay() const
+{
+  return packetsPaced > 0 ? (DWORD)(totalPacingDelay/packetsPaced) : 0;
+}
+
+
+PBoolean H323VideoPacer::TakeKeyFrameRequest()
+{
+  PWaitAndSignal m(mutex);
+
+  if (!keyFrameWanted)
+    return FALSE;
+
+  PInt64 now = PTimer::Tick().GetMilliSeconds();
+  if (lastKeyFrameRequest > 0 && now - lastKeyFrameRequest < keyFrameRequestInterval)
+    return FALSE;
+
+  lastKeyFrameRequest = now;
+  keyFrameWanted = FALSE;
+  return TRUE;
+}
+
+
+PBoolean H323VideoPacer::Pace(PINDEX size, PBoolean marker, PBoolean keyFrame, DWORD timestamp)
+{
+  PInt64 delay = 0;
+
+  {
+    PWaitAndSignal m(mutex);
+
+    PInt64 now = RTP_MediaStatistics::GetTime();
+    PInt64 rate = GetBitRate();
+
+    if (frameStart) {
+      frameStart = FALSE;
+
+      // The gap since the previous frame's timestamp is how long we have
+      if (haveTimestamp) {
+        unsigned interval = (timestamp - lastTimestamp)/90;
+        if (interval >= VIDEO_PACER_MIN_INTERVAL && interval <= VIDEO_PACER_MAX_INTERVAL)
+          frameInterval = interval;
+      }
+      lastTimestamp = timestamp;
+      haveTimestamp = TRUE;
+
+      // Spread the frame over its interval, or longer if that would take it
+      // over the bit rate by more than a key frame's burst budget
+      frameIsKey = keyFrame;
+      expectedBits = keyFrame ? keyFrameBits : deltaFrameBits;
+      frameSpread = (PInt64)frameInterval*1000;
+      if (rate > 0) {
+        PInt64 burstBits = keyFrame ? rate*keyFrameBurst/1000 : 0;
+        if (expectedBits > burstBits)
+          frameSpread = PMAX(frameSpread, (expectedBits - burstBits)*1000000/rate);
+      }
+
+      // Drop frames that would start too far behind the previous one
+      PInt64 backlog = nextSend - now;
+      if (maxDelay > 0 && !keyFrame && backlog > (PInt64)maxDelay*1000) {
+        dropping = TRUE;
+        keyFrameWanted = TRUE;
+        framesDropped++;
+        PTRACE(3, "H323RTP\tVideo pacing " << backlog/1000
+               << "ms behind, dropping frame " << framesDropped);
+      }
+      else if (nextSend < now)
+        nextSend = now;
+
+      frameBits = 0;
+    }
+
+    if (marker)
+      frameStart = TRUE;
+
+    if (dropping) {
+      if (marker)
+        dropping = FALSE;
+      return FALSE;
+    }
+
+    if (keyFrame)
+      keyFrameWanted = FALSE;
+
+    packetsPaced++;
+
+    PInt64 bits = (PInt64)size*8;
+    if (nextSend > now)
+      delay = nextSend - now;
+
+    // This packet's share of the frame interval. Until the size of a frame
+    // of this kind is known it is sent at the bit rate, if there is one.
+    if (expectedBits > 0)
+      nextSend += frameSpread*bits/expectedBits;
+    else if (rate > 0)
+      nextSend += bits*1000000/rate;
+    frameBits += bits;
+
+    if (marker) {
+      PInt64 & estimate = frameIsKey ? keyFrameBits : deltaFrameBits;
+      estimate = estimate > 0 ? (estimate*3 + frameBits)/4 : frameBits;
+    }
+
+    queueDepth = delay > 0 && frameSpread > 0 && expectedBits > 0
+                      ? (DWORD)(delay*expectedBits/frameSpread/8) : 0;
+    totalPacingDelay += delay/1000;
+    if (delay/1000 > maximumPacingDelay)
+      maximumPacingDelay = (DWORD)(delay/1000);
+  }
+
+  if (delay >= 1000)
+    PThread::Sleep((unsigned)(delay/1000));
+
+  return TRUE;
+}
+#endif
+
+
+/////////////////////////////////////////////////////////////////////////////
+
+#ifdef H323_AUDIO_CODECS
+
+class H323MediaClock::Worker : public PThread
+{
+    PCLASSINFO(Worker, PThread);
+  public:
+    Worker(H323MediaClock & c, PINDEX stackSize)
+      : PThread(stackSize, NoAutoDeleteThread, HighestPriority, "Media Clock:%x"),
+        load(0),
+        clock(c),
+        wake(0, INT_MAX)
+    {
+      Resume();
+    }
+
+    void Stop()
+    {
+      wake.Signal();
+      WaitForTermination(3000);
+    }
+
+    void Post(unsigned packetTime)
+    {
+      dueMutex.Wait();
+      due.push_back(packetTime);
+      dueMutex.Signal();
+      wake.Signal();
+    }
+
+    void Add(H323_RTPChannel * channel, unsigned packetTime)
+    {
+      PWaitAndSignal m(mutex);
+      channels[packetTime].push_back(channel);
+    }
+
+    void Remove(H323_RTPChannel * channel, unsigned packetTime)
+    {
+      // Ticks are done with the mutex held, so once we have it the channel
+      // is idle. The entry is only cleared as a tick may be iterating it.
+      PWaitAndSignal m(mutex);
+      ChannelList & list = channels[packetTime];
+      for (size_t i = 0; i < list.size(); i++) {
+        if (list[i] == channel) {
+          list[i] = NULL;
+          return;
+        }
+      }
+    }
+
+    PINDEX load;   // Protected by the clock mutex
+
+  protected:
+    // A channel the tick failed on, kept by call token as the channel and
+    // connection may be gone by the time it is closed.
+    struct FailedChannel {
+      FailedChannel(const H323_RTPChannel & channel)
+        : endpoint(&channel.GetConnection().GetEndPoint()),
+          callToken(channel.GetConnection().GetCallToken()),
+          number(channel.GetNumber())
+      { }
+
+      H323EndPoint    * endpoint;
+      PString           callToken;
+      H323ChannelNumber number;
+    };
+
+    void Main()
+    {
+      std::vector<FailedChannel> failed;
+      for (;;) {
+        wake.Wait();
+        if (clock.shutdown)
+          break;
+
+        unsigned packetTime = 0;
+        dueMutex.Wait();
+        PBoolean idle = due.empty();
+        if (!idle) {
+          packetTime = due.front();
+          due.pop_front();
+          if (!due.empty())
+            ++clock.lateTicks;
+        }
+        dueMutex.Signal();
+        if (idle)
+          continue;
+
+        mutex.Wait();
+
+        ChannelList & list = channels[packetTime];
+        PBoolean compact = FALSE;
+        for (size_t i = 0; i < list.size(); i++) {
+          H323_RTPChannel * channel = list[i];
+          PBoolean channelFailed = FALSE;
+          if (channel == NULL)
+            compact = TRUE;
+          else if (!channel->OnMediaClockTick(channelFailed)) {
+            list[i] = NULL;
+            compact = TRUE;
+            if (channelFailed)
+              failed.push_back(FailedChannel(*channel));
+          }
+        }
+
+        if (compact)
+          list.erase(std::remove(list.begin(), list.end(), (H323_RTPChannel *)NULL), list.end());
+
+        mutex.Signal();
+
+        /* Closing a channel takes the connection mutex and removes it from
+           the clock, so is done after the tick. Another thread holding the
+           connection mutex may be waiting in Remove() for this worker. */
+        for (size_t f = 0; f < failed.size(); f++) {
+          H323ConnectionHandle connection = failed[f].endpoint->FindConnectionHandle(failed[f].callToken);
+          if (!connection.IsNULL())
+            connection->CloseLogicalChannelNumber(failed[f].number);
+        }
+        failed.clear();
+      }
+    }
+
+    typedef std::vector<H323_RTPChannel *> ChannelList;
+    typedef std::map<unsigned, ChannelList> ChannelMap;
+
+    H323MediaClock    & clock;
+    ChannelMap          channels;
+    PMutex              mutex;
+    std::list<unsigned> due;
+    PMutex              dueMutex;
+    PSemaphore          wake;
+};
+
+
+H323MediaClock::H323MediaClock(PINDEX workerCount, PINDEX stackSize)
+  : shutdown(FALSE)
+{
+  if (workerCount < 1)
+    workerCount = 1;
+
+  for (PINDEX i = 0; i < workerCount; i++)
+    workers.push_back(new Worker(*this, stackSize));
+
+  thread = PThread::Create(PCREATE_NOTIFIER(ClockMain), 0,
+                           PThread::NoAutoDeleteThread,
+                           PThread::HighestPriority,
+                           "Media Clock", stackSize);
+}
+
+
+H323MediaClock::~H323MediaClock()
+{
+  shutdown = TRUE;
+  changed.Signal();
+  if (thread != NULL) {
+    thread->WaitForTermination(3000);
+    delete thread;
+  }
+
+  for (size_t i = 0; i < workers.size(); i++) {
+    workers[i]->Stop();
+    delete workers[i];
+  }
+}
+
+
+void H323MediaClock::Add(H323_RTPChannel & channel, unsigned packetTime)
+{
+  if (packetTime == 0)
+    packetTime = 1;
+
+  Worker * worker;
+
+  {
+    PWaitAndSignal m(mutex);
+
+    // Spread the channels evenly over the workers
+    size_t best = 0;
+    for (size_t i = 1; i < workers.size(); i++) {
+      if (workers[i]->load < workers[best]->load)
+        best = i;
+    }
+    worker = workers[best];
+    worker->load++;
+
+    GroupMap::iterator group = groups.find(packetTime);
+    if (group == groups.end()) {
+      group = groups.insert(GroupMap::value_type(packetTime, Group())).first;
+      group->second.nextTick = PTimer::Tick() + PTimeInterval(packetTime);
+      group->second.channels.resize(workers.size(), 0);
+    }
+    group->second.channels[best]++;
+
+    Registration & registration = registrations[&channel];
+    registration.worker = worker;
+    registration.packetTime = packetTime;
+
+    PTRACE(4, "H323RTP\tMedia clock added channel " << &channel
+           << " period=" << packetTime << "ms count=" << registrations.size());
+  }
+
+  worker->Add(&channel, packetTime);
+  changed.Signal();
+}
+
+
+void H323MediaClock::Remove(H323_RTPChannel & channel)
+{
+  Registration registration;
+
+  {
+    PWaitAndSignal m(mutex);
+
+    RegistrationMap::iterator r = registrations.find(&channel);
+    if (r == registrations.end())
+      return;
+
+    registration = r->second;
+    registrations.erase(r);
+    registration.worker->load--;
+
+    GroupMap::iterator group = groups.find(registration.packetTime);
+    if (group != groups.end()) {
+      PINDEX total = 0;
+      for (size_t i = 0; i < workers.size(); i++) {
+        if (workers[i] == registration.worker)
+          group->second.channels[i]--;
+        total += group->second.channels[i];
+      }
+      if (total == 0)
+        groups.erase(group);
+    }
+
+    PTRACE(4, "H323RTP\tMedia clock removed channel " << &channel << " count=" << registrations.size());
+  }
+
+  // Not nested in the clock mutex, a tick may be removing its own channel
+  registration.worker->Remove(&channel, registration.packetTime);
+}
+
+
+PINDEX H323MediaClock::GetChannelCount() const
+{
+  PWaitAndSignal m(mutex);
+  return registrations.size();
+}
+
+
+void H323MediaClock::ClockMain(PThread &, H323_INT)
+{
+  PTRACE(3, "H323RTP\tMedia clock started, workers=" << workers.size());
+
+  while (!shutdown) {
+    PTimeInterval now = PTimer::Tick();
+    PTimeInterval wait = 1000;
+
+    {
+      PWaitAndSignal m(mutex);
+
+      for (GroupMap::iterator group = groups.begin(); group != groups.end(); ++group) {
+        unsigned packetTime = group->first;
+        Group & tick = group->second;
+
+        if (tick.nextTick <= now) {
+          PInt64 late = (now - tick.nextTick).GetMilliSeconds();
+          if (late > (PInt64)packetTime*8) {
+            // Do not try and catch up on a long stall
+            PTRACE(2, "H323RTP\tMedia clock overloaded, " << packetTime << "ms group skipped " << late << "ms");
+            tick.nextTick = now;
+          }
+
+          for (size_t i = 0; i < workers.size(); i++) {
+            if (tick.channels[i] > 0)
+              workers[i]->Post(packetTime);
+          }
+
+          // Deadlines are absolute so the ticks do not drift
+          tick.nextTick += PTimeInterval(packetTime);
+        }
+
+        PTimeInterval delay = tick.nextTick - now;
+        if (delay < wait)
+          wait = delay;
+      }
+    }
+
+    if (wait > 0)
+      changed.Wait(wait);
+  }
+
+  PTRACE(3, "H323RTP\tMedia clock finished");
+}
+
+#endif // H323_AUDIO_CODECS
+
 
 /////////////////////////////////////////////////////////////////////////////
 
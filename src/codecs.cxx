@@ -54,6 +54,22 @@ extern "C" {
 #include "g711.h"
 };
 
+#if defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define H323_G711_SSE2 1
+#if (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)) || defined(__clang__)
+#define H323_G711_AVX2 1
+#endif
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define H323_G711_SSE2 1
+#endif
+
+#ifdef H323_G711_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef H323_G711_AVX2
+#include <immintrin.h>
+#endif
+
 #define new PNEW
 
 /////////////////////////////////////////////////////////////////////////////
@@ -67,6 +83,7 @@ H323Codec::H323Codec(const OpalMediaFormat & fmt, Direction dir)
   lastSequenceNumber = 1;
   rawDataChannel = NULL;
   deleteChannel  = FALSE;
+  mediaStatistics = NULL;
 
   rtpInformation.m_sessionID=0;
   rtpInformation.m_sendTime=0;
@@ -512,6 +529,7 @@ H323AudioCodec::H323AudioCodec(const OpalMediaFormat & fmt, Direction dir)
   inTalkBurst = FALSE;
 
   IsRawDataHeld = FALSE;
+  mediaClocked = FALSE;
 
   // Initialise the adaptive threshold variables.
   SetSilenceDetectionMode(AdaptiveSilenceDetection);
@@ -754,7 +772,8 @@ PBoolean H323FramedAudioCodec::Read(BYTE * buffer, unsigned & length, RTP_DataFr
   }
 
   if (IsRawDataHeld) {	 // If connection is onHold
-    PThread::Sleep(5);  // Sleep to avoid CPU overload. <--Should be a better method but it works :)
+    if (!mediaClocked)  // The media clock already paces the reads
+      PThread::Sleep(5);  // Sleep to avoid CPU overload. <--Should be a better method but it works :)
     length = 0;
     return TRUE;
   }
@@ -793,7 +812,14 @@ PBoolean H323FramedAudioCodec::Read(BYTE * buffer, unsigned & length, RTP_DataFr
 
   // Default length is the frame size
   length = bytesPerFrame;
-  return EncodeFrame(buffer, length);
+
+  if (mediaStatistics == NULL)
+    return EncodeFrame(buffer, length);
+
+  PInt64 start = RTP_MediaStatistics::GetTime();
+  PBoolean ok = EncodeFrame(buffer, length);
+  (*mediaStatistics)[RTP_MediaStatistics::EncodeTime].Record(RTP_MediaStatistics::GetTime() - start);
+  return ok;
 }
 
 WORD lastSequence=0;
@@ -839,10 +865,13 @@ PBoolean H323FramedAudioCodec::Write(const BYTE * buffer,
     written = bytesPerFrame;
 
     // Decode the data
+    PInt64 start = mediaStatistics != NULL ? RTP_MediaStatistics::GetTime() : 0;
     if (!DecodeFrame(buffer, length, written, writeBytes)) {
       written = length;
       length = 0;
     }
+    if (mediaStatistics != NULL)
+      (*mediaStatistics)[RTP_MediaStatistics::DecodeTime].Record(RTP_MediaStatistics::GetTime() - start);
   }
 
   if (length == 0)
@@ -1201,6 +1230,327 @@ PBoolean H323StreamedAudioCodec::DecodeFrame(const BYTE * buffer,
 }
 
 
+/////////////////////////////////////////////////////////////////////////////
+// Batch G.711 conversion
+
+/* The encoders only depend on the sample shifted right by 3 (A-Law) or 2
+   (u-Law), so the scalar path is a lookup in an 8K or 16K entry table, and
+   the decoders are a lookup in a 256 entry table. All tables are filled
+   from the reference functions in g711.h so the results are bit exact. */
+static BYTE  G711ALawEncodeTable[8192];
+static BYTE  G711uLawEncodeTable[16384];
+static short G711ALawDecodeTable[256];
+static short G711uLawDecodeTable[256];
+
+enum G711Kernel {
+  G711ScalarKernel,
+  G711SSE2Kernel,
+  G711AVX2Kernel
+};
+
+static G711Kernel G711SelectKernel()
+{
+  int i;
+  for (i = 0; i < 8192; i++)
+    G711ALawEncodeTable[i] = (BYTE)linear2alaw((short)(i << 3));
+  for (i = 0; i < 16384; i++)
+    G711uLawEncodeTable[i] = (BYTE)linear2ulaw((short)(i << 2));
+  for (i = 0; i < 256; i++) {
+    G711ALawDecodeTable[i] = (short)alaw2linear((unsigned char)i);
+    G711uLawDecodeTable[i] = (short)ulaw2linear((unsigned char)i);
+  }
+
+#if defined(H323_G711_AVX2)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return G711AVX2Kernel;
+#endif
+#if defined(H323_G711_SSE2)
+  return G711SSE2Kernel;
+#else
+  return G711ScalarKernel;
+#endif
+}
+
+static G711Kernel GetG711Kernel()
+{
+  // Fills the tables on first use, so is safe from other static initialisers
+  static const G711Kernel kernel = G711SelectKernel();
+  return kernel;
+}
+
+
+static inline BYTE G711ALawEncodeScalar(short sample)
+{
+  // Index by the top 13 bits, as linear2alaw() shifts right by 3
+  return G711ALawEncodeTable[((unsigned short)sample) >> 3];
+}
+
+
+static inline BYTE G711uLawEncodeScalar(short sample)
+{
+  return G711uLawEncodeTable[((unsigned short)sample) >> 2];
+}
+
+
+#ifdef H323_G711_SSE2
+
+/* Eight samples at a time. The segment is the count of segment end points
+   the magnitude exceeds. SSE2 has no per lane variable shift, so the right
+   shift of the magnitude by the segment is a high multiply by a power of
+   two that starts at 0x8000 (shift by one) and is halved, by subtracting
+   the step, for each end point exceeded. A-Law segments 0 and 1 both shift
+   by one so its first step is zero. */
+static inline void G711SegmentStep(__m128i magnitude, short end, short step, __m128i & segment, __m128i & multiplier)
+{
+  __m128i above = _mm_cmpgt_epi16(magnitude, _mm_set1_epi16(end));
+  segment = _mm_sub_epi16(segment, above);
+  multiplier = _mm_sub_epi16(multiplier, _mm_and_si128(above, _mm_set1_epi16(step)));
+}
+
+
+static inline __m128i G711ALawEncode8(__m128i samples)
+{
+  __m128i value = _mm_srai_epi16(samples, 3);
+  __m128i sign = _mm_srai_epi16(value, 15);
+  __m128i magnitude = _mm_xor_si128(value, sign);         // -v-1 for negative
+
+  __m128i segment = _mm_setzero_si128();
+  __m128i multiplier = _mm_set1_epi16((short)0x8000);
+  G711SegmentStep(magnitude, 0x1F,  0,      segment, multiplier);
+  G711SegmentStep(magnitude, 0x3F,  0x4000, segment, multiplier);
+  G711SegmentStep(magnitude, 0x7F,  0x2000, segment, multiplier);
+  G711SegmentStep(magnitude, 0xFF,  0x1000, segment, multiplier);
+  G711SegmentStep(magnitude, 0x1FF, 0x800,  segment, multiplier);
+  G711SegmentStep(magnitude, 0x3FF, 0x400,  segment, multiplier);
+  G711SegmentStep(magnitude, 0x7FF, 0x200,  segment, multiplier);
+  G711SegmentStep(magnitude, 0xFFF, 0x100,  segment, multiplier);
+
+  __m128i quant = _mm_and_si128(_mm_mulhi_epu16(magnitude, multiplier), _mm_set1_epi16(0x0F));
+  __m128i aval = _mm_or_si128(_mm_slli_epi16(segment, 4), quant);
+  __m128i mask = _mm_or_si128(_mm_set1_epi16(0x55), _mm_andnot_si128(sign, _mm_set1_epi16(0x80)));
+  return _mm_xor_si128(aval, mask);
+}
+
+
+static inline __m128i G711uLawEncode8(__m128i samples)
+{
+  __m128i value = _mm_srai_epi16(samples, 2);
+  __m128i sign = _mm_srai_epi16(value, 15);
+  __m128i magnitude = _mm_sub_epi16(_mm_xor_si128(value, sign), sign);
+  magnitude = _mm_add_epi16(_mm_min_epi16(magnitude, _mm_set1_epi16(8159)), _mm_set1_epi16(0x21));
+
+  __m128i segment = _mm_setzero_si128();
+  __m128i multiplier = _mm_set1_epi16((short)0x8000);
+  G711SegmentStep(magnitude, 0x3F,  0x4000, segment, multiplier);
+  G711SegmentStep(magnitude, 0x7F,  0x2000, segment, multiplier);
+  G711SegmentStep(magnitude, 0xFF,  0x1000, segment, multiplier);
+  G711SegmentStep(magnitude, 0x1FF, 0x800,  segment, multiplier);
+  G711SegmentStep(magnitude, 0x3FF, 0x400,  segment, multiplier);
+  G711SegmentStep(magnitude, 0x7FF, 0x200,  segment, multiplier);
+  G711SegmentStep(magnitude, 0xFFF, 0x100,  segment, multiplier);
+
+  __m128i quant = _mm_and_si128(_mm_mulhi_epu16(magnitude, multiplier), _mm_set1_epi16(0x0F));
+  __m128i uval = _mm_or_si128(_mm_slli_epi16(segment, 4), quant);
+
+  // Beyond the last segment, ie the clipped maximum, is 0x7F
+  __m128i over = _mm_cmpgt_epi16(magnitude, _mm_set1_epi16(0x1FFF));
+  uval = _mm_or_si128(_mm_and_si128(over, _mm_set1_epi16(0x7F)), _mm_andnot_si128(over, uval));
+
+  __m128i mask = _mm_xor_si128(_mm_set1_epi16(0xFF), _mm_and_si128(sign, _mm_set1_epi16(0x80)));
+  return _mm_xor_si128(uval, mask);
+}
+
+
+static unsigned G711ALawEncodeSSE2(const short * samples, BYTE * encoded, unsigned count)
+{
+  unsigned i;
+  for (i = 0; i+16 <= count; i += 16) {
+    __m128i lo = G711ALawEncode8(_mm_loadu_si128((const __m128i *)(samples+i)));
+    __m128i hi = G711ALawEncode8(_mm_loadu_si128((const __m128i *)(samples+i+8)));
+    _mm_storeu_si128((__m128i *)(encoded+i), _mm_packus_epi16(lo, hi));
+  }
+  return i;
+}
+
+
+static unsigned G711uLawEncodeSSE2(const short * samples, BYTE * encoded, unsigned count)
+{
+  unsigned i;
+  for (i = 0; i+16 <= count; i += 16) {
+    __m128i lo = G711uLawEncode8(_mm_loadu_si128((const __m128i *)(samples+i)));
+    __m128i hi = G711uLawEncode8(_mm_loadu_si128((const __m128i *)(samples+i+8)));
+    _mm_storeu_si128((__m128i *)(encoded+i), _mm_packus_epi16(lo, hi));
+  }
+  return i;
+}
+
+#endif // H323_G711_SSE2
+
+
+#ifdef H323_G711_AVX2
+
+// Same algorithms as the SSE2 kernels, sixteen samples at a time
+
+__attribute__((target("avx2")))
+static inline void G711SegmentStep(__m256i magnitude, short end, short step, __m256i & segment, __m256i & multiplier)
+{
+  __m256i above = _mm256_cmpgt_epi16(magnitude, _mm256_set1_epi16(end));
+  segment = _mm256_sub_epi16(segment, above);
+  multiplier = _mm256_sub_epi16(multiplier, _mm256_and_si256(above, _mm256_set1_epi16(step)));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i G711ALawEncode16(__m256i samples)
+{
+  __m256i value = _mm256_srai_epi16(samples, 3);
+  __m256i sign = _mm256_srai_epi16(value, 15);
+  __m256i magnitude = _mm256_xor_si256(value, sign);
+
+  __m256i segment = _mm256_setzero_si256();
+  __m256i multiplier = _mm256_set1_epi16((short)0x8000);
+  G711SegmentStep(magnitude, 0x1F,  0,      segment, multiplier);
+  G711SegmentStep(magnitude, 0x3F,  0x4000, segment, multiplier);
+  G711SegmentStep(magnitude, 0x7F,  0x2000, segment, multiplier);
+  G711SegmentStep(magnitude, 0xFF,  0x1000, segment, multiplier);
+  G711SegmentStep(magnitude, 0x1FF, 0x800,  segment, multiplier);
+  G711SegmentStep(magnitude, 0x3FF, 0x400,  segment, multiplier);
+  G711SegmentStep(magnitude, 0x7FF, 0x200,  segment, multiplier);
+  G711SegmentStep(magnitude, 0xFFF, 0x100,  segment, multiplier);
+
+  __m256i quant = _mm256_and_si256(_mm256_mulhi_epu16(magnitude, multiplier), _mm256_set1_epi16(0x0F));
+  __m256i aval = _mm256_or_si256(_mm256_slli_epi16(segment, 4), quant);
+  __m256i mask = _mm256_or_si256(_mm256_set1_epi16(0x55), _mm256_andnot_si256(sign, _mm256_set1_epi16(0x80)));
+  return _mm256_xor_si256(aval, mask);
+}
+
+
+__attribute__((target("avx2")))
+static inline __m256i G711uLawEncode16(__m256i samples)
+{
+  __m256i value = _mm256_srai_epi16(samples, 2);
+  __m256i sign = _mm256_srai_epi16(value, 15);
+  __m256i magnitude = _mm256_sub_epi16(_mm256_xor_si256(value, sign), sign);
+  magnitude = _mm256_add_epi16(_mm256_min_epi16(magnitude, _mm256_set1_epi16(8159)), _mm256_set1_epi16(0x21));
+
+  __m256i segment = _mm256_setzero_si256();
+  __m256i multiplier = _mm256_set1_epi16((short)0x8000);
+  G711SegmentStep(magnitude, 0x3F,  0x4000, segment, multiplier);
+  G711SegmentStep(magnitude, 0x7F,  0x2000, segment, multiplier);
+  G711SegmentStep(magnitude, 0xFF,  0x1000, segment, multiplier);
+  G711SegmentStep(magnitude, 0x1FF, 0x800,  segment, multiplier);
+  G711SegmentStep(magnitude, 0x3FF, 0x400,  segment, multiplier);
+  G711SegmentStep(magnitude, 0x7FF, 0x200,  segment, multiplier);
+  G711SegmentStep(magnitude, 0xFFF, 0x100,  segment, multiplier);
+
+  __m256i quant = _mm256_and_si256(_mm256_mulhi_epu16(magnitude, multiplier), _mm256_set1_epi16(0x0F));
+  __m256i uval = _mm256_or_si256(_mm256_slli_epi16(segment, 4), quant);
+
+  __m256i over = _mm256_cmpgt_epi16(magnitude, _mm256_set1_epi16(0x1FFF));
+  uval = _mm256_blendv_epi8(uval, _mm256_set1_epi16(0x7F), over);
+
+  __m256i mask = _mm256_xor_si256(_mm256_set1_epi16(0xFF), _mm256_and_si256(sign, _mm256_set1_epi16(0x80)));
+  return _mm256_xor_si256(uval, mask);
+}
+
+
+__attribute__((target("avx2")))
+static unsigned G711ALawEncodeAVX2(const short * samples, BYTE * encoded, unsigned count)
+{
+  unsigned i;
+  for (i = 0; i+32 <= count; i += 32) {
+    __m256i lo = G711ALawEncode16(_mm256_loadu_si256((const __m256i *)(samples+i)));
+    __m256i hi = G711ALawEncode16(_mm256_loadu_si256((const __m256i *)(samples+i+16)));
+    // Pack works within 128 bit lanes, put the quadwords back in order
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8);
+    _mm256_storeu_si256((__m256i *)(encoded+i), packed);
+  }
+  return i;
+}
+
+
+__attribute__((target("avx2")))
+static unsigned G711uLawEncodeAVX2(const short * samples, BYTE * encoded, unsigned count)
+{
+  unsigned i;
+  for (i = 0; i+32 <= count; i += 32) {
+    __m256i lo = G711uLawEncode16(_mm256_loadu_si256((const __m256i *)(samples+i)));
+    __m256i hi = G711uLawEncode16(_mm256_loadu_si256((const __m256i *)(samples+i+16)));
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8);
+    _mm256_storeu_si256((__m256i *)(encoded+i), packed);
+  }
+  return i;
+}
+
+#endif // H323_G711_AVX2
+
+
+void H323G711ALawEncode(const short * samples, BYTE * encoded, unsigned count)
+{
+  unsigned done = 0;
+
+  switch (GetG711Kernel()) {
+#ifdef H323_G711_AVX2
+    case G711AVX2Kernel :
+      done = G711ALawEncodeAVX2(samples, encoded, count);
+      break;
+#endif
+#ifdef H323_G711_SSE2
+    case G711SSE2Kernel :
+      done = G711ALawEncodeSSE2(samples, encoded, count);
+      break;
+#endif
+    default :
+      break;
+  }
+
+  for (unsigned i = done; i < count; i++)
+    encoded[i] = G711ALawEncodeScalar(samples[i]);
+}
+
+
+void H323G711uLawEncode(const short * samples, BYTE * encoded, unsigned count)
+{
+  unsigned done = 0;
+
+  switch (GetG711Kernel()) {
+#ifdef H323_G711_AVX2
+    case G711AVX2Kernel :
+      done = G711uLawEncodeAVX2(samples, encoded, count);
+      break;
+#endif
+#ifdef H323_G711_SSE2
+    case G711SSE2Kernel :
+      done = G711uLawEncodeSSE2(samples, encoded, count);
+      break;
+#endif
+    default :
+      break;
+  }
+
+  for (unsigned i = done; i < count; i++)
+    encoded[i] = G711uLawEncodeScalar(samples[i]);
+}
+
+
+void H323G711ALawDecode(const BYTE * encoded, short * samples, unsigned count)
+{
+  GetG711Kernel();
+  for (unsigned i = 0; i < count; i++)
+    samples[i] = G711ALawDecodeTable[encoded[i]];
+}
+
+
+void H323G711uLawDecode(const BYTE * encoded, short * samples, unsigned count)
+{
+  GetG711Kernel();
+  for (unsigned i = 0; i < count; i++)
+    samples[i] = G711uLawDecodeTable[encoded[i]];
+}
+
+
+
+
 /////////////////////////////////////////////////////////////////////////////
 
 H323_ALawCodec::H323_ALawCodec(Direction dir,
@@ -1229,6 +1579,25 @@ short H323_ALawCodec::DecodeSample(int sample)
 }
 
 
+PBoolean H323_ALawCodec::EncodeFrame(BYTE * buffer, unsigned &)
+{
+  H323G711ALawEncode(sampleBuffer, buffer, samplesPerFrame);
+  return TRUE;
+}
+
+
+PBoolean H323_ALawCodec::DecodeFrame(const BYTE * buffer,
+                                     unsigned length,
+                                     unsigned & written,
+                                     unsigned & decodedBytes)
+{
+  H323G711ALawDecode(buffer, sampleBuffer.GetPointer(PMAX(samplesPerFrame, length)), length);
+  written = length;
+  decodedBytes = length*2;
+  return TRUE;
+}
+
+
 /////////////////////////////////////////////////////////////////////////////
 
 H323_muLawCodec::H323_muLawCodec(Direction dir,
@@ -1256,6 +1625,25 @@ short H323_muLawCodec::DecodeSample(int sample)
 }
 
 
+PBoolean H323_muLawCodec::EncodeFrame(BYTE * buffer, unsigned &)
+{
+  H323G711uLawEncode(sampleBuffer, buffer, samplesPerFrame);
+  return TRUE;
+}
+
+
+PBoolean H323_muLawCodec::DecodeFrame(const BYTE * buffer,
+                                      unsigned length,
+                                      unsigned & written,
+                                      unsigned & decodedBytes)
+{
+  H323G711uLawDecode(buffer, sampleBuffer.GetPointer(PMAX(samplesPerFrame, length)), length);
+  written = length;
+  decodedBytes = length*2;
+  return TRUE;
+}
+
+
 /////////////////////////////////////////////////////////////////////////////
 
 #endif // NO_H323_AUDIO_CODECS
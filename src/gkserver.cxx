@@ -1215,6 +1215,8 @@ H323GatekeeperRequest::Response H323GatekeeperCall::OnInfoResponse(H323Gatekeepe
 
   UnlockReadWrite();
 
+  gatekeeper.ScheduleHeartbeat(*this);
+
   return H323GatekeeperRequest::Confirm;
 }
 
@@ -1240,6 +1242,22 @@ static PBoolean CheckTimeSince(PTime & lastTime, unsigned threshold)
 }
 
 
+// Time at which CheckTimeSince() will first fail for the threshold
+static PTime GetAgingDeadline(const PTime & lastTime, unsigned threshold)
+{
+  return lastTime + PTimeInterval(0, threshold+10);
+}
+
+
+// Key for the call on the aging wheel, same form as accepted by FindCall()
+static PString GetCallAgingKey(const H323GatekeeperCall & call)
+{
+  PStringStream key;
+  key << call;
+  return key;
+}
+
+
 PBoolean H323GatekeeperCall::OnHeartbeat()
 {
   if (!LockReadOnly()) {
@@ -1281,6 +1299,23 @@ PBoolean H323GatekeeperCall::OnHeartbeat()
   return response;
 }
 
+
+PTime H323GatekeeperCall::GetHeartbeatDeadline() const
+{
+  if (!LockReadOnly()) {
+    PTRACE(1, "RAS\tGetHeartbeatDeadline lock failed on call " << *this);
+    return PTime(0);
+  }
+
+  PTime deadline(0);
+  if (infoResponseRate > 0)
+    deadline = GetAgingDeadline(lastInfoResponse, infoResponseRate);
+
+  UnlockReadOnly();
+
+  return deadline;
+}
+
 #ifdef H323_H248
 
 PString H323GatekeeperCall::GetCallCreditAmount() const
@@ -1627,9 +1662,11 @@ H323GatekeeperRequest::Response H323RegisteredEndPoint::OnRegistration(H323Gatek
 
   UnlockReadWrite();
 
-  if (info.rrq.m_keepAlive)
+  if (info.rrq.m_keepAlive) {
+    gatekeeper.ScheduleTimeToLive(*this);
     return info.CheckCryptoTokens() ? H323GatekeeperRequest::Confirm
                                     : H323GatekeeperRequest::Reject;
+  }
 
   if (info.rrq.HasOptionalField(H225_RegistrationRequest::e_endpointIdentifier)) {
     // Make sure addresses are a superset of previous registration
@@ -1899,6 +1936,8 @@ H323GatekeeperRequest::Response H323RegisteredEndPoint::OnInfoResponse(H323Gatek
   lastInfoResponse = PTime();
   UnlockReadWrite();
 
+  gatekeeper.ScheduleTimeToLive(*this);
+
   if (info.irr.HasOptionalField(H225_InfoRequestResponse::e_irrStatus) &&
       info.irr.m_irrStatus.GetTag() == H225_InfoRequestResponseStatus::e_invalidCall) {
     PTRACE(2, "RAS\tIRR for call-id endpoint does not know about");
@@ -2009,6 +2048,25 @@ PBoolean H323RegisteredEndPoint::OnTimeToLive()
   return response;
 }
 
+
+PTime H323RegisteredEndPoint::GetTimeToLiveDeadline() const
+{
+  if (!LockReadOnly()) {
+    PTRACE(1, "RAS\tGetTimeToLiveDeadline lock failed on endpoint " << *this);
+    return PTime(0);
+  }
+
+  PTime deadline(0);
+  if (timeToLive > 0)
+    deadline = GetAgingDeadline(lastRegistration > lastInfoResponse ? lastRegistration
+                                                                     : lastInfoResponse,
+                                timeToLive);
+
+  UnlockReadOnly();
+
+  return deadline;
+}
+
 #ifdef H323_H248
 
 PString H323RegisteredEndPoint::GetCallCreditAmount() const
@@ -2633,6 +2691,601 @@ void H323GatekeeperListener::OnReceiveFeatureSet(unsigned pduType, const H225_Fe
   gatekeeper.OnReceiveFeatureSet(pduType, set);
 }
 
+/////////////////////////////////////////////////////////////////////////////
+
+H323RegistrationIndex::HashTable::HashTable()
+  : buckets(64, (Entry *)NULL),
+    count(0)
+{
+}
+
+
+H323RegistrationIndex::HashTable::~HashTable()
+{
+  for (size_t i = 0; i < buckets.size(); i++) {
+    Entry * entry = buckets[i];
+    while (entry != NULL) {
+      Entry * next = entry->next;
+      delete entry;
+      entry = next;
+    }
+  }
+}
+
+
+unsigned H323RegistrationIndex::HashTable::Hash(const PString & key)
+{
+  // FNV-1a
+  unsigned hash = 2166136261U;
+  for (const char * ptr = key; *ptr != '\0'; ptr++) {
+    hash ^= (BYTE)*ptr;
+    hash *= 16777619U;
+  }
+  return hash;
+}
+
+
+void H323RegistrationIndex::HashTable::Grow()
+{
+  std::vector<Entry *> old(buckets.size()*2, (Entry *)NULL);
+  old.swap(buckets);
+
+  // Walk each old chain in order so same key entries keep insertion order
+  for (size_t i = 0; i < old.size(); i++) {
+    Entry * entry = old[i];
+    while (entry != NULL) {
+      Entry * next = entry->next;
+      Entry ** link = &buckets[entry->hash & (buckets.size()-1)];
+      while (*link != NULL)
+        link = &(*link)->next;
+      entry->next = NULL;
+      *link = entry;
+      entry = next;
+    }
+  }
+}
+
+
+PBoolean H323RegistrationIndex::HashTable::Add(const PString & key, const PString & identifier)
+{
+  unsigned hash = Hash(key);
+  Entry ** link = &buckets[hash & (buckets.size()-1)];
+  while (*link != NULL) {
+    if ((*link)->hash == hash && (*link)->key == key && (*link)->identifier == identifier)
+      return FALSE;
+    link = &(*link)->next;
+  }
+
+  Entry * entry = new Entry;
+  entry->key = key;
+  entry->identifier = identifier;
+  entry->hash = hash;
+  entry->next = NULL;
+  *link = entry;
+
+  if ((size_t)++count > buckets.size())
+    Grow();
+  return TRUE;
+}
+
+
+PBoolean H323RegistrationIndex::HashTable::Remove(const PString & key, const PString & identifier)
+{
+  unsigned hash = Hash(key);
+  Entry ** link = &buckets[hash & (buckets.size()-1)];
+  while (*link != NULL) {
+    Entry * entry = *link;
+    if (entry->hash == hash && entry->key == key && entry->identifier == identifier) {
+      *link = entry->next;
+      delete entry;
+      count--;
+      return TRUE;
+    }
+    link = &entry->next;
+  }
+  return FALSE;
+}
+
+
+PString H323RegistrationIndex::HashTable::Find(const PString & key) const
+{
+  unsigned hash = Hash(key);
+  for (Entry * entry = buckets[hash & (buckets.size()-1)]; entry != NULL; entry = entry->next) {
+    if (entry->hash == hash && entry->key == key)
+      return entry->identifier;
+  }
+  return PString::Empty();
+}
+
+
+H323RegistrationIndex::PrefixNode::PrefixNode(PrefixNode * p, int s)
+  : parent(p),
+    slot(s),
+    childCount(0)
+{
+  for (PINDEX i = 0; i < PrefixFanout; i++)
+    children[i] = NULL;
+}
+
+
+H323RegistrationIndex::PrefixNode::~PrefixNode()
+{
+  for (PINDEX i = 0; i < PrefixFanout; i++)
+    delete children[i];
+}
+
+
+H323RegistrationIndex::H323RegistrationIndex()
+  : prefixes(NULL, -1),
+    prefixCount(0)
+{
+}
+
+
+H323RegistrationIndex::~H323RegistrationIndex()
+{
+}
+
+
+int H323RegistrationIndex::GetPrefixSlot(char digit)
+{
+  if (digit >= '0' && digit <= '9')
+    return digit - '0';
+  if (digit == '*')
+    return 10;
+  if (digit == '#')
+    return 11;
+  return -1;
+}
+
+
+static PBoolean AddUniqueString(std::vector<PString> & list, const PString & identifier)
+{
+  for (size_t i = 0; i < list.size(); i++) {
+    if (list[i] == identifier)
+      return FALSE;
+  }
+  list.push_back(identifier);
+  return TRUE;
+}
+
+
+static PBoolean RemoveString(std::vector<PString> & list, const PString & identifier)
+{
+  for (std::vector<PString>::iterator it = list.begin(); it != list.end(); ++it) {
+    if (*it == identifier) {
+      list.erase(it);
+      return TRUE;
+    }
+  }
+  return FALSE;
+}
+
+
+PBoolean H323RegistrationIndex::AddPrefix(const PString & prefix, const PString & identifier)
+{
+  PINDEX len = prefix.GetLength();
+  PINDEX i;
+  for (i = 0; i < len; i++) {
+    if (GetPrefixSlot(prefix[i]) < 0)
+      return AddUniqueString(otherPrefixes[prefix], identifier);
+  }
+
+  PrefixNode * node = &prefixes;
+  for (i = 0; i < len; i++) {
+    int slot = GetPrefixSlot(prefix[i]);
+    if (node->children[slot] == NULL) {
+      node->children[slot] = new PrefixNode(node, slot);
+      node->childCount++;
+    }
+    node = node->children[slot];
+  }
+
+  return AddUniqueString(node->identifiers, identifier);
+}
+
+
+PBoolean H323RegistrationIndex::RemovePrefix(const PString & prefix, const PString & identifier)
+{
+  PINDEX len = prefix.GetLength();
+  PINDEX i;
+  for (i = 0; i < len; i++) {
+    if (GetPrefixSlot(prefix[i]) < 0) {
+      std::map<PString, StringVector>::iterator it = otherPrefixes.find(prefix);
+      if (it == otherPrefixes.end() || !RemoveString(it->second, identifier))
+        return FALSE;
+      if (it->second.empty())
+        otherPrefixes.erase(it);
+      return TRUE;
+    }
+  }
+
+  PrefixNode * node = &prefixes;
+  for (i = 0; i < len && node != NULL; i++)
+    node = node->children[GetPrefixSlot(prefix[i])];
+
+  if (node == NULL || !RemoveString(node->identifiers, identifier))
+    return FALSE;
+
+  // Prune the branch back to the last node still in use
+  while (node->parent != NULL && node->identifiers.empty() && node->childCount == 0) {
+    PrefixNode * parent = node->parent;
+    parent->children[node->slot] = NULL;
+    parent->childCount--;
+    delete node;
+    node = parent;
+  }
+
+  return TRUE;
+}
+
+
+void H323RegistrationIndex::Add(Kinds kind, const PString & key, const PString & identifier)
+{
+  PWriteWaitAndSignal lock(mutex);
+
+  PBoolean added;
+  switch (kind) {
+    case SignalAddress :
+      added = addresses.Add(key, identifier);
+      break;
+
+    case Alias :
+      added = aliases.Add(key, identifier);
+      if (added)
+        sortedAliases.insert(std::pair<PString, PString>(key, identifier));
+      break;
+
+    case VoicePrefix :
+      added = AddPrefix(key, identifier);
+      if (added)
+        prefixCount++;
+      break;
+
+    default :
+      return;
+  }
+
+  if (added)
+    keysByIdentifier[kind][identifier].push_back(key);
+}
+
+
+PBoolean H323RegistrationIndex::Remove(Kinds kind, const PString & key, const PString & identifier)
+{
+  PWriteWaitAndSignal lock(mutex);
+  return InternalRemove(kind, key, identifier);
+}
+
+
+PBoolean H323RegistrationIndex::InternalRemove(Kinds kind, const PString & key, const PString & identifier)
+{
+  PBoolean removed;
+  switch (kind) {
+    case SignalAddress :
+      removed = addresses.Remove(key, identifier);
+      break;
+
+    case Alias :
+      removed = aliases.Remove(key, identifier);
+      if (removed) {
+        std::multimap<PString, PString>::iterator it = sortedAliases.lower_bound(key);
+        while (it != sortedAliases.end() && it->first == key) {
+          if (it->second == identifier) {
+            sortedAliases.erase(it);
+            break;
+          }
+          ++it;
+        }
+      }
+      break;
+
+    case VoicePrefix :
+      removed = RemovePrefix(key, identifier);
+      if (removed)
+        prefixCount--;
+      break;
+
+    default :
+      return FALSE;
+  }
+
+  if (removed) {
+    std::map<PString, StringVector>::iterator it = keysByIdentifier[kind].find(identifier);
+    if (it != keysByIdentifier[kind].end()) {
+      RemoveString(it->second, key);
+      if (it->second.empty())
+        keysByIdentifier[kind].erase(it);
+    }
+  }
+
+  return removed;
+}
+
+
+void H323RegistrationIndex::RemoveAll(const PString & identifier)
+{
+  PWriteWaitAndSignal lock(mutex);
+
+  for (int kind = 0; kind < NumKinds; kind++) {
+    std::map<PString, StringVector>::iterator it = keysByIdentifier[kind].find(identifier);
+    if (it == keysByIdentifier[kind].end())
+      continue;
+
+    // Copy as InternalRemove() erases the entry once the last key goes
+    StringVector keys = it->second;
+    for (size_t i = 0; i < keys.size(); i++)
+      InternalRemove((Kinds)kind, keys[i], identifier);
+  }
+}
+
+
+PString H323RegistrationIndex::Find(Kinds kind, const PString & key) const
+{
+  PReadWaitAndSignal lock(mutex);
+
+  switch (kind) {
+    case SignalAddress :
+      return addresses.Find(key);
+
+    case Alias :
+      return aliases.Find(key);
+
+    case VoicePrefix :
+    {
+      PrefixNode * node = (PrefixNode *)&prefixes;
+      for (PINDEX i = 0; i < key.GetLength() && node != NULL; i++) {
+        int slot = GetPrefixSlot(key[i]);
+        node = slot < 0 ? NULL : node->children[slot];
+      }
+      if (node != NULL && !node->identifiers.empty())
+        return node->identifiers[0];
+
+      std::map<PString, StringVector>::const_iterator it = otherPrefixes.find(key);
+      if (it != otherPrefixes.end())
+        return it->second[0];
+      break;
+    }
+
+    default :
+      break;
+  }
+
+  return PString::Empty();
+}
+
+
+PString H323RegistrationIndex::FindPartialAlias(const PString & partial, PString & alias) const
+{
+  PReadWaitAndSignal lock(mutex);
+
+  std::multimap<PString, PString>::const_iterator it = sortedAliases.lower_bound(partial);
+  if (it == sortedAliases.end() || it->first.NumCompare(partial) != EqualTo)
+    return PString::Empty();
+
+  alias = it->first;
+  return it->second;
+}
+
+
+PString H323RegistrationIndex::FindLongestPrefix(const PString & number) const
+{
+  PReadWaitAndSignal lock(mutex);
+
+  if (prefixCount == 0)
+    return PString::Empty();
+
+  // Walk the trie as far as the number goes, remembering the deepest match
+  const PrefixNode * node = &prefixes;
+  const PrefixNode * match = NULL;
+  PINDEX matchLength = 0;
+  PINDEX length = number.GetLength();
+  for (PINDEX i = 0; i < length; i++) {
+    int slot = GetPrefixSlot(number[i]);
+    if (slot < 0 || (node = node->children[slot]) == NULL)
+      break;
+    if (!node->identifiers.empty()) {
+      match = node;
+      matchLength = i+1;
+    }
+  }
+
+  // Only prefixes with non-dialable characters need the per length search
+  if (!otherPrefixes.empty()) {
+    for (PINDEX len = length; len > matchLength; len--) {
+      std::map<PString, StringVector>::const_iterator it = otherPrefixes.find(number.Left(len));
+      if (it != otherPrefixes.end())
+        return it->second[0];
+    }
+  }
+
+  if (match != NULL)
+    return match->identifiers[0];
+
+  return PString::Empty();
+}
+
+
+PINDEX H323RegistrationIndex::GetSize(Kinds kind) const
+{
+  PReadWaitAndSignal lock(mutex);
+
+  switch (kind) {
+    case SignalAddress :
+      return addresses.GetSize();
+    case Alias :
+      return aliases.GetSize();
+    case VoicePrefix :
+      return prefixCount;
+    default :
+      return 0;
+  }
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+
+H323GatekeeperTimerWheel::H323GatekeeperTimerWheel()
+  : currentTick(PTime().GetTimeInSeconds())
+{
+  memset(slots, 0, sizeof(slots));
+}
+
+
+H323GatekeeperTimerWheel::~H323GatekeeperTimerWheel()
+{
+  for (std::map<PString, Entry *>::iterator it = entries.begin(); it != entries.end(); ++it)
+    delete it->second;
+}
+
+
+void H323GatekeeperTimerWheel::Schedule(const PString & key, const PTime & deadline)
+{
+  PWaitAndSignal lock(mutex);
+
+  Entry * entry;
+  std::map<PString, Entry *>::iterator it = entries.find(key);
+  if (it != entries.end()) {
+    entry = it->second;
+    Unlink(entry);
+  }
+  else {
+    entry = new Entry;
+    entry->key = key;
+    entries[key] = entry;
+  }
+
+  // Round up so an entry is never seen before its deadline has passed
+  entry->tick = deadline.GetTimeInSeconds();
+  if (deadline.GetMicrosecond() > 0)
+    entry->tick++;
+
+  Place(entry);
+}
+
+
+PBoolean H323GatekeeperTimerWheel::Cancel(const PString & key)
+{
+  PWaitAndSignal lock(mutex);
+
+  std::map<PString, Entry *>::iterator it = entries.find(key);
+  if (it == entries.end())
+    return FALSE;
+
+  Unlink(it->second);
+  delete it->second;
+  entries.erase(it);
+  return TRUE;
+}
+
+
+PINDEX H323GatekeeperTimerWheel::Expire(const PTime & now, std::vector<PString> & due)
+{
+  PWaitAndSignal lock(mutex);
+
+  PINDEX count = 0;
+  PInt64 nowTick = now.GetTimeInSeconds();
+
+  // If the clock jumped further than the wheel spans, re-place everything
+  // relative to the new time rather than turning through every tick.
+  if (nowTick - currentTick > ((PInt64)1 << (LevelBits*NumLevels))) {
+    PTRACE(2, "RAS\tAging clock jumped " << (nowTick - currentTick) << " seconds");
+    currentTick = nowTick;
+    memset(slots, 0, sizeof(slots));
+    for (std::map<PString, Entry *>::iterator it = entries.begin(); it != entries.end(); ++it)
+      Place(it->second);
+  }
+
+  while (currentTick <= nowTick) {
+    // Move entries down from the upper levels as their slots come around
+    for (int level = 1; level < NumLevels; level++) {
+      if ((currentTick & (((PInt64)1 << (LevelBits*level)) - 1)) != 0)
+        break;
+      Cascade(level);
+    }
+
+    int slot = (int)(currentTick & SlotMask);
+    Entry * entry = slots[0][slot];
+    slots[0][slot] = NULL;
+
+    while (entry != NULL) {
+      Entry * next = entry->next;
+      due.push_back(entry->key);
+      entries.erase(entry->key);
+      delete entry;
+      entry = next;
+      count++;
+    }
+
+    currentTick++;
+  }
+
+  return count;
+}
+
+
+PINDEX H323GatekeeperTimerWheel::GetSize() const
+{
+  PWaitAndSignal lock(mutex);
+  return entries.size();
+}
+
+
+void H323GatekeeperTimerWheel::Place(Entry * entry)
+{
+  // Overdue entries go in the slot for the next tick to be expired
+  PInt64 tick = entry->tick;
+  if (tick < currentTick)
+    tick = currentTick;
+
+  PInt64 delta = tick - currentTick;
+
+  int level = 0;
+  while (level < NumLevels-1 && delta >= ((PInt64)1 << (LevelBits*(level+1))))
+    level++;
+
+  // Beyond the top level, park in its furthest slot until it comes around
+  PInt64 range = (PInt64)1 << (LevelBits*NumLevels);
+  if (delta >= range)
+    tick = currentTick + range - 1;
+
+  entry->level = level;
+  entry->slot = (int)((tick >> (LevelBits*level)) & SlotMask);
+
+  entry->prev = NULL;
+  entry->next = slots[level][entry->slot];
+  if (entry->next != NULL)
+    entry->next->prev = entry;
+  slots[level][entry->slot] = entry;
+}
+
+
+void H323GatekeeperTimerWheel::Unlink(Entry * entry)
+{
+  if (entry->prev != NULL)
+    entry->prev->next = entry->next;
+  else
+    slots[entry->level][entry->slot] = entry->next;
+
+  if (entry->next != NULL)
+    entry->next->prev = entry->prev;
+}
+
+
+void H323GatekeeperTimerWheel::Cascade(int level)
+{
+  int slot = (int)((currentTick >> (LevelBits*level)) & SlotMask);
+  Entry * entry = slots[level][slot];
+  slots[level][slot] = NULL;
+
+  while (entry != NULL) {
+    Entry * next = entry->next;
+    Place(entry);
+    entry = next;
+  }
+}
+
+
 /////////////////////////////////////////////////////////////////////////////
 
 H323GatekeeperServer::H323GatekeeperServer(H323EndPoint & ep)
@@ -2922,18 +3575,18 @@ void H323GatekeeperServer::AddEndPoint(H323RegisteredEndPoint * ep)
     totalRegistrations++;
   }
 
+  mutex.Signal();
+
   for (i = 0; i < ep->GetSignalAddressCount(); i++)
-    byAddress.Append(new StringMap(ep->GetSignalAddress(i), ep->GetIdentifier()));
+    registrations.Add(H323RegistrationIndex::SignalAddress, ep->GetSignalAddress(i), ep->GetIdentifier());
 
-  for (i = 0; i < ep->GetAliasCount(); i++) {
-    PString alias = ep->GetAlias(i);
-    byAlias.Append(new StringMap(ep->GetAlias(i), ep->GetIdentifier()));
-  }
+  for (i = 0; i < ep->GetAliasCount(); i++)
+    registrations.Add(H323RegistrationIndex::Alias, ep->GetAlias(i), ep->GetIdentifier());
 
   for (i = 0; i < ep->GetPrefixCount(); i++)
-    byVoicePrefix.Append(new StringMap(ep->GetPrefix(i), ep->GetIdentifier()));
+    registrations.Add(H323RegistrationIndex::VoicePrefix, ep->GetPrefix(i), ep->GetIdentifier());
 
-  mutex.Signal();
+  ScheduleTimeToLive(*ep);
 }
 
 
@@ -2949,30 +3602,10 @@ PBoolean H323GatekeeperServer::RemoveEndPoint(H323RegisteredEndPoint * ep)
   while (ep->GetAliasCount() > 0)
     ep->RemoveAlias(ep->GetAlias(0));
 
-  PWaitAndSignal wait(mutex);
-
-  PINDEX i;
+  // remove prefixes, aliases and call signalling addresses of this endpoint
+  registrations.RemoveAll(ep->GetIdentifier());
 
-  // remove prefixes belonging to this endpoint
-  for (i = 0; i < byVoicePrefix.GetSize(); i++) {
-    StringMap & prefixMap = (StringMap &)*byVoicePrefix.GetAt(i);
-    if (prefixMap.identifier == ep->GetIdentifier())
-      byVoicePrefix.RemoveAt(i);
-  }
-
-  // remove aliases belonging to this endpoint
-  for (i = 0; i < byAlias.GetSize(); i++) {
-    StringMap & aliasMap = (StringMap &)*byAlias.GetAt(i);
-    if (aliasMap.identifier == ep->GetIdentifier())
-      byAlias.RemoveAt(i);
-  }
-
-  // remove call signalling addresses
-  for (i = 0; i < byAddress.GetSize(); i++) {
-    StringMap & aliasMap = (StringMap &)*byAddress.GetAt(i);
-    if (aliasMap.identifier == ep->GetIdentifier())
-      byAddress.RemoveAt(i);
-  }
+  endpointAging.Cancel(ep->GetIdentifier());
 
   // remove the descriptor
 #ifdef H323_H501
@@ -2991,27 +3624,14 @@ void H323GatekeeperServer::RemoveAlias(H323RegisteredEndPoint & ep,
 {
   PTRACE(3, "RAS\tRemoving registered endpoint alias: " << alias);
 
-  mutex.Wait();
-
-  PINDEX pos = byAlias.GetValuesIndex(alias);
-  if (pos != P_MAX_INDEX) {
-    // Allow for possible multiple aliases
-    while (pos < byAlias.GetSize()) {
-      StringMap & aliasMap = (StringMap &)byAlias[pos];
-      if (aliasMap != alias)
-        break;
-
-      if (aliasMap.identifier == ep.GetIdentifier())
-        byAlias.RemoveAt(pos);
-      else
-        pos++;
-    }
-  }
+  registrations.Remove(H323RegistrationIndex::Alias, alias, ep.GetIdentifier());
 
   if (ep.ContainsAlias(alias))
     ep.RemoveAlias(alias);
 
-  mutex.Signal();
+  // Due now, so the monitor removes an endpoint left without aliases
+  if (ep.GetAliasCount() == 0)
+    ScheduleTimeToLive(ep);
 }
 
 
@@ -3040,12 +3660,11 @@ PSafePtr<H323RegisteredEndPoint> H323GatekeeperServer::FindEndPointByIdentifier(
 PSafePtr<H323RegisteredEndPoint> H323GatekeeperServer::FindEndPointBySignalAddresses(
                             const H225_ArrayOf_TransportAddress & addresses, PSafetyMode mode)
 {
-  PWaitAndSignal wait(mutex);
-
   for (PINDEX i = 0; i < addresses.GetSize(); i++) {
-    PINDEX pos = byAddress.GetValuesIndex(H323TransportAddress(addresses[i]));
-    if (pos != P_MAX_INDEX)
-      return FindEndPointByIdentifier(((StringMap &)byAddress[pos]).identifier, mode);
+    PString identifier = registrations.Find(H323RegistrationIndex::SignalAddress,
+                                            H323TransportAddress(addresses[i]));
+    if (!identifier)
+      return FindEndPointByIdentifier(identifier, mode);
   }
 
   return (H323RegisteredEndPoint *)NULL;
@@ -3055,11 +3674,9 @@ PSafePtr<H323RegisteredEndPoint> H323GatekeeperServer::FindEndPointBySignalAddre
 PSafePtr<H323RegisteredEndPoint> H323GatekeeperServer::FindEndPointBySignalAddress(
                                      const H323TransportAddress & address, PSafetyMode mode)
 {
-  PWaitAndSignal wait(mutex);
-
-  PINDEX pos = byAddress.GetValuesIndex(address);
-  if (pos != P_MAX_INDEX)
-    return FindEndPointByIdentifier(((StringMap &)byAddress[pos]).identifier, mode);
+  PString identifier = registrations.Find(H323RegistrationIndex::SignalAddress, address);
+  if (!identifier)
+    return FindEndPointByIdentifier(identifier, mode);
 
   return (H323RegisteredEndPoint *)NULL;
 }
@@ -3075,13 +3692,9 @@ PSafePtr<H323RegisteredEndPoint> H323GatekeeperServer::FindEndPointByAliasAddres
 PSafePtr<H323RegisteredEndPoint> H323GatekeeperServer::FindEndPointByAliasString(
                                                   const PString & alias, PSafetyMode mode)
 {
-  {
-    PWaitAndSignal wait(mutex);
-    PINDEX pos = byAlias.GetValuesIndex(alias);
-
-    if (pos != P_MAX_INDEX)
-      return FindEndPointByIdentifier(((StringMap &)byAlias[pos]).identifier, mode);
-  }
+  PString identifier = registrations.Find(H323RegistrationIndex::Alias, alias);
+  if (!identifier)
+    return FindEndPointByIdentifier(identifier, mode);
 
   return FindEndPointByPrefixString(alias, mode);
 }
@@ -3090,16 +3703,13 @@ PSafePtr<H323RegisteredEndPoint> H323GatekeeperServer::FindEndPointByAliasString
 PSafePtr<H323RegisteredEndPoint> H323GatekeeperServer::FindEndPointByPartialAlias(
                                                   const PString & alias, PSafetyMode mode)
 {
-  PWaitAndSignal wait(mutex);
-  PINDEX pos = byAlias.GetNextStringsIndex(alias);
-
-  if (pos != P_MAX_INDEX) {
-    StringMap & possible = (StringMap &)byAlias[pos];
-    if (possible.NumCompare(alias) == EqualTo) {
-      PTRACE(4, "RAS\tPartial endpoint search for "
-                "\"" << alias << "\" found \"" << possible << '"');
-      return FindEndPointByIdentifier(possible.identifier, mode);
-    }
+  PString possible;
+  PString identifier = registrations.FindPartialAlias(alias, possible);
+
+  if (!identifier) {
+    PTRACE(4, "RAS\tPartial endpoint search for "
+              "\"" << alias << "\" found \"" << possible << '"');
+    return FindEndPointByIdentifier(identifier, mode);
   }
 
   PTRACE(4, "RAS\tPartial endpoint search for \"" << alias << "\" failed");
@@ -3110,16 +3720,9 @@ PSafePtr<H323RegisteredEndPoint> H323GatekeeperServer::FindEndPointByPartialAlia
 PSafePtr<H323RegisteredEndPoint> H323GatekeeperServer::FindEndPointByPrefixString(
                                                   const PString & prefix, PSafetyMode mode)
 {
-  PWaitAndSignal wait(mutex);
-
-  if (byVoicePrefix.IsEmpty())
-    return (H323RegisteredEndPoint *)NULL;
-
-  for (PINDEX len = prefix.GetLength(); len > 0; len--) {
-    PINDEX pos = byVoicePrefix.GetValuesIndex(prefix.Left(len));
-    if (pos != P_MAX_INDEX)
-      return FindEndPointByIdentifier(((StringMap &)byVoicePrefix[pos]).identifier, mode);
-  }
+  PString identifier = registrations.FindLongestPrefix(prefix);
+  if (!identifier)
+    return FindEndPointByIdentifier(identifier, mode);
 
   return (H323RegisteredEndPoint *)NULL;
 }
@@ -3192,6 +3795,7 @@ H323GatekeeperRequest::Response H323GatekeeperServer::OnAdmission(H323Gatekeeper
       mutex.Signal();
 
       AddCall(oldCall);
+      ScheduleHeartbeat(*oldCall);
     } else {
       delete newCall;
     }
@@ -3314,6 +3918,8 @@ void H323GatekeeperServer::RemoveCall(H323GatekeeperCall * call)
   call->SetBandwidthUsed(0);
   PAssert(call->GetEndPoint().RemoveCall(call), PLogicError);
 
+  callAging.Cancel(GetCallAgingKey(*call));
+
   PTRACE(2, "RAS\tRemoved call (total=" << (activeCalls.GetSize()-1) << ") id=" << *call);
   PAssert(activeCalls.Remove(call), PLogicError);
 }
@@ -3564,28 +4170,80 @@ PBoolean H323GatekeeperServer::OpenPeerElement(const H323TransportAddress & remo
 
 #endif // H323_H501
 
+void H323GatekeeperServer::ScheduleTimeToLive(H323RegisteredEndPoint & ep)
+{
+  if (ep.GetAliasCount() == 0) {
+    endpointAging.Schedule(ep.GetIdentifier(), PTime());
+    return;
+  }
+
+  PTime deadline = ep.GetTimeToLiveDeadline();
+  if (deadline.IsValid())
+    endpointAging.Schedule(ep.GetIdentifier(), deadline);
+  else
+    endpointAging.Cancel(ep.GetIdentifier());
+}
+
+
+void H323GatekeeperServer::ScheduleHeartbeat(H323GatekeeperCall & call)
+{
+  PTime deadline = call.GetHeartbeatDeadline();
+  if (deadline.IsValid())
+    callAging.Schedule(GetCallAgingKey(call), deadline);
+  else
+    callAging.Cancel(GetCallAgingKey(call));
+}
+
+
 void H323GatekeeperServer::MonitorMain(PThread &, H323_INT)
 {
-  while (!monitorExit.Wait(1000)) {
-    PTRACE(6, "RAS\tAging registered endpoints");
+  std::vector<PString> due;
+  size_t i;
 
-    for (PSafePtr<H323RegisteredEndPoint> ep = GetFirstEndPoint(PSafeReference); ep != NULL; ep++) {
-      if (!ep->OnTimeToLive()) {
-        PTRACE(2, "RAS\tRemoving expired endpoint " << *ep);
-        RemoveEndPoint(ep);
-      }
-      if (ep->GetAliasCount() == 0) {
-        PTRACE(2, "RAS\tRemoving endpoint " << *ep << " with no aliases");
-        RemoveEndPoint(ep);
+  while (!monitorExit.Wait(1000)) {
+    PTime now;
+
+    // Only endpoints whose time to live has passed are on the expired list,
+    // anything that sent an RRQ or IRR in the meantime has been rescheduled.
+    due.clear();
+    if (endpointAging.Expire(now, due) > 0) {
+      PTRACE(6, "RAS\tAging " << due.size() << " registered endpoints");
+
+      for (i = 0; i < due.size(); i++) {
+        PSafePtr<H323RegisteredEndPoint> ep = FindEndPointByIdentifier(due[i], PSafeReference);
+        if (ep == NULL)
+          continue;
+
+        if (!ep->OnTimeToLive()) {
+          PTRACE(2, "RAS\tRemoving expired endpoint " << *ep);
+          RemoveEndPoint(ep);
+        }
+        else if (ep->GetAliasCount() == 0) {
+          PTRACE(2, "RAS\tRemoving endpoint " << *ep << " with no aliases");
+          RemoveEndPoint(ep);
+        }
+        else
+          ScheduleTimeToLive(*ep);
       }
     }
 
     byIdentifier.DeleteObjectsToBeRemoved();
 
-    for (PSafePtr<H323GatekeeperCall> call = GetFirstCall(PSafeReference); call != NULL; call++) {
-      if (!call->OnHeartbeat()) {
-        if (disengageOnHearbeatFail)
+    due.clear();
+    if (callAging.Expire(now, due) > 0) {
+      PTRACE(6, "RAS\tHeartbeat of " << due.size() << " calls");
+
+      for (i = 0; i < due.size(); i++) {
+        PSafePtr<H323GatekeeperCall> call = FindCall(due[i], PSafeReference);
+        if (call == NULL)
+          continue;
+
+        if (call->OnHeartbeat())
+          ScheduleHeartbeat(*call);
+        else if (disengageOnHearbeatFail)
           call->Disengage();
+        else
+          ScheduleHeartbeat(*call);
       }
     }
 
@@ -222,6 +222,74 @@ PBoolean H225_RAS::HandleTransaction(const PASN_Object & rawPDU)
 }
 
 
+PBoolean H225_RAS::GetDispatchKey(const H323TransactionPDU & transPDU, PString & key) const
+{
+  const H323RasPDU & pdu = (const H323RasPDU &)transPDU;
+
+  switch (pdu.GetTag()) {
+    case H225_RasMessage::e_gatekeeperRequest :
+    case H225_RasMessage::e_infoRequest :
+    case H225_RasMessage::e_serviceControlIndication :
+      break;
+
+    case H225_RasMessage::e_registrationRequest : {
+      const H225_RegistrationRequest & rrq = pdu;
+      if (rrq.HasOptionalField(H225_RegistrationRequest::e_endpointIdentifier))
+        key = rrq.m_endpointIdentifier;
+      break;
+    }
+
+    case H225_RasMessage::e_unregistrationRequest : {
+      const H225_UnregistrationRequest & urq = pdu;
+      if (urq.HasOptionalField(H225_UnregistrationRequest::e_endpointIdentifier))
+        key = urq.m_endpointIdentifier;
+      break;
+    }
+
+    case H225_RasMessage::e_admissionRequest :
+      key = ((const H225_AdmissionRequest &)pdu).m_endpointIdentifier;
+      break;
+
+    case H225_RasMessage::e_bandwidthRequest :
+      key = ((const H225_BandwidthRequest &)pdu).m_endpointIdentifier;
+      break;
+
+    case H225_RasMessage::e_disengageRequest :
+      key = ((const H225_DisengageRequest &)pdu).m_endpointIdentifier;
+      break;
+
+    case H225_RasMessage::e_locationRequest : {
+      const H225_LocationRequest & lrq = pdu;
+      if (lrq.HasOptionalField(H225_LocationRequest::e_endpointIdentifier))
+        key = lrq.m_endpointIdentifier;
+      break;
+    }
+
+    case H225_RasMessage::e_resourcesAvailableIndicate :
+      key = ((const H225_ResourcesAvailableIndicate &)pdu).m_endpointIdentifier;
+      break;
+
+    case H225_RasMessage::e_infoRequestResponse : {
+      // A solicited IRR is the response to our IRQ, see 7.15.2/H.225.0 for
+      // the sequence number of one meaning unsolicited.
+      const H225_InfoRequestResponse & irr = pdu;
+      if (!irr.m_unsolicited && irr.m_requestSeqNum != 1)
+        return FALSE;
+      key = irr.m_endpointIdentifier;
+      break;
+    }
+
+    default :
+      return FALSE;
+  }
+
+  if (key.IsEmpty())
+    key = GetLastReceivedAddress();
+
+  return TRUE;
+}
+
+
 void H225_RAS::OnSendingPDU(PASN_Object & rawPDU)
 {
   H323RasPDU & pdu = (H323RasPDU &)rawPDU;
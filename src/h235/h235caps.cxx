@@ -1364,7 +1364,7 @@ H323Capability * H235Capabilities::CopySecure(PINDEX descriptorNum, PINDEX simul
   if (PIsDescendant(&capability,H235SecurityCapability)) {
      H235SecurityCapability * newCapability = (H235SecurityCapability *)capability.Clone();
      newCapability->SetCapabilityNumber(capability.GetCapabilityNumber());
-     table.Append(newCapability);
+     AppendCapability(newCapability);
      SetCapability(descriptorNum, simultaneous, newCapability);
      return newCapability;
   } else {
@@ -67,6 +67,122 @@ PString CipherString(const PString & m_algorithmOID)
     return "Unknown";
 }
 
+H235TransmitWorker::H235TransmitWorker(H235Session & session, RTP_Session & rtp, PINDEX maxQueued)
+  : PThread(10000, NoAutoDeleteThread, HighPriority, "H235Tx:%0x"),
+    m_session(session), m_rtp(rtp), m_maxQueued(maxQueued), m_stop(false),
+    m_failed(false), m_dropped(0), m_batches(0), m_frames(0)
+{
+    Resume();
+}
+
+H235TransmitWorker::~H235TransmitWorker()
+{
+    Stop();
+
+    for (std::deque<RTP_DataFrame *>::iterator q = m_queue.begin(); q != m_queue.end(); ++q)
+        delete *q;
+    for (std::vector<RTP_DataFrame *>::iterator f = m_free.begin(); f != m_free.end(); ++f)
+        delete *f;
+}
+
+PBoolean H235TransmitWorker::Enqueue(const RTP_DataFrame & frame)
+{
+    PINDEX size = frame.GetHeaderSize() + frame.GetPayloadSize();
+    RTP_DataFrame * copy;
+    {
+        PWaitAndSignal m(m_mutex);
+        if (m_stop)
+            return false;
+        if ((PINDEX)m_queue.size() >= m_maxQueued) {
+            ++m_dropped;
+            return true;
+        }
+        if (m_free.empty())
+            copy = new RTP_DataFrame(0);
+        else {
+            copy = m_free.back();
+            m_free.pop_back();
+        }
+    }
+
+    // Copy outside the lock, recycled frames already have the capacity
+    copy->SetMinSize(size + EVP_MAX_BLOCK_LENGTH);
+    memcpy(copy->GetPointer(), (const BYTE *)frame, size);
+    copy->SetPayloadSize(frame.GetPayloadSize());
+
+    PBoolean wake;
+    {
+        PWaitAndSignal m(m_mutex);
+        wake = m_queue.empty();
+        m_queue.push_back(copy);
+    }
+    if (wake)
+        m_wakeup.Signal();
+    return true;
+}
+
+void H235TransmitWorker::Stop()
+{
+    {
+        PWaitAndSignal m(m_mutex);
+        m_stop = true;
+    }
+    m_wakeup.Signal();
+
+    if (!IsTerminated()) {
+        WaitForTermination();
+        PTRACE(3, "H235\tTransmit worker sent " << m_frames << " frames in "
+               << m_batches << " batches, dropped " << m_dropped);
+    }
+}
+
+void H235TransmitWorker::Main()
+{
+    std::vector<RTP_DataFrame *> batch;
+    PBoolean stopping = false;
+
+    while (!stopping) {
+        m_wakeup.Wait();
+
+        {
+            PWaitAndSignal m(m_mutex);
+            batch.assign(m_queue.begin(), m_queue.end());
+            m_queue.clear();
+            stopping = m_stop;
+        }
+
+        if (!batch.empty()) {
+            m_session.WriteFramesInPlace(&batch[0], batch.size());
+
+            // Only frames with a payload are queued, so an empty one failed to encrypt
+            PBoolean failed = false;
+            for (size_t i = 0; i < batch.size() && !failed; i++) {
+                if (batch[i]->GetPayloadSize() == 0) {
+                    PTRACE(1, "H235\tTransmit worker encryption failed, stopping");
+                    failed = true;
+                }
+                else if (!m_rtp.WriteData(*batch[i])) {
+                    PTRACE(2, "H235\tTransmit worker write failed, stopping");
+                    failed = true;
+                }
+            }
+            // Only this thread updates the counts
+            ++m_batches;
+            m_frames.SetValue(m_frames + (long)batch.size());
+
+            PWaitAndSignal m(m_mutex);
+            m_free.insert(m_free.end(), batch.begin(), batch.end());
+            if (failed) {
+                m_failed = true;
+                m_stop = true;
+                stopping = true;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
 H323SecureRTPChannel::H323SecureRTPChannel(H323Connection & conn,
                                  const H323Capability & cap,
                                  Directions direction,
@@ -74,12 +190,13 @@ H323SecureRTPChannel::H323SecureRTPChannel(H323Connection & conn,
                                  )
     : H323_RTPChannel(conn,cap,direction, r), m_algorithm(cap.GetEncryptionAlgorithm()),
       m_encryption((H235Capabilities*)conn.GetLocalCapabilitiesRef(), cap.GetEncryptionAlgorithm()),
-      m_payload(RTP_DataFrame::IllegalPayloadType)
+      m_payload(RTP_DataFrame::IllegalPayloadType), m_transmitWorker(NULL)
 {
 }
 
 H323SecureRTPChannel::~H323SecureRTPChannel()
 {
+    delete m_transmitWorker;
     delete capability;
     capability = NULL;
 }
@@ -89,9 +206,24 @@ void H323SecureRTPChannel::CleanUpOnTermination()
   if (terminating)
     return;
 
+  // Flush the queued frames before the RTP session is closed
+  if (m_transmitWorker != NULL)
+    m_transmitWorker->Stop();
+
   return H323_RTPChannel::CleanUpOnTermination();
 }
 
+PBoolean H323SecureRTPChannel::Start()
+{
+  // Created before the transmit thread runs, so WriteFrame() and
+  // CleanUpOnTermination() never race with it being set.
+  unsigned maxQueued = connection.GetEndPoint().GetH235MediaWorker();
+  if (m_transmitWorker == NULL && maxQueued > 0 && GetDirection() == IsTransmitter)
+    m_transmitWorker = new H235TransmitWorker(m_encryption, rtpSession, maxQueued);
+
+  return H323_RTPChannel::Start();
+}
+
 void BuildEncryptionSync(H245_EncryptionSync & sync, const H323Channel & chan, const H235Session & session)
 {
     sync.m_synchFlag = chan.GetRTPPayloadType();
@@ -261,10 +393,16 @@ PBoolean H323SecureRTPChannel::WriteFrame(RTP_DataFrame & frame)
         return false;
 
     if (m_encryption.IsInitialised()) {
-        if (m_encryption.WriteFrameInPlace(frame))
-            return rtpSession.WriteData(frame);
-        else
+        // Nothing to encrypt or send
+        if (frame.GetPayloadSize() == 0)
             return true;
+        if (m_transmitWorker != NULL)
+            return m_transmitWorker->Enqueue(frame);
+        if (!m_encryption.WriteFrameInPlace(frame)) {
+            PTRACE(1, "H235\tMedia encryption failed, closing channel");
+            return false;
+        }
+        return rtpSession.WriteData(frame);
     }
     return rtpSession.WriteData(frame);
 }
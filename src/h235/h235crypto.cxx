@@ -613,38 +613,35 @@ PINDEX H235CryptoEngine::EncryptInPlace(const BYTE * inData, PINDEX inLength, BY
         return inLength;
     }
 
-    // max ciphertext len for a n bytes of plaintext is n + BLOCK_SIZE -1 bytes
-    int outSize = 0;
-    int inSize =  inLength + m_enc_blockSize;
-
     SetIV(m_iv, ivSequence, m_enc_ivLength);
     EVP_EncryptInit_ex(m_encryptCtx, NULL, NULL, NULL, m_iv);
-    m_encryptHelper.Reset();
 
-    rtpPadding = (inLength % m_enc_blockSize > 0);
-    EVP_CIPHER_CTX_set_padding(m_encryptCtx, rtpPadding ? 1 : 0);
+    // Run the whole blocks through the cipher in one call straight from the
+    // input and pad the last partial block ourselves, this gives the same
+    // result as EVP_EncryptUpdate()/EVP_EncryptFinal_ex() with padding but
+    // without the copies through the context buffer. inData may be outData.
+    int leftover = inLength % m_enc_blockSize;
+    int whole = inLength - leftover;
+    rtpPadding = (leftover > 0);
 
-    if (!rtpPadding && (inLength % m_enc_blockSize > 0)) {
-        // use cyphertext stealing
-        if (!m_encryptHelper.EncryptUpdateCTS(m_encryptCtx, outData, &inSize, inData, inLength)) {
-            PTRACE(1, "H235\tEVP_EncryptUpdate_cts() failed");
-        }
-        if (!m_encryptHelper.EncryptFinalCTS(m_encryptCtx, outData + inSize, &outSize)) {
-            PTRACE(1, "H235\tEVP_EncryptFinal_cts() failed");
-        }
-    } else {
-        /* update ciphertext, ciphertext_len is filled with the length of ciphertext generated,
-         *len is the size of plaintext in bytes */
-        if (!EVP_EncryptUpdate(m_encryptCtx, outData, &inSize, inData, inLength)) {
-            PTRACE(1, "H235\tEVP_EncryptUpdate() failed");
-        }
+    if (whole > 0 && EVP_Cipher(m_encryptCtx, outData, inData, whole) <= 0) {
+        PTRACE(1, "H235\tEVP_Cipher() failed");
+        return 0;
+    }
 
-        // update ciphertext with the final remaining bytes, if any use RTP padding
-        if (!EVP_EncryptFinal_ex(m_encryptCtx, outData + inSize, &outSize)) {
-            PTRACE(1, "H235\tEVP_EncryptFinal_ex() failed");
+    if (leftover > 0) {
+        unsigned char last[EVP_MAX_BLOCK_LENGTH];
+        memcpy(last, inData + whole, leftover);
+        memset(last + leftover, m_enc_blockSize - leftover, m_enc_blockSize - leftover);
+        if (EVP_Cipher(m_encryptCtx, outData + whole, last, m_enc_blockSize) <= 0) {
+            PTRACE(1, "H235\tEVP_Cipher() failed");
+            return 0;
         }
+        whole += m_enc_blockSize;
     }
-    return inSize + outSize;
+
+    m_operationCnt++;
+    return whole;
 }
 
 PBYTEArray H235CryptoEngine::Decrypt(const PBYTEArray & _data, unsigned char * ivSequence, bool & rtpPadding)
@@ -691,39 +688,57 @@ PBYTEArray H235CryptoEngine::Decrypt(const PBYTEArray & _data, unsigned char * i
 
 PINDEX H235CryptoEngine::DecryptInPlace(const BYTE * inData, PINDEX inLength, BYTE * outData, unsigned char * ivSequence, bool & rtpPadding)
 {
-
-    /* plaintext will always be equal to or lesser than length of ciphertext*/
-    int outSize = 0;
-    int inSize =  inLength;
+    if (!m_initialised) {
+        PTRACE(1, "H235\tERROR: Decryption not initialised!!");
+        return 0;
+    }
 
     SetIV(m_iv, ivSequence, m_dec_ivLength);
     EVP_DecryptInit_ex(m_decryptCtx, NULL, NULL, NULL, m_iv);
-    m_decryptHelper.Reset();
 
-    EVP_CIPHER_CTX_set_padding(m_decryptCtx, rtpPadding ? 1 : 0);
-
-    if (!rtpPadding && inLength % m_dec_blockSize > 0) {
-        // use cyphertext stealing
+    if (inLength % m_dec_blockSize > 0) {
+        if (rtpPadding) {
+            PTRACE(1, "H235\tDecrypt error: data not a multiple of block length");
+            return 0;	// no usable payload
+        }
+        // use cyphertext stealing, the helper needs separate input and output
+        /* plaintext will always be equal to or lesser than length of ciphertext*/
+        int outSize = 0;
+        int inSize =  inLength;
+        m_decryptHelper.Reset();
+        EVP_CIPHER_CTX_set_padding(m_decryptCtx, 0);
         if (!m_decryptHelper.DecryptUpdateCTS(m_decryptCtx, outData, &inSize, inData, inLength)) {
             PTRACE(1, "H235\tDecryptUpdateCTS() failed");
-			return 0;	// no usable payload
+            return 0;	// no usable payload
         }
         if(!m_decryptHelper.DecryptFinalCTS(m_decryptCtx, outData + inSize, &outSize)) {
             PTRACE(1, "H235\tDecryptFinalCTS() failed");
-			return 0;	// no usable payload
+            return 0;	// no usable payload
         }
-    } else {
-        if (!m_decryptHelper.DecryptUpdate(m_decryptCtx, outData, &inSize, inData, inLength)) {
-            PTRACE(1, "H235\tDecryptUpdate() failed");
-			return 0;	// no usable payload
-        }
-        if (!m_decryptHelper.DecryptFinalRelaxed(m_decryptCtx, outData + inSize, &outSize)) {
-            PTRACE(1, "H235\tDecryptFinalRelaxed() failed - incorrect padding ?");
-			return 0;	// no usable payload
+        m_operationCnt++;
+        return inSize + outSize;
+    }
+
+    // Whole blocks, decrypt in one call, inData may be outData
+    if (inLength > 0 && EVP_Cipher(m_decryptCtx, outData, inData, inLength) <= 0) {
+        PTRACE(1, "H235\tEVP_Cipher() failed");
+        return 0;	// no usable payload
+    }
+
+    PINDEX plainLength = inLength;
+    if (rtpPadding) {
+        // Relaxed check as in DecryptFinalRelaxed(), some endpoints don't fill the padding properly
+        int n = (inLength > 0) ? outData[inLength - 1] : 0;
+        if (n == 0 || n > m_dec_blockSize) {
+            PTRACE(1, "H235\tDecrypt error: bad decrypt - incorrect padding ?");
+            return 0;	// no usable payload
         }
+        plainLength -= n;
     }
+
 	rtpPadding = false;	// we return the real length of the decrypted data without padding
-    return inSize + outSize;
+    m_operationCnt++;
+    return plainLength;
 }
 
 PBYTEArray H235CryptoEngine::GenerateRandomKey()
@@ -800,6 +815,7 @@ PBoolean H235Session::DecodeMediaKey(PBYTEArray & key)
     PTRACE(4, "H235Key\tH235v3 encrypted key received, size=" << key.GetSize() << endl << hex << key);
 
     bool rtpPadding = false;
+    PWaitAndSignal m(m_mutex);
     m_crytoMasterKey = m_dhcontext.Decrypt(key, NULL, rtpPadding);
     m_context.SetKey(m_crytoMasterKey);
 
@@ -831,8 +847,10 @@ PBoolean H235Session::CreateSession(PBoolean isMaster)
 
     m_dhcontext.SetKey(shortSessionKey);
 
-    if (m_isMaster)
+    if (m_isMaster) {
+        PWaitAndSignal m(m_mutex);
         m_crytoMasterKey = m_context.GenerateRandomKey();
+    }
 
     m_isInitialised = true;
     return true;
@@ -840,6 +858,8 @@ PBoolean H235Session::CreateSession(PBoolean isMaster)
 
 PBoolean H235Session::ReadFrame(DWORD & /*rtpTimestamp*/, RTP_DataFrame & frame)
 {
+    PWaitAndSignal m(m_mutex);
+
     unsigned char ivSequence[6];
     memcpy(ivSequence, frame.GetSequenceNumberPtr(), 6);
     PBoolean padding = frame.GetPadding();
@@ -855,16 +875,27 @@ PBoolean H235Session::ReadFrame(DWORD & /*rtpTimestamp*/, RTP_DataFrame & frame)
 
 PBoolean H235Session::ReadFrameInPlace(RTP_DataFrame & frame)
 {
+    PWaitAndSignal m(m_mutex);
+
     memcpy(m_ivSequence, frame.GetSequenceNumberPtr(), 6);
     m_padding = frame.GetPadding();
-    frame.SetPayloadSize(m_context.DecryptInPlace(frame.GetPayloadPtr(), frame.GetPayloadSize(), m_frameBuffer.GetPointer(), m_ivSequence, m_padding));
-    memmove(frame.GetPayloadPtr(), m_frameBuffer.GetPointer(), frame.GetPayloadSize());
+    BYTE * payload = frame.GetPayloadPtr();
+    PINDEX size = frame.GetPayloadSize();
+    if (!m_padding && (size % m_context.GetBlockSize()) > 0) {
+        // ciphertext stealing can't decrypt in place
+        size = m_context.DecryptInPlace(payload, size, m_frameBuffer.GetPointer(size), m_ivSequence, m_padding);
+        memcpy(payload, m_frameBuffer.GetPointer(), size);
+    } else
+        size = m_context.DecryptInPlace(payload, size, payload, m_ivSequence, m_padding);
+    frame.SetPayloadSize(size);
     frame.SetPadding(m_padding);
     return true;	// don't stop on decoding errors
 }
 
 PBoolean H235Session::WriteFrame(RTP_DataFrame & frame)
 {
+    PWaitAndSignal m(m_mutex);
+
     unsigned char ivSequence[6];
     memcpy(ivSequence, frame.GetSequenceNumberPtr(), 6);
     PBoolean padding = frame.GetPadding();
@@ -879,11 +910,32 @@ PBoolean H235Session::WriteFrame(RTP_DataFrame & frame)
 }
 
 PBoolean H235Session::WriteFrameInPlace(RTP_DataFrame & frame)
+{
+    PWaitAndSignal m(m_mutex);
+    return InternalWriteFrame(frame);
+}
+
+PINDEX H235Session::WriteFramesInPlace(RTP_DataFrame * const * frames, PINDEX count)
+{
+    PINDEX written = 0;
+
+    PWaitAndSignal m(m_mutex);
+    for (PINDEX i = 0; i < count; i++) {
+        if (InternalWriteFrame(*frames[i]))
+            written++;
+    }
+    return written;
+}
+
+PBoolean H235Session::InternalWriteFrame(RTP_DataFrame & frame)
 {
     memcpy(m_ivSequence, frame.GetSequenceNumberPtr(), 6);
     m_padding = frame.GetPadding();
-    frame.SetPayloadSize(m_context.EncryptInPlace(frame.GetPayloadPtr(), frame.GetPayloadSize(), m_frameBuffer.GetPointer(), m_ivSequence, m_padding));
-    memmove(frame.GetPayloadPtr(), m_frameBuffer.GetPointer(), frame.GetPayloadSize());
+    PINDEX size = frame.GetPayloadSize();
+    // make room for the padding block, then encrypt straight into the frame
+    frame.SetPayloadSize(size + EVP_MAX_BLOCK_LENGTH);
+    BYTE * payload = frame.GetPayloadPtr();
+    frame.SetPayloadSize(m_context.EncryptInPlace(payload, size, payload, m_ivSequence, m_padding));
     frame.SetPadding(m_padding);
     return (frame.GetPayloadSize() > 0);
 }
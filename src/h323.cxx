@@ -180,6 +180,82 @@ class AggregatedH245Handle : public H323AggregatedH2x5Handle
 
 /////////////////////////////////////////////////////////////////////////////
 
+class H225ReactorHandle : public H323SignalReactor::Handle
+{
+  PCLASSINFO(H225ReactorHandle, H323SignalReactor::Handle);
+  public:
+    H225ReactorHandle(H323Transport & transport, H323Connection & conn)
+      : H323SignalReactor::Handle(transport, &conn), connection(conn)
+    {
+    }
+
+    PBoolean OnReceivePDU(const PBYTEArray & data)
+    {
+      H323SignalPDU pdu;
+      PBoolean ok = pdu.ProcessReadData(transport, data);
+      // skip keep-alives
+      if (ok && pdu.GetQ931().GetMessageType() == 0)
+        return TRUE;
+      return connection.HandleReceivedSignalPDU(ok, pdu);
+    }
+
+    PBoolean OnReadError(PChannel::Errors)
+    {
+      H323SignalPDU pdu;
+      return connection.HandleReceivedSignalPDU(FALSE, pdu);
+    }
+
+    void OnDetached()
+    {
+      connection.EndHandleSignallingChannel();
+    }
+
+  protected:
+    H323Connection & connection;
+};
+
+class H245ReactorHandle : public H323SignalReactor::Handle
+{
+  PCLASSINFO(H245ReactorHandle, H323SignalReactor::Handle);
+  public:
+    H245ReactorHandle(H323Transport & transport, H323Connection & conn)
+      : H323SignalReactor::Handle(transport, &conn), connection(conn)
+    {
+    }
+
+    PBoolean OnReceivePDU(const PBYTEArray & data)
+    {
+      PPER_Stream strm(data);
+      if (!connection.HandleReceivedControlPDU(TRUE, strm))
+        return FALSE;
+      connection.MonitorCallStatus();
+      return TRUE;
+    }
+
+    PBoolean OnReadError(PChannel::Errors)
+    {
+      PPER_Stream strm;
+      return connection.HandleReceivedControlPDU(FALSE, strm);
+    }
+
+    // Checked every MonitorCallStatusTime, even while PDUs keep arriving
+    void OnMonitor()
+    {
+      connection.MonitorCallStatus();
+    }
+
+    void OnDetached()
+    {
+      connection.EndHandleControlChannel();
+      PTRACE(2, "H245\tControl channel closed.");
+    }
+
+  protected:
+    H323Connection & connection;
+};
+
+/////////////////////////////////////////////////////////////////////////////
+
 #if PTRACING
 ostream & operator<<(ostream & o, H323Connection::CallEndReason r)
 {
@@ -589,6 +665,14 @@ H323Connection::H323Connection(H323EndPoint & ep,
   AuthenticationFailed = FALSE;
   hasAuthentication = FALSE;
 
+  // share the endpoint media reactor, if enabled, between RTP sessions
+  rtpSessions.SetMediaReactor(endpoint.GetMediaReactor());
+
+  signallingReactor = endpoint.GetSignallingReactor();
+  signalReactorHandle = NULL;
+  controlReactorHandle = NULL;
+  reactorClosed = FALSE;
+
   // set aggregation options
 #ifdef H323_RTP_AGGREGATE
   useRTPAggregation        = (options & RTPAggregationMask)        != RTPAggregationDisable;
@@ -863,6 +947,8 @@ void H323Connection::CleanUpOnCallEnd()
   if (controlChannel != NULL)
     controlChannel->CleanUpOnTermination();
 
+  RemoveReactorHandle(controlReactorHandle);
+
 #ifdef H323_SIGNAL_AGGREGATE
   if (controlAggregator != NULL)
     endpoint.GetSignallingAggregator()->RemoveHandle(controlAggregator);
@@ -872,6 +958,8 @@ void H323Connection::CleanUpOnCallEnd()
   if (signallingChannel != NULL)
     signallingChannel->CleanUpOnTermination();
 
+  RemoveReactorHandle(signalReactorHandle);
+
 #ifdef H323_SIGNAL_AGGREGATE
   if (signalAggregator != NULL)
     endpoint.GetSignallingAggregator()->RemoveHandle(signalAggregator);
@@ -990,6 +1078,11 @@ void H323Connection::HandleSignallingChannel()
       break;
   }
 
+  EndHandleSignallingChannel();
+}
+
+void H323Connection::EndHandleSignallingChannel()
+{
   // If we are the only link to the far end then indicate that we have
   // received endSession even if we hadn't, because we are now never going
   // to get one so there is no point in having CleanUpOnCallEnd wait.
@@ -3343,6 +3436,73 @@ void H323Connection::HandleControlChannel()
 }
 
 
+PBoolean H323Connection::StartSignalChannelReactor(H323Transport * transport, PBoolean keepAlive)
+{
+  if (signallingReactor == NULL || transport == NULL || !H323SignalReactor::CanService(*transport))
+    return FALSE;
+
+  PWaitAndSignal m(reactorMutex);
+  if (reactorClosed)
+    return FALSE;
+
+  H225ReactorHandle * handle = new H225ReactorHandle(*transport, *this);
+  handle->SetKeepAlive(keepAlive);
+  if (!signallingReactor->AddHandle(handle)) {
+    delete handle;
+    return FALSE;
+  }
+
+  signalReactorHandle = handle;
+  PTRACE(3, "H225\tSignal channel handed to reactor: callRef=" << callReference);
+  return TRUE;
+}
+
+
+PBoolean H323Connection::StartControlChannelReactor(H323Transport * transport, PBoolean keepAlive)
+{
+  if (signallingReactor == NULL || transport == NULL || !transport->IsOpen() ||
+      !H323SignalReactor::CanService(*transport))
+    return FALSE;
+
+  // The channel is finished, just as HandleControlChannel() would be
+  if (!OnStartHandleControlChannel())
+    return TRUE;
+
+  PWaitAndSignal m(reactorMutex);
+
+  H245ReactorHandle * handle = new H245ReactorHandle(*transport, *this);
+  handle->SetKeepAlive(keepAlive);
+  handle->SetMonitorInterval(MonitorCallStatusTime);
+  if (reactorClosed || !signallingReactor->AddHandle(handle)) {
+    PTRACE_IF(1, !reactorClosed, "H245\tCould not hand control channel to reactor");
+    delete handle;
+    if (!reactorClosed)
+      ClearCall(EndedByTransportFail);
+    EndHandleControlChannel();
+    return TRUE;
+  }
+
+  controlReactorHandle = handle;
+  PTRACE(3, "H245\tControl channel handed to reactor");
+  return TRUE;
+}
+
+
+void H323Connection::RemoveReactorHandle(H323SignalReactor::Handle * & handle)
+{
+  reactorMutex.Wait();
+  H323SignalReactor::Handle * removing = handle;
+  handle = NULL;
+  reactorClosed = TRUE;
+  reactorMutex.Signal();
+
+  if (removing != NULL) {
+    signallingReactor->RemoveHandle(removing);
+    delete removing;
+  }
+}
+
+
 PBoolean H323Connection::HandleReceivedControlPDU(PBoolean readStatus, PPER_Stream & strm)
 {
   PBoolean ok = FALSE;
@@ -4243,6 +4403,7 @@ void H323Connection::SetInitialBandwidth(H323Capability::MainTypes captype, int
              fmt.SetOptionInteger(OpalVideoFormat::MaxBitRateOption,bitRate);
     }
   }
+  localCapabilities.InvalidatePDUCache();
 #endif
 }
 
@@ -4259,6 +4420,7 @@ void H323Connection::SetMaxPayloadSize(H323Capability::MainTypes captype, int si
       }
     }
   }
+  localCapabilities.InvalidatePDUCache();
 #endif
 }
 
@@ -4272,6 +4434,7 @@ void H323Connection::SetEmphasisSpeed(H323Capability::MainTypes captype, bool sp
           fmt.SetOptionBoolean(OpalVideoFormat::EmphasisSpeedOption,speed);
     }
   }
+  localCapabilities.InvalidatePDUCache();
 #endif
 }
 
@@ -6368,6 +6531,13 @@ void H323Connection::UpdateSession(unsigned oldSessionID, unsigned newSessionID)
 }
 
 
+void H323Connection::GetMediaStatistics(RTP_MediaStatisticsList & list)
+{
+  for (RTP_Session * session = rtpSessions.First(); session != NULL; session = rtpSessions.Next())
+    list.Append(new RTP_MediaStatisticsSnapshot(callToken, session->GetSessionID(), session->GetMediaStatistics()));
+}
+
+
 void H323Connection::OnRTPStatistics(const RTP_Session & session) const
 {
 #ifdef H323_H4609
@@ -7748,3 +7918,173 @@ PBoolean H323Connection::IsMaintainedConnection() const
 
 /////////////////////////////////////////////////////////////////////////////
 
+
+void H323Connection::AddHandleReference(PThreadIdentifier owner)
+{
+  PWaitAndSignal m(handleMutex);
+  ++handleReferences;
+  handleOwners.insert(owner);
+}
+
+
+void H323Connection::RemoveHandleReference(PThreadIdentifier owner)
+{
+  // Once the count is zero the cleaner may delete the connection, so it is
+  // only touched while the mutex is held.
+  PWaitAndSignal m(handleMutex);
+
+  std::multiset<PThreadIdentifier>::iterator it = handleOwners.find(owner);
+  if (it != handleOwners.end())
+    handleOwners.erase(it);
+
+  if (--handleReferences == 0)
+    handlesReleased.Signal();
+}
+
+
+PBoolean H323Connection::IsHandleReferencedBy(PThreadIdentifier thread) const
+{
+  PWaitAndSignal m(handleMutex);
+  return handleOwners.find(thread) != handleOwners.end();
+}
+
+
+void H323Connection::WaitForHandleReferences()
+{
+  for (;;) {
+    {
+      PWaitAndSignal m(handleMutex);
+      if (handleReferences == 0)
+        return;
+    }
+
+    PTRACE(4, "H323\tWaiting for handles to " << callToken << " to be released");
+    handlesReleased.Wait();
+  }
+}
+
+
+H323ConnectionHandle::H323ConnectionHandle(H323Connection * conn)
+  : connection(conn),
+    owner(PThread::GetCurrentThreadId())
+{
+  if (connection != NULL)
+    connection->AddHandleReference(owner);
+}
+
+
+H323ConnectionHandle::H323ConnectionHandle(const H323ConnectionHandle & other)
+  : connection(other.connection),
+    owner(PThread::GetCurrentThreadId())
+{
+  if (connection != NULL)
+    connection->AddHandleReference(owner);
+}
+
+
+H323ConnectionHandle::~H323ConnectionHandle()
+{
+  if (connection != NULL)
+    connection->RemoveHandleReference(owner);
+}
+
+
+H323ConnectionHandle & H323ConnectionHandle::operator=(const H323ConnectionHandle & other)
+{
+  PThreadIdentifier thread = PThread::GetCurrentThreadId();
+  if (other.connection != NULL)
+    other.connection->AddHandleReference(thread);
+  if (connection != NULL)
+    connection->RemoveHandleReference(owner);
+  connection = other.connection;
+  owner = thread;
+  return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+H323ConnectionRegistry::H323ConnectionRegistry(PINDEX count)
+{
+  if (count < 1)
+    count = 1;
+
+  for (PINDEX i = 0; i < count; i++)
+    shards.push_back(new Shard);
+}
+
+
+H323ConnectionRegistry::~H323ConnectionRegistry()
+{
+  for (size_t i = 0; i < shards.size(); i++)
+    delete shards[i];
+}
+
+
+H323ConnectionRegistry::Shard & H323ConnectionRegistry::GetShard(const PString & token) const
+{
+  // FNV-1a
+  unsigned hash = 2166136261U;
+  for (const char * ptr = token; *ptr != '\0'; ptr++) {
+    hash ^= (BYTE)*ptr;
+    hash *= 16777619U;
+  }
+  return *shards[hash % shards.size()];
+}
+
+
+void H323ConnectionRegistry::Add(const PString & token, H323Connection * connection)
+{
+  if (token.IsEmpty() || connection == NULL)
+    return;
+
+  Shard & shard = GetShard(token);
+  PWriteWaitAndSignal lock(shard.mutex);
+  shard.connections[token] = connection;
+}
+
+
+void H323ConnectionRegistry::Remove(const PString & token, H323Connection * connection)
+{
+  Shard & shard = GetShard(token);
+  PWriteWaitAndSignal lock(shard.mutex);
+
+  ConnectionMap::iterator r = shard.connections.find(token);
+  if (r != shard.connections.end() && r->second == connection)
+    shard.connections.erase(r);
+}
+
+
+H323ConnectionHandle H323ConnectionRegistry::Find(const PString & token) const
+{
+  if (token.IsEmpty())
+    return H323ConnectionHandle();
+
+  Shard & shard = GetShard(token);
+  PReadWaitAndSignal lock(shard.mutex);
+
+  // The reference is taken under the shard lock so Remove() followed by a
+  // zero reference count guarantees no other thread can be using it.
+  ConnectionMap::const_iterator r = shard.connections.find(token);
+  return H323ConnectionHandle(r != shard.connections.end() ? r->second : NULL);
+}
+
+
+PBoolean H323ConnectionRegistry::Contains(const PString & token) const
+{
+  Shard & shard = GetShard(token);
+  PReadWaitAndSignal lock(shard.mutex);
+  return shard.connections.find(token) != shard.connections.end();
+}
+
+
+PINDEX H323ConnectionRegistry::GetSize() const
+{
+  PINDEX size = 0;
+  for (size_t i = 0; i < shards.size(); i++) {
+    PReadWaitAndSignal lock(shards[i]->mutex);
+    size += shards[i]->connections.size();
+  }
+  return size;
+}
+
+/////////////////////////////////////////////////////////////////////////////
@@ -3208,13 +3208,84 @@ PBoolean H323CapabilitiesSet::SetSize(PINDEX newSize)
 }
 
 
+H323CapabilityPDUCache::H323CapabilityPDUCache()
+  : generation(0),
+    hits(0)
+{
+}
+
+
+unsigned H323CapabilityPDUCache::NewGeneration()
+{
+  PWaitAndSignal m(mutex);
+  if (++generation == 0)
+    generation = 1;
+  return generation;
+}
+
+
+PBoolean H323CapabilityPDUCache::Find(const PString & key, PBYTEArray & encoding, PBoolean & packetization) const
+{
+  PWaitAndSignal m(mutex);
+
+  std::map<PString, Entry>::const_iterator it = entries.find(key);
+  if (it == entries.end())
+    return FALSE;
+
+  encoding = it->second.encoding;
+  packetization = it->second.packetization;
+  hits++;
+  return TRUE;
+}
+
+
+void H323CapabilityPDUCache::Add(const PString & key, const PBYTEArray & encoding, PBoolean packetization)
+{
+  PWaitAndSignal m(mutex);
+
+  if (entries.find(key) != entries.end())
+    return;
+
+  // Entries of old versions are never found again, rather than track which
+  // those are start afresh, the ones in use are rebuilt on next use.
+  if (entries.size() >= MaxEntries)
+    entries.clear();
+
+  Entry & entry = entries[key];
+  entry.encoding = encoding;
+  entry.packetization = packetization;
+}
+
+
+PINDEX H323CapabilityPDUCache::GetSize() const
+{
+  PWaitAndSignal m(mutex);
+  return entries.size();
+}
+
+
+unsigned H323CapabilityPDUCache::GetHits() const
+{
+  PWaitAndSignal m(mutex);
+  return hits;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+
 H323Capabilities::H323Capabilities()
+  : indexValid(FALSE),
+    pduCache(NULL),
+    pduGeneration(0)
 {
 }
 
 
 H323Capabilities::H323Capabilities(const H323Connection & connection,
                                    const H245_TerminalCapabilitySet & pdu)
+  : indexValid(FALSE),
+    pduCache(NULL),
+    pduGeneration(0)
 {
   const H323Capabilities & localCapabilities = connection.GetLocalCapabilities();
 
@@ -3228,7 +3299,7 @@ H323Capabilities::H323Capabilities(const H323Connection & connection,
           H323Capability * copy = (H323Capability *)capability->Clone();
           copy->SetCapabilityNumber(capabilityNo);
           if (copy->OnReceivedPDU(pdu.m_capabilityTable[i].m_capability))
-            table.Append(copy);
+            AppendCapability(copy);
           else
             delete copy;
         }
@@ -3246,12 +3317,9 @@ H323Capabilities::H323Capabilities(const H323Connection & connection,
       for (PINDEX middle = 0; middle < middleSize; middle++) {
         H245_AlternativeCapabilitySet & alt = desc.m_simultaneousCapabilities[middle];
         for (PINDEX inner = 0; inner < alt.GetSize(); inner++) {
-          for (PINDEX cap = 0; cap < table.GetSize(); cap++) {
-            if (table[cap].GetCapabilityNumber() == alt[inner]) {
-              set[outer][middle].Append(&table[cap]);
-              break;
-            }
-          }
+          H323Capability * capability = LookupCapability(alt[inner]);
+          if (capability != NULL)
+            set[outer][middle].Append(capability);
         }
       }
     }
@@ -3260,6 +3328,9 @@ H323Capabilities::H323Capabilities(const H323Connection & connection,
 
 
 H323Capabilities::H323Capabilities(const H323Capabilities & original)
+  : indexValid(FALSE),
+    pduCache(NULL),
+    pduGeneration(0)
 {
   operator=(original);
 }
@@ -3280,10 +3351,14 @@ H323Capabilities & H323Capabilities::operator=(const H323Capabilities & original
     for (PINDEX middle = 0; middle < middleSize; middle++) {
       PINDEX innerSize = original.set[outer][middle].GetSize();
       for (PINDEX inner = 0; inner < innerSize; inner++)
-        set[outer][middle].Append(FindCapability(original.set[outer][middle][inner].GetCapabilityNumber()));
+        set[outer][middle].Append(LookupCapability(original.set[outer][middle][inner].GetCapabilityNumber()));
     }
   }
 
+  // The copy is identical so it can share encodings until either changes
+  pduCache = original.pduCache;
+  pduGeneration = original.GetPDUGeneration();
+
   return *this;
 }
 
@@ -3332,6 +3407,7 @@ PINDEX H323Capabilities::SetCapability(PINDEX descriptorNum,
 
   // Now we can put the new entry in.
   set[descriptorNum][simultaneousNum].Append(capability);
+  InvalidatePDUCache();
   return newDescriptor ? descriptorNum : simultaneousNum;
 }
 
@@ -3400,29 +3476,116 @@ PINDEX H323Capabilities::AddAllCapabilities(PINDEX descriptorNum,
 }
 
 
-static unsigned MergeCapabilityNumber(const H323CapabilitiesList & table,
-                                      unsigned newCapabilityNumber)
+unsigned H323Capabilities::MergeCapabilityNumber(unsigned newCapabilityNumber) const
 {
   // Assign a unique number to the codec, check if the user wants a specific
   // value and start with that.
   if (newCapabilityNumber == 0)
     newCapabilityNumber = 1;
 
-  PINDEX i = 0;
-  while (i < table.GetSize()) {
-    if (table[i].GetCapabilityNumber() != newCapabilityNumber)
-      i++;
-    else {
-      // If it already in use, increment it
-      newCapabilityNumber++;
-      i = 0;
-    }
-  }
+  PWaitAndSignal mutex(indexMutex);
+  CheckIndex();
+
+  // If it already in use, increment it
+  while (numberIndex.find(newCapabilityNumber) != numberIndex.end())
+    newCapabilityNumber++;
 
   return newCapabilityNumber;
 }
 
 
+void H323Capabilities::InvalidateIndex()
+{
+  PWaitAndSignal mutex(indexMutex);
+  indexValid = FALSE;
+}
+
+
+void H323Capabilities::CheckIndex() const
+{
+  // The size check catches a table appended to other than by AppendCapability()
+  if (!indexValid || nameIndex.size() != (size_t)table.GetSize())
+    BuildIndex();
+}
+
+
+void H323Capabilities::BuildIndex() const
+{
+  numberIndex.clear();
+  typeIndex.clear();
+  nameIndex.clear();
+  nameIndex.reserve(table.GetSize());
+
+  for (PINDEX i = 0; i < table.GetSize(); i++)
+    IndexCapability(i);
+
+  indexValid = TRUE;
+}
+
+
+void H323Capabilities::IndexCapability(PINDEX idx) const
+{
+  H323Capability & capability = table[idx];
+
+  // Only the first instance of a number is found, as for a linear search
+  numberIndex.insert(NumberIndex::value_type(capability.GetCapabilityNumber(), idx));
+
+  unsigned mainType = capability.GetMainType();
+  unsigned subType = capability.GetSubType();
+  typeIndex[std::make_pair(mainType, (unsigned)UINT_MAX)].push_back(idx);
+  if (subType != UINT_MAX)
+    typeIndex[std::make_pair(mainType, subType)].push_back(idx);
+
+  nameIndex.push_back(capability.GetFormatName());
+}
+
+
+H323Capability * H323Capabilities::LookupCapability(unsigned capabilityNumber) const
+{
+  PWaitAndSignal mutex(indexMutex);
+  CheckIndex();
+
+  NumberIndex::const_iterator r = numberIndex.find(capabilityNumber);
+  return r != numberIndex.end() ? &table[r->second] : NULL;
+}
+
+
+void H323Capabilities::SetPDUCache(H323CapabilityPDUCache * cache)
+{
+  pduCache = cache;
+  InvalidatePDUCache();
+}
+
+
+void H323Capabilities::InvalidatePDUCache()
+{
+  PWaitAndSignal mutex(indexMutex);
+  pduGeneration = 0;
+}
+
+
+unsigned H323Capabilities::GetPDUGeneration() const
+{
+  PWaitAndSignal mutex(indexMutex);
+  if (pduGeneration == 0 && pduCache != NULL)
+    pduGeneration = pduCache->NewGeneration();
+  return pduGeneration;
+}
+
+
+void H323Capabilities::AppendCapability(H323Capability * capability)
+{
+  table.Append(capability);
+
+  {
+    PWaitAndSignal mutex(indexMutex);
+    if (indexValid)
+      IndexCapability(table.GetSize()-1);
+  }
+  InvalidatePDUCache();
+}
+
+
 void H323Capabilities::Add(H323Capability * capability)
 {
   if (capability == NULL)
@@ -3432,8 +3595,8 @@ void H323Capabilities::Add(H323Capability * capability)
   if (table.GetObjectsIndex(capability) != P_MAX_INDEX)
     return;
 
-  capability->SetCapabilityNumber(MergeCapabilityNumber(table, capability->GetCapabilityNumber()));
-  table.Append(capability);
+  capability->SetCapabilityNumber(MergeCapabilityNumber(capability->GetCapabilityNumber()));
+  AppendCapability(capability);
 
   OpalMediaFormat::DebugOptionList(capability->GetMediaFormat());
 }
@@ -3442,8 +3605,8 @@ void H323Capabilities::Add(H323Capability * capability)
 H323Capability * H323Capabilities::Copy(const H323Capability & capability)
 {
   H323Capability * newCapability = (H323Capability *)capability.Clone();
-  newCapability->SetCapabilityNumber(MergeCapabilityNumber(table, capability.GetCapabilityNumber()));
-  table.Append(newCapability);
+  newCapability->SetCapabilityNumber(MergeCapabilityNumber(capability.GetCapabilityNumber()));
+  AppendCapability(newCapability);
 
   PTRACE(3, "H323\tAdded capability: " << *newCapability);
   return newCapability;
@@ -3503,6 +3666,9 @@ void H323Capabilities::Remove(H323Capability * capability)
      RemoveSecure(capabilityNumber);
 #endif
   table.Remove(capability);
+
+  InvalidateIndex();
+  InvalidatePDUCache();
 }
 
 
@@ -3531,6 +3697,9 @@ void H323Capabilities::RemoveAll()
 {
   table.RemoveAll();
   set.RemoveAll();
+
+  InvalidateIndex();
+  InvalidatePDUCache();
 }
 
 
@@ -3538,14 +3707,9 @@ H323Capability * H323Capabilities::FindCapability(unsigned capabilityNumber) con
 {
   PTRACE(4, "H323\tFindCapability: " << capabilityNumber);
 
-  for (PINDEX i = 0; i < table.GetSize(); i++) {
-    if (table[i].GetCapabilityNumber() == capabilityNumber) {
-      PTRACE(3, "H323\tFound capability: " << table[i]);
-      return &table[i];
-    }
-  }
-
-  return NULL;
+  H323Capability * capability = LookupCapability(capabilityNumber);
+  PTRACE_IF(3, capability != NULL, "H323\tFound capability: " << *capability);
+  return capability;
 }
 
 
@@ -3556,9 +3720,13 @@ H323Capability * H323Capabilities::FindCapability(const PString & formatName,
 
   PStringArray wildcard = formatName.Tokenise('*', FALSE);
 
+  // Partial matches must still be tried in table order, the index saves
+  // fetching and folding every format name on each search.
+  PWaitAndSignal mutex(indexMutex);
+  CheckIndex();
+
   for (PINDEX i = 0; i < table.GetSize(); i++) {
-    PCaselessString str = table[i].GetFormatName();
-    if (MatchWildcard(str, wildcard) &&
+    if (MatchWildcard(nameIndex[i], wildcard) &&
           (direction == H323Capability::e_Unknown ||
            table[i].GetCapabilityDirection() == direction)) {
       PTRACE(3, "H323\tFound capability: " << table[i]);
@@ -3837,11 +4005,17 @@ H323Capability * H323Capabilities::FindCapability(H323Capability::MainTypes main
     PTRACE(4, "H323\tFindCapability: " << mainType << " Generic " << oid);
 
     unsigned int subType = subTypePDU.GetTag();
-    for (PINDEX i = 0; i < table.GetSize(); i++) {
-        H323Capability & capability = table[i];
-        if (capability.GetMainType() == mainType &&
-            (subType == UINT_MAX || capability.GetSubType() == subType) &&
-            (capability.GetIdentifier() == oid)) {
+
+    PWaitAndSignal mutex(indexMutex);
+    CheckIndex();
+
+    TypeIndex::const_iterator r = typeIndex.find(std::make_pair((unsigned)mainType, subType));
+    if (r == typeIndex.end())
+        return NULL;
+
+    for (size_t i = 0; i < r->second.size(); i++) {
+        H323Capability & capability = table[r->second[i]];
+        if (capability.GetIdentifier() == oid) {
                 PTRACE(3, "H323\tFound capability: " << capability);
                 return &capability;
         }
@@ -3932,16 +4106,16 @@ H323Capability * H323Capabilities::FindCapability(H323Capability::MainTypes main
      PTRACE(4, "H323\tFindCapability: " << mainType << " subtype=" << subType);
   }
 
-  for (PINDEX i = 0; i < table.GetSize(); i++) {
-    H323Capability & capability = table[i];
-    if (capability.GetMainType() == mainType &&
-                        (subType == UINT_MAX || capability.GetSubType() == subType)) {
-      PTRACE(3, "H323\tFound capability: " << capability);
-      return &capability;
-    }
-  }
+  PWaitAndSignal mutex(indexMutex);
+  CheckIndex();
 
-  return NULL;
+  TypeIndex::const_iterator r = typeIndex.find(std::make_pair((unsigned)mainType, subType));
+  if (r == typeIndex.end() || r->second.empty())
+    return NULL;
+
+  H323Capability & capability = table[r->second.front()];
+  PTRACE(3, "H323\tFound capability: " << capability);
+  return &capability;
 }
 
 PBoolean H323Capabilities::RemoveCapability(H323Capability::MainTypes capabilityType)
@@ -3977,6 +4151,7 @@ PBoolean H323Capabilities::SetVideoEncoder(unsigned frameWidth, unsigned frameHe
       if (capability.GetMainType() == H323Capability::e_Video)
          capability.SetCustomEncode(frameWidth,frameHeight,frameRate);
     }
+    InvalidatePDUCache();
     return true;
 }
 
@@ -4023,6 +4198,7 @@ PBoolean H323Capabilities::SetVideoFrameSize(H323Capability::CapabilityFrameSize
         if (capability.GetMainType() == H323Capability::e_Video)
                  capability.SetMaxFrameSize(frameSize,frameUnits);
     }
+    InvalidatePDUCache();
     return TRUE;
 }
 #endif
@@ -4042,6 +4218,34 @@ void H323Capabilities::BuildPDU(const H323Connection & connection,
   H245_H2250Capability & h225_0 = pdu.m_multiplexCapability;
   PINDEX rtpPacketizationCount = 0;
 
+  PString cacheKey;
+  if (pduCache != NULL) {
+    // The encoding only depends on the version of the set and which of its
+    // capabilities the connection can use
+    cacheKey.sprintf("%u:", GetPDUGeneration());
+    for (PINDEX i = 0; i < tableSize; i++)
+      cacheKey += table[i].IsUsable(connection) ? '1' : '0';
+
+    PBYTEArray cached;
+    PBoolean packetization;
+    if (pduCache->Find(cacheKey, cached, packetization)) {
+      PPER_Stream strm(cached);
+      if (pdu.m_capabilityTable.Decode(strm) &&
+          (!packetization || h225_0.m_mediaPacketizationCapability.m_rtpPayloadType.Decode(strm)) &&
+          pdu.m_capabilityDescriptors.Decode(strm)) {
+        if (packetization)
+          h225_0.m_mediaPacketizationCapability.IncludeOptionalField(H245_MediaPacketizationCapability::e_rtpPayloadType);
+        pdu.IncludeOptionalField(H245_TerminalCapabilitySet::e_capabilityDescriptors);
+        return;
+      }
+
+      PTRACE(2, "H323\tCould not decode cached capability PDU, rebuilding");
+      pdu.m_capabilityTable.SetSize(0);
+      h225_0.m_mediaPacketizationCapability.m_rtpPayloadType.SetSize(0);
+      pdu.m_capabilityDescriptors.SetSize(0);
+    }
+  }
+
   PINDEX count = 0;
   for (PINDEX i = 0; i < tableSize; i++) {
     H323Capability & capability = table[i];
@@ -4097,6 +4301,16 @@ void H323Capabilities::BuildPDU(const H323Connection & connection,
       }
     }
   }
+
+  if (pduCache != NULL) {
+    PPER_Stream strm;
+    pdu.m_capabilityTable.Encode(strm);
+    if (rtpPacketizationCount > 0)
+      h225_0.m_mediaPacketizationCapability.m_rtpPayloadType.Encode(strm);
+    pdu.m_capabilityDescriptors.Encode(strm);
+    strm.CompleteEncoding();
+    pduCache->Add(cacheKey, strm, rtpPacketizationCount > 0);
+  }
 }
 
 
@@ -4128,6 +4342,7 @@ PBoolean H323Capabilities::Merge(const H323Capabilities & newCaps)
       }
     }
   }
+  InvalidatePDUCache();
 
   PTRACE_IF(4, !table.IsEmpty(), "H245\tCapability merge result:\n" << *this);
   PTRACE(3, "H245\tReceived capability set, is "
@@ -4178,6 +4393,9 @@ void H323Capabilities::Reorder(const PStringArray & preferenceOrder)
   }
 
   table.AllowDeleteObjects();
+
+  InvalidateIndex();
+  InvalidatePDUCache();
 }
 
 
@@ -114,6 +114,10 @@
 #include "../version.h"
 #include "h323pluginmgr.h"
 
+#ifdef H323_AUDIO_CODECS
+#include "jitter.h"
+#endif
+
 #include <ptlib/sound.h>
 #include <ptclib/random.h>
 #include <ptclib/pstun.h>
@@ -529,7 +533,7 @@ class H323ConnectionsCleaner : public PThread
   PCLASSINFO(H323ConnectionsCleaner, PThread)
 
   public:
-    H323ConnectionsCleaner(H323EndPoint & endpoint);
+    H323ConnectionsCleaner(H323EndPoint & endpoint, PSemaphore * pool = NULL);
     ~H323ConnectionsCleaner();
 
     void Signal() { wakeupFlag.Signal(); }
@@ -540,6 +544,7 @@ class H323ConnectionsCleaner : public PThread
     H323EndPoint & endpoint;
     PBoolean           stopFlag;
     PSyncPoint     wakeupFlag;
+    PSemaphore   * poolWakeup;   // Shared by the pool threads, NULL for the first cleaner
 };
 
 
@@ -625,6 +630,13 @@ void H225CallThread::Main()
         return;
       }
 #endif
+      // With the signalling reactor the channel is read by the shared
+      // reactor threads and this thread ends here.
+      if (connection.StartSignalChannelReactor(&transport)) {
+        if (transport.DetachThread(this))
+          SetAutoDelete(AutoDeleteThread);
+        return;
+      }
       connection.HandleSignallingChannel();
     }
   }
@@ -633,23 +645,36 @@ void H225CallThread::Main()
 
 /////////////////////////////////////////////////////////////////////////////
 
-H323ConnectionsCleaner::H323ConnectionsCleaner(H323EndPoint & ep)
+H323ConnectionsCleaner::H323ConnectionsCleaner(H323EndPoint & ep, PSemaphore * pool)
   : PThread(ep.GetCleanerThreadStackSize(),
             NoAutoDeleteThread,
             NormalPriority,
             "H323 Cleaner"),
-    endpoint(ep)
+    endpoint(ep),
+    poolWakeup(pool)
 {
-  Resume();
   stopFlag = FALSE;
+  Resume();
 }
 
 
 H323ConnectionsCleaner::~H323ConnectionsCleaner()
 {
   stopFlag = TRUE;
-  wakeupFlag.Signal();
-  PAssert(WaitForTermination(10000), "Cleaner thread did not terminate");
+
+  if (poolWakeup == NULL) {
+    wakeupFlag.Signal();
+    PAssert(WaitForTermination(10000), "Cleaner thread did not terminate");
+    return;
+  }
+
+  // Any idle pool thread may take the wake up, so keep posting until this
+  // one has seen its stop flag. The others just make an empty pass.
+  PINDEX tries = 0;
+  do {
+    poolWakeup->Signal();
+  } while (!WaitForTermination(10) && ++tries < 1000);
+  PAssert(tries < 1000, "Cleaner thread did not terminate");
 }
 
 
@@ -658,7 +683,11 @@ void H323ConnectionsCleaner::Main()
   PTRACE(3, "H323\tStarted cleaner thread");
 
   for (;;) {
-    wakeupFlag.Wait();
+    if (poolWakeup == NULL)
+      wakeupFlag.Wait();
+    else
+      endpoint.WaitForCleanerPoolWakeup();
+
     if (stopFlag)
       break;
 
@@ -708,7 +737,8 @@ H323EndPoint::H323EndPoint()
     callIntrusionT6(0,10),                   // Seconds
     nextH450CallIdentity(0)
 #endif
-
+    ,
+    cleanerPoolWakeup(0, INT_MAX)
 {
   PString username = PProcess::Current().GetUserName();
   if (username.IsEmpty())
@@ -727,6 +757,10 @@ H323EndPoint::H323EndPoint()
 
 #ifdef H323_VIDEO
   autoStartReceiveVideo = autoStartTransmitVideo = TRUE;
+  videoKeyFrameBurst = 0;
+  videoMaxPacingDelay = 0;
+  sharedVideoEncoding = FALSE;
+  sharedVideoKeyFrameInterval = 1000;
 
 #ifdef H323_H239
   autoStartReceiveExtVideo = autoStartTransmitExtVideo = FALSE;
@@ -842,6 +876,21 @@ H323EndPoint::H323EndPoint()
   rtpAggregator = NULL;
 #endif
 
+  mediaReactorThreads = 0;
+  mediaReactor = NULL;
+
+  signallingReactorThreads = 0;
+  signallingReactorWorkers = 4;
+  signallingReactor = NULL;
+
+#ifdef H323_AUDIO_CODECS
+  useJitterScheduler = FALSE;
+  jitterScheduler = NULL;
+
+  mediaClockThreads = 0;
+  mediaClock = NULL;
+#endif
+
   channelThreadPriority     = PThread::HighestPriority;
 
   gatekeeper = NULL;
@@ -853,6 +902,10 @@ H323EndPoint::H323EndPoint()
   secondaryConnectionsActive.DisallowDeleteObjects();
 #endif
 
+  cleanerThreads = 1;
+  cleanerPoolWakeups = 0;
+  cleanUpPeakDepth = 0;
+  cleanUpCount = 0;
   connectionsCleaner = new H323ConnectionsCleaner(*this);
 
   srand((unsigned)time(NULL)+clock());
@@ -861,6 +914,9 @@ H323EndPoint::H323EndPoint()
   SetEPCredentials(PString(),PString());
   isSecureCall = FALSE;
   m_disableMD5Authenticators = FALSE;
+#ifdef H323_H235
+  h235MediaWorkerQueue = 0;
+#endif
 
 #ifdef H323_H460
   disableH460 = false;
@@ -878,6 +934,8 @@ H323EndPoint::H323EndPoint()
 #ifdef H323_H46019M
   m_h46019Menabled = true;
   m_h46019Msend = false;
+  m_h46019MbatchSize = 1;
+  m_h46019Mreaders = 1;
 #endif
 
 #ifdef H323_H46023
@@ -980,12 +1038,29 @@ H323EndPoint::~H323EndPoint()
   // Clear any pending calls on this endpoint
   ClearAllCalls();
 
-  // Shut down the cleaner thread
+  // Shut down the cleaner threads
+  SetCleanerThreads(1);
   delete connectionsCleaner;
 
   // Clean up any connections that the cleaner thread missed
   CleanUpConnections();
 
+  // All RTP sessions are gone so the media reactor threads can be stopped
+  delete mediaReactor;
+  mediaReactor = NULL;
+
+  // Likewise all signalling channels
+  delete signallingReactor;
+  signallingReactor = NULL;
+
+#ifdef H323_AUDIO_CODECS
+  delete jitterScheduler;
+  jitterScheduler = NULL;
+
+  delete mediaClock;
+  mediaClock = NULL;
+#endif
+
 #ifdef H323_TLS
   if (m_transportContext) {
     delete m_transportContext;
@@ -1252,6 +1327,18 @@ void H323EndPoint::ReorderCapabilities(const PStringArray & preferenceOrder)
 }
 
 
+void H323EndPoint::SetCapabilityPDUCaching(PBoolean enable)
+{
+  capabilities.SetPDUCache(enable ? &capabilityPDUCache : NULL);
+}
+
+
+void H323EndPoint::SetPDUArenaDecoding(PBoolean enable)
+{
+  H323PDUArena::SetEnabled(enable);
+}
+
+
 PBoolean H323EndPoint::UseGatekeeper(const PString & address,
                                  const PString & identifier,
                                  const PString & localAddress)
@@ -1691,6 +1778,16 @@ H323EndPoint::H235MediaCipher H323EndPoint::GetH235MediaCipher()
     return static_cast<H235MediaCipher>(H235Authenticators::GetMaxCipherLength());
 }
 
+void H323EndPoint::SetH235MediaWorker(unsigned maxQueuedFrames)
+{
+    h235MediaWorkerQueue = maxQueuedFrames;
+}
+
+unsigned H323EndPoint::GetH235MediaWorker() const
+{
+    return h235MediaWorkerQueue;
+}
+
 void H323EndPoint::H235SetDiffieHellmanFiles(const PString & file)
 {
     SetEncryptionCacheFiles(file);
@@ -1963,6 +2060,8 @@ H323Connection * H323EndPoint::InternalMakeCall(const PString & trasferFromToken
       adjustedToken.sprintf("-%u", ++tieBreaker);
     } while (connectionsActive.Contains(adjustedToken));
     connectionsActive.SetAt(adjustedToken, connectionsActive.RemoveAt(newToken));
+    connectionsRegistry.Remove(newToken, connectionsActive.GetAt(adjustedToken));
+    connectionsRegistry.Add(adjustedToken, connectionsActive.GetAt(adjustedToken));
     connectionsToBeCleaned += adjustedToken;
     PTRACE(3, "H323\tOverwriting call " << newToken << ", renamed to " << adjustedToken);
   }
@@ -1974,6 +2073,8 @@ H323Connection * H323EndPoint::InternalMakeCall(const PString & trasferFromToken
     if (!adjustedToken.IsEmpty())  {
         connectionsMutex.Wait();
         connectionsActive.SetAt(newToken, connectionsActive.RemoveAt(adjustedToken));
+        connectionsRegistry.Remove(adjustedToken, connectionsActive.GetAt(newToken));
+        connectionsRegistry.Add(newToken, connectionsActive.GetAt(newToken));
         connectionsToBeCleaned -= adjustedToken;
         PTRACE(3, "H323\tOverwriting call " << adjustedToken << ", renamed to " << newToken);
         connectionsMutex.Signal();
@@ -1989,6 +2090,7 @@ H323Connection * H323EndPoint::InternalMakeCall(const PString & trasferFromToken
 
   connectionsMutex.Wait();
   connectionsActive.SetAt(newToken, connection);
+  connectionsRegistry.Add(newToken, connection);
 
   connectionsMutex.Signal();
 
@@ -2622,7 +2724,7 @@ PBoolean H323EndPoint::ClearCallSynchronous(const PString & token,
                                         H323Connection::CallEndReason reason,
                                         PSyncPoint * sync)
 {
-  if (PThread::Current() == connectionsCleaner)
+  if (IsConnectionsCleanerThread())
     sync = NULL;
 
   /*The hugely multi-threaded nature of the H323Connection objects means that
@@ -2643,6 +2745,13 @@ PBoolean H323EndPoint::ClearCallSynchronous(const PString & token,
       return FALSE;
     }
 
+    // The connection is not deleted while this thread holds a handle to it,
+    // so the wait below would never end.
+    if (sync != NULL && connection->IsHandleReferencedBy(PThread::GetCurrentThreadId())) {
+      PTRACE(1, "H323\tRefusing to clear " << token << " synchronously, caller holds a handle to it");
+      return FALSE;
+    }
+
     PTRACE(3, "H323\tClearing connection " << connection->GetCallToken()
                                            << " reason=" << reason);
 
@@ -2656,7 +2765,7 @@ PBoolean H323EndPoint::ClearCallSynchronous(const PString & token,
     connection->SetCallEndReason(reason, sync);
 
     // Signal the background threads that there is some stuff to process.
-    connectionsCleaner->Signal();
+    SignalConnectionsCleaner();
   }
 
   if (sync != NULL)
@@ -2689,7 +2798,7 @@ void H323EndPoint::ClearAllCalls(H323Connection::CallEndReason reason,
   }
 
   // Signal the background threads that there is some stuff to process.
-  connectionsCleaner->Signal();
+  SignalConnectionsCleaner();
 
   // Make sure any previous signals are removed before waiting later
   while (connectionsAreCleaned.Wait(0))
@@ -2701,6 +2810,90 @@ void H323EndPoint::ClearAllCalls(H323Connection::CallEndReason reason,
     connectionsAreCleaned.Wait();
 }
 
+void H323EndPoint::SetCleanerThreads(PINDEX threads)
+{
+  if (threads < 1)
+    threads = 1;
+
+  std::vector<H323ConnectionsCleaner *> stopping;
+
+  {
+    PWaitAndSignal wait(connectionsMutex);
+
+    cleanerThreads = threads;
+
+    while ((PINDEX)cleanerPool.size()+1 < threads)
+      cleanerPool.push_back(new H323ConnectionsCleaner(*this, &cleanerPoolWakeup));
+
+    while ((PINDEX)cleanerPool.size()+1 > threads) {
+      stopping.push_back(cleanerPool.back());
+      cleanerPool.pop_back();
+    }
+  }
+
+  // Stopped outside the lock as the threads need it to finish any
+  // connection they are currently tearing down.
+  for (size_t i = 0; i < stopping.size(); i++)
+    delete stopping[i];
+}
+
+
+void H323EndPoint::SignalConnectionsCleaner()
+{
+  // Must be called with connectionsMutex held
+  PINDEX depth = connectionsToBeCleaned.GetSize();
+  if (depth > cleanUpPeakDepth)
+    cleanUpPeakDepth = depth;
+
+  connectionsCleaner->Signal();
+
+  // Post one wake up per unclaimed connection beyond the first, up to the
+  // pool size, so whichever pool threads are idle take them.
+  PINDEX unclaimed = depth - connectionsBeingCleaned.GetSize();
+  PINDEX wanted = unclaimed > 1 ? unclaimed - 1 : 0;
+  if (wanted > (PINDEX)cleanerPool.size())
+    wanted = cleanerPool.size();
+
+  while (cleanerPoolWakeups < wanted) {
+    cleanerPoolWakeups++;
+    cleanerPoolWakeup.Signal();
+  }
+}
+
+
+void H323EndPoint::WaitForCleanerPoolWakeup()
+{
+  cleanerPoolWakeup.Wait();
+
+  PWaitAndSignal wait(connectionsMutex);
+  if (cleanerPoolWakeups > 0)
+    cleanerPoolWakeups--;
+}
+
+
+PINDEX H323EndPoint::GetCleanUpQueueDepth() const
+{
+  PWaitAndSignal wait(connectionsMutex);
+  return connectionsToBeCleaned.GetSize();
+}
+
+
+PBoolean H323EndPoint::IsConnectionsCleanerThread()
+{
+  PThread * current = PThread::Current();
+  if (current == connectionsCleaner)
+    return TRUE;
+
+  PWaitAndSignal wait(connectionsMutex);
+  for (size_t i = 0; i < cleanerPool.size(); i++) {
+    if (current == cleanerPool[i])
+      return TRUE;
+  }
+
+  return FALSE;
+}
+
+
 void H323EndPoint::CleanUpConnections()
 {
   PTRACE(3, "H323\tCleaning up connections");
@@ -2709,15 +2902,28 @@ void H323EndPoint::CleanUpConnections()
   connectionsMutex.Wait();
 
   // Continue cleaning up until no more connections to clean
-  while (connectionsToBeCleaned.GetSize() > 0) {
-    // Just get the first entry in the set of tokens to clean up.
-    PString token = connectionsToBeCleaned.GetKeyAt(0);
+  for (;;) {
+    // Get the first entry in the set of tokens to clean up that is not
+    // already being torn down by another cleaner thread.
+    PString token;
+    for (PINDEX i = 0; i < connectionsToBeCleaned.GetSize(); i++) {
+      if (!connectionsBeingCleaned.Contains(connectionsToBeCleaned.GetKeyAt(i))) {
+        token = connectionsToBeCleaned.GetKeyAt(i);
+        break;
+      }
+    }
+    if (token.IsEmpty())
+      break;
+
+    connectionsBeingCleaned += token;
     H323Connection & connection = connectionsActive[token];
 
     // Unlock the structures here so does not block other uses of ClearCall()
     // for the possibly long time it takes to CleanUpOnCallEnd().
     connectionsMutex.Signal();
 
+    PTimeInterval startTime = PTimer::Tick();
+
     // Clean up the connection, waiting for all threads to terminate
     connection.CleanUpOnCallEnd();
     connection.OnCleared();
@@ -2727,10 +2933,12 @@ void H323EndPoint::CleanUpConnections()
 
     // Remove the token from the set of connections to be cleaned up
     connectionsToBeCleaned -= token;
+    connectionsBeingCleaned -= token;
 
     // And remove the connection instance itself from the dictionary which will
     // cause its destructor to be called.
     H323Connection * connectionToDelete = connectionsActive.RemoveAt(token);
+    connectionsRegistry.Remove(token, connectionToDelete);
 
     // Unlock the structures yet again to avoid possible race conditions when
     // deleting the connection as well as the delte of a conncetion descendent
@@ -2738,20 +2946,38 @@ void H323EndPoint::CleanUpConnections()
     // lots of time.
     connectionsMutex.Signal();
 
+    // No new handles can be obtained now, wait for those still held by
+    // other threads to be released.
+    if (connectionToDelete != NULL)
+      connectionToDelete->WaitForHandleReferences();
+
     // Finally we get to delete it!
     // TODO: Clang Analysizer determines a false positive
     // Argument to 'delete' is a constant address (x), which is not memory allocated by 'new'
     delete connectionToDelete;
 
+    PTimeInterval cleanUpTime = PTimer::Tick() - startTime;
+    PTRACE(4, "H323\tCleaned up connection " << token << " in " << cleanUpTime << " seconds");
+
     // Get the lock again as we continue around the loop
     connectionsMutex.Wait();
+
+    cleanUpCount++;
+    cleanUpTotalTime += cleanUpTime;
+    if (cleanUpTime > cleanUpMaxTime)
+      cleanUpMaxTime = cleanUpTime;
   }
 
+  // Other cleaner threads may still be tearing down connections, the last
+  // one to finish signals that everything is cleaned.
+  PBoolean allCleaned = connectionsToBeCleaned.IsEmpty();
+
   // Finished with loop, unlock the connections database.
   connectionsMutex.Signal();
 
   // Signal thread that may be waiting on ClearAllCalls()
-  connectionsAreCleaned.Signal();
+  if (allCleaned)
+    connectionsAreCleaned.Signal();
 }
 
 PBoolean H323EndPoint::WillConnectionMutexBlock()
@@ -2761,6 +2987,9 @@ PBoolean H323EndPoint::WillConnectionMutexBlock()
 
 PBoolean H323EndPoint::HasConnection(const PString & token)
 {
+  if (connectionsRegistry.Contains(token))
+    return TRUE;
+
   PWaitAndSignal wait(connectionsMutex);
 
   return FindConnectionWithoutLocks(token) != NULL;
@@ -2768,6 +2997,13 @@ PBoolean H323EndPoint::HasConnection(const PString & token)
 
 H323Connection * H323EndPoint::FindConnectionWithLock(const PString & token)
 {
+  /*A connection found by call token is held by a handle while locking, so
+    it cannot be deleted and Lock() may block without connectionsMutex.
+   */
+  H323ConnectionHandle handle = connectionsRegistry.Find(token);
+  if (!handle.IsNULL())
+    return handle->Lock() ? handle.GetConnection() : NULL;
+
   PWaitAndSignal mutex(connectionsMutex);
 
   /*We have a very yucky polling loop here as a semi permanant measure.
@@ -2799,6 +3035,19 @@ H323Connection * H323EndPoint::FindConnectionWithLock(const PString & token)
 }
 
 
+H323ConnectionHandle H323EndPoint::FindConnectionHandle(const PString & token)
+{
+  H323ConnectionHandle handle = connectionsRegistry.Find(token);
+  if (!handle.IsNULL())
+    return handle;
+
+  // Call and conference identifiers are searched for under connectionsMutex,
+  // which the cleaner holds while removing a connection.
+  PWaitAndSignal wait(connectionsMutex);
+  return H323ConnectionHandle(FindConnectionWithoutLocks(token));
+}
+
+
 H323Connection * H323EndPoint::FindConnectionWithoutLocks(const PString & token)
 {
   if (token.IsEmpty())
@@ -2840,6 +3089,30 @@ PStringList H323EndPoint::GetAllConnections()
 }
 
 
+void H323EndPoint::GetMediaStatistics(RTP_MediaStatisticsList & list)
+{
+  PStringList tokens = GetAllConnections();
+  for (PINDEX i = 0; i < tokens.GetSize(); i++) {
+    H323Connection * connection = FindConnectionWithLock(tokens[i]);
+    if (connection != NULL) {
+      connection->GetMediaStatistics(list);
+      connection->Unlock();
+    }
+  }
+}
+
+
+PString H323EndPoint::GetMediaStatisticsText()
+{
+  RTP_MediaStatisticsList list;
+  GetMediaStatistics(list);
+
+  PStringStream text;
+  RTP_PrintMediaStatistics(text, list);
+  return text;
+}
+
+
 PBoolean H323EndPoint::OnIncomingCall(H323Connection & /*connection*/,
                                   const H323SignalPDU & /*setupPDU*/,
                                   H323SignalPDU & /*alertingPDU*/)
@@ -3011,6 +3284,7 @@ H323Connection * H323EndPoint::OnIncomingConnection(H323Transport * transport,
 
     connectionsMutex.Wait();
     connectionsActive.SetAt(token, connection);
+    connectionsRegistry.Add(token, connection);
     connectionsMutex.Signal();
   }
 
@@ -4798,6 +5072,65 @@ PHandleAggregator * H323EndPoint::GetRTPAggregator()
 }
 #endif
 
+RTP_MediaReactor * H323EndPoint::GetMediaReactor()
+{
+  PWaitAndSignal m(connectionsMutex);
+#ifdef H323_AUDIO_CODECS
+  // The shared jitter scheduler only reads frames the reactor has queued
+  if (mediaReactorThreads == 0 && !useJitterScheduler)
+    return NULL;
+#else
+  if (mediaReactorThreads == 0)
+    return NULL;
+#endif
+
+  if (mediaReactor == NULL)
+    mediaReactor = new RTP_MediaReactor(mediaReactorThreads, jitterThreadStackSize);
+
+  return mediaReactor;
+}
+
+H323SignalReactor * H323EndPoint::GetSignallingReactor()
+{
+  PWaitAndSignal m(connectionsMutex);
+  if (signallingReactorThreads == 0)
+    return NULL;
+
+  if (signallingReactor == NULL)
+    signallingReactor = new H323SignalReactor(signallingReactorThreads,
+                                              signallingReactorWorkers,
+                                              signallingThreadStackSize);
+
+  return signallingReactor;
+}
+
+#ifdef H323_AUDIO_CODECS
+RTP_JitterScheduler * H323EndPoint::GetJitterScheduler()
+{
+  PWaitAndSignal m(connectionsMutex);
+  if (!useJitterScheduler)
+    return NULL;
+
+  if (jitterScheduler == NULL)
+    jitterScheduler = new RTP_JitterScheduler(5, jitterThreadStackSize);
+
+  return jitterScheduler;
+}
+
+
+H323MediaClock * H323EndPoint::GetMediaClock()
+{
+  PWaitAndSignal m(connectionsMutex);
+  if (mediaClockThreads == 0)
+    return NULL;
+
+  if (mediaClock == NULL)
+    mediaClock = new H323MediaClock(mediaClockThreads, logicalThreadStackSize);
+
+  return mediaClock;
+}
+#endif
+
 #ifdef H323_SIGNAL_AGGREGATE
 PHandleAggregator * H323EndPoint::GetSignallingAggregator()
 {
@@ -45,6 +45,8 @@
 #include "h460/h460.h"
 #endif
 
+#include <new>
+
 #ifdef _MSC_VER
 #pragma warning(disable : 4100)
 #endif
@@ -644,6 +646,10 @@ static void BuildAuthenticatorPDU(PDUType & pdu, unsigned code, const H323Connec
 ///////////////////////////////////////////////////////////////////////////////
 
 H323SignalPDU::H323SignalPDU()
+  : lazyDecode(FALSE),
+    uuieDecoded(TRUE),
+    uuieTag(H225_H323_UU_PDU_h323_message_body::e_empty),
+    bodyPeeked(FALSE)
 {
 }
 
@@ -721,6 +727,7 @@ H225_Setup_UUIE & H323SignalPDU::BuildSetup(const H323Connection & connection,
 void H323SignalPDU::LoadTunneledQ931(const Q931 & q931)
 {
   SetQ931(q931);
+  uuieDecoded = TRUE;
 
   PPER_Stream strm = q931pdu.GetIE(Q931::UserUserIE);
   if (!Decode(strm)) {
@@ -1181,6 +1188,10 @@ H225_Notify_UUIE & H323SignalPDU::BuildNotify(const H323Connection & connection)
 
 void H323SignalPDU::BuildQ931()
 {
+  // Received User-User data that was never decoded is sent unchanged
+  if (KeepReceivedUUIE())
+    return;
+
   // Encode the H225 PDu into the Q931 PDU as User-User data
   PPER_Stream strm;
   Encode(strm);
@@ -1201,6 +1212,13 @@ void H323SignalPDU::PrintOn(ostream & strm) const
 }
 
 
+PBoolean H323SignalPDU::Decode(PASN_Stream & strm)
+{
+  H323PDUArenaScope arena;
+  return H225_H323_UserInformation::Decode(strm);
+}
+
+
 PBoolean H323SignalPDU::Read(H323Transport & transport)
 {
   PBYTEArray rawData;
@@ -1226,6 +1244,9 @@ PBoolean H323SignalPDU::Read(H323Transport & transport)
 
 PBoolean H323SignalPDU::ProcessReadData(H323Transport & transport, const PBYTEArray & rawData)
 {
+  uuieDecoded = TRUE;
+  bodyPeeked = FALSE;
+
   if (rawData.GetSize() < 5) {
      PTRACE(4,"H225\tSignalling Channel KeepAlive Rec'vd");
      return TRUE;
@@ -1248,6 +1269,16 @@ PBoolean H323SignalPDU::ProcessReadData(H323Transport & transport, const PBYTEAr
     return TRUE;
   }
 
+  if (lazyDecode && PeekUUIETag()) {
+    // Leave the H.225 fields empty so KeepReceivedUUIE() can tell if they
+    // are set before DecodeUUIE().
+    H225_H323_UserInformation::operator=(H225_H323_UserInformation());
+    uuieDecoded = FALSE;
+    PTRACE(4, "H225\tDeferred decode of " << q931pdu.GetMessageTypeName()
+           << " User-User IE, " << q931pdu.GetIE(Q931::UserUserIE).GetSize() << " bytes");
+    return TRUE;
+  }
+
   PPER_Stream strm = q931pdu.GetIE(Q931::UserUserIE);
   if (!Decode(strm)) {
     PTRACE(1, "H225\tRead error: PER decode failure in Q.931 User-User Information Element,"
@@ -1266,17 +1297,230 @@ PBoolean H323SignalPDU::ProcessReadData(H323Transport & transport, const PBYTEAr
 }
 
 
+PBoolean H323SignalPDU::PeekUUIETag()
+{
+  // Only the sequence preambles and the choice index are read, the body
+  // itself is left for DecodeUUIE().
+  PPER_Stream strm = q931pdu.GetIE(Q931::UserUserIE);
+  H225_H323_UserInformation uuie;
+  if (!uuie.PreambleDecode(strm) || !uuie.m_h323_uu_pdu.PreambleDecode(strm))
+    return FALSE;
+
+  const unsigned rootChoices = H225_H323_UU_PDU_h323_message_body::e_facility + 1;
+  const unsigned allChoices = H225_H323_UU_PDU_h323_message_body::e_notify + 1;
+
+  unsigned tag = UINT_MAX;
+  if (strm.SingleBitDecode()) {
+    strm.SmallUnsignedDecode(tag);
+    tag += rootChoices;
+  }
+  else
+    strm.UnsignedDecode(0, rootChoices-1, tag);
+
+  if (tag >= allChoices || strm.IsAtEnd())
+    return FALSE;
+
+  uuieTag = tag;
+  return TRUE;
+}
+
+
+PBoolean H323SignalPDU::DecodeUUIE()
+{
+  if (uuieDecoded)
+    return TRUE;
+
+  uuieDecoded = TRUE;
+
+  PPER_Stream strm = q931pdu.GetIE(Q931::UserUserIE);
+  if (bodyPeeked ? DecodePeekedUUIE(strm) : Decode(strm))
+    return TRUE;
+
+  PTRACE(1, "H225\tRead error: PER decode failure in deferred Q.931 User-User Information Element,"
+            "\nQ.931 PDU:\n  " << setprecision(2) << q931pdu <<
+            "\nPartial PDU:\n  " << setprecision(2) << *this);
+  m_h323_uu_pdu.m_h323_message_body.SetTag(H225_H323_UU_PDU_h323_message_body::e_empty);
+  return FALSE;
+}
+
+
+unsigned H323SignalPDU::GetUUIETag() const
+{
+  return uuieDecoded ? m_h323_uu_pdu.m_h323_message_body.GetTag() : uuieTag;
+}
+
+
+PBoolean H323SignalPDU::PeekMessageBody() const
+{
+  if (bodyPeeked)
+    return TRUE;
+
+  // The fields after the body in the H323-UU-PDU are not decoded, the
+  // stream is kept where the body ends for DecodePeekedUUIE().
+  H323PDUArenaScope arena;
+  peekedStrm = q931pdu.GetIE(Q931::UserUserIE);
+  H225_H323_UserInformation uuie;
+  bodyPeeked = uuie.PreambleDecode(peekedStrm) &&
+               uuie.m_h323_uu_pdu.PreambleDecode(peekedStrm) &&
+               peekedBody.Decode(peekedStrm);
+  return bodyPeeked;
+}
+
+
+PBoolean H323SignalPDU::DecodePeekedUUIE(PPER_Stream & strm)
+{
+  // As H225_H323_UserInformation::Decode(), but the body comes from the
+  // peek and the fields after it are decoded from where the peek stopped.
+  H323PDUArenaScope arena;
+  if (!PreambleDecode(strm) || !m_h323_uu_pdu.PreambleDecode(strm))
+    return FALSE;
+
+  H225_H323_UU_PDU & pdu = m_h323_uu_pdu;
+  pdu.m_h323_message_body = peekedBody;
+  peekedBody.SetTag(H225_H323_UU_PDU_h323_message_body::e_empty);
+  bodyPeeked = FALSE;
+
+  PPER_Stream & rest = peekedStrm;
+  return (!pdu.HasOptionalField(H225_H323_UU_PDU::e_nonStandardData) || pdu.m_nonStandardData.Decode(rest)) &&
+         pdu.KnownExtensionDecode(rest, H225_H323_UU_PDU::e_h4501SupplementaryService, pdu.m_h4501SupplementaryService) &&
+         pdu.KnownExtensionDecode(rest, H225_H323_UU_PDU::e_h245Tunneling, pdu.m_h245Tunneling) &&
+         pdu.KnownExtensionDecode(rest, H225_H323_UU_PDU::e_h245Control, pdu.m_h245Control) &&
+         pdu.KnownExtensionDecode(rest, H225_H323_UU_PDU::e_nonStandardControl, pdu.m_nonStandardControl) &&
+         pdu.KnownExtensionDecode(rest, H225_H323_UU_PDU::e_callLinkage, pdu.m_callLinkage) &&
+         pdu.KnownExtensionDecode(rest, H225_H323_UU_PDU::e_tunnelledSignallingMessage, pdu.m_tunnelledSignallingMessage) &&
+         pdu.KnownExtensionDecode(rest, H225_H323_UU_PDU::e_provisionalRespToH245Tunneling, pdu.m_provisionalRespToH245Tunneling) &&
+         pdu.KnownExtensionDecode(rest, H225_H323_UU_PDU::e_stimulusControl, pdu.m_stimulusControl) &&
+         pdu.KnownExtensionDecode(rest, H225_H323_UU_PDU::e_genericData, pdu.m_genericData) &&
+         pdu.UnknownExtensionsDecode(rest) &&
+         (!HasOptionalField(e_user_data) || m_user_data.Decode(rest)) &&
+         UnknownExtensionsDecode(rest);
+}
+
+
+PBoolean H323SignalPDU::KeepReceivedUUIE() const
+{
+  if (uuieDecoded || !q931pdu.HasIE(Q931::UserUserIE))
+    return FALSE;
+
+  // A lazy read leaves the H.225 fields empty, anything set since without
+  // calling DecodeUUIE() first would be lost with the received IE.
+  H225_H323_UserInformation empty;
+  PAssert(Compare(empty) == EqualTo, "H.225 fields set in lazily decoded PDU before DecodeUUIE()");
+  return TRUE;
+}
+
+
+template <class UUIE>
+static PBoolean GetOptionalCallIdentifier(const H225_H323_UU_PDU_h323_message_body & body,
+                                          H225_CallIdentifier & callIdentifier)
+{
+  const UUIE & uuie = body;
+  if (!uuie.HasOptionalField(UUIE::e_callIdentifier))
+    return FALSE;
+  callIdentifier = uuie.m_callIdentifier;
+  return TRUE;
+}
+
+
+template <class UUIE>
+static PBoolean GetCallIdentifier(const H225_H323_UU_PDU_h323_message_body & body,
+                                  H225_CallIdentifier & callIdentifier)
+{
+  const UUIE & uuie = body;
+  callIdentifier = uuie.m_callIdentifier;
+  return TRUE;
+}
+
+
+static PBoolean GetBodyCallIdentifier(const H225_H323_UU_PDU_h323_message_body & body,
+                                      H225_CallIdentifier & callIdentifier)
+{
+  switch (body.GetTag()) {
+    case H225_H323_UU_PDU_h323_message_body::e_setup :
+      return GetOptionalCallIdentifier<H225_Setup_UUIE>(body, callIdentifier);
+    case H225_H323_UU_PDU_h323_message_body::e_callProceeding :
+      return GetOptionalCallIdentifier<H225_CallProceeding_UUIE>(body, callIdentifier);
+    case H225_H323_UU_PDU_h323_message_body::e_connect :
+      return GetOptionalCallIdentifier<H225_Connect_UUIE>(body, callIdentifier);
+    case H225_H323_UU_PDU_h323_message_body::e_alerting :
+      return GetOptionalCallIdentifier<H225_Alerting_UUIE>(body, callIdentifier);
+    case H225_H323_UU_PDU_h323_message_body::e_information :
+      return GetOptionalCallIdentifier<H225_Information_UUIE>(body, callIdentifier);
+    case H225_H323_UU_PDU_h323_message_body::e_releaseComplete :
+      return GetOptionalCallIdentifier<H225_ReleaseComplete_UUIE>(body, callIdentifier);
+    case H225_H323_UU_PDU_h323_message_body::e_facility :
+      return GetOptionalCallIdentifier<H225_Facility_UUIE>(body, callIdentifier);
+    case H225_H323_UU_PDU_h323_message_body::e_progress :
+      return GetCallIdentifier<H225_Progress_UUIE>(body, callIdentifier);
+    case H225_H323_UU_PDU_h323_message_body::e_status :
+      return GetCallIdentifier<H225_Status_UUIE>(body, callIdentifier);
+    case H225_H323_UU_PDU_h323_message_body::e_statusInquiry :
+      return GetCallIdentifier<H225_StatusInquiry_UUIE>(body, callIdentifier);
+    case H225_H323_UU_PDU_h323_message_body::e_setupAcknowledge :
+      return GetCallIdentifier<H225_SetupAcknowledge_UUIE>(body, callIdentifier);
+    case H225_H323_UU_PDU_h323_message_body::e_notify :
+      return GetCallIdentifier<H225_Notify_UUIE>(body, callIdentifier);
+    default :
+      return FALSE;
+  }
+}
+
+
+static PBoolean GetBodyConferenceID(const H225_H323_UU_PDU_h323_message_body & body,
+                                    H225_ConferenceIdentifier & conferenceID)
+{
+  switch (body.GetTag()) {
+    case H225_H323_UU_PDU_h323_message_body::e_setup :
+      conferenceID = ((const H225_Setup_UUIE &)body).m_conferenceID;
+      return TRUE;
+    case H225_H323_UU_PDU_h323_message_body::e_connect :
+      conferenceID = ((const H225_Connect_UUIE &)body).m_conferenceID;
+      return TRUE;
+    case H225_H323_UU_PDU_h323_message_body::e_facility :
+    {
+      const H225_Facility_UUIE & facility = body;
+      if (!facility.HasOptionalField(H225_Facility_UUIE::e_conferenceID))
+        return FALSE;
+      conferenceID = facility.m_conferenceID;
+      return TRUE;
+    }
+    default :
+      return FALSE;
+  }
+}
+
+
+PBoolean H323SignalPDU::PeekCallIdentifier(H225_CallIdentifier & callIdentifier) const
+{
+  if (uuieDecoded)
+    return GetBodyCallIdentifier(m_h323_uu_pdu.m_h323_message_body, callIdentifier);
+
+  return PeekMessageBody() && GetBodyCallIdentifier(peekedBody, callIdentifier);
+}
+
+
+PBoolean H323SignalPDU::PeekConferenceID(H225_ConferenceIdentifier & conferenceID) const
+{
+  if (uuieDecoded)
+    return GetBodyConferenceID(m_h323_uu_pdu.m_h323_message_body, conferenceID);
+
+  return PeekMessageBody() && GetBodyConferenceID(peekedBody, conferenceID);
+}
+
+
 PBoolean H323SignalPDU::Write(H323Transport & transport, H323Connection * connection)
 {
   if (!q931pdu.HasIE(Q931::UserUserIE) && m_h323_uu_pdu.m_h323_message_body.IsValid())
     BuildQ931();
+  else
+    KeepReceivedUUIE();   // Check a lazily decoded PDU was not changed
 
   PBYTEArray rawData;
   if (!q931pdu.Encode(rawData))
     return FALSE;
 
   if (connection != NULL) {
-      int tag = m_h323_uu_pdu.m_h323_message_body.GetTag();
+      int tag = GetUUIETag();
       connection->OnAuthenticationFinalise(tag,rawData);
   }
 
@@ -1575,6 +1819,13 @@ void H323SignalPDU::SetQ931Fields(const H323Connection & connection,
 
 /////////////////////////////////////////////////////////////////////////////
 
+PBoolean H323ControlPDU::Decode(PASN_Stream & strm)
+{
+  H323PDUArenaScope arena;
+  return H245_MultimediaSystemControlMessage::Decode(strm);
+}
+
+
 H245_RequestMessage & H323ControlPDU::Build(H245_RequestMessage::Choices request)
 {
   SetTag(e_request);
@@ -1946,6 +2197,13 @@ PObject * H323RasPDU::Clone() const
 }
 
 
+PBoolean H323RasPDU::Decode(PASN_Stream & strm)
+{
+  H323PDUArenaScope arena;
+  return H225_RasMessage::Decode(strm);
+}
+
+
 PASN_Object & H323RasPDU::GetPDU()
 {
   return *this;
@@ -2391,6 +2649,150 @@ H225_ServiceControlResponse & H323RasPDU::BuildServiceControlResponse(unsigned s
   return scr;
 }
 
+
+/////////////////////////////////////////////////////////////////////////////
+
+#undef new
+
+#if defined(_MSC_VER)
+static __declspec(thread) H323PDUArena * CurrentPDUArena = NULL;
+#else
+static __thread H323PDUArena * CurrentPDUArena = NULL;
+#endif
+
+// Each allocation is preceded by the owning arena (NULL for the heap),
+// padded to keep the object suitably aligned.
+union H323PDUArenaHeader {
+  H323PDUArena * arena;
+  double         align1;
+  void         * align2[2];
+};
+
+PBoolean H323PDUArena::enabled = FALSE;
+
+
+H323PDUArena::H323PDUArena(PINDEX size)
+  : blockSize(size),
+    blocks(NULL),
+    current(NULL),
+    remaining(0),
+    references(1)
+{
+}
+
+
+H323PDUArena::~H323PDUArena()
+{
+  while (blocks != NULL) {
+    BYTE * next = *(BYTE **)blocks;
+    ::operator delete(blocks);
+    blocks = next;
+  }
+}
+
+
+void * H323PDUArena::Carve(size_t size)
+{
+  size = (size + sizeof(H323PDUArenaHeader) - 1) & ~(sizeof(H323PDUArenaHeader) - 1);
+
+  if (size > remaining) {
+    // First slot of every block links to the previous block
+    size_t needed = size + sizeof(H323PDUArenaHeader);
+    size_t allocSize = needed > (size_t)blockSize ? needed : (size_t)blockSize;
+    BYTE * block = (BYTE *)::operator new(allocSize, std::nothrow);
+    if (block == NULL)
+      return NULL;
+    *(BYTE **)block = blocks;
+    blocks = block;
+    current = block + sizeof(H323PDUArenaHeader);
+    remaining = allocSize - sizeof(H323PDUArenaHeader);
+  }
+
+  void * ptr = current;
+  current += size;
+  remaining -= size;
+  return ptr;
+}
+
+
+void H323PDUArena::RemoveReference()
+{
+  if (--references == 0)
+    delete this;
+}
+
+
+void * H323PDUArena::Allocate(size_t size)
+{
+  H323PDUArena * arena = CurrentPDUArena;
+  size += sizeof(H323PDUArenaHeader);
+
+  H323PDUArenaHeader * header;
+  if (arena != NULL && (header = (H323PDUArenaHeader *)arena->Carve(size)) != NULL)
+    arena->AddReference();
+  else {
+    header = (H323PDUArenaHeader *)::operator new(size);
+    arena = NULL;
+  }
+
+  header->arena = arena;
+  return header + 1;
+}
+
+
+void H323PDUArena::Deallocate(void * ptr)
+{
+  if (ptr == NULL)
+    return;
+
+  H323PDUArenaHeader * header = ((H323PDUArenaHeader *)ptr) - 1;
+  if (header->arena != NULL)
+    header->arena->RemoveReference();
+  else
+    ::operator delete(header);
+}
+
+
+void H323PDUArena::SetEnabled(PBoolean enable)
+{
+  PTRACE(4, "H323\tArena decoding of PDUs " << (enable ? "enabled" : "disabled"));
+  enabled = enable;
+}
+
+
+PBoolean H323PDUArena::IsEnabled()
+{
+  return enabled;
+}
+
+
+H323PDUArena * H323PDUArena::GetCurrent()
+{
+  return CurrentPDUArena;
+}
+
+
+H323PDUArenaScope::H323PDUArenaScope(PINDEX blockSize)
+  : arena(NULL)
+{
+  if (!H323PDUArena::enabled || CurrentPDUArena != NULL)
+    return;
+
+  arena = new H323PDUArena(blockSize);
+  CurrentPDUArena = arena;
+}
+
+
+H323PDUArenaScope::~H323PDUArenaScope()
+{
+  if (arena == NULL)
+    return;
+
+  // Objects still alive from the message keep the arena until they go
+  CurrentPDUArena = NULL;
+  arena->RemoveReference();
+}
+
 #ifdef _MSC_VER
 #pragma warning(default : 4100)
 #endif
@@ -197,13 +197,6 @@ class OpalPluginCodec : public OpalFactoryCodec {
 
 #ifdef H323_AUDIO_CODECS
 
-extern "C" {
-  unsigned char linear2ulaw(int pcm_val);
-  int ulaw2linear(unsigned char u_val);
-  unsigned char linear2alaw(int pcm_val);
-  int alaw2linear(unsigned char u_val);
-};
-
 #define DECLARE_FIXED_CODEC(name, format, bps, frameTime, samples, bytes, fpp, maxfpp, payload, sdp) \
 class name##_Base : public OpalFactoryCodec { \
   PCLASSINFO(name##_Base, OpalFactoryCodec) \
@@ -260,8 +253,7 @@ int OpalG711ALaw64k_Encoder::Encode(const void * _from, unsigned * fromLen, void
   unsigned count = *fromLen / 2;
   *toLen         = count;
 
-  while (count-- > 0)
-    *to++ = linear2alaw(*from++);
+  H323G711ALawEncode(from, to, count);
 
   return 1;
 }
@@ -277,8 +269,7 @@ int OpalG711ALaw64k_Decoder::Encode(const void * _from, unsigned * fromLen, void
   unsigned count = *fromLen;
   *toLen         = count * 2;
 
-  while (count-- > 0)
-    *to++ = (short)alaw2linear(*from++);
+  H323G711ALawDecode(from, to, count);
 
   return 1;
 }
@@ -296,8 +287,7 @@ int OpalG711ALaw64k20_Encoder::Encode(const void * _from, unsigned * fromLen, vo
   unsigned count = *fromLen / 2;
   *toLen         = count;
 
-  while (count-- > 0)
-    *to++ = linear2alaw(*from++);
+  H323G711ALawEncode(from, to, count);
 
   return 1;
 }
@@ -313,8 +303,7 @@ int OpalG711ALaw64k20_Decoder::Encode(const void * _from, unsigned * fromLen, vo
   unsigned count = *fromLen;
   *toLen         = count * 2;
 
-  while (count-- > 0)
-    *to++ = (short)alaw2linear(*from++);
+  H323G711ALawDecode(from, to, count);
 
   return 1;
 }
@@ -332,8 +321,7 @@ int OpalG711uLaw64k_Encoder::Encode(const void * _from, unsigned * fromLen, void
   unsigned count = *fromLen / 2;
   *toLen         = count;
 
-  while (count-- > 0)
-    *to++ = linear2ulaw(*from++);
+  H323G711uLawEncode(from, to, count);
 
   return 1;
 }
@@ -349,8 +337,7 @@ int OpalG711uLaw64k_Decoder::Encode(const void * _from, unsigned * fromLen, void
   unsigned count = *fromLen;
   *toLen         = count * 2;
 
-  while (count-- > 0)
-    *to++ = (short)ulaw2linear(*from++);
+  H323G711uLawDecode(from, to, count);
 
   return 1;
 }
@@ -368,8 +355,7 @@ int OpalG711uLaw64k20_Encoder::Encode(const void * _from, unsigned * fromLen, vo
   unsigned count = *fromLen / 2;
   *toLen         = count;
 
-  while (count-- > 0)
-    *to++ = linear2ulaw(*from++);
+  H323G711uLawEncode(from, to, count);
 
   return 1;
 }
@@ -385,8 +371,7 @@ int OpalG711uLaw64k20_Decoder::Encode(const void * _from, unsigned * fromLen, vo
   unsigned count = *fromLen;
   *toLen         = count * 2;
 
-  while (count-- > 0)
-    *to++ = (short)ulaw2linear(*from++);
+  H323G711uLawDecode(from, to, count);
 
   return 1;
 }
@@ -1124,14 +1109,13 @@ class H323PluginFramedAudioCodec : public H323FramedAudioCodec
     H323PluginFramedAudioCodec(const OpalMediaFormat & fmtName, Direction direction, PluginCodec_Definition * _codec)
       : H323FramedAudioCodec(fmtName, direction), codec(_codec)
     {
-      if (codec && codec->createCodec) {
-         context = (*codec->createCodec)(codec);
+      context = H323PluginCodecManager::AcquireContext(codec);
+      if (codec && codec->createCodec)
          UpdatePluginOptions(codec,context,GetWritableMediaFormat());
-      } else context = NULL;
     }
 
     ~H323PluginFramedAudioCodec()
-    { if (codec != NULL && codec->destroyCodec != NULL) (*codec->destroyCodec)(codec, context); }
+    { H323PluginCodecManager::ReleaseContext(codec, context); }
 
     PBoolean EncodeFrame(
       BYTE * buffer,        /// Buffer into which encoded bytes are placed
@@ -1211,10 +1195,10 @@ class H323StreamedPluginAudioCodec : public H323StreamedAudioCodec
       PluginCodec_Definition * _codec
     )
       : H323StreamedAudioCodec(fmtName, direction, samplesPerFrame, bits), codec(_codec)
-    { if (codec != NULL && codec->createCodec != NULL) context = (*codec->createCodec)(codec); else context = NULL; }
+    { context = H323PluginCodecManager::AcquireContext(codec); }
 
     ~H323StreamedPluginAudioCodec()
-    { if (codec != NULL && codec->destroyCodec != NULL) (*codec->destroyCodec)(codec, context); }
+    { H323PluginCodecManager::ReleaseContext(codec, context); }
 
     int Encode(short sample) const
     {
@@ -1328,6 +1312,74 @@ protected:
 
 #ifdef H323_VIDEO
 
+class H323PluginVideoCodec;
+
+/* An encoded video frame shared by the subscribers of an encoder group.
+   Packets are reference counted PTLib arrays, each subscriber copies them
+   into its own RTP frame as the sequence numbers and SSRC differ. */
+struct H323PluginSharedVideoFrame
+{
+    H323PluginSharedVideoFrame(unsigned seq)
+      : sequence(seq), keyFrame(false), references(1) { }
+
+    unsigned                   sequence;
+    bool                       keyFrame;
+    std::vector<RTP_DataFrame> packets;
+    PAtomicInteger             references;
+};
+
+/* One encoder shared by transmit video channels whose negotiated media
+   formats are identical, see H323EndPoint::SetSharedVideoEncoding(). The
+   first subscriber to want a frame that has not been encoded yet grabs it
+   from its own video channel and encodes it while the others wait, then
+   they all send the same packets. Key frame requests from any subscriber
+   are merged and forced no more often than the key frame interval. */
+class H323PluginVideoEncoderGroup
+{
+  public:
+    static void Join(H323PluginVideoCodec & codec, const PString & sourceGroup, unsigned keyFrameInterval);
+    static void Leave(H323PluginVideoCodec & codec);
+    static PBoolean RequestKeyFrame(H323PluginVideoCodec & codec);
+
+    PBoolean Read(H323PluginVideoCodec & subscriber, unsigned & length, RTP_DataFrame & dst);
+
+  protected:
+    H323PluginVideoEncoderGroup(const PString & key, PluginCodec_Definition * codec,
+                                const OpalMediaFormat & mediaFormat, unsigned keyFrameInterval);
+    ~H323PluginVideoEncoderGroup();
+
+    PBoolean Encode(H323PluginVideoCodec & leader, PBoolean forceKeyFrame, H323PluginSharedVideoFrame * & frame);
+    static void Release(H323PluginSharedVideoFrame * frame);
+
+    typedef std::map<PString, H323PluginVideoEncoderGroup *> GroupMap;
+    static GroupMap & GetGroups();
+    static PMutex & GetGroupsMutex();
+
+    enum { MaxPacketsPerFrame = 1000 };
+
+    PString                      key;
+    PluginCodec_Definition     * codec;
+    void                       * context;
+    OpalMediaFormat              mediaFormat;
+    int                          frameWidth;
+    int                          frameHeight;
+    unsigned                     keyFrameInterval;
+    PINDEX                       subscribers;     // Protected by the groups mutex
+    PINDEX                       maxSubscribers;
+
+    PMutex                       mutex;
+    PSemaphore                   frameReady;
+    PINDEX                       waiting;
+    PBoolean                     encoding;
+    H323PluginSharedVideoFrame * current;
+    unsigned                     sequence;
+    PBoolean                     keyFrameRequested;
+    PInt64                       lastKeyFrameTick;
+    unsigned                     framesEncoded;
+    unsigned                     keyFramesMerged;
+};
+
+
 class H323PluginVideoCodec : public H323VideoCodec
 {
   PCLASSINFO(H323PluginVideoCodec, H323VideoCodec);
@@ -1413,13 +1465,13 @@ class H323PluginVideoCodec : public H323VideoCodec
     void SetVideoMode(int mode);
 
     // The following require implementation in the plugin codec
-    virtual void OnFastUpdatePicture() {
-      EventCodecControl(codec, context, "on_fast_update", "");
-      sendIntra = true;
-    }
+    virtual void OnFastUpdatePicture();
 
     virtual void OnFlowControl(long bitRateRestriction);
 
+    virtual PBoolean IsKeyFrame() const
+    { return lastKeyFrame; }
+
     virtual PBoolean SetSupportedFormats(std::list<PVideoFrameInfo> & info);
 
     virtual void OnLostPartialPicture()
@@ -1429,6 +1481,11 @@ class H323PluginVideoCodec : public H323VideoCodec
     { EventCodecControl(codec, context, "on_lost_picture", ""); }
 
   protected:
+    /* Grab the next frame from the video channel into bufferRTP. Returns
+       FALSE if transmission should stop, grabbed is FALSE if the grabber
+       had nothing this time. */
+    PBoolean GrabFrame(PBoolean & grabbed);
+
     void *       context;
     PluginCodec_Definition * codec;
     int          bufferSize;
@@ -1443,6 +1500,7 @@ class H323PluginVideoCodec : public H323VideoCodec
     long         flowRequest;
     PBoolean     lastPacketSent;
     bool         sendIntra;
+    bool         lastKeyFrame;
 
     PInt64  lastFrameTick;
     PInt64  nowFrameTick;
@@ -1459,6 +1517,14 @@ class H323PluginVideoCodec : public H323VideoCodec
 #ifdef H323_FRAMEBUFFER
     H323PluginFrameBuffer  m_frameBuffer;
 #endif
+
+    // Shared encoder, if any
+    H323PluginVideoEncoderGroup * encoderGroup;
+    H323PluginSharedVideoFrame  * sharedFrame;
+    size_t                        sharedPacket;
+    unsigned                      sharedSequence;
+
+  friend class H323PluginVideoEncoderGroup;
 };
 
 static bool SetFlowControl(const PluginCodec_Definition * codec, void * context, OpalMediaFormat & mediaFormat, long bitRate)
@@ -1598,13 +1664,13 @@ H323PluginVideoCodec::H323PluginVideoCodec(const OpalMediaFormat & fmt, Directio
       bufferSize(sizeof(PluginCodec_Video_FrameHeader) + (PLUGIN_MAX_WIDTH * PLUGIN_MAX_HEIGHT * 3)/2 + PLUGIN_RTP_HEADER_SIZE), bufferRTP(bufferSize-PLUGIN_RTP_HEADER_SIZE, TRUE),
       maxWidth(fmt.GetOptionInteger(OpalVideoFormat::FrameWidthOption)), maxHeight(fmt.GetOptionInteger(OpalVideoFormat::FrameHeightOption)),
       bytesPerFrame((maxHeight * maxWidth * 3)/2), lastFrameTimeRTP(0), targetFrameTimeMs(fmt.GetOptionInteger(OpalVideoFormat::FrameTimeOption)),
-      flowRequest(0), lastPacketSent(true), sendIntra(true), lastFrameTick(0), nowFrameTick(0), lastFUPTick(0), nowFUPTick(0), outputDataSize(MAX_MTU_SIZE),
-      fromLen(0), toLen(0), flags(0), pluginRetVal(0)
+      flowRequest(0), lastPacketSent(true), sendIntra(true), lastKeyFrame(false), lastFrameTick(0), nowFrameTick(0), lastFUPTick(0), nowFUPTick(0), outputDataSize(MAX_MTU_SIZE),
+      fromLen(0), toLen(0), flags(0), pluginRetVal(0),
+      encoderGroup(NULL), sharedFrame(NULL), sharedPacket(0), sharedSequence(0)
 {
-    if (codec && codec->createCodec) {
-        context = (*codec->createCodec)(codec);
+    context = H323PluginCodecManager::AcquireContext(codec);
+    if (codec && codec->createCodec)
         UpdatePluginOptions(codec,context,GetWritableMediaFormat());
-    } else context = NULL;
 
     if (cap) {
         OpalMediaFormat & capFmt = PRemoveConst(H323Capability, cap)->GetWritableMediaFormat();
@@ -1624,6 +1690,8 @@ H323PluginVideoCodec::~H323PluginVideoCodec()
 {
     //PWaitAndSignal mutex(videoHandlerActive);
 
+    H323PluginVideoEncoderGroup::Leave(*this);
+
 #ifdef H323_FRAMEBUFFER
     m_frameBuffer.Terminate();
     m_frameBuffer.WaitForTermination();
@@ -1632,8 +1700,7 @@ H323PluginVideoCodec::~H323PluginVideoCodec()
     // memory leak
     bufferRTP.SetSize(0);
 
-    if (codec != NULL && codec->destroyCodec != NULL)
-        (*codec->destroyCodec)(codec, context);
+    H323PluginCodecManager::ReleaseContext(codec, context);
 }
 
 PBoolean H323PluginVideoCodec::SetMaxBitRate(unsigned bitRate)
@@ -1745,10 +1812,8 @@ PBoolean H323PluginVideoCodec::Read(BYTE * /*buffer*/, unsigned & length, RTP_Da
         return FALSE;
     }
 
-    PVideoChannel *videoIn = (PVideoChannel *)rawDataChannel;
-
-
 #ifdef H323_MEDIAENCODED
+    PVideoChannel *videoIn = (PVideoChannel *)rawDataChannel;
     if (videoIn->SourceEncoded(lastPacketSent,length)) {
         int maxDataSize = 1518-14-4-8-20-16; // Max Ethernet packet (1518 bytes) minus 802.3/CRC, 802.3, IP, UDP headers
         dst.SetMinSize(maxDataSize);
@@ -1761,74 +1826,27 @@ PBoolean H323PluginVideoCodec::Read(BYTE * /*buffer*/, unsigned & length, RTP_Da
     }
 #endif
 
-    PluginCodec_Video_FrameHeader * frameHeader = (PluginCodec_Video_FrameHeader *)bufferRTP.GetPayloadPtr();
-    if (!frameHeader) {
-        PTRACE(1,"PLUGIN\tCould not locate frame header, close down video transmission thread");
-        return false;
-    }
-
-    frameHeader->x = 0;
-    frameHeader->y = 0;
-    frameHeader->width        = videoIn->GetGrabWidth();
-    frameHeader->height       = videoIn->GetGrabHeight();
+    if (encoderGroup != NULL) {
+        // Flow control needs an encoder of our own, change over between frames
+        if (flowRequest == 0 || sharedFrame != NULL)
+            return encoderGroup->Read(*this, length, dst);
 
-    if (frameHeader->width == 0 || frameHeader->height == 0) {
-        PTRACE(1,"PLUGIN\tVideo grab dimension is 0, close down video transmission thread");
-        return false;
+        PTRACE(3, "PLUGIN\tLeaving shared encoder to apply flow control " << flowRequest);
+        H323PluginVideoEncoderGroup::Leave(*this);
+        sendIntra = true;
+        lastPacketSent = true;
     }
 
-
     if (lastPacketSent) {
-        videoIn->RestrictAccess();
-
-        if (!videoIn->IsGrabberOpen()) {
-            PTRACE(1, "PLUGIN\tVideo grabber is not initialised, close down video transmission thread");
-            videoIn->EnableAccess();
-            return FALSE;
-        }
-
-#if PTLIB_VER >= 290
-        if (flowRequest && lastFrameTimeRTP) {
-            PStringArray options;
-            if (videoIn->FlowControl((void *)&options)    // test if implemented with empty options
-                && SetFlowControl(codec,context,mediaFormat, flowRequest)) {
-                PTRACE(4, "PLUGIN\tApplying Flow Control " << flowRequest);
-                options = LoadInputDeviceOptions(mediaFormat);
-                if (videoIn->FlowControl((void *)&options)) {
-                    frameHeader->width  = videoIn->GetGrabWidth();
-                    frameHeader->height = videoIn->GetGrabHeight();
-                    sendIntra = true;  // Send a FPU when setting flow control.
-                }
-            } else if (videoIn->GetVideoReader() && videoIn->GetVideoReader()->GetCaptureMode() == 0) {
-                    frameHeader->width  = videoIn->GetGrabWidth();
-                    frameHeader->height = videoIn->GetGrabHeight();
-            }
-            flowRequest = 0;
-        }
-#endif
-
-        if (!SetFrameSize(frameHeader->width, frameHeader->height)) {
-            PTRACE(1, "PLUGIN\tFailed to resize, close down video transmission thread");
-            videoIn->EnableAccess();
+        PBoolean grabbed;
+        if (!GrabFrame(grabbed))
             return FALSE;
-        }
 
-        unsigned char * data = OPAL_VIDEO_FRAME_DATA_PTR(frameHeader);
-        if (!rawDataChannel->Read(data, bytesPerFrame)) {
-            PTRACE(3, "PLUGIN\tFailed to read data from video grabber");
-            videoIn->EnableAccess();
+        if (!grabbed) {
             length=0;
             dst.SetPayloadSize(0);
             return TRUE; // and hope the error condition will fix itself
         }
-
-        videoIn->EnableAccess();
-
-        RenderFrame(data, NULL);
-
-        nowFrameTick = PTimer::Tick().GetMilliSeconds();
-        lastFrameTimeRTP = (nowFrameTick - lastFrameTick)*90;
-        lastFrameTick = nowFrameTick;
     }
     else
         lastFrameTimeRTP = 0;
@@ -1846,10 +1864,13 @@ PBoolean H323PluginVideoCodec::Read(BYTE * /*buffer*/, unsigned & length, RTP_Da
     toLen = outputDataSize;
     flags = sendIntra ? PluginCodec_CoderForceIFrame : 0;
 
+    PInt64 start = mediaStatistics != NULL ? RTP_MediaStatistics::GetTime() : 0;
     pluginRetVal = (codec->codecFunction)(codec, context,
                                         bufferRTP.GetPointer(), &fromLen,
                                         dst.GetPointer(), &toLen,
                                         &flags);
+    if (mediaStatistics != NULL)
+      (*mediaStatistics)[RTP_MediaStatistics::EncodeTime].Record(RTP_MediaStatistics::GetTime() - start);
 
     if (pluginRetVal == 0) {
         PTRACE(3,"PLUGIN\tError encoding frame from plugin " << codec->descr);
@@ -1857,7 +1878,8 @@ PBoolean H323PluginVideoCodec::Read(BYTE * /*buffer*/, unsigned & length, RTP_Da
         return FALSE;
     }
 
-    if ((flags & PluginCodec_ReturnCoderIFrame) != 0) {
+    lastKeyFrame = (flags & PluginCodec_ReturnCoderIFrame) != 0;
+    if (lastKeyFrame) {
         PTRACE(sendIntra ? 3 : 5,"PLUGIN\tSent I-Frame" << (sendIntra ? ", in response to VideoFastUpdate" : ""));
         sendIntra = false;
     }
@@ -1872,12 +1894,101 @@ PBoolean H323PluginVideoCodec::Read(BYTE * /*buffer*/, unsigned & length, RTP_Da
     return TRUE;
 }
 
+PBoolean H323PluginVideoCodec::GrabFrame(PBoolean & grabbed)
+{
+    grabbed = FALSE;
+
+    PVideoChannel *videoIn = (PVideoChannel *)rawDataChannel;
+
+    PluginCodec_Video_FrameHeader * frameHeader = (PluginCodec_Video_FrameHeader *)bufferRTP.GetPayloadPtr();
+    if (!frameHeader) {
+        PTRACE(1,"PLUGIN\tCould not locate frame header, close down video transmission thread");
+        return false;
+    }
+
+    frameHeader->x = 0;
+    frameHeader->y = 0;
+    frameHeader->width        = videoIn->GetGrabWidth();
+    frameHeader->height       = videoIn->GetGrabHeight();
+
+    if (frameHeader->width == 0 || frameHeader->height == 0) {
+        PTRACE(1,"PLUGIN\tVideo grab dimension is 0, close down video transmission thread");
+        return false;
+    }
+
+    videoIn->RestrictAccess();
+
+    if (!videoIn->IsGrabberOpen()) {
+        PTRACE(1, "PLUGIN\tVideo grabber is not initialised, close down video transmission thread");
+        videoIn->EnableAccess();
+        return FALSE;
+    }
+
+#if PTLIB_VER >= 290
+    if (flowRequest && lastFrameTimeRTP) {
+        PStringArray options;
+        if (videoIn->FlowControl((void *)&options)    // test if implemented with empty options
+            && SetFlowControl(codec,context,mediaFormat, flowRequest)) {
+            PTRACE(4, "PLUGIN\tApplying Flow Control " << flowRequest);
+            options = LoadInputDeviceOptions(mediaFormat);
+            if (videoIn->FlowControl((void *)&options)) {
+                frameHeader->width  = videoIn->GetGrabWidth();
+                frameHeader->height = videoIn->GetGrabHeight();
+                sendIntra = true;  // Send a FPU when setting flow control.
+            }
+        } else if (videoIn->GetVideoReader() && videoIn->GetVideoReader()->GetCaptureMode() == 0) {
+                frameHeader->width  = videoIn->GetGrabWidth();
+                frameHeader->height = videoIn->GetGrabHeight();
+        }
+        flowRequest = 0;
+    }
+#endif
+
+    if (!SetFrameSize(frameHeader->width, frameHeader->height)) {
+        PTRACE(1, "PLUGIN\tFailed to resize, close down video transmission thread");
+        videoIn->EnableAccess();
+        return FALSE;
+    }
+
+    unsigned char * data = OPAL_VIDEO_FRAME_DATA_PTR(frameHeader);
+    if (!rawDataChannel->Read(data, bytesPerFrame)) {
+        PTRACE(3, "PLUGIN\tFailed to read data from video grabber");
+        videoIn->EnableAccess();
+        return TRUE; // and hope the error condition will fix itself
+    }
+
+    videoIn->EnableAccess();
+
+    RenderFrame(data, NULL);
+
+    nowFrameTick = PTimer::Tick().GetMilliSeconds();
+    lastFrameTimeRTP = (nowFrameTick - lastFrameTick)*90;
+    lastFrameTick = nowFrameTick;
+
+    grabbed = TRUE;
+    return TRUE;
+}
+
+void H323PluginVideoCodec::OnFastUpdatePicture()
+{
+    if (H323PluginVideoEncoderGroup::RequestKeyFrame(*this))
+        return;
+
+    EventCodecControl(codec, context, "on_fast_update", "");
+    sendIntra = true;
+}
+
 PBoolean H323PluginVideoCodec::Open(H323Connection & connection) {
 
 #ifdef H323_FRAMEBUFFER
     if (direction == Decoder && connection.HasVideoFrameBuffer())
         m_frameBuffer.SetCodec(this);
 #endif
+
+    if (direction == Encoder && connection.GetEndPoint().UsesSharedVideoEncoding())
+        H323PluginVideoEncoderGroup::Join(*this, connection.GetSharedVideoGroup(),
+                                          connection.GetEndPoint().GetSharedVideoKeyFrameInterval());
+
     return H323VideoCodec::Open(connection);
 }
 
@@ -1952,10 +2063,13 @@ PBoolean H323PluginVideoCodec::WriteInternal(const BYTE * /*buffer*/, unsigned l
   toLen = bufferSize;
   flags=0;
 
+  PInt64 start = mediaStatistics != NULL ? RTP_MediaStatistics::GetTime() : 0;
   pluginRetVal = (codec->codecFunction)(codec, context,
                               (const BYTE *)src, &fromLen,
                               bufferRTP.GetPointer(toLen), &toLen,
                               &flags);
+  if (mediaStatistics != NULL)
+    (*mediaStatistics)[RTP_MediaStatistics::DecodeTime].Record(RTP_MediaStatistics::GetTime() - start);
 
   for(;;) {
       if (!pluginRetVal) {
@@ -2109,6 +2223,309 @@ void H323PluginVideoCodec::SetVideoMode(int mode)
      }
 }
 
+//////////////////////////////////////////////////////////////////////////////
+
+H323PluginVideoEncoderGroup::GroupMap & H323PluginVideoEncoderGroup::GetGroups()
+{
+    static GroupMap groups;
+    return groups;
+}
+
+PMutex & H323PluginVideoEncoderGroup::GetGroupsMutex()
+{
+    static PMutex groupsMutex;
+    return groupsMutex;
+}
+
+H323PluginVideoEncoderGroup::H323PluginVideoEncoderGroup(const PString & _key, PluginCodec_Definition * _codec,
+                                                         const OpalMediaFormat & fmt, unsigned interval)
+  : key(_key), codec(_codec), context(NULL), mediaFormat(fmt),
+    frameWidth(fmt.GetOptionInteger(OpalVideoFormat::FrameWidthOption)),
+    frameHeight(fmt.GetOptionInteger(OpalVideoFormat::FrameHeightOption)),
+    keyFrameInterval(interval), subscribers(0), maxSubscribers(0),
+    frameReady(0, INT_MAX), waiting(0), encoding(FALSE), current(NULL), sequence(0),
+    keyFrameRequested(TRUE), lastKeyFrameTick(0), framesEncoded(0), keyFramesMerged(0)
+{
+    context = H323PluginCodecManager::AcquireContext(codec);
+    if (context != NULL)
+        UpdatePluginOptions(codec, context, mediaFormat);
+
+    PTRACE(4, "PLUGIN\tCreated shared " << codec->descr << " encoder " << frameWidth << "x" << frameHeight);
+}
+
+H323PluginVideoEncoderGroup::~H323PluginVideoEncoderGroup()
+{
+    if (current != NULL)
+        Release(current);
+
+    H323PluginCodecManager::ReleaseContext(codec, context);
+
+    PTRACE(3, "PLUGIN\tClosed shared " << codec->descr << " encoder, " << framesEncoded << " frames for up to "
+           << maxSubscribers << " channels, " << keyFramesMerged << " key frame requests merged");
+}
+
+void H323PluginVideoEncoderGroup::Join(H323PluginVideoCodec & codec, const PString & sourceGroup, unsigned keyFrameInterval)
+{
+    // Only the application knows which calls send the same pictures
+    if (sourceGroup.IsEmpty() || codec.encoderGroup != NULL || codec.codec == NULL || codec.codec->createCodec == NULL)
+        return;
+
+    // Only channels agreeing on every option can take the same packets
+    const OpalMediaFormat & fmt = codec.GetMediaFormat();
+    PStringStream key;
+    key << sourceGroup << '\n' << codec.codec->descr;
+    for (PINDEX i = 0; i < fmt.GetOptionCount(); i++) {
+        const OpalMediaOption & option = fmt.GetOption(i);
+        key << '\n' << option.GetName() << '=' << option.AsString();
+    }
+
+    PWaitAndSignal m(GetGroupsMutex());
+
+    GroupMap & groups = GetGroups();
+    H323PluginVideoEncoderGroup * group;
+    GroupMap::iterator r = groups.find(key);
+    if (r != groups.end())
+        group = r->second;
+    else {
+        group = new H323PluginVideoEncoderGroup(key, codec.codec, fmt, keyFrameInterval);
+        if (group->context == NULL) {
+            PTRACE(2, "PLUGIN\tCould not create shared " << codec.codec->descr << " encoder");
+            delete group;
+            return;
+        }
+        groups[key] = group;
+    }
+
+    group->subscribers++;
+    if (group->subscribers > group->maxSubscribers)
+        group->maxSubscribers = group->subscribers;
+
+    codec.encoderGroup = group;
+    codec.sharedFrame = NULL;
+    codec.sharedPacket = 0;
+
+    // The new viewer has to start from a key frame
+    PWaitAndSignal m2(group->mutex);
+    codec.sharedSequence = group->sequence;
+    group->keyFrameRequested = TRUE;
+
+    PTRACE(4, "PLUGIN\tJoined shared " << codec.codec->descr << " encoder, " << group->subscribers << " channels");
+}
+
+void H323PluginVideoEncoderGroup::Leave(H323PluginVideoCodec & codec)
+{
+    PWaitAndSignal m(GetGroupsMutex());
+
+    H323PluginVideoEncoderGroup * group = codec.encoderGroup;
+    if (group == NULL)
+        return;
+
+    codec.encoderGroup = NULL;
+    if (codec.sharedFrame != NULL) {
+        Release(codec.sharedFrame);
+        codec.sharedFrame = NULL;
+    }
+
+    if (--group->subscribers > 0)
+        return;
+
+    GetGroups().erase(group->key);
+    delete group;
+}
+
+PBoolean H323PluginVideoEncoderGroup::RequestKeyFrame(H323PluginVideoCodec & codec)
+{
+    PWaitAndSignal m(GetGroupsMutex());
+
+    H323PluginVideoEncoderGroup * group = codec.encoderGroup;
+    if (group == NULL)
+        return FALSE;
+
+    PWaitAndSignal m2(group->mutex);
+    if (group->keyFrameRequested)
+        group->keyFramesMerged++;
+    group->keyFrameRequested = TRUE;
+    return TRUE;
+}
+
+void H323PluginVideoEncoderGroup::Release(H323PluginSharedVideoFrame * frame)
+{
+    if (--frame->references == 0)
+        delete frame;
+}
+
+PBoolean H323PluginVideoEncoderGroup::Read(H323PluginVideoCodec & subscriber, unsigned & length, RTP_DataFrame & dst)
+{
+    length = 0;
+
+    if (subscriber.sharedFrame == NULL) {
+        mutex.Wait();
+
+        // Wait for a frame we have not sent yet, encoding it if nobody else is
+        while (current == NULL || current->sequence == subscriber.sharedSequence) {
+            if (!encoding) {
+                PBoolean forceKeyFrame = FALSE;
+                PInt64 now = PTimer::Tick().GetMilliSeconds();
+                if (keyFrameRequested && (lastKeyFrameTick == 0 || now - lastKeyFrameTick >= keyFrameInterval)) {
+                    forceKeyFrame = TRUE;
+                    keyFrameRequested = FALSE;
+                    lastKeyFrameTick = now;
+                }
+                encoding = TRUE;
+                mutex.Signal();
+
+                H323PluginSharedVideoFrame * frame = NULL;
+                PBoolean ok = Encode(subscriber, forceKeyFrame, frame);
+
+                mutex.Wait();
+                encoding = FALSE;
+                H323PluginSharedVideoFrame * old = NULL;
+                if (frame != NULL) {
+                    frame->sequence = ++sequence;
+                    if (frame->keyFrame) {
+                        keyFrameRequested = FALSE;
+                        lastKeyFrameTick = now;
+                    }
+                    old = current;
+                    current = frame;
+                    framesEncoded++;
+                }
+                else if (forceKeyFrame)
+                    keyFrameRequested = TRUE;
+
+                while (waiting > 0) {
+                    waiting--;
+                    frameReady.Signal();
+                }
+
+                if (old != NULL)
+                    Release(old);
+
+                if (!ok || frame == NULL) {
+                    mutex.Signal();
+                    dst.SetPayloadSize(0);
+                    return ok; // nothing grabbed, try again next time
+                }
+            }
+            else {
+                waiting++;
+                mutex.Signal();
+                PBoolean signalled = frameReady.Wait(1000);
+                mutex.Wait();
+
+                if (!signalled) {
+                    if (waiting > 0)
+                        waiting--;
+                    else
+                        frameReady.Wait();  // signalled just after the time out
+                    mutex.Signal();
+                    PTRACE(3, "PLUGIN\tTimed out waiting for shared " << codec->descr << " encoder");
+                    dst.SetPayloadSize(0);
+                    return TRUE;
+                }
+            }
+        }
+
+        // A viewer that missed a frame needs a key frame to resynchronise
+        if (!current->keyFrame && current->sequence != subscriber.sharedSequence+1) {
+            if (keyFrameRequested)
+                keyFramesMerged++;
+            keyFrameRequested = TRUE;
+        }
+
+        ++current->references;
+        subscriber.sharedFrame = current;
+        subscriber.sharedPacket = 0;
+        subscriber.sharedSequence = current->sequence;
+        mutex.Signal();
+    }
+
+    // Each channel stamps its own sequence number, timestamp and SSRC on its copy
+    const RTP_DataFrame & packet = subscriber.sharedFrame->packets[subscriber.sharedPacket++];
+    PINDEX packetSize = packet.GetHeaderSize() + packet.GetPayloadSize();
+    dst.SetMinSize(packetSize);
+    memcpy(dst.GetPointer(), (const BYTE *)packet, packetSize);
+    length = packet.GetPayloadSize();
+
+    subscriber.lastKeyFrame = subscriber.sharedFrame->keyFrame;
+    subscriber.lastPacketSent = subscriber.sharedPacket >= subscriber.sharedFrame->packets.size();
+    if (subscriber.lastPacketSent) {
+        if (subscriber.lastKeyFrame)
+            subscriber.sendIntra = false;
+        Release(subscriber.sharedFrame);
+        subscriber.sharedFrame = NULL;
+    }
+
+    return TRUE;
+}
+
+PBoolean H323PluginVideoEncoderGroup::Encode(H323PluginVideoCodec & leader, PBoolean forceKeyFrame,
+                                             H323PluginSharedVideoFrame * & frame)
+{
+    frame = NULL;
+
+    PBoolean grabbed;
+    if (!leader.GrabFrame(grabbed))
+        return FALSE;
+    if (!grabbed)
+        return TRUE;
+
+    // Follow the grabber if it changed size
+    PluginCodec_Video_FrameHeader * header = (PluginCodec_Video_FrameHeader *)leader.bufferRTP.GetPayloadPtr();
+    if ((int)header->width != frameWidth || (int)header->height != frameHeight) {
+        frameWidth  = header->width;
+        frameHeight = header->height;
+        mediaFormat.SetOptionInteger(OpalVideoFormat::FrameWidthOption, frameWidth);
+        mediaFormat.SetOptionInteger(OpalVideoFormat::FrameHeightOption, frameHeight);
+        UpdatePluginOptions(codec, context, mediaFormat);
+        PTRACE(3, "PLUGIN\tShared encoder resized to w:" << frameWidth << " h:" << frameHeight);
+    }
+
+    if (forceKeyFrame) {
+        EventCodecControl(codec, context, "on_fast_update", "");
+        PTRACE(4, "PLUGIN\tForcing key frame on shared " << codec->descr << " encoder");
+    }
+
+    frame = new H323PluginSharedVideoFrame(0);
+
+    PInt64 start = leader.mediaStatistics != NULL ? RTP_MediaStatistics::GetTime() : 0;
+
+    unsigned flags = 0;
+    for (PINDEX count = 0; count < MaxPacketsPerFrame && (flags & PluginCodec_ReturnCoderLastFrame) == 0; count++) {
+        RTP_DataFrame packet(leader.outputDataSize);
+        unsigned fromLen = leader.bufferSize;
+        unsigned toLen = leader.outputDataSize;
+        flags = forceKeyFrame ? PluginCodec_CoderForceIFrame : 0;
+
+        if ((codec->codecFunction)(codec, context,
+                                   leader.bufferRTP.GetPointer(), &fromLen,
+                                   packet.GetPointer(), &toLen,
+                                   &flags) == 0) {
+            PTRACE(3, "PLUGIN\tError encoding frame from plugin " << codec->descr);
+            delete frame;
+            frame = NULL;
+            return FALSE;
+        }
+
+        if ((flags & PluginCodec_ReturnCoderIFrame) != 0)
+            frame->keyFrame = true;
+
+        if (toLen > (unsigned)packet.GetHeaderSize()) {
+            packet.SetPayloadSize(toLen - packet.GetHeaderSize());
+            frame->packets.push_back(packet);
+        }
+    }
+
+    if (leader.mediaStatistics != NULL)
+      (*leader.mediaStatistics)[RTP_MediaStatistics::EncodeTime].Record(RTP_MediaStatistics::GetTime() - start);
+
+    if (frame->packets.empty()) {
+        delete frame;
+        frame = NULL;
+    }
+
+    return TRUE;
+}
 
 
 #endif // H323_VIDEO
@@ -2642,6 +3059,69 @@ class H323StaticPluginCodec
     virtual PluginCodec_GetCodecFunction Get_GetCodecFn() = 0;
 };
 
+/* Free lists of idle plugin codec contexts, one per codec definition.
+   Pooling is enabled per media format and only for plugins with a
+   reset_codec control, which is called on each context returned to the
+   pool so the next call gets it as if just created. A timer destroys the
+   contexts that stay idle too long. */
+class H323PluginContextPool : public PObject
+{
+    PCLASSINFO(H323PluginContextPool, PObject);
+  public:
+    static H323PluginContextPool & Get();
+
+    void AddFormat(const PString & name, PluginCodec_Definition * encoder, PluginCodec_Definition * decoder);
+
+    void * Acquire(PluginCodec_Definition * codec);
+    void Release(PluginCodec_Definition * codec, void * context);
+
+    void SetLimits(PINDEX maxIdle, const PTimeInterval & idleTimeout);
+    PBoolean SetPooling(const PString & name, PBoolean enable);
+    PBoolean Prewarm(const PString & name, PINDEX count);
+    void Evict(PBoolean all);
+    void Discard(PluginCodec_Definition * codec);
+    void GetStatistics(PINDEX & idle, unsigned & hits, unsigned & misses);
+
+  protected:
+    H323PluginContextPool();
+
+    struct Idle {
+      Idle(void * ctx, const PTimeInterval & tick) : context(ctx), released(tick) { }
+      void        * context;
+      PTimeInterval released;
+    };
+
+    struct FreeList {
+      FreeList() : enabled(FALSE), minimum(0) { }
+      std::list<Idle> contexts;
+      PBoolean        enabled;
+      PINDEX          minimum;   // pre-warmed count kept through idle eviction
+    };
+
+    typedef std::map<PluginCodec_Definition *, FreeList> FreeLists;
+    typedef std::pair<PluginCodec_Definition *, PluginCodec_Definition *> Definitions;
+    typedef std::vector<std::pair<PluginCodec_Definition *, void *> > Expired;
+
+    // Called with the mutex held, the contexts are destroyed after it is released
+    void Sweep(const PTimeInterval & now, PBoolean all, Expired & expired);
+    static void Destroy(const Expired & expired);
+    static PBoolean CanReset(PluginCodec_Definition * codec);
+    static PBoolean Reset(PluginCodec_Definition * codec, void * context);
+
+    // Not called with the mutex held, stopping waits for a sweep in progress
+    void StartSweepTimer();
+    PDECLARE_NOTIFIER(PTimer, H323PluginContextPool, OnSweepTimer);
+
+    PMutex                         mutex;
+    FreeLists                      freeLists;
+    std::map<PString, Definitions> formats;
+    PINDEX                         maxIdle;
+    PTimeInterval                  idleTimeout;
+    PTimer                         sweepTimer;
+    unsigned                       hits;
+    unsigned                       misses;
+};
+
 PMutex & H323PluginCodecManager::GetMediaFormatMutex()
 {
   static PMutex mutex;
@@ -2701,6 +3181,9 @@ H323PluginCodecManager::~H323PluginCodecManager()
 
 void H323PluginCodecManager::OnShutdown()
 {
+  // destroy pooled contexts while the plugins are still loaded
+  EvictIdleContexts(TRUE);
+
   // unregister the plugin media formats
   OpalMediaFormatFactory::UnregisterAll();
 
@@ -2830,8 +3313,326 @@ void H323PluginCodecManager::RegisterCodecs(unsigned int count, void * _codecLis
   }
 }
 
-void H323PluginCodecManager::UnregisterCodecs(unsigned int /*count*/, void * /*codec*/)
+void H323PluginCodecManager::UnregisterCodecs(unsigned int count, void * _codecList)
+{
+  PluginCodec_Definition * codecList = (PluginCodec_Definition *)_codecList;
+  for (unsigned i = 0; i < count; i++)
+    H323PluginContextPool::Get().Discard(&codecList[i]);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+H323PluginContextPool & H323PluginContextPool::Get()
+{
+  // Never destroyed, the plugins may be gone by the time statics are
+  static H323PluginContextPool * pool = new H323PluginContextPool;
+  return *pool;
+}
+
+H323PluginContextPool::H323PluginContextPool()
+  : maxIdle(0), idleTimeout(0, 60), hits(0), misses(0)
+{
+  sweepTimer.SetNotifier(PCREATE_NOTIFIER(OnSweepTimer));
+}
+
+void H323PluginContextPool::AddFormat(const PString & name, PluginCodec_Definition * encoder, PluginCodec_Definition * decoder)
+{
+  PWaitAndSignal m(mutex);
+  formats[name] = Definitions(encoder, decoder);
+}
+
+void * H323PluginContextPool::Acquire(PluginCodec_Definition * codec)
+{
+  if (codec == NULL || codec->createCodec == NULL)
+    return NULL;
+
+  {
+    PWaitAndSignal m(mutex);
+    FreeLists::iterator r = freeLists.find(codec);
+    if (r != freeLists.end() && r->second.enabled) {
+      if (!r->second.contexts.empty()) {
+        void * context = r->second.contexts.back().context;
+        r->second.contexts.pop_back();
+        hits++;
+        return context;
+      }
+      misses++;
+    }
+  }
+
+  return (*codec->createCodec)(codec);
+}
+
+void H323PluginContextPool::Release(PluginCodec_Definition * codec, void * context)
+{
+  if (codec == NULL || context == NULL)
+    return;
+
+  PBoolean kept = FALSE;
+  PBoolean pooled;
+
+  {
+    PWaitAndSignal m(mutex);
+    FreeLists::iterator r = freeLists.find(codec);
+    pooled = r != freeLists.end() && r->second.enabled &&
+             (PINDEX)r->second.contexts.size() < PMAX(maxIdle, r->second.minimum);
+  }
+
+  // Reset outside the lock, it may cost as much as creating a context
+  if (pooled && Reset(codec, context)) {
+    PWaitAndSignal m(mutex);
+    FreeList & list = freeLists[codec];
+    if (list.enabled && (PINDEX)list.contexts.size() < PMAX(maxIdle, list.minimum)) {
+      list.contexts.push_back(Idle(context, PTimer::Tick()));
+      kept = TRUE;
+    }
+  }
+
+  if (!kept && codec->destroyCodec != NULL)
+    (*codec->destroyCodec)(codec, context);
+}
+
+void H323PluginContextPool::SetLimits(PINDEX _maxIdle, const PTimeInterval & timeout)
+{
+  PWaitAndSignal m(mutex);
+  maxIdle = _maxIdle;
+  idleTimeout = timeout;
+}
+
+PBoolean H323PluginContextPool::SetPooling(const PString & name, PBoolean enable)
+{
+  Expired expired;
+  PBoolean enabled = FALSE;
+
+  {
+    PWaitAndSignal m(mutex);
+    std::map<PString, Definitions>::iterator r = formats.find(name);
+    if (r == formats.end())
+      return FALSE;
+
+    PluginCodec_Definition * codecs[2] = { r->second.first, r->second.second };
+    for (PINDEX i = 0; i < 2; i++) {
+      PluginCodec_Definition * codec = codecs[i];
+      if (codec == NULL || codec->createCodec == NULL)
+        continue;
+
+      if (enable) {
+        if (!CanReset(codec)) {
+          PTRACE(3, "H323PLUGIN\tCannot pool " << codec->descr << " contexts, no reset control");
+          continue;
+        }
+        freeLists[codec].enabled = TRUE;
+        enabled = TRUE;
+        continue;
+      }
+
+      FreeLists::iterator list = freeLists.find(codec);
+      if (list == freeLists.end())
+        continue;
+      for (std::list<Idle>::iterator c = list->second.contexts.begin(); c != list->second.contexts.end(); ++c)
+        expired.push_back(Expired::value_type(codec, c->context));
+      freeLists.erase(list);
+    }
+  }
+
+  Destroy(expired);
+
+  if (!enable)
+    return TRUE;
+
+  if (enabled)
+    StartSweepTimer();
+  return enabled;
+}
+
+PBoolean H323PluginContextPool::Prewarm(const PString & name, PINDEX count)
 {
+  Definitions definitions;
+  {
+    PWaitAndSignal m(mutex);
+    std::map<PString, Definitions>::iterator r = formats.find(name);
+    if (r == formats.end())
+      return FALSE;
+    definitions = r->second;
+  }
+
+  PBoolean prewarmed = FALSE;
+  PluginCodec_Definition * codecs[2] = { definitions.first, definitions.second };
+  for (PINDEX i = 0; i < 2; i++) {
+    PluginCodec_Definition * codec = codecs[i];
+    if (codec == NULL || codec->createCodec == NULL)
+      continue;
+
+    {
+      PWaitAndSignal m(mutex);
+      FreeLists::iterator r = freeLists.find(codec);
+      if (r == freeLists.end() || !r->second.enabled)
+        continue;
+    }
+
+    // Create outside the lock, some plugins start helper processes
+    std::vector<void *> created;
+    for (PINDEX j = 0; j < count; j++) {
+      void * context = (*codec->createCodec)(codec);
+      if (context != NULL)
+        created.push_back(context);
+    }
+
+    PWaitAndSignal m(mutex);
+    FreeList & list = freeLists[codec];
+    if (list.minimum < count)
+      list.minimum = count;
+    PTimeInterval now = PTimer::Tick();
+    for (size_t j = 0; j < created.size(); j++)
+      list.contexts.push_back(Idle(created[j], now));
+    prewarmed = TRUE;
+  }
+
+  if (!prewarmed)
+    return FALSE;
+
+  PTRACE(4, "H323PLUGIN\tPre-warmed " << count << " contexts for " << name);
+  return TRUE;
+}
+
+void H323PluginContextPool::Evict(PBoolean all)
+{
+  // Evicting everything is done at shutdown, no more sweeps are needed
+  if (all)
+    sweepTimer.Stop();
+
+  Expired expired;
+  {
+    PWaitAndSignal m(mutex);
+    Sweep(PTimer::Tick(), all, expired);
+  }
+  Destroy(expired);
+}
+
+void H323PluginContextPool::StartSweepTimer()
+{
+  if (!sweepTimer.IsRunning())
+    sweepTimer.RunContinuous(1000);
+}
+
+void H323PluginContextPool::OnSweepTimer(PTimer &, H323_INT)
+{
+  Evict(FALSE);
+}
+
+void H323PluginContextPool::Discard(PluginCodec_Definition * codec)
+{
+  Expired expired;
+  {
+    PWaitAndSignal m(mutex);
+    std::map<PString, Definitions>::iterator f = formats.begin();
+    while (f != formats.end()) {
+      if (f->second.first == codec || f->second.second == codec)
+        formats.erase(f++);
+      else
+        ++f;
+    }
+
+    FreeLists::iterator r = freeLists.find(codec);
+    if (r == freeLists.end())
+      return;
+    for (std::list<Idle>::iterator i = r->second.contexts.begin(); i != r->second.contexts.end(); ++i)
+      expired.push_back(Expired::value_type(codec, i->context));
+    freeLists.erase(r);
+  }
+  Destroy(expired);
+}
+
+void H323PluginContextPool::GetStatistics(PINDEX & idle, unsigned & _hits, unsigned & _misses)
+{
+  PWaitAndSignal m(mutex);
+  idle = 0;
+  for (FreeLists::iterator r = freeLists.begin(); r != freeLists.end(); ++r)
+    idle += r->second.contexts.size();
+  _hits = hits;
+  _misses = misses;
+}
+
+void H323PluginContextPool::Sweep(const PTimeInterval & now, PBoolean all, Expired & expired)
+{
+  for (FreeLists::iterator r = freeLists.begin(); r != freeLists.end(); ++r) {
+    std::list<Idle> & contexts = r->second.contexts;
+    PINDEX keep = all ? 0 : r->second.minimum;
+    PINDEX limit = PMAX(maxIdle, r->second.minimum);
+    // Oldest first, the most recently returned context is reused first
+    while ((PINDEX)contexts.size() > keep &&
+           (all || (PINDEX)contexts.size() > limit || now - contexts.front().released >= idleTimeout)) {
+      expired.push_back(Expired::value_type(r->first, contexts.front().context));
+      contexts.pop_front();
+    }
+  }
+}
+
+void H323PluginContextPool::Destroy(const Expired & expired)
+{
+  for (size_t i = 0; i < expired.size(); i++) {
+    PluginCodec_Definition * codec = expired[i].first;
+    if (codec->destroyCodec != NULL)
+      (*codec->destroyCodec)(codec, expired[i].second);
+  }
+
+  if (!expired.empty())
+    PTRACE(5, "H323PLUGIN\tDestroyed " << expired.size() << " idle codec contexts");
+}
+
+PBoolean H323PluginContextPool::CanReset(PluginCodec_Definition * codec)
+{
+  return GetCodecControl(codec, PLUGINCODEC_CONTROL_RESET_CODEC) != NULL;
+}
+
+PBoolean H323PluginContextPool::Reset(PluginCodec_Definition * codec, void * context)
+{
+  PluginCodec_ControlDefn * control = GetCodecControl(codec, PLUGINCODEC_CONTROL_RESET_CODEC);
+  if (control == NULL)
+    return FALSE;
+
+  unsigned len = 0;
+  if ((*control->control)(codec, context, PLUGINCODEC_CONTROL_RESET_CODEC, NULL, &len) > 0)
+    return TRUE;
+
+  PTRACE(3, "H323PLUGIN\tCould not reset " << codec->descr << " context, not pooled");
+  return FALSE;
+}
+
+void * H323PluginCodecManager::AcquireContext(PluginCodec_Definition * codec)
+{
+  return H323PluginContextPool::Get().Acquire(codec);
+}
+
+void H323PluginCodecManager::ReleaseContext(PluginCodec_Definition * codec, void * context)
+{
+  H323PluginContextPool::Get().Release(codec, context);
+}
+
+void H323PluginCodecManager::SetContextPool(PINDEX maxIdle, const PTimeInterval & idleTimeout)
+{
+  H323PluginContextPool::Get().SetLimits(maxIdle, idleTimeout);
+  EvictIdleContexts(FALSE);
+}
+
+PBoolean H323PluginCodecManager::SetContextPooling(const PString & mediaFormat, PBoolean enable)
+{
+  return H323PluginContextPool::Get().SetPooling(mediaFormat, enable);
+}
+
+PBoolean H323PluginCodecManager::PrewarmContexts(const PString & mediaFormat, PINDEX count)
+{
+  return H323PluginContextPool::Get().Prewarm(mediaFormat, count);
+}
+
+void H323PluginCodecManager::EvictIdleContexts(PBoolean all)
+{
+  H323PluginContextPool::Get().Evict(all);
+}
+
+void H323PluginCodecManager::GetContextPoolStatistics(PINDEX & idle, unsigned & hits, unsigned & misses)
+{
+  H323PluginContextPool::Get().GetStatistics(idle, hits, misses);
 }
 
 void H323PluginCodecManager::AddFormat(OpalMediaFormat * fmt)
@@ -2999,6 +3800,9 @@ void H323PluginCodecManager::CreateCapabilityAndMediaFormat(
       // save the format
       H323PluginCodecManager::AddFormat(mediaFormat);
     }
+
+    // so contexts can be pre-warmed by media format name
+    H323PluginContextPool::Get().AddFormat(fmtName, encoderCodec, decoderCodec);
   }
 
   // add the capability
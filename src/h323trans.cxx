@@ -43,6 +43,8 @@
 
 static PTimeInterval ResponseRetirementAge(0, 30); // Seconds
 
+#define RESPONSE_CACHE_BUCKETS 256
+
 
 #define new PNEW
 
@@ -160,6 +162,10 @@ void H323Transactor::Construct()
   checkResponseCryptoTokens = TRUE;
   lastRequest = NULL;
 
+  dispatchThreadCount = 0;
+  slowThreadCount = 0;
+  slowQueue = NULL;
+
   requests.DisallowDeleteObjects();
 }
 
@@ -213,6 +219,7 @@ PBoolean H323Transactor::SetTransport(const H323TransportAddress & iface)
   if (oldTransport != NULL) {
     PTRACE(4, "H323\tShutting down transactor thread on " << oldTransport->GetLocalAddress());
     oldTransport->CleanUpOnTermination();
+    StopDispatchThreads();
     delete oldTransport;
   }
 
@@ -244,6 +251,7 @@ PBoolean H323Transactor::StartChannel()
                                           PThread::NoAutoDeleteThread,
                                           PThread::NormalPriority,
                                           "Transactor:%x"));
+  StartDispatchThreads();
   return TRUE;
 }
 
@@ -252,6 +260,7 @@ void H323Transactor::StopChannel()
 {
   if (transport != NULL) {
     transport->CleanUpOnTermination();
+    StopDispatchThreads();
     delete transport;
     transport = NULL;
   }
@@ -275,11 +284,16 @@ void H323Transactor::HandleTransactions(PThread &, H323_INT)
     H323TransactionPDU * response = CreateTransactionPDU();
     if (response->Read(*transport)) {
       consecutiveErrors = 0;
-      lastRequest = NULL;
-      if (HandleTransaction(response->GetPDU()) && lastRequest) {
-        lastRequest->responseHandled.Signal();
-        lastRequest->responseMutex.Signal();
-      } 
+      PString key;
+      if (GetDispatchKey(*response, key) && QueueDispatch(response, key))
+        response = NULL;  // Owned by dispatch thread now
+      else {
+        lastRequest = NULL;
+        if (HandleTransaction(response->GetPDU()) && lastRequest) {
+          lastRequest->responseHandled.Signal();
+          lastRequest->responseMutex.Signal();
+        }
+      }
     }
     else {
       switch (transport->GetErrorCode(PChannel::LastReadError)) {
@@ -347,13 +361,7 @@ void H323Transactor::AgeResponses()
 
   PWaitAndSignal mutex(pduWriteMutex);
 
-  for (PINDEX i = 0; i < responses.GetSize(); i++) {
-    const Response & response = responses[i];
-    if ((now - response.lastUsedTime) > response.retirementAge) {
-      PTRACE(4, "Trans\tRemoving cached response: " << response);
-      responses.RemoveAt(i--);
-    }
-  }
+  responses.Age(now);
 }
 
 
@@ -362,15 +370,18 @@ PBoolean H323Transactor::SendCachedResponse(const H323TransactionPDU & pdu)
   if (PAssertNULL(transport) == NULL)
     return FALSE;
 
-  Response key(transport->GetLastReceivedAddress(), pdu.GetSequenceNumber());
+  Response key(GetLastReceivedAddress(), pdu.GetSequenceNumber());
 
   PWaitAndSignal mutex(pduWriteMutex);
 
-  PINDEX idx = responses.GetValuesIndex(key);
-  if (idx != P_MAX_INDEX)
-    return responses[idx].SendCachedResponse(*transport);
+  Response * response = responses.Find(key);
+  if (response != NULL) {
+    PBoolean sent = response->SendCachedResponse(*transport);
+    responses.Touch(response);
+    return sent;
+  }
 
-  responses.Append(new Response(key));
+  responses.Add(new Response(key));
   return FALSE;
 }
 
@@ -384,15 +395,24 @@ PBoolean H323Transactor::WritePDU(H323TransactionPDU & pdu)
 
   PWaitAndSignal mutex(pduWriteMutex);
 
-  Response key(transport->GetLastReceivedAddress(), pdu.GetSequenceNumber());
-  PINDEX idx = responses.GetValuesIndex(key);
-  if (idx != P_MAX_INDEX)
-    responses[idx].SetPDU(pdu);
+  Response key(GetLastReceivedAddress(), pdu.GetSequenceNumber());
+  Response * response = responses.Find(key);
+  if (response != NULL) {
+    response->SetPDU(pdu);
+    responses.Touch(response);
+  }
 
   return pdu.Write(*transport);
 }
 
 
+PINDEX H323Transactor::GetCachedResponseCount() const
+{
+  PWaitAndSignal mutex(pduWriteMutex);
+  return responses.GetSize();
+}
+
+
 PBoolean H323Transactor::WriteTo(H323TransactionPDU & pdu,
                              const H323TransportAddressArray & addresses,
                              PBoolean callback)
@@ -673,6 +693,9 @@ H323Transactor::Response::Response(const H323TransportAddress & addr, unsigned s
 {
   sprintf("#%u", seqNum);
   replyPDU = NULL;
+  hash = 0;
+  retireTime = 0;
+  next = NULL;
 }
 
 
@@ -717,6 +740,354 @@ PBoolean H323Transactor::Response::SendCachedResponse(H323Transport & transport)
 }
 
 
+/////////////////////////////////////////////////////////////////////////////////
+
+H323Transactor::ResponseCache::ResponseCache()
+  : buckets(RESPONSE_CACHE_BUCKETS),
+    count(0)
+{
+}
+
+
+H323Transactor::ResponseCache::~ResponseCache()
+{
+  for (size_t i = 0; i < buckets.size(); i++) {
+    Response * response = buckets[i];
+    while (response != NULL) {
+      Response * next = response->next;
+      delete response;
+      response = next;
+    }
+  }
+}
+
+
+unsigned H323Transactor::ResponseCache::Hash(const PString & key)
+{
+  // FNV-1a
+  unsigned hash = 2166136261U;
+  for (const char * ptr = key; *ptr != '\0'; ptr++) {
+    hash ^= (BYTE)*ptr;
+    hash *= 16777619U;
+  }
+  return hash;
+}
+
+
+H323Transactor::Response * H323Transactor::ResponseCache::Find(const PString & key) const
+{
+  unsigned hash = Hash(key);
+  for (Response * response = buckets[hash % buckets.size()]; response != NULL; response = response->next) {
+    if (response->hash == hash && *response == key)
+      return response;
+  }
+  return NULL;
+}
+
+
+void H323Transactor::ResponseCache::Add(Response * response)
+{
+  if (count >= (PINDEX)buckets.size()*2)
+    Grow();
+
+  response->hash = Hash(*response);
+  Response * & bucket = buckets[response->hash % buckets.size()];
+  response->next = bucket;
+  bucket = response;
+  count++;
+
+  Touch(response);
+}
+
+
+void H323Transactor::ResponseCache::Touch(Response * response)
+{
+  // Retire in the first whole second after the retirement age is exceeded,
+  // any earlier entry left in another bucket is ignored when it comes due.
+  response->retireTime = (response->lastUsedTime + response->retirementAge).GetTimeInSeconds() + 1;
+  retirements[response->retireTime].push_back(*response);
+}
+
+
+PINDEX H323Transactor::ResponseCache::Age(const PTime & now)
+{
+  PINDEX removed = 0;
+  time_t nowTime = now.GetTimeInSeconds();
+
+  while (!retirements.empty() && retirements.begin()->first <= nowTime) {
+    const std::vector<PString> & keys = retirements.begin()->second;
+    for (size_t i = 0; i < keys.size(); i++) {
+      Response * response = Find(keys[i]);
+      if (response != NULL && response->retireTime <= nowTime) {
+        PTRACE(4, "Trans\tRemoving cached response: " << *response);
+        Remove(response);
+        delete response;
+        removed++;
+      }
+    }
+    retirements.erase(retirements.begin());
+  }
+
+  return removed;
+}
+
+
+void H323Transactor::ResponseCache::Remove(Response * response)
+{
+  Response * * link = &buckets[response->hash % buckets.size()];
+  while (*link != NULL) {
+    if (*link == response) {
+      *link = response->next;
+      response->next = NULL;
+      count--;
+      return;
+    }
+    link = &(*link)->next;
+  }
+}
+
+
+void H323Transactor::ResponseCache::Grow()
+{
+  std::vector<Response *> newBuckets(buckets.size()*2);
+
+  for (size_t i = 0; i < buckets.size(); i++) {
+    Response * response = buckets[i];
+    while (response != NULL) {
+      Response * next = response->next;
+      Response * & bucket = newBuckets[response->hash % newBuckets.size()];
+      response->next = bucket;
+      bucket = response;
+      response = next;
+    }
+  }
+
+  buckets.swap(newBuckets);
+}
+
+
+/////////////////////////////////////////////////////////////////////////////////
+
+class H323Transactor::DispatchQueue
+{
+  public:
+    DispatchQueue()
+      : available(0, INT_MAX)
+    {
+    }
+
+    ~DispatchQueue()
+    {
+      // Anything still queued was never handled
+      while (!jobs.empty()) {
+        delete jobs.front().pdu;
+        delete jobs.front().transaction;
+        jobs.pop_front();
+      }
+    }
+
+    void Push(const DispatchJob & job)
+    {
+      mutex.Wait();
+      jobs.push_back(job);
+      mutex.Signal();
+      available.Signal();
+    }
+
+    // Returns FALSE when released with nothing left to do
+    PBoolean Pop(DispatchJob & job)
+    {
+      available.Wait();
+      PWaitAndSignal lock(mutex);
+      if (jobs.empty())
+        return FALSE;
+      job = jobs.front();
+      jobs.pop_front();
+      return TRUE;
+    }
+
+    void Release(size_t threads)
+    {
+      while (threads-- > 0)
+        available.Signal();
+    }
+
+  protected:
+    std::deque<DispatchJob> jobs;
+    PMutex                  mutex;
+    PSemaphore              available;
+};
+
+
+class H323Transactor::DispatchThread : public PThread
+{
+    PCLASSINFO(DispatchThread, PThread);
+  public:
+    DispatchThread(H323Transactor & t, DispatchQueue & q, const char * name)
+      : PThread(0, NoAutoDeleteThread, NormalPriority, name),
+        transactor(t),
+        queue(q)
+    {
+      Resume();
+    }
+
+    H323Transactor       & transactor;
+    H323TransportAddress   receivedAddress;
+
+  protected:
+    void Main()
+    {
+      DispatchJob job;
+      while (queue.Pop(job)) {
+        receivedAddress = job.address;
+        transactor.HandleDispatch(job);
+      }
+    }
+
+    DispatchQueue & queue;
+};
+
+
+void H323Transactor::SetDispatchThreads(unsigned threads, unsigned slowThreads)
+{
+  StopDispatchThreads();
+
+  dispatchThreadCount = threads;
+  slowThreadCount = slowThreads;
+
+  if (transport != NULL)
+    StartDispatchThreads();
+}
+
+
+PBoolean H323Transactor::GetDispatchKey(const H323TransactionPDU &, PString &) const
+{
+  return FALSE;
+}
+
+
+H323TransportAddress H323Transactor::GetLastReceivedAddress() const
+{
+  DispatchThread * thread = dynamic_cast<DispatchThread *>(PThread::Current());
+  if (thread != NULL && &thread->transactor == this)
+    return thread->receivedAddress;
+
+  if (transport == NULL)
+    return H323TransportAddress();
+
+  return transport->GetLastReceivedAddress();
+}
+
+
+PBoolean H323Transactor::QueueSlowTransaction(H323Transaction * transaction)
+{
+  PWaitAndSignal mutex(dispatchMutex);
+
+  if (slowQueue == NULL)
+    return FALSE;
+
+  DispatchJob job;
+  job.pdu = NULL;
+  job.address = transaction->GetReceivedAddress();
+  job.transaction = transaction;
+  slowQueue->Push(job);
+  return TRUE;
+}
+
+
+void H323Transactor::StartDispatchThreads()
+{
+  PWaitAndSignal mutex(dispatchMutex);
+
+  if (!dispatchThreads.empty())
+    return;
+
+  unsigned i;
+  for (i = 0; i < dispatchThreadCount; i++) {
+    DispatchQueue * queue = new DispatchQueue;
+    dispatchQueues.push_back(queue);
+    dispatchThreads.push_back(new DispatchThread(*this, *queue, "Trans Dispatch:%x"));
+  }
+
+  if (slowThreadCount > 0) {
+    slowQueue = new DispatchQueue;
+    for (i = 0; i < slowThreadCount; i++)
+      dispatchThreads.push_back(new DispatchThread(*this, *slowQueue, "Trans Slow:%x"));
+  }
+
+  PTRACE_IF(3, !dispatchThreads.empty(), "Trans\tStarted " << dispatchThreadCount
+            << " dispatch and " << slowThreadCount << " slow handler threads");
+}
+
+
+void H323Transactor::StopDispatchThreads()
+{
+  // Detach everything first so the listener thread goes back to handling
+  // PDUs itself while the threads finish what is already queued.
+  dispatchMutex.Wait();
+  std::vector<DispatchQueue *> queues;
+  queues.swap(dispatchQueues);
+  DispatchQueue * slow = slowQueue;
+  slowQueue = NULL;
+  std::vector<DispatchThread *> threads;
+  threads.swap(dispatchThreads);
+  dispatchMutex.Signal();
+
+  if (threads.empty())
+    return;
+
+  size_t i;
+  for (i = 0; i < queues.size(); i++)
+    queues[i]->Release(1);
+  if (slow != NULL)
+    slow->Release(threads.size() - queues.size());
+
+  for (i = 0; i < threads.size(); i++) {
+    threads[i]->WaitForTermination();
+    delete threads[i];
+  }
+
+  for (i = 0; i < queues.size(); i++)
+    delete queues[i];
+  delete slow;
+
+  PTRACE(3, "Trans\tStopped dispatch threads");
+}
+
+
+PBoolean H323Transactor::QueueDispatch(H323TransactionPDU * pdu, const PString & key)
+{
+  PWaitAndSignal mutex(dispatchMutex);
+
+  if (dispatchQueues.empty())
+    return FALSE;
+
+  DispatchJob job;
+  job.pdu = pdu;
+  job.address = transport->GetLastReceivedAddress();
+  job.transaction = NULL;
+  dispatchQueues[ResponseCache::Hash(key) % dispatchQueues.size()]->Push(job);
+  return TRUE;
+}
+
+
+void H323Transactor::HandleDispatch(DispatchJob & job)
+{
+  if (job.transaction != NULL) {
+    // Deletes the transaction when done
+    job.transaction->SlowHandler(*PThread::Current(), 0);
+    return;
+  }
+
+  // Only requests are dispatched, responses need lastRequest which belongs
+  // to the listener thread.
+  PBoolean isResponse = HandleTransaction(job.pdu->GetPDU());
+  PTRACE_IF(1, isResponse, "Trans\tResponse PDU was handled on a dispatch thread");
+
+  delete job.pdu;
+}
+
+
 /////////////////////////////////////////////////////////////////////////////////
 
 H323Transaction::H323Transaction(H323Transactor & trans,
@@ -724,7 +1095,8 @@ H323Transaction::H323Transaction(H323Transactor & trans,
                                  H323TransactionPDU * conf,
                                  H323TransactionPDU * rej)
   : transactor(trans),
-    replyAddresses(trans.GetTransport().GetLastReceivedAddress()),
+    receivedAddress(trans.GetLastReceivedAddress()),
+    replyAddresses(receivedAddress),
     request(requestToCopy.ClonePDU())
 {
   confirm = conf;
@@ -771,10 +1143,11 @@ PBoolean H323Transaction::HandlePDU()
 
   if (fastResponseRequired) {
     fastResponseRequired = FALSE;
-    PThread::Create(PCREATE_NOTIFIER(SlowHandler), 0,
-                                     PThread::AutoDeleteThread,
-                                     PThread::NormalPriority,
-                                     "Transaction:%x");
+    if (!transactor.QueueSlowTransaction(this))
+      PThread::Create(PCREATE_NOTIFIER(SlowHandler), 0,
+                                       PThread::AutoDeleteThread,
+                                       PThread::NormalPriority,
+                                       "Transaction:%x");
   }
 
   return TRUE;
@@ -824,6 +1197,8 @@ H323TransactionServer::H323TransactionServer(H323EndPoint & ep)
 {
   usingAllInterfaces = FALSE;
   monitorThread = NULL;
+  dispatchThreads = 0;
+  slowHandlerThreads = 0;
 }
 
 
@@ -921,6 +1296,8 @@ PBoolean H323TransactionServer::AddListener(H323Transactor * listener)
 
   mutex.Wait();
   listeners.Append(listener);
+  if (dispatchThreads > 0 || slowHandlerThreads > 0)
+    listener->SetDispatchThreads(dispatchThreads, slowHandlerThreads);
   mutex.Signal();
 
   listener->StartChannel();
@@ -929,6 +1306,18 @@ PBoolean H323TransactionServer::AddListener(H323Transactor * listener)
 }
 
 
+void H323TransactionServer::SetDispatchThreads(unsigned threads, unsigned slowThreads)
+{
+  PWaitAndSignal wait(mutex);
+
+  dispatchThreads = threads;
+  slowHandlerThreads = slowThreads;
+
+  for (PINDEX i = 0; i < listeners.GetSize(); i++)
+    listeners[i].SetDispatchThreads(threads, slowThreads);
+}
+
+
 PBoolean H323TransactionServer::RemoveListener(H323Transactor * listener)
 {
   PBoolean ok = TRUE;
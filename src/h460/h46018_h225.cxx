@@ -60,6 +60,11 @@
 #define H46024A_MAX_PROBE_COUNT  15
 #define H46024A_PROBE_INTERVAL  200
 
+// Multiplex sockets can read and write batches of datagrams per system call
+#if defined(H323_H46019M) && defined(P_LINUX) && defined(MSG_WAITFORONE)
+#define H46019_MMSG 1
+#endif
+
 #if PTLIB_VER >= 2130
 PCREATE_NAT_PLUGIN(H46019, "H.460.19");
 #else
@@ -486,6 +491,24 @@ muxPortMap                    PNatMethod_H46019::rtpPortMap;
 muxSocketMap                  PNatMethod_H46019::rtcpSocketMap;
 PBoolean                      PNatMethod_H46019::muxShutdown;
 PMutex                        PNatMethod_H46019::muxMutex;
+PINDEX                        PNatMethod_H46019::muxBatchSize = 1;
+PINDEX                        PNatMethod_H46019::muxReaders = 1;
+std::vector<H323Connection::NAT_Sockets> PNatMethod_H46019::muxShards;
+std::vector<PThread *>        PNatMethod_H46019::muxReadThreads;
+H46019MultiplexTable * volatile PNatMethod_H46019::rtpMuxTable = NULL;
+H46019MultiplexTable * volatile PNatMethod_H46019::rtcpMuxTable = NULL;
+H46019MultiplexTable * volatile PNatMethod_H46019::muxHazards[PNatMethod_H46019::MaxMultiplexReaders*2];
+std::list<H46019MultiplexTable *> PNatMethod_H46019::muxRetired;
+#endif
+
+#ifdef H323_H46019M
+static H46019MultiplexSocket * CreateMultiplexSocket(bool rtp, PINDEX batchSize, PBoolean reusePort)
+{
+    H46019MultiplexSocket * socket = new H46019MultiplexSocket(rtp);
+    socket->SetBatchSize(batchSize);
+    socket->SetReusePort(reusePort);
+    return socket;
+}
 #endif
 
 PNatMethod_H46019::PNatMethod_H46019()
@@ -499,9 +522,10 @@ PNatMethod_H46019::PNatMethod_H46019()
 PNatMethod_H46019::~PNatMethod_H46019()
 {
 #ifdef H323_H46019M
-    PWaitAndSignal m(muxMutex);
+    muxMutex.Wait();
 
-    if (IsMultiplexed()) {
+    PBoolean closing = IsMultiplexed();
+    if (closing) {
         muxShutdown = true;
         EnableMultiplex(false);
 
@@ -510,19 +534,14 @@ PNatMethod_H46019::~PNatMethod_H46019()
         rtpSocketMap.clear();
         rtpPortMap.clear();
         rtcpSocketMap.clear();
+        PublishMultiplexTable(true);
+        PublishMultiplexTable(false);
+    }
 
-        if (muxSockets.rtp) {
-            muxSockets.rtp->Close();
-            delete muxSockets.rtp;
-            muxSockets.rtp = NULL;
-        }
+    muxMutex.Signal();
 
-        if (muxSockets.rtcp) {
-            muxSockets.rtcp->Close();
-            delete muxSockets.rtcp;
-            muxSockets.rtcp = NULL;
-        }
-    }
+    if (closing)
+        CloseMultiplexSockets();
 #endif
 }
 
@@ -601,8 +620,13 @@ PBoolean PNatMethod_H46019::CreateSocketPair(PUDPSocket * & socket1,
 #ifdef H323_H46019M
     if (info->GetRecvMultiplexID() > 0) {
         if (!multiplex) {
-           muxSockets.rtp = new H46019MultiplexSocket(true);
-           muxSockets.rtcp = new H46019MultiplexSocket(false);
+           H323EndPoint * ep = handler->GetEndPoint();
+           if (ep != NULL) {
+               muxBatchSize = PMAX(1, PMIN(ep->GetMultiplexBatchSize(), (PINDEX)H46019MultiplexSocket::MaxBatchSize));
+               muxReaders = PMAX(1, PMIN(ep->GetMultiplexReaderThreads(), (PINDEX)MaxMultiplexReaders));
+           }
+           muxSockets.rtp = CreateMultiplexSocket(true, muxBatchSize, muxReaders > 1);
+           muxSockets.rtcp = CreateMultiplexSocket(false, muxBatchSize, muxReaders > 1);
            muxPortInfo.currentPort = muxPortInfo.basePort-1;
             while ((!OpenSocket(*muxSockets.rtp, muxPortInfo, binding)) ||
                    (!OpenSocket(*muxSockets.rtcp, muxPortInfo, binding)) ||
@@ -610,12 +634,15 @@ PBoolean PNatMethod_H46019::CreateSocketPair(PUDPSocket * & socket1,
                 {
                     delete muxSockets.rtp;
                     delete muxSockets.rtcp;
-                    muxSockets.rtp = new H46019MultiplexSocket(true);    /// Data
-                    muxSockets.rtcp = new H46019MultiplexSocket(false);    /// Signal
+                    muxSockets.rtp = CreateMultiplexSocket(true, muxBatchSize, muxReaders > 1);    /// Data
+                    muxSockets.rtcp = CreateMultiplexSocket(false, muxBatchSize, muxReaders > 1);    /// Signal
                 }
                PTRACE(4, "H46019\tMultiplex UDP ports "
                      << muxSockets.rtp->GetPort() << '-' << muxSockets.rtcp->GetPort());
 
+              if (muxReaders > 1)
+                  OpenMultiplexShards(binding);
+
               StartMultiplexListener();  // Start Multiplexing Listening thread;
               EnableMultiplex(true);
         }
@@ -802,44 +829,114 @@ void CloseAllSessions(const muxSocketMap & socMap)
 
 void PNatMethod_H46019::StartMultiplexListener()
 {
-  if (m_readThread)
+  PWaitAndSignal m(muxMutex);
+
+  if (!muxReadThreads.empty())
       return;
 
+  // Readers are kept so CloseMultiplexSockets() can wait for them to finish
+  // with the sockets before deleting them.
   muxShutdown = false;
   m_readThread = PThread::Create(PCREATE_NOTIFIER(ReadThread), 0,
-                                    PThread::AutoDeleteThread,
+                                    PThread::NoAutoDeleteThread,
                                     PThread::NormalPriority,
                                     "GkMonitor:%x");
+  muxReadThreads.push_back(m_readThread);
+
+  // Additional readers for the sockets sharing the port with SO_REUSEPORT
+  for (PINDEX shard = 1; shard < muxReaders; shard++)
+      muxReadThreads.push_back(PThread::Create(PCREATE_NOTIFIER(ReadThread), shard,
+                                    PThread::NoAutoDeleteThread,
+                                    PThread::NormalPriority,
+                                    "H46019Mux:%x"));
+}
+
+/* Read the datagrams waiting on a multiplex socket. With batching, all
+   that are ready (up to count) are taken with one recvmmsg() call. Slots
+   whose buffer was handed on to a session get a new one from the pool. */
+PINDEX H46019MultiplexSocket::ReadBatch(PUDPSocket & socket, H46019MultiplexDatagram * datagrams, PINDEX count, int & error)
+{
+    for (PINDEX i = 0; i < count; i++) {
+        if (datagrams[i].frame.IsEmpty())
+            datagrams[i].frame = RTP_FramePool::Default().Allocate(H46019MultiplexDatagram::MaxSize);
+        else
+            datagrams[i].frame.SetSize(H46019MultiplexDatagram::MaxSize);
+    }
+
+#ifdef H46019_MMSG
+    if (count > 1 && socket.GetHandle() >= 0) {
+        struct mmsghdr msgs[H46019MultiplexSocket::MaxBatchSize];
+        struct iovec iovecs[H46019MultiplexSocket::MaxBatchSize];
+        struct sockaddr_storage addrs[H46019MultiplexSocket::MaxBatchSize];
+
+        if (count > H46019MultiplexSocket::MaxBatchSize)
+            count = H46019MultiplexSocket::MaxBatchSize;
+
+        memset(msgs, 0, sizeof(struct mmsghdr)*count);
+        for (PINDEX i = 0; i < count; i++) {
+            iovecs[i].iov_base = datagrams[i].frame.GetPointer();
+            iovecs[i].iov_len = datagrams[i].frame.GetSize();
+            msgs[i].msg_hdr.msg_name = &addrs[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        int received = ::recvmmsg(socket.GetHandle(), msgs, count, MSG_DONTWAIT, NULL);
+        if (received < 0) {
+            error = errno;
+            return (error == EAGAIN || error == EWOULDBLOCK) ? 0 : -1;
+        }
+
+        for (int i = 0; i < received; i++) {
+            struct sockaddr * sa = (struct sockaddr *)&addrs[i];
+            datagrams[i].length = msgs[i].msg_len;
+            datagrams[i].addr = PIPSocket::Address(sa->sa_family, msgs[i].msg_hdr.msg_namelen, sa);
+            if (sa->sa_family == AF_INET6)
+                datagrams[i].port = ntohs(((struct sockaddr_in6 *)sa)->sin6_port);
+            else
+                datagrams[i].port = ntohs(((struct sockaddr_in *)sa)->sin_port);
+        }
+        return received;
+    }
+#endif
+
+    H46019MultiplexDatagram & datagram = datagrams[0];
+    if (!socket.ReadFrom(datagram.frame.GetPointer(), datagram.frame.GetSize(), datagram.addr, datagram.port)) {
+        error = socket.GetErrorNumber(PChannel::LastReadError);
+        return -1;
+    }
+    datagram.length = socket.GetLastReadCount();
+    return 1;
 }
 
-void PNatMethod_H46019::ReadThread(PThread &, H323_INT)
+void PNatMethod_H46019::ReadThread(PThread &, H323_INT param)
 {
-    PINDEX bufferLen = 2000;
-    RTP_MultiDataFrame buffer(bufferLen);
-    PINDEX len = bufferLen;
-    PIPSocket::Address addr;
-    WORD port = 0;
+    PINDEX shard = (PINDEX)param;
+    PINDEX batchSize = muxBatchSize;
+    H46019MultiplexDatagram * datagrams = new H46019MultiplexDatagram[batchSize];
 
     PUDPSocket * socket = NULL;
-    H46019MultiplexSocket::MuxType socketRead;
+    bool rtp = true;
 
-    PUDPSocket & dataSocket = *GetMultiplexReadSocket(true);
-    PUDPSocket & ctrlSocket = *GetMultiplexReadSocket(false);
+    PUDPSocket & dataSocket = *GetShardReadSocket(shard, true);
+    PUDPSocket & ctrlSocket = *GetShardReadSocket(shard, false);
 
     int select = 0;
     while (!muxShutdown) {
+        // Time out now and again so a close is noticed promptly
         if (select == 0)
-            select = PIPSocket::Select(dataSocket, ctrlSocket);
+            select = PIPSocket::Select(dataSocket, ctrlSocket, 500);
 
         switch (select) {
         case -1:
-            socketRead = H46019MultiplexSocket::e_rtp;
+            rtp = true;
             socket = &dataSocket;
             select = 0;
             break;
         case -2:
         case -3:
-            socketRead = H46019MultiplexSocket::e_rtcp;
+            rtp = false;
             socket = &ctrlSocket;
             if (select == -3) select = -1;  // loop back to read RTP socket
             else select = 0;
@@ -849,70 +946,26 @@ void PNatMethod_H46019::ReadThread(PThread &, H323_INT)
             continue;
     }
 
-    if (!muxShutdown && socket && socket->ReadFrom(buffer.GetPointer(), len, addr, port)) {
-        int actRead = socket->GetLastReadCount();
-        int muxHeader = buffer.GetMultiHeaderSize();
-        std::map<unsigned, PUDPSocket*>::const_iterator it;
-        switch (socketRead) {
-            case H46019MultiplexSocket::e_rtp:
-            {
-                DWORD multiplexID = 0;
-                if (PNatMethod_H46019::IsMultiplexed() && !buffer.IsValidRTPPayload()) {
-                    if (!buffer.IsNotMultiplexed()) {
-                        PTRACE(2, "H46019M\tBad RTP MUX Packet received from " << addr << ":" << port);
-                        continue;
-                    }
-                    // We have received a valid RTP UnMuxed Packet.
-                    muxHeader = 0;  // Read from the first byte
-                    multiplexID = ResolveMuxIDFromSourceAddress(rtpSocketMap, rtpPortMap, addr, port);
-                    } else {
-                        multiplexID = buffer.GetMultiplexID();
-                    }
-
-                    it = rtpSocketMap.find(multiplexID);
-                    if (it == rtpSocketMap.end()) {
-                        unsigned badMUXid = multiplexID;
-                        unsigned rightMUXid = 0;
-                        unsigned detected = ResolveSession(rtpSocketMap, badMUXid, true, addr, port, rightMUXid);
-                        if (!detected) {
-                            PTRACE(2, "H46019M\tReceived RTP packet with unknown MUX ID " << badMUXid << " " << addr << ":" << port);
-                            continue;
-                        }
-                        it = rtpSocketMap.find(detected);
-                        if (it == rtpSocketMap.end()) continue;
-
-                        if (rightMUXid == 0) {
-                            PTRACE(2, "H46019M\tERROR: Receive UnMultiplex Packet " << " " << addr << ":" << port);
-                            ((H46019UDPSocket *)it->second)->WriteMultiplexBuffer(buffer.GetPointer(), actRead, addr, port);
-                            continue;
-                        }
-                        PTRACE(2, "H46019M\tERROR: Recover Receive Multiplex Session " << rightMUXid  << " incorrectly sent as " << badMUXid);
-                    }
-                    break;
-                }
-
-                case H46019MultiplexSocket::e_rtcp:
-                    it = rtcpSocketMap.find(buffer.GetMultiplexID());
-                    if (it == rtcpSocketMap.end()) {
-                        PTRACE(2, "H46019M\tReceived RTCP packet with unknown MUX ID "
-                                << buffer.GetMultiplexID() << " " << addr << ":" << port);
-                        continue;
-                    }
-                break;
-                default:
-                    PTRACE(2, "H46019M\tUnknown Muxed RTP packet received from " << addr << ":" << port);
-                    continue;
-             }
-
-             ((H46019UDPSocket *)it->second)->WriteMultiplexBuffer(buffer.GetPointer()+muxHeader, actRead-muxHeader, addr, port);
-             len = bufferLen;
-         } else {
+    if (muxShutdown || !socket)
+        continue;
+
+    int error = 0;
+    PINDEX count = H46019MultiplexSocket::ReadBatch(*socket, datagrams, batchSize, error);
+    if (count > 0) {
+        const H46019MultiplexTable * table = AcquireMultiplexTable(rtp, shard);
+        for (PINDEX i = 0; i < count; i++) {
+            OnMultiplexPacket(rtp, datagrams[i], table);
+            // Drop our reference, a session queue may still hold the buffer
+            datagrams[i].frame.Release();
+        }
+        ReleaseMultiplexTable(rtp, shard);
+    } else if (count < 0) {
              if (muxShutdown) continue;
 
-              switch (socket->GetErrorNumber(PChannel::LastReadError)) {
+              switch (error) {
                 case ECONNRESET :
 /*                PTRACE(2, "H46019M\tUDP Port Reset! Closing all Sockets");
-                  if (socketRead == H46019MultiplexSocket::e_rtp)
+                  if (rtp)
                              CloseAllSessions(rtpSocketMap);
                    continue; */
                 case ECONNREFUSED :
@@ -920,7 +973,7 @@ void PNatMethod_H46019::ReadThread(PThread &, H323_INT)
                   continue;
 
                 case EMSGSIZE :
-                  PTRACE(2, "H46019M\tRead UDP packet too large for buffer of " << len << " bytes.");
+                  PTRACE(2, "H46019M\tRead UDP packet too large for buffer of " << datagrams[0].frame.GetSize() << " bytes.");
                   continue;
 
                 case EBADF : // Interface went down
@@ -931,20 +984,117 @@ void PNatMethod_H46019::ReadThread(PThread &, H323_INT)
          }
      }
 
-     m_readThread = NULL;
-     PTRACE(4, "H46019M\tMultiplex Read Shutdown");
+     delete [] datagrams;
+
+     PTRACE(4, "H46019M\tMultiplex Read Shutdown " << shard);
+}
+
+#define MUX_HEADER_SIZE 4
+
+static DWORD GetFrameMultiplexID(const RTP_FrameSlice & frame)
+{
+    if (frame.GetSize() < MUX_HEADER_SIZE)
+        return 0;
+    return *(const PUInt32b *)frame.GetPointer();
+}
+
+// Same check as RTP_MultiDataFrame::IsValidRTPPayload() on the pooled buffer
+static PBoolean IsValidFrameRTPPayload(const RTP_FrameSlice & frame, PBoolean muxed)
+{
+    PINDEX muxHeader = muxed ? MUX_HEADER_SIZE : 0;
+    if (frame.GetSize() < muxHeader+2)
+        return false;
+
+    const BYTE * data = frame.GetPointer() + muxHeader;
+    if (((data[0]>>6)&3) != 2)
+        return false;
+
+    return (RTP_DataFrame::PayloadTypes)(data[1]&0x7f) < RTP_DataFrame::IllegalPayloadType;
+}
+
+void PNatMethod_H46019::OnMultiplexPacket(bool rtp, H46019MultiplexDatagram & datagram, const H46019MultiplexTable * table)
+{
+    RTP_FrameSlice & buffer = datagram.frame;
+    const PIPSocket::Address & addr = datagram.addr;
+    WORD port = datagram.port;
+    int muxHeader = MUX_HEADER_SIZE;
+    PUDPSocket * socket = NULL;
+
+    buffer.SetSize(datagram.length);
+
+    if (rtp) {
+        DWORD multiplexID = 0;
+        if (PNatMethod_H46019::IsMultiplexed() && !IsValidFrameRTPPayload(buffer, true)) {
+            if (!IsValidFrameRTPPayload(buffer, false)) {
+                PTRACE(2, "H46019M\tBad RTP MUX Packet received from " << addr << ":" << port);
+                return;
+            }
+            // We have received a valid RTP UnMuxed Packet.
+            muxHeader = 0;  // Read from the first byte
+            PWaitAndSignal m(muxMutex);
+            multiplexID = ResolveMuxIDFromSourceAddress(rtpSocketMap, rtpPortMap, addr, port);
+        } else {
+            multiplexID = GetFrameMultiplexID(buffer);
+        }
+
+        if (table != NULL)
+            socket = table->Find(multiplexID);
+
+        if (socket == NULL) {
+            // Not registered, try and recover the session under the lock
+            PWaitAndSignal m(muxMutex);
+            unsigned badMUXid = multiplexID;
+            unsigned rightMUXid = 0;
+            unsigned detected = ResolveSession(rtpSocketMap, badMUXid, true, addr, port, rightMUXid);
+            if (!detected) {
+                PTRACE(2, "H46019M\tReceived RTP packet with unknown MUX ID " << badMUXid << " " << addr << ":" << port);
+                return;
+            }
+            std::map<unsigned, PUDPSocket*>::const_iterator it = rtpSocketMap.find(detected);
+            if (it == rtpSocketMap.end())
+                return;
+
+            if (rightMUXid == 0) {
+                PTRACE(2, "H46019M\tERROR: Receive UnMultiplex Packet " << " " << addr << ":" << port);
+                ((H46019UDPSocket *)it->second)->WriteMultiplexBuffer(buffer, addr, port);
+                return;
+            }
+            PTRACE(2, "H46019M\tERROR: Recover Receive Multiplex Session " << rightMUXid  << " incorrectly sent as " << badMUXid);
+            socket = it->second;
+        }
+    } else {
+        if (table != NULL)
+            socket = table->Find(GetFrameMultiplexID(buffer));
+        if (socket == NULL) {
+            PTRACE(2, "H46019M\tReceived RTCP packet with unknown MUX ID "
+                    << GetFrameMultiplexID(buffer) << " " << addr << ":" << port);
+            return;
+        }
+    }
+
+    // Skip the multiplex header in place, the session queue shares the buffer
+    if (!buffer.Advance(muxHeader))
+        return;
+
+    ((H46019UDPSocket *)socket)->WriteMultiplexBuffer(buffer, addr, port);
 }
 
 void PNatMethod_H46019::RegisterSocket(bool rtp, unsigned id, PUDPSocket * socket)
 {
+    PWaitAndSignal m(muxMutex);
+
     if (rtp)
        rtpSocketMap.insert(pair<unsigned, PUDPSocket*>(id,socket));
     else
        rtcpSocketMap.insert(pair<unsigned, PUDPSocket*>(id,socket));
+
+    PublishMultiplexTable(rtp);
 }
 
 void PNatMethod_H46019::UnregisterSocket(bool rtp, unsigned id)
 {
+    muxMutex.Wait();
+
     if (rtp) {
         std::map<unsigned, PUDPSocket*>::iterator it = rtpSocketMap.find(id);
         if (it != rtpSocketMap.end())
@@ -955,20 +1105,213 @@ void PNatMethod_H46019::UnregisterSocket(bool rtp, unsigned id)
              rtcpSocketMap.erase(it);
     }
 
-    if (rtp && rtpSocketMap.size() == 0) {
+    PublishMultiplexTable(rtp);
+
+    PBoolean closing = rtp && rtpSocketMap.size() == 0;
+    if (closing) {
         muxShutdown = true;
-        if (muxSockets.rtp) {
-            muxSockets.rtp->Close();
-            delete muxSockets.rtp;
-            muxSockets.rtp = NULL;
+        EnableMultiplex(false);
+    }
+
+    muxMutex.Signal();
+
+    // Waits for the reader threads, so must not hold muxMutex they may need
+    if (closing)
+        CloseMultiplexSockets();
+}
+
+PBoolean PNatMethod_H46019::OpenMultiplexShards(const PIPSocket::Address & binding)
+{
+    WORD port = muxSockets.rtp->GetPort();
+    PINDEX wanted = muxReaders;
+
+    muxReaders = 1;
+    while (muxReaders < wanted) {
+        H46019MultiplexSocket * rtp = CreateMultiplexSocket(true, muxBatchSize, true);
+        H46019MultiplexSocket * rtcp = CreateMultiplexSocket(false, muxBatchSize, true);
+        if (!rtp->Listen(binding, 1, port) || !rtcp->Listen(binding, 1, (WORD)(port+1))) {
+            PTRACE(2, "H46019M\tCould not share multiplex port " << port << ", using "
+                   << muxReaders << " reader threads");
+            delete rtp;
+            delete rtcp;
+            break;
         }
-        if (muxSockets.rtcp) {
-            muxSockets.rtcp->Close();
-            delete muxSockets.rtcp;
-            muxSockets.rtcp = NULL;
+        rtp->SetReadTimeout(500);
+        rtcp->SetReadTimeout(500);
+
+        H323Connection::NAT_Sockets shard;
+        shard.rtp = rtp;
+        shard.rtcp = rtcp;
+        muxShards.push_back(shard);
+        muxReaders++;
+    }
+
+    PTRACE(4, "H46019M\tMultiplex port " << port << " served by " << muxReaders << " reader threads");
+    return muxReaders > 1;
+}
+
+void PNatMethod_H46019::CloseMultiplexSockets()
+{
+    std::vector<PUDPSocket *> sockets;
+    std::vector<PThread *> threads;
+
+    muxMutex.Wait();
+    if (muxSockets.rtp)
+        sockets.push_back(muxSockets.rtp);
+    if (muxSockets.rtcp)
+        sockets.push_back(muxSockets.rtcp);
+    muxSockets.rtp = NULL;
+    muxSockets.rtcp = NULL;
+
+    for (std::vector<H323Connection::NAT_Sockets>::iterator i = muxShards.begin(); i != muxShards.end(); ++i) {
+        sockets.push_back(i->rtp);
+        sockets.push_back(i->rtcp);
+    }
+    muxShards.clear();
+    threads.swap(muxReadThreads);
+    muxMutex.Signal();
+
+    // Close the sockets to get the readers out of Select(), then wait for
+    // them to let go of their socket references before deleting anything.
+    std::vector<PUDPSocket *>::iterator s;
+    for (s = sockets.begin(); s != sockets.end(); ++s)
+        (*s)->Close();
+
+    PBoolean fromReader = false;
+    for (std::vector<PThread *>::iterator t = threads.begin(); t != threads.end(); ++t) {
+        if (*t == PThread::Current()) {
+            // Cannot wait for ourselves, leave the thread to clean up after itself
+            (*t)->SetAutoDelete(PThread::AutoDeleteThread);
+            fromReader = true;
+            continue;
         }
-        EnableMultiplex(false);
+        (*t)->WaitForTermination();
+        delete *t;
     }
+
+    if (fromReader) {
+        PTRACE(2, "H46019M	Multiplex closed from a reader thread, sockets not deleted");
+        return;
+    }
+
+    for (s = sockets.begin(); s != sockets.end(); ++s)
+        delete *s;
+}
+
+PUDPSocket * PNatMethod_H46019::GetShardReadSocket(PINDEX shard, bool rtp)
+{
+    if (shard == 0)
+        return GetMultiplexReadSocket(rtp);
+
+    return rtp ? muxShards[shard-1].rtp : muxShards[shard-1].rtcp;
+}
+
+void PNatMethod_H46019::PublishMultiplexTable(bool rtp)
+{
+    PWaitAndSignal m(muxMutex);
+
+    H46019MultiplexTable * volatile & current = rtp ? rtpMuxTable : rtcpMuxTable;
+    H46019MultiplexTable * table = new H46019MultiplexTable(rtp ? rtpSocketMap : rtcpSocketMap);
+
+    H46019MultiplexTable * old = current;
+    H323_MEMORY_BARRIER();
+    current = table;
+    H323_MEMORY_BARRIER();
+
+    if (old != NULL)
+        muxRetired.push_back(old);
+
+    // Free the retired tables no reader thread is still looking at
+    std::list<H46019MultiplexTable *>::iterator r = muxRetired.begin();
+    while (r != muxRetired.end()) {
+        PBoolean inUse = false;
+        for (PINDEX i = 0; i < MaxMultiplexReaders*2; i++) {
+            if (muxHazards[i] == *r) {
+                inUse = true;
+                break;
+            }
+        }
+        if (inUse)
+            ++r;
+        else {
+            delete *r;
+            r = muxRetired.erase(r);
+        }
+    }
+}
+
+const H46019MultiplexTable * PNatMethod_H46019::AcquireMultiplexTable(bool rtp, PINDEX shard)
+{
+    H46019MultiplexTable * volatile & current = rtp ? rtpMuxTable : rtcpMuxTable;
+    H46019MultiplexTable * volatile & hazard = muxHazards[shard*2 + (rtp ? 0 : 1)];
+
+    // Announce the table before using it, and check it was not retired
+    // before the announcement could be seen by PublishMultiplexTable().
+    H46019MultiplexTable * table;
+    do {
+        table = current;
+        hazard = table;
+        H323_MEMORY_BARRIER();
+    } while (table != current);
+
+    return table;
+}
+
+void PNatMethod_H46019::ReleaseMultiplexTable(bool rtp, PINDEX shard)
+{
+    H323_MEMORY_BARRIER();
+    muxHazards[shard*2 + (rtp ? 0 : 1)] = NULL;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+static inline unsigned MultiplexHash(unsigned id)
+{
+    id ^= id >> 16;
+    id *= 0x45d9f3b;
+    id ^= id >> 16;
+    return id;
+}
+
+H46019MultiplexTable::H46019MultiplexTable(const muxSocketMap & socMap)
+{
+    // Keep the table at most half full so probe sequences stay short
+    unsigned size = 16;
+    while (size < socMap.size()*2)
+        size <<= 1;
+
+    m_mask = size-1;
+    m_slots = new Slot[size];
+    memset(m_slots, 0, sizeof(Slot)*size);
+
+    for (muxSocketMap::const_iterator i = socMap.begin(); i != socMap.end(); ++i) {
+        if (i->first == 0)  // Zero marks an empty slot and is never a valid multiplexID
+            continue;
+        unsigned pos = MultiplexHash(i->first) & m_mask;
+        while (m_slots[pos].id != 0)
+            pos = (pos+1) & m_mask;
+        m_slots[pos].id = i->first;
+        m_slots[pos].socket = i->second;
+    }
+}
+
+H46019MultiplexTable::~H46019MultiplexTable()
+{
+    delete [] m_slots;
+}
+
+PUDPSocket * H46019MultiplexTable::Find(unsigned id) const
+{
+    if (id == 0)
+        return NULL;
+
+    unsigned pos = MultiplexHash(id) & m_mask;
+    while (m_slots[pos].id != 0) {
+        if (m_slots[pos].id == id)
+            return m_slots[pos].socket;
+        pos = (pos+1) & m_mask;
+    }
+    return NULL;
 }
 #endif
 
@@ -976,12 +1319,12 @@ void PNatMethod_H46019::UnregisterSocket(bool rtp, unsigned id)
 
 #ifdef H323_H46019M
 H46019MultiplexSocket::H46019MultiplexSocket()
- : m_subSocket(NULL), m_plexType(e_unknown)
+ : m_subSocket(NULL), m_plexType(e_unknown), m_reusePort(false), m_batchSize(1)
 {
 }
 
 H46019MultiplexSocket::H46019MultiplexSocket(bool rtp)
-: m_subSocket(NULL), m_plexType(rtp ? e_rtp : e_rtcp)
+: m_subSocket(NULL), m_plexType(rtp ? e_rtp : e_rtcp), m_reusePort(false), m_batchSize(1)
 {
 }
 
@@ -1029,6 +1372,12 @@ PBoolean H46019MultiplexSocket::ReadFrom(void *buf, PINDEX len, Address & addr,
 
 PBoolean H46019MultiplexSocket::WriteTo(const void *buf, PINDEX len, const Address & addr, WORD pt)
 {
+#ifdef H46019_MMSG
+    if (m_batchSize > 1 && m_subSocket == NULL) {
+        return WriteFrame(RTP_FramePool::Default().Copy(buf, len), addr, pt);
+    }
+#endif
+
     PWaitAndSignal m(m_mutex);
 
     if (m_subSocket)
@@ -1037,6 +1386,149 @@ PBoolean H46019MultiplexSocket::WriteTo(const void *buf, PINDEX len, const Addre
         return PUDPSocket::WriteTo(buf,len,addr,pt);
 }
 
+PBoolean H46019MultiplexSocket::WriteFrame(const RTP_FrameSlice & frame, const Address & addr, WORD pt)
+{
+#ifdef H46019_MMSG
+    if (m_batchSize > 1 && m_subSocket == NULL) {
+        H46019MultiPacket packet;
+        packet.fromAddr = addr;
+        packet.fromPort = pt;
+        packet.frame = frame;
+
+        m_queueMutex.Wait();
+        m_writeQueue.push(packet);
+        m_queueMutex.Signal();
+
+        return WriteQueued();
+    }
+#endif
+
+    PWaitAndSignal m(m_mutex);
+
+    if (m_subSocket)
+        return m_subSocket->WriteTo(frame.GetPointer(),frame.GetSize(),addr,pt);
+    else
+        return PUDPSocket::WriteTo(frame.GetPointer(),frame.GetSize(),addr,pt);
+}
+
+void H46019MultiplexSocket::SetBatchSize(PINDEX size)
+{
+    m_batchSize = PMAX(1, PMIN(size, (PINDEX)MaxBatchSize));
+}
+
+PBoolean H46019MultiplexSocket::OpenSocket()
+{
+    return PUDPSocket::OpenSocket() && ApplyReusePort();
+}
+
+PBoolean H46019MultiplexSocket::OpenSocket(int ipAdressFamily)
+{
+    return PUDPSocket::OpenSocket(ipAdressFamily) && ApplyReusePort();
+}
+
+PBoolean H46019MultiplexSocket::ApplyReusePort()
+{
+    if (!m_reusePort)
+        return true;
+
+#ifdef SO_REUSEPORT
+    if (SetOption(SO_REUSEPORT, 1, SOL_SOCKET))
+        return true;
+#endif
+
+    // Carry on with a single reader, the other sockets will fail to bind
+    PTRACE(2, "H46019M\tSO_REUSEPORT not available for multiplex socket");
+    return true;
+}
+
+#ifdef H46019_MMSG
+static socklen_t SetMultiplexSocketAddress(struct sockaddr_storage & sa, const PIPSocket::Address & addr, WORD port)
+{
+    memset(&sa, 0, sizeof(sa));
+#if P_HAS_IPV6
+    if (addr.GetVersion() == 6) {
+        struct sockaddr_in6 & in6 = (struct sockaddr_in6 &)sa;
+        in6.sin6_family = AF_INET6;
+        in6.sin6_addr = addr;
+        in6.sin6_port = htons(port);
+        return sizeof(in6);
+    }
+#endif
+    struct sockaddr_in & in = (struct sockaddr_in &)sa;
+    in.sin_family = AF_INET;
+    in.sin_addr = addr;
+    in.sin_port = htons(port);
+    return sizeof(in);
+}
+#endif
+
+PBoolean H46019MultiplexSocket::WriteQueued()
+{
+#ifdef H46019_MMSG
+    PBoolean ok = true;
+
+    /* Whichever writer gets the send mutex sends everything queued, including
+       packets from writers that found it busy, and checks again after letting
+       go so nothing queued in the meantime is left behind. */
+    for (;;) {
+        if (!m_mutex.Wait(0))
+            return ok;
+
+        for (;;) {
+            H46019MultiPacket packets[MaxBatchSize];
+            struct mmsghdr msgs[MaxBatchSize];
+            struct iovec iovecs[MaxBatchSize];
+            struct sockaddr_storage addrs[MaxBatchSize];
+
+            int count = 0;
+            m_queueMutex.Wait();
+            while (count < m_batchSize && !m_writeQueue.empty()) {
+                packets[count] = m_writeQueue.front();
+                m_writeQueue.pop();
+                count++;
+            }
+            m_queueMutex.Signal();
+
+            if (count == 0)
+                break;
+
+            memset(msgs, 0, sizeof(struct mmsghdr)*count);
+            for (int i = 0; i < count; i++) {
+                iovecs[i].iov_base = packets[i].frame.GetPointer();
+                iovecs[i].iov_len = packets[i].frame.GetSize();
+                msgs[i].msg_hdr.msg_name = &addrs[i];
+                msgs[i].msg_hdr.msg_namelen = SetMultiplexSocketAddress(addrs[i], packets[i].fromAddr, packets[i].fromPort);
+                msgs[i].msg_hdr.msg_iov = &iovecs[i];
+                msgs[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            int sent = 0;
+            while (sent < count) {
+                int result = ::sendmmsg(GetHandle(), &msgs[sent], count-sent, 0);
+                if (result < 0) {
+                    if (errno == EINTR)
+                        continue;
+                    PTRACE(2, "H46019M\tMultiplex batch write failed, " << count-sent << " packets dropped, error " << errno);
+                    ok = false;
+                    break;
+                }
+                sent += result;
+            }
+        }
+
+        m_mutex.Signal();
+
+        m_queueMutex.Wait();
+        PBoolean empty = m_writeQueue.empty();
+        m_queueMutex.Signal();
+        if (empty)
+            return ok;
+    }
+#else
+    return false;
+#endif
+}
+
 PBoolean H46019MultiplexSocket::Close()
 {
     if (m_subSocket)
@@ -1327,6 +1819,12 @@ void H46019UDPSocket::SetMultiplexID(unsigned id, PBoolean isAck)
 
 PBoolean H46019UDPSocket::WriteMultiplexBuffer(const void * buf, PINDEX len, const Address & addr, WORD port)
 {
+    return WriteMultiplexBuffer(RTP_FramePool::Default().Copy(buf, len), addr, port);
+}
+
+PBoolean H46019UDPSocket::WriteMultiplexBuffer(const RTP_FrameSlice & frame, const Address & addr, WORD port)
+{
+    PINDEX len = frame.GetSize();
     if (rtpSocket && len == 12) {  /// Filter out RTP keepAlive Packets
 #ifdef H323_H46024B
         if (m_h46024b && addr == m_altAddr /*&& port == m_altPort*/) {
@@ -1344,18 +1842,16 @@ PBoolean H46019UDPSocket::WriteMultiplexBuffer(const void * buf, PINDEX len, con
     H46019MultiPacket packet;
         packet.fromAddr = addr;
         packet.fromPort = port;
-        packet.frame.SetSize(len);
-        memcpy(packet.frame.GetPointer(), buf, len);
+        packet.frame = frame;
 
     m_multiMutex.Wait();
       m_multQueue.push(packet);
     m_multiMutex.Signal();
     m_multiBuffer++;
 
-    if (!rtpSocket) {
-        RTP_ControlFrame frame(len);
-        memcpy(frame.GetPointer(),buf,len);
-        if (frame.GetPayloadType() == RTP_ControlFrame::e_ApplDefined) {
+    if (!rtpSocket && len > 1) {
+        // Payload type of the first RTCP packet, no need for an RTP_ControlFrame copy
+        if (frame.GetPointer()[1] == RTP_ControlFrame::e_ApplDefined) {
             PTRACE(6, "H46024A\tReading RTCP Probe Packet.");
             PBYTEArray tempData;
             tempData.SetSize(2048);
@@ -1448,11 +1944,13 @@ PBoolean H46019UDPSocket::WriteSocket(const void * buf, PINDEX len, const Addres
         if (muxSocket && !mux)                            // Rec'v Multiplex
             return muxSocket->WriteTo(buf,len, addr, port);
 
-        RTP_MultiDataFrame frame(mux,(const BYTE *)buf,len);
+        // One copy into a pooled buffer, the multiplex ID goes in its head room
+        RTP_FrameSlice frame = RTP_FramePool::Default().Copy(buf, len);
+        *(PUInt32b *)frame.Prepend(MUX_HEADER_SIZE) = mux;
         if (!muxSocket)                                                // Send Multiplex
             return PUDPSocket::WriteTo(frame.GetPointer(), frame.GetSize(), addr, port);
         else                                                           //  Send & Rec'v Multiplexed
-            return muxSocket->WriteTo(frame.GetPointer(), frame.GetSize(), addr, port);
+            return ((H46019MultiplexSocket *)muxSocket)->WriteFrame(frame, addr, port);
 
     }
 }
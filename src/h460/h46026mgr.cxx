@@ -51,12 +51,13 @@
 #define FAST_UPDATE_INTERVAL  REC_FRAME_TIME * 3
 #define MAX_VIDEO_KBPS       384000.0
 
-
-#define PACKETDELAY(sz,mbps) \
-      int((double(sz) / (mbps *0.5)) * 1000.0);
-
 //-------------------------------------------
 
+static double PacketDelay(PINDEX sz, double mbps)
+{
+    return (double(sz) / (mbps *0.5)) * 1000.0;
+}
+
 
 static bool GetInfoUUIE(const Q931 & q931, H225_H323_UserInformation & uuie)
 {
@@ -211,6 +212,8 @@ H46026UDPBuffer::H46026UDPBuffer(int sessionId, PBoolean rtp)
 {
     m_size = 0;
     m_rtp = rtp;
+    m_type = H46026ChannelManager::e_Audio;
+    m_firstTime = 0;
     m_data.m_sessionId.SetValue(sessionId);
     m_data.m_dataFrame = m_rtp;
     m_data.m_frame.SetSize(0);
@@ -225,6 +228,8 @@ void H46026UDPBuffer::SetFrame(const PBYTEArray & data)
 {
     m_size += data.GetSize();
     int sz = m_data.m_frame.GetSize();
+    if (sz == 0)
+        m_firstTime = PTimer::Tick().GetMilliSeconds();
     m_data.m_frame.SetSize(sz+1);
     m_data.m_frame[sz].SetTag(m_rtp ? H46026_FrameData::e_rtp : H46026_FrameData::e_rtcp);
     PASN_OctetString & raw = m_data.m_frame[sz];
@@ -288,7 +293,8 @@ void H46026_MediaFrame::PrintInfo(ostream & strm) const
 //-------------------------------------------
 
 H46026ChannelManager::H46026ChannelManager()
-:  m_mbps(MAX_VIDEO_KBPS), m_socketPacketReady(false), m_currentPacketTime(0), m_pktCounter(0)
+:  m_mbps(MAX_VIDEO_KBPS), m_socketPacketReady(false), m_currentPacketTime(0), m_pktCounter(0),
+   m_latencyBudget(0), m_socketQueueSize(0)
 {
 
     // Initialise the Information PDU RTP Message structure.
@@ -321,8 +327,8 @@ H46026ChannelManager::~H46026ChannelManager()
     PWaitAndSignal m(m_queueMutex);
 
     ClearBufferEntries(m_rtpBuffer, 0);
-    while (!m_socketQueue.empty())
-        m_socketQueue.pop();
+    for (int i = 0; i <= socketOrder::Priority_Low; ++i)
+        m_socketQueue[i].clear();
 }
 
  void H46026ChannelManager::RTPFrameIn(unsigned crv, PINDEX sessionId, PBoolean rtp, const PBYTEArray & data)
@@ -335,8 +341,15 @@ H46026ChannelManager::~H46026ChannelManager()
      m_mbps = double(bps);
  }
 
+void H46026ChannelManager::SetLatencyBudget(unsigned ms)
+{
+    m_latencyBudget = ms;
+    m_socketReady.Signal();
+}
+
 void H46026ChannelManager::BufferRelease(unsigned crv)
 {
+    PWaitAndSignal m(m_writeMutex);
     ClearBufferEntries(m_rtpBuffer, crv);
 }
 
@@ -348,7 +361,7 @@ PBoolean H46026ChannelManager::SignalMsgOut(const Q931 & pdu)
     prior.crv = pdu.GetCallReference();
     prior.priority = socketOrder::Priority_High;
     prior.packTime = PTimer::Tick().GetMilliSeconds();
-    prior.delay = PACKETDELAY(pdu.GetIE(Q931::UserUserIE).GetSize(), m_mbps);
+    prior.delay = (int)PacketDelay(pdu.GetIE(Q931::UserUserIE).GetSize(), m_mbps);
     return WriteQueue(pdu, prior);
 }
 
@@ -361,7 +374,7 @@ PBoolean H46026ChannelManager::SignalMsgOut(const BYTE * data, PINDEX len)
     prior.crv = 0;
     prior.priority = socketOrder::Priority_High;
     prior.packTime = PTimer::Tick().GetMilliSeconds();
-    prior.delay = PACKETDELAY(len, m_mbps);
+    prior.delay = (int)PacketDelay(len, m_mbps);
     return WriteQueue(msg, prior);
 }
 
@@ -405,7 +418,7 @@ PBoolean H46026ChannelManager::PackageFrame(PBoolean rtp, unsigned crv, PacketTy
         prior.priority = socketOrder::Priority_Low;
     prior.id = NextPacketCounter();
     prior.packTime = PTimer::Tick().GetMilliSeconds();
-    prior.delay = PACKETDELAY(mediaPDU.GetIE(Q931::UserUserIE).GetSize(), m_mbps);
+    prior.delay = (int)PacketDelay(mediaPDU.GetIE(Q931::UserUserIE).GetSize(), m_mbps);
 
     if (PTrace::CanTrace(6)) {
         PStringStream info;
@@ -438,6 +451,7 @@ PBoolean H46026ChannelManager::RTPFrameOut(unsigned crv, PacketTypes id, PINDEX
         H46026UDPBuffer * buffer = GetRTPBuffer(crv, sessionId);
         if (!buffer) return false;
 
+        buffer->SetType(id);
         PBoolean toSend = false;
         switch (id) {
             case e_Audio:
@@ -463,8 +477,12 @@ PBoolean H46026ChannelManager::RTPFrameOut(unsigned crv, PacketTypes id, PINDEX
             PBoolean sent = PackageFrame(rtp, crv, id, sessionId, buffer->GetBuffer());
             buffer->ClearBuffer();
             return sent;
-        } else
-            return ProcessQueue();
+        }
+
+        // Let a waiting writer pick up the deadline of a newly started buffer
+        if (m_latencyBudget > 0 && buffer->GetPacketCount() == 1)
+            m_socketReady.Signal();
+        return ProcessQueue();
     } else {
        H46026UDPBuffer data(sessionId, rtp);
        data.SetFrame(msg);
@@ -476,31 +494,86 @@ PBoolean H46026ChannelManager::ProcessQueue()
 {
     PWaitAndSignal m(m_queueMutex);
 
-    if (m_socketQueue.size() == 0) {
-        m_socketPacketReady = false;
-        return true;
+    H46026SocketFifo & video = m_socketQueue[socketOrder::Priority_Discretion];
+    if (!video.empty()) {
+        PInt64 nowTime = PTimer::Tick().GetMilliSeconds();
+        PInt64 stackTime = nowTime - video.front().second.packTime;
+
+        if (stackTime > MAX_STACK_DESCRETION) {
+            PTRACE(5,"H46026\tPossible pipe blockage detected. Delay " << stackTime << " Dropping video frames...");
+            unsigned crv = video.front().second.crv;
+            PINDEX sessionId = video.front().second.sessionId;
+            m_socketQueueSize -= (PINDEX)video.size();
+            video.clear();
+            FastUpdatePictureRequired(crv, sessionId);
+            // TODO: Flow Control based on the Time in the queue (stackTime) - SH
+        }
     }
 
-    PInt64 nowTime = PTimer::Tick().GetMilliSeconds();
-    PInt64 stackTime = nowTime - m_socketQueue.top().second.packTime;
+    m_socketPacketReady = (m_socketQueueSize > 0);
+
+    return true;
+}
+
+PInt64 H46026ChannelManager::FlushExpired(PInt64 nowTime)
+{
+    if (m_latencyBudget == 0)
+        return -1;
+
+    PWaitAndSignal m(m_writeMutex);
+
+    PInt64 wait = -1;
+    for (H46026RTPBuffer::iterator r = m_rtpBuffer.begin(); r != m_rtpBuffer.end(); ++r) {
+        for (H46026CallMap::iterator c = r->second.begin(); c != r->second.end(); ++c) {
+            H46026UDPBuffer * buffer = c->second;
+            if (buffer->GetPacketCount() == 0)
+                continue;
+
+            PInt64 expires = buffer->GetFirstFrameTime() + m_latencyBudget - nowTime;
+            if (expires <= 0) {
+                PackageFrame(true, r->first, (PacketTypes)buffer->GetType(), c->first, buffer->GetBuffer());
+                buffer->ClearBuffer();
+            } else if (wait < 0 || expires < wait)
+                wait = expires;
+        }
+    }
+
+    return wait;
+}
 
-    PBoolean dropPacket = ((m_socketQueue.top().second.priority == socketOrder::Priority_Discretion) &&
-            (stackTime > MAX_STACK_DESCRETION));
+PBoolean H46026ChannelManager::PopPacket(PInt64 nowTime, PBYTEArray & packet, PInt64 & wait)
+{
+    ProcessQueue();
+
+    PWaitAndSignal m(m_queueMutex);
 
-    if (dropPacket) {
+    wait = -1;
+    if (m_socketQueueSize == 0)
+        return false;
+
+    if (m_currentPacketTime > nowTime) {
+        wait = (PInt64)(m_currentPacketTime - nowTime) + 1;
+        return false;
+    }
 
-        PTRACE(5,"H46026\tPossible pipe blockage detected. Delay " << stackTime << " Dropping video frames...");
-        unsigned crv = m_socketQueue.top().second.crv;
-        PINDEX sessionId = m_socketQueue.top().second.sessionId;
-        while (m_socketQueue.size()>0 && m_socketQueue.top().second.priority == socketOrder::Priority_Discretion) {
-            m_socketQueue.pop();
+    // Strict priority, first in first out within each priority
+    for (int priority = socketOrder::Priority_Critical; priority <= socketOrder::Priority_Low; ++priority) {
+        H46026SocketFifo & fifo = m_socketQueue[priority];
+        if (!fifo.empty()) {
+            PTRACE(6,"H46026\tSending #" << fifo.front().second.id << " delay " << fifo.front().second.delay << "ms");
+            packet = fifo.front().first;
+            fifo.pop_front();
+            m_socketQueueSize--;
+            break;
         }
-        FastUpdatePictureRequired(crv, sessionId);
-        // TODO: Flow Control based on the Time in the queue (stackTime) - SH
     }
 
-    m_socketPacketReady = (!m_socketQueue.empty());
+    // Pace the messages to the pipe bandwidth, without credit for idle time
+    if (m_currentPacketTime < nowTime)
+        m_currentPacketTime = (double)nowTime;
+    m_currentPacketTime += PacketDelay(packet.GetSize() - 4, m_mbps);
 
+    m_socketPacketReady = (m_socketQueueSize > 0);
     return true;
 }
 
@@ -568,28 +641,44 @@ PBoolean H46026ChannelManager::SocketOut(PBYTEArray & data, PINDEX & len)
 
 PBoolean H46026ChannelManager::SocketOut(BYTE * data, PINDEX & len)
 {
-    if (!m_socketPacketReady)
+    if (!m_socketPacketReady && m_latencyBudget == 0)
         return false;
 
     PInt64 nowTime = PTimer::Tick().GetMilliSeconds();
-    if (m_currentPacketTime > nowTime)
+    FlushExpired(nowTime);
+
+    PBYTEArray packet;
+    PInt64 wait;
+    if (!PopPacket(nowTime, packet, wait))
         return false;
 
-    PBoolean gotPacket = false;
-    m_queueMutex.Wait();
-        if (!m_socketQueue.empty()) {
-            PTRACE(6,"H46026\tSending #" << m_socketQueue.top().second.id << " delay " << m_socketQueue.top().second.delay << "ms");
-            m_currentPacketTime = nowTime + m_socketQueue.top().second.delay;
-            len = m_socketQueue.top().first.GetSize();
-            memcpy(data, (const BYTE *)m_socketQueue.top().first, len);
-            m_socketQueue.pop();
-            gotPacket = true;
-        } else {
-            m_currentPacketTime = nowTime;
-        }
-    m_queueMutex.Signal();
+    len = packet.GetSize() - 4;
+    memcpy(data, (const BYTE *)packet + 4, len);
+    return true;
+}
+
+PBoolean H46026ChannelManager::WaitSocketOut(PBYTEArray & packet, const PTimeInterval & timeout)
+{
+    PInt64 endTime = PTimer::Tick().GetMilliSeconds() + timeout.GetMilliSeconds();
+
+    for (;;) {
+        PInt64 nowTime = PTimer::Tick().GetMilliSeconds();
+        PInt64 flushWait = FlushExpired(nowTime);
+
+        PInt64 wait;
+        if (PopPacket(nowTime, packet, wait))
+            return true;
 
-    return gotPacket;
+        // Sleep until paced, a buffer expires, something is queued or timeout
+        if (wait < 0 || (flushWait >= 0 && flushWait < wait))
+            wait = flushWait;
+        if (wait < 0 || wait > endTime - nowTime)
+            wait = endTime - nowTime;
+        if (wait <= 0)
+            return false;
+
+        m_socketReady.Wait(PTimeInterval(wait));
+    }
 }
 
 PBoolean H46026ChannelManager::WriteQueue(const Q931 & msg, const socketOrder::MessageHeader & prior)
@@ -602,10 +691,26 @@ PBoolean H46026ChannelManager::WriteQueue(const Q931 & msg, const socketOrder::M
 
 PBoolean H46026ChannelManager::WriteQueue(const PBYTEArray & data, const socketOrder::MessageHeader & prior)
 {
+    // Framed with the RFC1006 TPKT header here so the writer sends it as is
+    PINDEX len = data.GetSize() + 4;
+    PBYTEArray packet(len);
+    packet[0] = 3;
+    packet[1] = 0;
+    packet[2] = (BYTE)(len >> 8);
+    packet[3] = (BYTE)len;
+    memcpy(packet.GetPointer() + 4, (const BYTE *)data, data.GetSize());
+
+    int priority = prior.priority;
+    if (priority < socketOrder::Priority_Critical || priority > socketOrder::Priority_Low)
+        priority = socketOrder::Priority_Low;
+
     m_queueMutex.Wait();
-     m_socketQueue.push(pair<PBYTEArray, socketOrder::MessageHeader>(data, prior) );
+     m_socketQueue[priority].push_back(pair<PBYTEArray, socketOrder::MessageHeader>(packet, prior) );
+     m_socketQueueSize++;
     m_queueMutex.Signal();
 
+    m_socketReady.Signal();
+
     return ProcessQueue();
 }
 
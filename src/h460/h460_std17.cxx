@@ -355,7 +355,10 @@ PBoolean H46017Transport::HandleH46017Socket()
       if (!IsOpen())
           return false;
 
+      // Only the Q.931 message is needed to pass it on, the H.225 part is
+      // decoded by the handler it is passed to.
       H323SignalPDU rpdu;
+      rpdu.SetLazyDecode(TRUE);
       if (!rpdu.Read(*this)) {
             PTRACE(3, "H46017\tSocket Read Failure");
             if (GetErrorNumber(PChannel::LastReadError) == 0) {
@@ -639,23 +642,13 @@ void H46017Transport::SetTunnel(H46026Tunnel * mgr)
 
 void H46017Transport::SocketWrite(PThread &, H323_INT)
 {
-    PBYTEArray tpkt(10004);  // 10K buffer with RFC1006 Header
-    tpkt[0] = 3;
-    tpkt[1] = 0;
-
-    PINDEX sz = 0;
-    int packetLength = 0;
+    // Messages are queued with their RFC1006 Header, the timeout only
+    // bounds how long it takes to notice the transport closing.
+    PBYTEArray tpkt;
     while (!closeTransport) {
-        if (m_socketMgr->SocketOut(tpkt.GetPointer()+4,sz)) {
-            packetLength = sz + 4;
-            tpkt[2] = (BYTE)(packetLength >> 8);
-            tpkt[3] = (BYTE)packetLength;
-            Write((const BYTE *)tpkt, packetLength);
-        } else {
-            PThread::Sleep(2);
-        }
+        if (m_socketMgr->WaitSocketOut(tpkt, 100))
+            Write((const BYTE *)tpkt, tpkt.GetSize());
     }
-    tpkt.SetSize(0);
     PTRACE(2,"H46017\tTunnel Write Thread ended");
 }
 #endif
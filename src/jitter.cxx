@@ -147,15 +147,23 @@ class RTP_AggregatedHandle : public PAggregatedHandle
 
 #define new PNEW
 
+/* Maximum number of frames taken from the transport each time the
+   scheduler polls a jitter buffer, so one busy stream cannot starve the
+   other buffers sharing the timer wheel. */
+#define MAX_FRAMES_PER_POLL 8
+
 /////////////////////////////////////////////////////////////////////////////
 
 RTP_JitterBuffer::RTP_JitterBuffer(RTP_Session & sess,
                                    unsigned minJitterDelay,
                                    unsigned maxJitterDelay,
                                    PINDEX stackSize)
-  : session(sess), jitterThread(NULL), jitterStackSize(stackSize)
+  : session(sess), framePool(NULL), framePoolSize(0), overrunFrame(NULL),
+    jitterThread(NULL), jitterStackSize(stackSize),
+    scheduler(NULL), schedulePeriod(0), scheduled(FALSE),
+    scheduledReadFrame(NULL), scheduledMarkerWarning(FALSE)
 {
-  // Jitter buffer is a queue of frames waiting for playback, a list of
+  // Jitter buffer is a queue of frames waiting for playback, a pool of
   // free frames, and a couple of place holders for the frame that is
   // currently beeing read from the RTP transport or written to the codec.
 
@@ -187,21 +195,16 @@ RTP_JitterBuffer::RTP_JitterBuffer(RTP_Session & sess,
   jitterCalc = 0;
   jitterCalcPacketCount = 0;
 
+  readerOverruns = 0;
+  consecutiveReaderOverruns = 0;
+  flushRequested = FALSE;
+
   shuttingDown = FALSE;
   preBuffering = TRUE;
   doneFirstWrite = FALSE;
 
-  // Allocate the frames and put them all into the free list
-  freeFrames = new Entry;
-  freeFrames->next = freeFrames->prev = NULL;
-
-  for (PINDEX i = 0; i < bufferSize; i++) {
-    Entry * frame = new Entry;
-    frame->prev = NULL;
-    frame->next = freeFrames;
-    freeFrames->prev = frame;
-    freeFrames = frame;
-  }
+  // Allocate the frames and put them all into the free queue
+  AllocateFrames(bufferSize);
 
   PTRACE(2, "RTP\tJitter buffer created:"
             " size=" << bufferSize <<
@@ -225,14 +228,18 @@ RTP_JitterBuffer::~RTP_JitterBuffer()
 {
   shuttingDown = TRUE;
 
+  if (scheduler != NULL) {
+    scheduler->Remove(*this);
+    scheduler = NULL;
+  }
 #ifdef H323_RTP_AGGREGATE
-  if (jitterThread == NULL) {
+  else if (aggregratedHandle != NULL) {
     aggregratedHandle->Remove();
     delete aggregratedHandle;  
     aggregratedHandle = NULL;
-  } else 
+  }
 #endif
-  {
+  else if (jitterThread != NULL) {
     PTRACE(3, "RTP\tRemoving jitter buffer " << this << ' ' << jitterThread->GetThreadName());
     //PAssert(jitterThread->WaitForTermination(10000), "Jitter buffer thread did not terminate");
 	jitterThread->WaitForTermination(3000);
@@ -243,20 +250,10 @@ RTP_JitterBuffer::~RTP_JitterBuffer()
   bufferMutex.Wait();
 
   // Free up all the memory allocated
-  while (oldestFrame != NULL) {
-    Entry * frame = oldestFrame;
-    oldestFrame = oldestFrame->next;
-    if (frame) delete frame;
-  }
-
-  while (freeFrames != NULL) {
-    Entry * frame = freeFrames;
-    freeFrames = freeFrames->next;
-    if (frame) delete frame;
-  }
-
-  if (currentWriteFrame)
-    delete currentWriteFrame;
+  delete [] framePool;
+  framePool = NULL;
+  delete overrunFrame;
+  overrunFrame = NULL;
 
   bufferMutex.Signal();
 
@@ -268,6 +265,46 @@ RTP_JitterBuffer::~RTP_JitterBuffer()
 }
 
 
+void RTP_JitterBuffer::AllocateFrames(PINDEX size)
+{
+  delete [] framePool;
+  delete overrunFrame;
+
+  // Room for a full buffer plus as many frames again in flight between the
+  // reading side and ReadData(), so the reading side only runs out of
+  // frames when ReadData() has stopped taking them.
+  framePoolSize = size*2 + 2;
+  framePool = new Entry[framePoolSize];
+  overrunFrame = new Entry;
+
+  receivedFrames.SetCapacity(framePoolSize);
+  freeFrames.SetCapacity(framePoolSize);
+
+  for (PINDEX i = 0; i < framePoolSize; i++) {
+    framePool[i].next = framePool[i].prev = NULL;
+    freeFrames.Push(&framePool[i]);
+  }
+
+  oldestFrame = newestFrame = currentWriteFrame = NULL;
+  scheduledReadFrame = NULL;
+  currentDepth = 0;
+}
+
+
+PBoolean RTP_JitterBuffer::IsReaderRunning() const
+{
+  if (scheduler != NULL)
+    return scheduled;
+
+#ifdef H323_RTP_AGGREGATE
+  if (aggregratedHandle != NULL)
+    return TRUE;
+#endif
+
+  return jitterThread != NULL && !jitterThread->IsTerminated();
+}
+
+
 void RTP_JitterBuffer::SetDelay(unsigned minJitterDelay, unsigned maxJitterDelay)
 {
   if (shuttingDown && jitterThread != NULL) {
@@ -282,32 +319,53 @@ void RTP_JitterBuffer::SetDelay(unsigned minJitterDelay, unsigned maxJitterDelay
   targetJitterTime = currentJitterTime;
 
   PINDEX newBufferSize = maxJitterTime/40+1;
-  while (bufferSize < newBufferSize) {
-    Entry * frame = new Entry;
-    frame->prev = NULL;
-    frame->next = freeFrames;
-    freeFrames->prev = frame;
-    freeFrames = frame;
-    bufferSize++;
-  }
-
-  if (jitterThread != NULL) {
-    if (jitterThread->IsTerminated()) {
-      packetsTooLate = 0;
-      bufferOverruns = 0;
-      consecutiveBufferOverruns = 0;
-      consecutiveMarkerBits = 0;
-      consecutiveEarlyPacketStartTime = 0;
+  if (newBufferSize > bufferSize) {
+    if (!IsReaderRunning()) {
+      bufferSize = newBufferSize;
+      AllocateFrames(bufferSize);
+    }
+    else {
+      // Frames cannot be reallocated under a running reader, grow into the
+      // spare frames of the pool instead.
+      PINDEX limit = framePoolSize - 2;
+      PTRACE_IF(2, newBufferSize > limit, "RTP\tJitter buffer size limited to " << limit
+                << " frames while running, wanted " << newBufferSize);
+      bufferSize = PMIN(newBufferSize, limit);
+    }
+  }
 
-      shuttingDown = FALSE;
-      preBuffering = TRUE;
+  PBoolean restart = FALSE;
+  if (scheduler != NULL)
+    restart = !scheduled;
+  else if (jitterThread != NULL)
+    restart = jitterThread->IsTerminated();
 
-      PTRACE(2, "RTP\tJitter buffer restarted:"
-                " size=" << bufferSize <<
-                " delay=" << minJitterTime << '-' << maxJitterTime << '/' << currentJitterTime <<
-                " (" << (currentJitterTime/8) << "ms)");
-      jitterThread->Restart();
+  if (restart) {
+    packetsTooLate = 0;
+    bufferOverruns = 0;
+    readerOverruns = 0;
+    consecutiveBufferOverruns = 0;
+    consecutiveReaderOverruns = 0;
+    consecutiveMarkerBits = 0;
+    consecutiveEarlyPacketStartTime = 0;
+    flushRequested = FALSE;
+
+    // The reading side has stopped, so all the frames can be reclaimed
+    AllocateFrames(bufferSize);
+
+    shuttingDown = FALSE;
+    preBuffering = TRUE;
+
+    PTRACE(2, "RTP\tJitter buffer restarted:"
+              " size=" << bufferSize <<
+              " delay=" << minJitterTime << '-' << maxJitterTime << '/' << currentJitterTime <<
+              " (" << (currentJitterTime/8) << "ms)");
+    if (scheduler != NULL) {
+      scheduled = TRUE;
+      scheduler->Add(*this, schedulePeriod);
     }
+    else
+      jitterThread->Restart();
   }
 
   bufferMutex.Signal();
@@ -334,11 +392,25 @@ void RTP_JitterBuffer::Resume(
     jitterThread->Resume();
 }
 
+
+PBoolean RTP_JitterBuffer::Schedule(RTP_JitterScheduler & sched, unsigned pollPeriod)
+{
+  if (jitterThread != NULL || !session.CanReadDataNoWait())
+    return FALSE;
+
+  scheduler = &sched;
+  schedulePeriod = pollPeriod;
+  scheduled = TRUE;
+  scheduler->Add(*this, pollPeriod);
+  return TRUE;
+}
+
+
 void RTP_JitterBuffer::JitterThreadMain(PThread &,  H323_INT)
 {
   PThread::Sleep(25);  // yield to allow receive thread to get going.
 
-  RTP_JitterBuffer::Entry * currentReadFrame;
+  RTP_JitterBuffer::Entry * currentReadFrame = NULL;
   PBoolean markerWarning;
 
   PTRACE(3, "RTP\tJitter RTP receive thread started: " << this);
@@ -360,9 +432,9 @@ void RTP_JitterBuffer::JitterThreadMain(PThread &,  H323_INT)
 }
 
 
-PBoolean RTP_JitterBuffer::Init(Entry * & /*currentReadFrame*/, PBoolean & markerWarning)
+PBoolean RTP_JitterBuffer::Init(Entry * & currentReadFrame, PBoolean & markerWarning)
 {
-  bufferMutex.Wait();
+  currentReadFrame = NULL;
   markerWarning = FALSE;
   return TRUE;
 }
@@ -375,44 +447,12 @@ void RTP_JitterBuffer::DeInit(Entry * & /*currentReadFrame*/, PBoolean & /*marke
 PBoolean RTP_JitterBuffer::PreRead(RTP_JitterBuffer::Entry * & currentReadFrame, PBoolean & /*markerWarning*/)
 {
   // Get the next free frame available for use for reading from the RTP
-  // transport. Place it into a parking spot.
-  if (freeFrames != NULL) {
-    // Take the next free frame and make it the current for reading
-    currentReadFrame = freeFrames;
-    freeFrames = freeFrames->next;
-    if (freeFrames != NULL)
-      freeFrames->prev = NULL;
-    PTRACE_IF(2, consecutiveBufferOverruns > 1,
-              "RTP\tJitter buffer full, threw away "
-              << consecutiveBufferOverruns << " oldest frames");
-    consecutiveBufferOverruns = 0;
-  }
-  else {
-    // We have a full jitter buffer, need a new frame so take the oldest one
-    currentReadFrame = oldestFrame;
-    oldestFrame = oldestFrame->next;
-    if (oldestFrame != NULL)
-      oldestFrame->prev = NULL;
-    currentDepth--;
-    bufferOverruns++;
-    consecutiveBufferOverruns++;
-    if (consecutiveBufferOverruns > MAX_BUFFER_OVERRUNS) {
-      PTRACE(2, "RTP\tJitter buffer continuously full, throwing away entire buffer.");
-      freeFrames = oldestFrame;
-      oldestFrame = newestFrame = NULL;
-      preBuffering = TRUE;
-    }
-    else {
-      PTRACE_IF(2, consecutiveBufferOverruns == 1,
-                "RTP\tJitter buffer full, throwing away oldest frame ("
-                << currentReadFrame->GetTimestamp() << ')');
-    }
-  }
+  // transport. If ReadData() is holding every frame, read into the overrun
+  // frame which is thrown away once read.
+  if (!freeFrames.Pop(currentReadFrame))
+    currentReadFrame = overrunFrame;
 
   currentReadFrame->next = NULL;
-
-  bufferMutex.Signal();
-
   return TRUE;
 }
 
@@ -420,14 +460,52 @@ PBoolean RTP_JitterBuffer::OnRead(RTP_JitterBuffer::Entry * & currentReadFrame,
 {
   // Keep reading from the RTP transport frames
   if (!session.ReadData(*currentReadFrame, loop)) {
-    delete currentReadFrame;  // Destructor won't delete this one, so do it here.
-    currentReadFrame = FALSE;
+    currentReadFrame = NULL;  // Frames belong to the pool, nothing to delete
     shuttingDown = TRUE; // Flag to stop the reading side thread
     PTRACE(3, "RTP\tJitter RTP receive thread ended");
     return FALSE;
   }
 
+  QueueFrame(currentReadFrame, markerWarning);
+  return TRUE;
+}
+
+
+PBoolean RTP_JitterBuffer::OnPoll()
+{
+  if (shuttingDown)
+    return FALSE;
+
+  for (PINDEX i = 0; i < MAX_FRAMES_PER_POLL; i++) {
+    if (scheduledReadFrame == NULL)
+      PreRead(scheduledReadFrame, scheduledMarkerWarning);
+
+    PBoolean available = FALSE;
+    if (!session.ReadDataNoWait(*scheduledReadFrame, available)) {
+      scheduledReadFrame = NULL;
+      shuttingDown = TRUE;
+      PTRACE(3, "RTP\tJitter RTP scheduled receive ended");
+      return FALSE;
+    }
+
+    if (!available) {
+      // Give back the overrun frame so a free one is tried next poll
+      if (scheduledReadFrame == overrunFrame)
+        scheduledReadFrame = NULL;
+      break;
+    }
+
+    QueueFrame(scheduledReadFrame, scheduledMarkerWarning);
+  }
+
+  return TRUE;
+}
+
+
+void RTP_JitterBuffer::QueueFrame(RTP_JitterBuffer::Entry * & currentReadFrame, PBoolean & markerWarning)
+{
   currentReadFrame->tick = PTimer::Tick();
+  currentReadFrame->received = RTP_MediaStatistics::GetTime();
 
   if (consecutiveMarkerBits < maxConsecutiveMarkerBits) {
     if (currentReadFrame->GetMarker()) {
@@ -451,43 +529,128 @@ PBoolean RTP_JitterBuffer::OnRead(RTP_JitterBuffer::Entry * & currentReadFrame,
   analyser->In(currentReadFrame->GetTimestamp(), currentDepth, preBuffering ? "PreBuf" : "");
 #endif
 
-  // Queue the frame for playing by the thread at other end of jitter buffer
-  bufferMutex.Wait();
-
-  // Have been reading a frame, put it into the queue now, at correct position
-  if (newestFrame == NULL)
-    oldestFrame = newestFrame = currentReadFrame; // Was empty
+  if (currentReadFrame == overrunFrame) {
+    readerOverruns++;
+    consecutiveReaderOverruns++;
+    PTRACE_IF(2, consecutiveReaderOverruns == 1,
+              "RTP\tJitter buffer full, throwing away newest frame ("
+              << currentReadFrame->GetTimestamp() << ')');
+    if (consecutiveReaderOverruns > MAX_BUFFER_OVERRUNS) {
+      // Have ReadData() throw the lot away and start again
+      flushRequested = TRUE;
+      consecutiveReaderOverruns = 0;
+    }
+  }
   else {
-    DWORD time = currentReadFrame->GetTimestamp();
+    PTRACE_IF(2, consecutiveReaderOverruns > 1,
+              "RTP\tJitter buffer full, threw away "
+              << consecutiveReaderOverruns << " newest frames");
+    consecutiveReaderOverruns = 0;
+
+    // Hand the frame over to ReadData(), the queue holds the whole pool so
+    // this cannot fail.
+    receivedFrames.Push(currentReadFrame);
+  }
+
+  currentReadFrame = NULL;
+}
+
 
-    if (time > newestFrame->GetTimestamp()) {
-      // Is newer than newst, put at that end of queue
-      currentReadFrame->prev = newestFrame;
-      newestFrame->next = currentReadFrame;
-      newestFrame = currentReadFrame;
+void RTP_JitterBuffer::ReleaseFrame(RTP_JitterBuffer::Entry * frame)
+{
+  frame->next = frame->prev = NULL;
+  freeFrames.Push(frame);
+}
+
+
+void RTP_JitterBuffer::ReceiveFrames()
+{
+  if (flushRequested) {
+    PTRACE(2, "RTP\tJitter buffer continuously full, throwing away entire buffer.");
+    while (oldestFrame != NULL) {
+      Entry * frame = oldestFrame;
+      oldestFrame = oldestFrame->next;
+      ReleaseFrame(frame);
     }
-    else if (time <= oldestFrame->GetTimestamp()) {
-      // Is older than the oldest, put at that end of queue
-      currentReadFrame->next = oldestFrame;
-      oldestFrame->prev = currentReadFrame;
-      oldestFrame = currentReadFrame;
+    newestFrame = NULL;
+    currentDepth = 0;
+    preBuffering = TRUE;
+    flushRequested = FALSE;
+  }
+
+  Entry * currentReadFrame;
+  while (receivedFrames.Pop(currentReadFrame)) {
+    currentReadFrame->next = currentReadFrame->prev = NULL;
+
+    if (currentDepth < (unsigned)bufferSize) {
+      PTRACE_IF(2, consecutiveBufferOverruns > 1,
+                "RTP\tJitter buffer full, threw away "
+                << consecutiveBufferOverruns << " oldest frames");
+      consecutiveBufferOverruns = 0;
     }
     else {
-      // Somewhere in between, locate its position
-      Entry * frame = newestFrame->prev;
-      while (time < frame->GetTimestamp())
-        frame = frame->prev;
+      // We have a full jitter buffer, throw away the oldest frame
+      Entry * wastedFrame = oldestFrame;
+      oldestFrame = oldestFrame->next;
+      if (oldestFrame != NULL)
+        oldestFrame->prev = NULL;
+      else
+        newestFrame = NULL;
+      currentDepth--;
+      bufferOverruns++;
+      consecutiveBufferOverruns++;
+      PTRACE_IF(2, consecutiveBufferOverruns == 1,
+                "RTP\tJitter buffer full, throwing away oldest frame ("
+                << wastedFrame->GetTimestamp() << ')');
+      ReleaseFrame(wastedFrame);
 
-      currentReadFrame->prev = frame;
-      currentReadFrame->next = frame->next;
-      frame->next->prev = currentReadFrame;
-      frame->next = currentReadFrame;
+      if (consecutiveBufferOverruns > MAX_BUFFER_OVERRUNS) {
+        PTRACE(2, "RTP\tJitter buffer continuously full, throwing away entire buffer.");
+        while (oldestFrame != NULL) {
+          Entry * frame = oldestFrame;
+          oldestFrame = oldestFrame->next;
+          ReleaseFrame(frame);
+        }
+        newestFrame = NULL;
+        currentDepth = 0;
+        consecutiveBufferOverruns = 0;
+        preBuffering = TRUE;
+      }
     }
-  }
 
-  currentDepth++;
+    // Put the frame into the queue, at correct position
+    if (newestFrame == NULL)
+      oldestFrame = newestFrame = currentReadFrame; // Was empty
+    else {
+      DWORD time = currentReadFrame->GetTimestamp();
 
-  return TRUE;
+      if (time > newestFrame->GetTimestamp()) {
+        // Is newer than newst, put at that end of queue
+        currentReadFrame->prev = newestFrame;
+        newestFrame->next = currentReadFrame;
+        newestFrame = currentReadFrame;
+      }
+      else if (time <= oldestFrame->GetTimestamp()) {
+        // Is older than the oldest, put at that end of queue
+        currentReadFrame->next = oldestFrame;
+        oldestFrame->prev = currentReadFrame;
+        oldestFrame = currentReadFrame;
+      }
+      else {
+        // Somewhere in between, locate its position
+        Entry * frame = newestFrame->prev;
+        while (time < frame->GetTimestamp())
+          frame = frame->prev;
+
+        currentReadFrame->prev = frame;
+        currentReadFrame->next = frame->next;
+        frame->next->prev = currentReadFrame;
+        frame->next = currentReadFrame;
+      }
+    }
+
+    currentDepth++;
+  }
 }
 
 void RTP_JitterBuffer::ResetFirstWrite()
@@ -500,31 +663,27 @@ PBoolean RTP_JitterBuffer::ReadData(DWORD timestamp, RTP_DataFrame & frame)
   if (shuttingDown)
     return FALSE;
 
+  // Only contended by SetDelay() and the destructor, the reading side hands
+  // frames over through the lock free queues.
+  PWaitAndSignal mutex(bufferMutex);
+
   /*Free the frame just written to codec, putting it back into
-    the free list and clearing the parking spot for it.
+    the free queue and clearing the parking spot for it.
    */
-  bufferMutex.Wait();
   if (currentWriteFrame != NULL) {
-
-    // Move frame from current to free list
-    currentWriteFrame->next = freeFrames;
-    if (freeFrames != NULL)
-      freeFrames->prev = currentWriteFrame;
-    freeFrames = currentWriteFrame;
-
+    ReleaseFrame(currentWriteFrame);
     currentWriteFrame = NULL;
   }
-  bufferMutex.Signal();
+
+  // Take everything the reading side has queued since the last call
+  ReceiveFrames();
 
   // Default response is an empty frame, ie silence
   frame.SetPayloadSize(0);
 
-  PWaitAndSignal mutex(bufferMutex);
-
   /*Get the next frame to write to the codec. Takes it from the oldest
     position in the queue, if it is time to do so, and parks it in the
-    special member so can unlock the mutex while the writer thread has its
-    way with the buffer.
+    special member until the next call.
    */
   if (oldestFrame == NULL) {
     /*No data to play! We ran the buffer down to empty, restart buffer by
@@ -700,10 +859,7 @@ PBoolean RTP_JitterBuffer::ReadData(DWORD timestamp, RTP_DataFrame & frame)
 
           currentWriteFrame->next = NULL; //currentWriteFrame should never be able to be NULL
           
-          wastedFrame->next = freeFrames;
-          if (freeFrames != NULL)
-            freeFrames->prev = wastedFrame;
-          freeFrames = wastedFrame;
+          ReleaseFrame(wastedFrame);
 
           if (oldestFrame == NULL) {
             newestFrame = NULL;
@@ -714,7 +870,7 @@ PBoolean RTP_JitterBuffer::ReadData(DWORD timestamp, RTP_DataFrame & frame)
         }
         
         doneFirstWrite = TRUE;
-        frame = *currentWriteFrame;
+        PlayFrame(frame);
         return TRUE;
       }
 
@@ -736,10 +892,7 @@ PBoolean RTP_JitterBuffer::ReadData(DWORD timestamp, RTP_DataFrame & frame)
 
           currentWriteFrame->next = NULL; //currentWriteFrame should never be able to be NULL
           
-          wastedFrame->next = freeFrames;
-          if (freeFrames != NULL)
-            freeFrames->prev = wastedFrame;
-          freeFrames = wastedFrame;
+          ReleaseFrame(wastedFrame);
 
           if (oldestFrame == NULL) {
             newestFrame = NULL;
@@ -785,11 +938,8 @@ PBoolean RTP_JitterBuffer::ReadData(DWORD timestamp, RTP_DataFrame & frame)
           newestFrame->next = NULL;
       wastedFrame->prev = NULL;
 
-      // Put thrown away frame on free list
-      wastedFrame->next = freeFrames;
-      if (freeFrames != NULL)
-        freeFrames->prev = wastedFrame;
-      freeFrames = wastedFrame;
+      // Put thrown away frame on free queue
+      ReleaseFrame(wastedFrame);
 
       // Reset jitter calculation baseline
       lastWriteTimestamp = 0;
@@ -810,10 +960,182 @@ PBoolean RTP_JitterBuffer::ReadData(DWORD timestamp, RTP_DataFrame & frame)
   }
 
   doneFirstWrite = TRUE;
-  frame = *currentWriteFrame;
+  PlayFrame(frame);
   return TRUE;
 }
 
+void RTP_JitterBuffer::PlayFrame(RTP_DataFrame & frame)
+{
+  PInt64 now = RTP_MediaStatistics::GetTime();
+  session.GetMediaStatistics()[RTP_MediaStatistics::JitterBufferResidence].Record(now - currentWriteFrame->received);
+  session.SetLastReadTime(currentWriteFrame->received);
+
+  // Copy into the caller's buffer, the entry is reused once the next read
+  // releases it while the codec may still be working on this frame
+  PINDEX payloadSize = currentWriteFrame->GetPayloadSize();
+  PINDEX size = currentWriteFrame->GetHeaderSize() + payloadSize;
+  memcpy(frame.GetPointer(size), currentWriteFrame->GetPointer(), size);
+  frame.SetPayloadSize(payloadSize);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+RTP_JitterScheduler::RTP_JitterScheduler(unsigned tick, PINDEX stackSize)
+  : currentSlot(0), tickTime(tick > 0 ? tick : 1), bufferCount(0), shutdown(FALSE)
+{
+  thread = PThread::Create(PCREATE_NOTIFIER(SchedulerMain), 0,
+                           PThread::NoAutoDeleteThread,
+                           PThread::HighestPriority,
+                           "RTP Jitter Sched", stackSize);
+}
+
+
+RTP_JitterScheduler::~RTP_JitterScheduler()
+{
+  shutdown = TRUE;
+  if (thread != NULL) {
+    thread->WaitForTermination(3000);
+    delete thread;
+  }
+}
+
+
+void RTP_JitterScheduler::Add(RTP_JitterBuffer & buffer, unsigned period)
+{
+  unsigned periodTicks = (period + tickTime - 1)/tickTime;
+  if (periodTicks == 0)
+    periodTicks = 1;
+
+  PWaitAndSignal m(mutex);
+  Insert(&buffer, periodTicks, currentSlot);
+  bufferCount++;
+
+  PTRACE(4, "RTP\tJitter scheduler added buffer " << &buffer
+         << " period=" << periodTicks*tickTime << "ms count=" << bufferCount);
+}
+
+
+void RTP_JitterScheduler::Remove(RTP_JitterBuffer & buffer)
+{
+  mutex.Wait();
+  if (!Unlink(wheel, WheelSlots, buffer))
+    Unlink(&polling, 1, buffer);
+  mutex.Signal();
+
+  // Polls are done without the mutex, wait for any pass that may still be
+  // using the buffer. The mutex is recursive so OnPoll() may remove itself.
+  PWaitAndSignal p(pollMutex);
+}
+
+
+PBoolean RTP_JitterScheduler::Unlink(TimerList * lists, PINDEX count, RTP_JitterBuffer & buffer)
+{
+  for (PINDEX i = 0; i < count; i++) {
+    for (TimerList::iterator r = lists[i].begin(); r != lists[i].end(); ++r) {
+      if (r->buffer == &buffer) {
+        // Entries being polled are cleared rather than erased, the scheduler
+        // thread owns their position in the list.
+        if (lists == &polling)
+          r->buffer = NULL;
+        else
+          lists[i].erase(r);
+        bufferCount--;
+        buffer.scheduled = FALSE;
+        PTRACE(4, "RTP\tJitter scheduler removed buffer " << &buffer << " count=" << bufferCount);
+        return TRUE;
+      }
+    }
+  }
+  return FALSE;
+}
+
+
+PINDEX RTP_JitterScheduler::GetBufferCount() const
+{
+  PWaitAndSignal m(mutex);
+  return bufferCount;
+}
+
+
+void RTP_JitterScheduler::Insert(RTP_JitterBuffer * buffer, unsigned periodTicks, unsigned fromSlot)
+{
+  Timer timer;
+  timer.buffer = buffer;
+  timer.periodTicks = periodTicks;
+  timer.rounds = (periodTicks-1)/WheelSlots;
+  wheel[(fromSlot + periodTicks) % WheelSlots].push_back(timer);
+}
+
+
+void RTP_JitterScheduler::SchedulerMain(PThread &, H323_INT)
+{
+  PTRACE(3, "RTP\tJitter scheduler started, tick=" << tickTime << "ms");
+
+  PTimeInterval nextTick = PTimer::Tick();
+
+  while (!shutdown) {
+    nextTick += tickTime;
+    PTimeInterval delay = nextTick - PTimer::Tick();
+    if (delay > 0)
+      PThread::Sleep(delay);
+    else if (delay.GetMilliSeconds() < -(PInt64)(tickTime*WheelSlots)) {
+      // Fell a whole revolution behind, do not try and catch up on it all
+      PTRACE(2, "RTP\tJitter scheduler overloaded, skipped " << -delay.GetMilliSeconds() << "ms");
+      nextTick = PTimer::Tick();
+    }
+
+    pollMutex.Wait();
+    mutex.Wait();
+
+    currentSlot = (currentSlot + 1) % WheelSlots;
+
+    TimerList due;
+    due.swap(wheel[currentSlot]);
+
+    while (!due.empty()) {
+      Timer timer = due.front();
+      due.pop_front();
+
+      if (timer.rounds > 0) {
+        timer.rounds--;
+        wheel[currentSlot].push_back(timer);
+      }
+      else
+        polling.push_back(timer);
+    }
+
+    // Poll without the mutex so a slow transport read does not hold up
+    // Add() and Remove() from the channel threads.
+    while (!polling.empty()) {
+      RTP_JitterBuffer * buffer = polling.front().buffer;
+      mutex.Signal();
+
+      PBoolean again = buffer != NULL && buffer->OnPoll();
+
+      mutex.Wait();
+      Timer timer = polling.front();
+      polling.pop_front();
+      if (timer.buffer == NULL)
+        continue;   // Removed while being polled
+
+      if (again)
+        Insert(timer.buffer, timer.periodTicks, currentSlot);
+      else {
+        timer.buffer->scheduled = FALSE;
+        bufferCount--;
+        PTRACE(3, "RTP\tJitter scheduler finished with buffer " << timer.buffer
+               << " count=" << bufferCount);
+      }
+    }
+
+    mutex.Signal();
+    pollMutex.Signal();
+  }
+
+  PTRACE(3, "RTP\tJitter scheduler finished");
+}
+
+
 /////////////////////////////////////////////////////////////////////////////////
 
 
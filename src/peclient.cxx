@@ -852,14 +852,16 @@ PBoolean H323PeerElement::AddDescriptor(const OpalGloballyUniqueID & descriptorI
   {
     PWaitAndSignal m(aliasMutex);
     if (descriptor != NULL) {
-      RemoveDescriptorInformation(descriptor->addressTemplates);
-
       // only update if the update time is later than what we already have
       if (updateTime < descriptor->lastChanged) {
         PTRACE(4, "PeerElement\tNot updating descriptor " << descriptorID << " as " << updateTime << " < " << descriptor->lastChanged);
         return TRUE;
       }
 
+      RemoveDescriptorInformation(descriptor->addressTemplates);
+      patternIndex.Remove(descriptorID, descriptor->addressTemplates);
+      descriptor->addressTemplates = addressTemplates;
+
     } else {
       add = TRUE;
       descriptor                   = CreateDescriptor(descriptorID);
@@ -868,6 +870,7 @@ PBoolean H323PeerElement::AddDescriptor(const OpalGloballyUniqueID & descriptorI
       updateType                   = H501_UpdateInformation_updateType::e_added;
     }
     descriptor->lastChanged = PTime();
+    patternIndex.Add(descriptorID, descriptor->addressTemplates);
 
     // add all patterns and transport addresses to secondary lookup tables
     PINDEX i, j, k;
@@ -958,7 +961,7 @@ void H323PeerElement::RemoveDescriptorInformation(const H501_ArrayOf_AddressTemp
     // remove transport addresses for this descriptor
     H501_ArrayOf_RouteInformation & routeInfos = addressTemplate.m_routeInfo;
     for (j = 0; j < routeInfos.GetSize(); j++) {
-      H501_ArrayOf_ContactInformation & contacts = routeInfos[i].m_contacts;
+      H501_ArrayOf_ContactInformation & contacts = routeInfos[j].m_contacts;
       for (k = 0; k < contacts.GetSize(); k++) {
         H501_ContactInformation & contact = contacts[k];
         H225_AliasAddress & transportAddress = contact.m_transportAddress;
@@ -1003,6 +1006,7 @@ PBoolean H323PeerElement::DeleteDescriptor(const OpalGloballyUniqueID & descript
   OnRemoveDescriptor(*descriptor);
 
   RemoveDescriptorInformation(descriptor->addressTemplates);
+  patternIndex.Remove(descriptorID, descriptor->addressTemplates);
 
   // delete the descriptor, or mark it as to be deleted
   if (now) {
@@ -1051,8 +1055,10 @@ PBoolean H323PeerElement::UpdateDescriptor(H323PeerElementDescriptor * descripto
     SendUpdateDescriptorByID(sr->serviceID, descriptor, updateType);
   }
 
-  if (descriptor->state == H323PeerElementDescriptor::Deleted)
+  if (descriptor->state == H323PeerElementDescriptor::Deleted) {
+    patternIndex.Remove(descriptor->descriptorID, descriptor->addressTemplates);
     descriptors.Remove(descriptor);
+  }
 
   return TRUE;
 }
@@ -1618,4 +1624,343 @@ unsigned H323PeerElementDescriptor::GetProtocolList(const H501_ArrayOf_Supported
 }
 
 
+//////////////////////////////////////////////////////////////////////////////
+
+H323PeerElementPatternIndex::Node::Node()
+{
+  for (PINDEX i = 0; i < NumDigits; i++)
+    children[i] = NULL;
+}
+
+
+H323PeerElementPatternIndex::Node::~Node()
+{
+  for (PINDEX i = 0; i < NumDigits; i++)
+    delete children[i];
+}
+
+
+PBoolean H323PeerElementPatternIndex::Node::IsEmpty() const
+{
+  if (!specific.empty() || !wildcard.empty() || !ranges.empty())
+    return FALSE;
+
+  for (PINDEX i = 0; i < NumDigits; i++) {
+    if (children[i] != NULL)
+      return FALSE;
+  }
+  return TRUE;
+}
+
+
+H323PeerElementPatternIndex::H323PeerElementPatternIndex()
+  : patternCount(0)
+{
+}
+
+
+H323PeerElementPatternIndex::~H323PeerElementPatternIndex()
+{
+}
+
+
+int H323PeerElementPatternIndex::DigitIndex(char c)
+{
+  if (c >= '0' && c <= '9')
+    return c - '0';
+
+  switch (c) {
+    case '*' :
+      return 10;
+    case '#' :
+      return 11;
+    case ',' :
+      return 12;
+  }
+  return -1;
+}
+
+
+PString H323PeerElementPatternIndex::GetE164(const H225_PartyNumber & number)
+{
+  H225_AliasAddress alias;
+  alias.SetTag(H225_AliasAddress::e_partyNumber);
+  (H225_PartyNumber &)alias = number;
+  return H323GetAliasAddressE164(alias);
+}
+
+
+PString H323PeerElementPatternIndex::GetKey(const H225_AliasAddress & alias)
+{
+  return psprintf("%u:", alias.GetTag()) + H323GetAliasAddressString(alias);
+}
+
+
+void H323PeerElementPatternIndex::RemoveMatch(MatchList & list, const OpalGloballyUniqueID & id, PINDEX pos)
+{
+  for (MatchList::iterator it = list.begin(); it != list.end(); ++it) {
+    if (it->pos == pos && it->id == id) {
+      list.erase(it);
+      return;
+    }
+  }
+}
+
+
+H323PeerElementPatternIndex::Node * H323PeerElementPatternIndex::GetNode(const PString & digits, PBoolean create)
+{
+  Node * node = &root;
+  for (PINDEX i = 0; i < digits.GetLength(); i++) {
+    Node * & child = node->children[DigitIndex(digits[i])];
+    if (child == NULL) {
+      if (!create)
+        return NULL;
+      child = new Node;
+    }
+    node = child;
+  }
+  return node;
+}
+
+
+void H323PeerElementPatternIndex::PruneNode(const PString & digits)
+{
+  // Delete the deepest empty node on the path, then its parent etc.
+  for (PINDEX len = digits.GetLength(); len > 0; len--) {
+    Node * parent = &root;
+    for (PINDEX i = 0; parent != NULL && i < len-1; i++)
+      parent = parent->children[DigitIndex(digits[i])];
+    if (parent == NULL)
+      return;
+
+    Node * & child = parent->children[DigitIndex(digits[len-1])];
+    if (child == NULL || !child->IsEmpty())
+      return;
+
+    delete child;
+    child = NULL;
+  }
+}
+
+
+void H323PeerElementPatternIndex::AddPattern(const H501_Pattern & pattern, const Match & match)
+{
+  switch (pattern.GetTag()) {
+    case H501_Pattern::e_specific :
+    case H501_Pattern::e_wildcard : {
+      const H225_AliasAddress & alias = pattern;
+      PString digits = H323GetAliasAddressE164(alias);
+      if (digits.IsEmpty()) {
+        PString key = GetKey(alias);
+        if (match.type == SpecificMatch)
+          specificAliases[key].push_back(match);
+        else
+          wildcardAliases[key].push_back(match);
+      }
+      else {
+        Node * node = GetNode(digits, TRUE);
+        (match.type == SpecificMatch ? node->specific : node->wildcard).push_back(match);
+      }
+      break;
+    }
+
+    case H501_Pattern::e_range : {
+      const H501_Pattern_range & range = pattern;
+      PString start = GetE164(range.m_startOfRange);
+      PString end = GetE164(range.m_endOfRange);
+      if (start.IsEmpty() || end.IsEmpty() || start > end) {
+        PTRACE(2, "PeerElement\tIgnoring invalid range pattern " << start << '-' << end);
+        return;
+      }
+
+      PINDEX common = 0;
+      while (common < start.GetLength() && common < end.GetLength() && start[common] == end[common])
+        common++;
+      GetNode(start.Left(common), TRUE)->ranges.push_back(Range(start, end, match));
+      break;
+    }
+
+    default :
+      return;
+  }
+
+  patternCount++;
+}
+
+
+void H323PeerElementPatternIndex::RemovePattern(const H501_Pattern & pattern, const OpalGloballyUniqueID & id, PINDEX pos)
+{
+  switch (pattern.GetTag()) {
+    case H501_Pattern::e_specific :
+    case H501_Pattern::e_wildcard : {
+      PBoolean wild = pattern.GetTag() == H501_Pattern::e_wildcard;
+      const H225_AliasAddress & alias = pattern;
+      PString digits = H323GetAliasAddressE164(alias);
+      if (digits.IsEmpty()) {
+        std::map<PString, MatchList> & aliases = wild ? wildcardAliases : specificAliases;
+        std::map<PString, MatchList>::iterator it = aliases.find(GetKey(alias));
+        if (it == aliases.end())
+          return;
+        size_t before = it->second.size();
+        RemoveMatch(it->second, id, pos);
+        if (it->second.size() == before)
+          return;
+        if (it->second.empty())
+          aliases.erase(it);
+      }
+      else {
+        Node * node = GetNode(digits, FALSE);
+        if (node == NULL)
+          return;
+        MatchList & list = wild ? node->wildcard : node->specific;
+        size_t before = list.size();
+        RemoveMatch(list, id, pos);
+        PBoolean removed = list.size() != before;
+        PruneNode(digits);
+        if (!removed)
+          return;
+      }
+      break;
+    }
+
+    case H501_Pattern::e_range : {
+      const H501_Pattern_range & range = pattern;
+      PString start = GetE164(range.m_startOfRange);
+      PString end = GetE164(range.m_endOfRange);
+      if (start.IsEmpty() || end.IsEmpty())
+        return;
+
+      PINDEX common = 0;
+      while (common < start.GetLength() && common < end.GetLength() && start[common] == end[common])
+        common++;
+      PString prefix = start.Left(common);
+
+      Node * node = GetNode(prefix, FALSE);
+      if (node == NULL)
+        return;
+
+      std::vector<Range> & ranges = node->ranges;
+      std::vector<Range>::iterator it;
+      for (it = ranges.begin(); it != ranges.end(); ++it) {
+        if (it->match.pos == pos && it->match.id == id && it->start == start && it->end == end)
+          break;
+      }
+      PBoolean removed = it != ranges.end();
+      if (removed)
+        ranges.erase(it);
+      PruneNode(prefix);
+      if (!removed)
+        return;
+      break;
+    }
+
+    default :
+      return;
+  }
+
+  patternCount--;
+}
+
+
+void H323PeerElementPatternIndex::Add(const OpalGloballyUniqueID & id, const H501_ArrayOf_AddressTemplate & templates)
+{
+  PWriteWaitAndSignal m(mutex);
+
+  for (PINDEX i = 0; i < templates.GetSize(); i++) {
+    const H501_ArrayOf_Pattern & patterns = templates[i].m_pattern;
+    for (PINDEX j = 0; j < patterns.GetSize(); j++) {
+      MatchTypes type = patterns[j].GetTag() == H501_Pattern::e_specific ? SpecificMatch
+                      : patterns[j].GetTag() == H501_Pattern::e_wildcard ? WildcardMatch
+                      : RangeMatch;
+      AddPattern(patterns[j], Match(id, i, type));
+    }
+  }
+}
+
+
+void H323PeerElementPatternIndex::Remove(const OpalGloballyUniqueID & id, const H501_ArrayOf_AddressTemplate & templates)
+{
+  PWriteWaitAndSignal m(mutex);
+
+  for (PINDEX i = 0; i < templates.GetSize(); i++) {
+    const H501_ArrayOf_Pattern & patterns = templates[i].m_pattern;
+    for (PINDEX j = 0; j < patterns.GetSize(); j++)
+      RemovePattern(patterns[j], id, i);
+  }
+}
+
+
+void H323PeerElementPatternIndex::RemoveAll()
+{
+  PWriteWaitAndSignal m(mutex);
+
+  for (PINDEX i = 0; i < NumDigits; i++) {
+    delete root.children[i];
+    root.children[i] = NULL;
+  }
+  root.specific.clear();
+  root.wildcard.clear();
+  root.ranges.clear();
+  specificAliases.clear();
+  wildcardAliases.clear();
+  patternCount = 0;
+}
+
+
+PBoolean H323PeerElementPatternIndex::Lookup(const H225_AliasAddress & alias, MatchList & matches) const
+{
+  matches.clear();
+
+  PReadWaitAndSignal m(mutex);
+
+  PString digits = H323GetAliasAddressE164(alias);
+  if (digits.IsEmpty()) {
+    PString key = GetKey(alias);
+    std::map<PString, MatchList>::const_iterator it = specificAliases.find(key);
+    if (it != specificAliases.end())
+      matches.insert(matches.end(), it->second.begin(), it->second.end());
+
+    // Wildcards match any alias of the same type they are a prefix of
+    PINDEX minLength = key.Find(':') + 1;
+    if (!wildcardAliases.empty()) {
+      for (PINDEX len = key.GetLength(); len >= minLength; len--) {
+        it = wildcardAliases.find(key.Left(len));
+        if (it != wildcardAliases.end())
+          matches.insert(matches.end(), it->second.begin(), it->second.end());
+      }
+    }
+    return !matches.empty();
+  }
+
+  // Walk the trie along the digits, remembering the nodes passed
+  std::vector<const Node *> path;
+  const Node * node = &root;
+  path.push_back(node);
+  for (PINDEX i = 0; i < digits.GetLength(); i++) {
+    int idx = DigitIndex(digits[i]);
+    if (idx < 0 || (node = node->children[idx]) == NULL)
+      break;
+    path.push_back(node);
+  }
+
+  if (path.size() == (size_t)digits.GetLength()+1)
+    matches.insert(matches.end(), path.back()->specific.begin(), path.back()->specific.end());
+
+  std::vector<const Node *>::reverse_iterator n;
+  for (n = path.rbegin(); n != path.rend(); ++n) {
+    const std::vector<Range> & ranges = (*n)->ranges;
+    for (std::vector<Range>::const_iterator r = ranges.begin(); r != ranges.end(); ++r) {
+      if (digits.GetLength() >= r->start.GetLength() && digits.GetLength() <= r->end.GetLength() &&
+          digits >= r->start && digits <= r->end)
+        matches.push_back(r->match);
+    }
+  }
+
+  for (n = path.rbegin(); n != path.rend(); ++n)
+    matches.insert(matches.end(), (*n)->wildcard.begin(), (*n)->wildcard.end());
+
+  return !matches.empty();
+}
+
+
 // End of file ////////////////////////////////////////////////////////////////
@@ -59,6 +59,14 @@
 #include <ptclib/sockagg.h>
 #endif
 
+#ifdef P_LINUX
+#include <sys/epoll.h>
+#endif
+
+#ifndef _WIN32
+#include <time.h>
+#endif
+
 #define new PNEW
 
 
@@ -80,6 +88,15 @@ RTP_DataFrame::RTP_DataFrame(PINDEX sz, PBoolean dynamicAllocation)
 }
 
 
+RTP_DataFrame::RTP_DataFrame(BYTE * data, PINDEX size, PBoolean dynamicAllocation)
+  : PBYTEArray(data, size, dynamicAllocation)
+{
+  payloadSize = GetSize() - MIN_HEADER_SIZE;
+  allocatedDynamically = dynamicAllocation;
+  theArray[0] = '\x80';
+}
+
+
 void RTP_DataFrame::SetExtension(PBoolean ext)
 {
   if (ext)
@@ -302,15 +319,16 @@ void RTP_MultiDataFrame::SetMultiplexID(DWORD id)
 void RTP_MultiDataFrame::GetRTPPayload(RTP_DataFrame & frame) const
 {
      int sz = GetSize()- GetMultiHeaderSize();
+     frame.SetSize(sz);
+     memcpy(frame.GetPointer(), theArray+GetMultiHeaderSize(), sz);
      frame.SetPayloadSize(sz - frame.GetHeaderSize());
-     memcpy(theArray+GetMultiHeaderSize(), frame.GetPointer(), sz);
 }
 
 void RTP_MultiDataFrame::SetRTPPayload(RTP_DataFrame & frame)
 {
     int sz = frame.GetPayloadSize() + frame.GetHeaderSize();
     SetSize(sz+ GetMultiHeaderSize());
-    memcpy(frame.GetPointer(),theArray+GetMultiHeaderSize(), sz);
+    memcpy(theArray+GetMultiHeaderSize(), frame.GetPointer(), sz);
 }
 
 PBoolean RTP_MultiDataFrame::IsValidRTPPayload(PBoolean muxed) const
@@ -332,6 +350,270 @@ PBoolean RTP_MultiDataFrame::IsNotMultiplexed() const
     return IsValidRTPPayload(false);
 }
 
+/////////////////////////////////////////////////////////////////////////////
+
+static const PINDEX FrameSizeClasses[RTP_FramePool::NumSizeClasses] = { 256, 2048, 8192, 65536 };
+
+RTP_FrameBuffer::RTP_FrameBuffer(RTP_FramePool & p, PINDEX sc, PINDEX cap)
+  : pool(p),
+    sizeClass(sc),
+    capacity(cap),
+    referenceCount(0),
+    next(NULL)
+{
+  memory = new BYTE[capacity];
+}
+
+
+RTP_FrameBuffer::~RTP_FrameBuffer()
+{
+  delete [] memory;
+}
+
+
+RTP_FrameSlice::RTP_FrameSlice()
+  : buffer(NULL),
+    offset(0),
+    length(0)
+{
+}
+
+
+RTP_FrameSlice::RTP_FrameSlice(const RTP_FrameSlice & other)
+  : buffer(other.buffer),
+    offset(other.offset),
+    length(other.length)
+{
+  if (buffer != NULL)
+    ++buffer->referenceCount;
+}
+
+
+RTP_FrameSlice & RTP_FrameSlice::operator=(const RTP_FrameSlice & other)
+{
+  if (other.buffer != NULL)
+    ++other.buffer->referenceCount;
+
+  Release();
+
+  buffer = other.buffer;
+  offset = other.offset;
+  length = other.length;
+  return *this;
+}
+
+
+RTP_FrameSlice::~RTP_FrameSlice()
+{
+  Release();
+}
+
+
+BYTE * RTP_FrameSlice::GetPointer() const
+{
+  return buffer != NULL ? buffer->memory + offset : NULL;
+}
+
+
+PBoolean RTP_FrameSlice::SetSize(PINDEX len)
+{
+  if (len > GetCapacity())
+    return FALSE;
+
+  length = len;
+  return TRUE;
+}
+
+
+PINDEX RTP_FrameSlice::GetCapacity() const
+{
+  return buffer != NULL ? buffer->capacity - offset : 0;
+}
+
+
+BYTE * RTP_FrameSlice::Prepend(PINDEX len)
+{
+  // Another slice may be using the head room
+  if (buffer == NULL || len > offset || buffer->referenceCount != 1)
+    return NULL;
+
+  offset -= len;
+  length += len;
+  return buffer->memory + offset;
+}
+
+
+PBoolean RTP_FrameSlice::Advance(PINDEX len)
+{
+  if (len > length)
+    return FALSE;
+
+  offset += len;
+  length -= len;
+  return TRUE;
+}
+
+
+RTP_FrameSlice RTP_FrameSlice::GetSlice(PINDEX start, PINDEX len) const
+{
+  RTP_FrameSlice slice(*this);
+  if (start > length)
+    start = length;
+  slice.offset += start;
+  slice.length = PMIN(len, length - start);
+  return slice;
+}
+
+
+void RTP_FrameSlice::Release()
+{
+  if (buffer != NULL && --buffer->referenceCount == 0)
+    buffer->pool.Release(buffer);
+
+  buffer = NULL;
+  offset = 0;
+  length = 0;
+}
+
+
+RTP_FramePool::RTP_FramePool(PINDEX max)
+  : maxFree(max)
+{
+  for (PINDEX i = 0; i < NumSizeClasses; i++) {
+    freeList[i] = NULL;
+    freeCount[i] = 0;
+  }
+  memset(counters, 0, sizeof(counters));
+}
+
+
+RTP_FramePool::~RTP_FramePool()
+{
+  for (PINDEX i = 0; i < NumSizeClasses; i++) {
+    while (freeList[i] != NULL) {
+      RTP_FrameBuffer * buffer = freeList[i];
+      freeList[i] = buffer->next;
+      delete buffer;
+    }
+  }
+}
+
+
+RTP_FramePool & RTP_FramePool::Default()
+{
+  static RTP_FramePool pool;
+  return pool;
+}
+
+
+PINDEX RTP_FramePool::GetSizeClass(PINDEX size)
+{
+  for (PINDEX i = 0; i < NumSizeClasses; i++) {
+    if (size <= FrameSizeClasses[i])
+      return i;
+  }
+  return NumSizeClasses;
+}
+
+
+RTP_FrameSlice RTP_FramePool::Allocate(PINDEX size)
+{
+  PINDEX sizeClass = GetSizeClass(size);
+  RTP_FrameBuffer * buffer = NULL;
+
+  {
+    PWaitAndSignal wait(mutex[sizeClass]);
+
+    Statistics & stats = counters[sizeClass];
+    if (sizeClass < NumSizeClasses && freeList[sizeClass] != NULL) {
+      buffer = freeList[sizeClass];
+      freeList[sizeClass] = buffer->next;
+      freeCount[sizeClass]--;
+      stats.poolAllocations++;
+    }
+    else
+      stats.heapAllocations++;
+    stats.inUse++;
+  }
+
+  if (buffer == NULL)
+    buffer = new RTP_FrameBuffer(*this, sizeClass,
+                                 HeadRoom + (sizeClass < NumSizeClasses ? FrameSizeClasses[sizeClass] : size));
+
+  buffer->next = NULL;
+  buffer->referenceCount.SetValue(1);
+
+  RTP_FrameSlice slice;
+  slice.buffer = buffer;
+  slice.offset = HeadRoom;
+  slice.length = size;
+  return slice;
+}
+
+
+RTP_FrameSlice RTP_FramePool::Copy(const void * data, PINDEX len)
+{
+  RTP_FrameSlice slice = Allocate(len);
+  memcpy(slice.GetPointer(), data, len);
+  CountCopy(len);
+  return slice;
+}
+
+
+void RTP_FramePool::CountCopy(PINDEX len)
+{
+  PWaitAndSignal wait(mutex[NumSizeClasses]);
+  counters[NumSizeClasses].copies++;
+  counters[NumSizeClasses].bytesCopied += len;
+}
+
+
+void RTP_FramePool::Release(RTP_FrameBuffer * buffer)
+{
+  PINDEX sizeClass = buffer->sizeClass;
+
+  {
+    PWaitAndSignal wait(mutex[sizeClass]);
+
+    Statistics & stats = counters[sizeClass];
+    stats.releases++;
+    stats.inUse--;
+
+    if (sizeClass < NumSizeClasses && freeCount[sizeClass] < maxFree) {
+      buffer->next = freeList[sizeClass];
+      freeList[sizeClass] = buffer;
+      freeCount[sizeClass]++;
+      return;
+    }
+  }
+
+  delete buffer;
+}
+
+
+RTP_PooledDataFrame::RTP_PooledDataFrame(const RTP_FrameSlice & slice)
+  : RTP_DataFrame(slice.GetPointer(), slice.GetSize(), FALSE),
+    buffer(slice)
+{
+}
+
+
+void RTP_FramePool::GetStatistics(Statistics & stats) const
+{
+  memset(&stats, 0, sizeof(stats));
+
+  for (PINDEX i = 0; i <= NumSizeClasses; i++) {
+    PWaitAndSignal wait(mutex[i]);
+    stats.heapAllocations += counters[i].heapAllocations;
+    stats.poolAllocations += counters[i].poolAllocations;
+    stats.releases        += counters[i].releases;
+    stats.inUse           += counters[i].inUse;
+    stats.copies          += counters[i].copies;
+    stats.bytesCopied     += counters[i].bytesCopied;
+  }
+}
+
+
 /////////////////////////////////////////////////////////////////////////////
 
 RTP_ControlFrame::RTP_ControlFrame(PINDEX sz)
@@ -507,6 +789,163 @@ void RTP_UserData::OnRxSenderReport(unsigned /*sessionID*/,
 {
 }
 
+/////////////////////////////////////////////////////////////////////////////
+
+RTP_MediaHistogram::RTP_MediaHistogram()
+{
+}
+
+
+void RTP_MediaHistogram::Record(PInt64 microseconds)
+{
+  if (microseconds < 0)
+    microseconds = 0;
+
+  PINDEX bucket = 0;
+  for (PUInt64 value = microseconds; value != 0 && bucket < NumBuckets-1; value >>= 1)
+    bucket++;
+
+  buckets[bucket].Add(1);
+  sum.Add(microseconds);
+  maximum.SetMaximum(microseconds);
+}
+
+
+void RTP_MediaHistogram::GetSnapshot(Snapshot & snapshot) const
+{
+  snapshot.count = 0;
+  for (PINDEX i = 0; i < NumBuckets; i++) {
+    snapshot.buckets[i] = buckets[i].Get();
+    snapshot.count += snapshot.buckets[i];
+  }
+  snapshot.sum = sum.Get();
+  snapshot.maximum = maximum.Get();
+}
+
+
+RTP_MediaHistogram::Snapshot::Snapshot()
+  : count(0), sum(0), maximum(0)
+{
+  memset(buckets, 0, sizeof(buckets));
+}
+
+
+PInt64 RTP_MediaHistogram::Snapshot::GetBucketLimit(PINDEX bucket)
+{
+  return bucket < NumBuckets-1 ? ((PInt64)1 << bucket) : 0;
+}
+
+
+PInt64 RTP_MediaHistogram::Snapshot::GetPercentile(unsigned percent) const
+{
+  if (count == 0)
+    return 0;
+
+  PUInt64 wanted = (count*percent + 99)/100;
+  PUInt64 total = 0;
+  for (PINDEX i = 0; i < NumBuckets-1; i++) {
+    total += buckets[i];
+    if (total >= wanted)
+      return PMIN(GetBucketLimit(i), maximum);
+  }
+  return maximum;
+}
+
+
+const char * RTP_MediaStatistics::GetName(Histograms h)
+{
+  static const char * const Names[NumHistograms] = {
+    "encode",
+    "decode",
+    "jitter_buffer_residence",
+    "read_to_playout",
+    "transmit_overrun",
+    "pacing_delay"
+  };
+  return h < NumHistograms ? Names[h] : "unknown";
+}
+
+
+PInt64 RTP_MediaStatistics::GetTime()
+{
+#if defined(_WIN32)
+  static LARGE_INTEGER frequency = { 0 };
+  if (frequency.QuadPart == 0)
+    QueryPerformanceFrequency(&frequency);
+  LARGE_INTEGER now;
+  QueryPerformanceCounter(&now);
+  return (PInt64)(now.QuadPart/frequency.QuadPart)*1000000 +
+         (PInt64)(now.QuadPart%frequency.QuadPart)*1000000/frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (PInt64)now.tv_sec*1000000 + now.tv_nsec/1000;
+#else
+  return PTimer::Tick().GetMilliSeconds()*1000;
+#endif
+}
+
+
+RTP_MediaStatisticsSnapshot::RTP_MediaStatisticsSnapshot(const PString & token,
+                                                         unsigned id,
+                                                         const RTP_MediaStatistics & stats)
+  : callToken(token), sessionID(id)
+{
+  for (PINDEX i = 0; i < RTP_MediaStatistics::NumHistograms; i++)
+    stats[(RTP_MediaStatistics::Histograms)i].GetSnapshot(histograms[i]);
+}
+
+
+void RTP_MediaStatisticsSnapshot::PrintOn(ostream & strm) const
+{
+  strm << "Call " << callToken << " session " << sessionID << '\n';
+  for (PINDEX i = 0; i < RTP_MediaStatistics::NumHistograms; i++) {
+    const RTP_MediaHistogram::Snapshot & h = histograms[i];
+    if (h.count == 0)
+      continue;
+    strm << "    " << RTP_MediaStatistics::GetName((RTP_MediaStatistics::Histograms)i)
+         << ": count=" << h.count
+         << " avg=" << h.GetAverage() << "us"
+         << " p99=" << h.GetPercentile(99) << "us"
+         << " max=" << h.maximum << "us\n";
+  }
+}
+
+
+static void PrintSeconds(ostream & strm, PInt64 microseconds)
+{
+  strm << microseconds/1000000 << '.' << setfill('0') << setw(6) << microseconds%1000000 << setfill(' ');
+}
+
+
+void RTP_PrintMediaStatistics(ostream & strm, const RTP_MediaStatisticsList & list)
+{
+  for (PINDEX h = 0; h < RTP_MediaStatistics::NumHistograms; h++) {
+    PString name = psprintf("h323_media_%s_seconds", RTP_MediaStatistics::GetName((RTP_MediaStatistics::Histograms)h));
+    strm << "# TYPE " << name << " histogram\n";
+
+    for (PINDEX s = 0; s < list.GetSize(); s++) {
+      const RTP_MediaHistogram::Snapshot & snap = list[s].histograms[h];
+      if (snap.count == 0)
+        continue;
+
+      PString labels = "call=\"" + list[s].callToken + "\",session=\"" + PString(PString::Unsigned, list[s].sessionID) + '"';
+      PUInt64 cumulative = 0;
+      for (PINDEX b = 0; b < RTP_MediaHistogram::NumBuckets-1; b++) {
+        cumulative += snap.buckets[b];
+        strm << name << "_bucket{" << labels << ",le=\"";
+        PrintSeconds(strm, RTP_MediaHistogram::Snapshot::GetBucketLimit(b));
+        strm << "\"} " << cumulative << '\n';
+      }
+      strm << name << "_bucket{" << labels << ",le=\"+Inf\"} " << snap.count << '\n'
+           << name << "_sum{" << labels << "} ";
+      PrintSeconds(strm, snap.sum);
+      strm << '\n' << name << "_count{" << labels << "} " << snap.count << '\n';
+    }
+  }
+}
+
+
 /////////////////////////////////////////////////////////////////////////////
 
 RTP_Session::RTP_Session(
@@ -526,7 +965,7 @@ RTP_Session::RTP_Session(
     maximumSendTime(0), minimumSendTime(0), averageReceiveTime(0), maximumReceiveTime(0), minimumReceiveTime(0), jitterLevel(0), maximumJitterLevel(0),
     locAddress(PString()), remAddress(PString()), txStatisticsCount(0), rxStatisticsCount(0), averageSendTimeAccum(0), maximumSendTimeAccum(0),
     minimumSendTimeAccum(0xffffffff), averageReceiveTimeAccum(0), maximumReceiveTimeAccum(0), minimumReceiveTimeAccum(0xffffffff), packetsLostSinceLastRR(0),
-    lastTransitTime(0), firstDataReceivedTime(0), avSyncData(false)
+    lastTransitTime(0), firstDataReceivedTime(0), lastReadTime(0), avSyncData(false)
 #ifdef H323_RTP_AGGREGATE
     ,aggregator(NULL)
 #endif
@@ -618,7 +1057,9 @@ void RTP_Session::SetUserData(RTP_UserData * data)
 
 void RTP_Session::SetJitterBufferSize(unsigned minJitterDelay,
                                       unsigned maxJitterDelay,
-                                      PINDEX stackSize)
+                                      PINDEX stackSize,
+                                      RTP_JitterScheduler * scheduler,
+                                      unsigned pollPeriod)
 {
   if (minJitterDelay == 0 && maxJitterDelay == 0) {
 #ifdef H323_AUDIO_CODECS
@@ -635,11 +1076,12 @@ void RTP_Session::SetJitterBufferSize(unsigned minJitterDelay,
     SetIgnoreOutOfOrderPackets(FALSE);
 #ifdef H323_AUDIO_CODECS
     jitter = new RTP_JitterBuffer(*this, minJitterDelay, maxJitterDelay, stackSize);
-    jitter->Resume(
+    if (scheduler == NULL || !jitter->Schedule(*scheduler, pollPeriod))
+      jitter->Resume(
 #ifdef H323_RTP_AGGREGATE
-      aggregator
+        aggregator
 #endif
-      );
+        );
 #endif
   }
 }
@@ -660,9 +1102,13 @@ PBoolean RTP_Session::ReadBufferedData(DWORD timestamp, RTP_DataFrame & frame)
 #ifdef H323_AUDIO_CODECS
   if (jitter != NULL)
     return jitter->ReadData(timestamp, frame);
-  else
 #endif
-    return ReadData(frame, TRUE);
+
+  if (!ReadData(frame, TRUE))
+    return FALSE;
+
+  lastReadTime = RTP_MediaStatistics::GetTime();
+  return TRUE;
 }
 
 PBoolean RTP_Session::PseudoRead(int & /*selectStatus*/)
@@ -1259,13 +1705,14 @@ DWORD RTP_Session::GetPacketsTooLate() const
 /////////////////////////////////////////////////////////////////////////////
 
 RTP_SessionManager::RTP_SessionManager()
+  : mediaReactor(NULL)
 {
   enumerationIndex = P_MAX_INDEX;
 }
 
 
 RTP_SessionManager::RTP_SessionManager(const RTP_SessionManager & sm)
-  : sessions(sm.sessions)
+  : sessions(sm.sessions), mediaReactor(sm.mediaReactor)
 {
   enumerationIndex = P_MAX_INDEX;
 }
@@ -1275,7 +1722,8 @@ RTP_SessionManager & RTP_SessionManager::operator=(const RTP_SessionManager & sm
 {
   PWaitAndSignal m1(mutex);
   PWaitAndSignal m2(sm.mutex);
-  sessions   = sm.sessions;
+  sessions     = sm.sessions;
+  mediaReactor = sm.mediaReactor;
   return *this;
 }
 
@@ -1301,6 +1749,12 @@ void RTP_SessionManager::AddSession(RTP_Session * session)
   if (PAssertNULL(session) != NULL) {
     PTRACE(2, "RTP\tAdding session " << *session);
     sessions.SetAt(session->GetSessionID(), session);
+
+    if (mediaReactor != NULL) {
+      RTP_UDP * udp = dynamic_cast<RTP_UDP *>(session);
+      if (udp != NULL && udp->CanUseReactor())
+        udp->AttachReactor(mediaReactor);
+    }
   }
 
   // The following is the mutex.Signal() that was not done in the UseSession()
@@ -1412,7 +1866,9 @@ RTP_UDP::RTP_UDP(
     remoteTransmitAddress(0), shutdownRead(false), shutdownWrite(false),
     dataSocket(NULL), controlSocket(NULL),
     appliedQOS(false), enableGQOS(false),
-    remoteIsNAT(_remoteIsNAT), successiveWrongAddresses(0), mediaIsTunneled(_mediaTunneled)
+    remoteIsNAT(_remoteIsNAT), successiveWrongAddresses(0), mediaIsTunneled(_mediaTunneled),
+    natMethodSockets(false), reactor(NULL), reactorFrames(NULL), reactorHead(0), reactorCount(0),
+    reactorOverruns(0), reactorAborted(false)
 {
 
 }
@@ -1420,6 +1876,8 @@ RTP_UDP::RTP_UDP(
 
 RTP_UDP::~RTP_UDP()
 {
+  DetachReactor();
+
   Close(TRUE);
   Close(FALSE);
 
@@ -1427,6 +1885,8 @@ RTP_UDP::~RTP_UDP()
   dataSocket = NULL;
   delete controlSocket;
   controlSocket = NULL;
+
+  delete [] reactorFrames;
 }
 
 
@@ -1499,10 +1959,13 @@ PBoolean RTP_UDP::Open(PIPSocket::Address _localAddress,
   localDataPort    = (WORD)(portBase&0xfffe);
   localControlPort = (WORD)(localDataPort + 1);
 
+  DetachReactor();
+
   delete dataSocket;
   delete controlSocket;
   dataSocket = NULL;
   controlSocket = NULL;
+  natMethodSockets = FALSE;
 
 #if P_QOS
   PQoS * dataQos = NULL;
@@ -1527,6 +1990,7 @@ PBoolean RTP_UDP::Open(PIPSocket::Address _localAddress,
 #endif
       dataSocket->GetLocalAddress(localAddress, localDataPort);
       controlSocket->GetLocalAddress(localAddress, localControlPort);
+      natMethodSockets = TRUE;
 #if PTLIB_VER >= 2130
       PString name = meth->GetMethodName();
 #else
@@ -1609,6 +2073,8 @@ void RTP_UDP::Close(PBoolean reading)
           PIPSocket::GetHostAddress(addr);
         dataSocket->WriteTo("", 1, addr, controlSocket->GetPort());
       }
+      if (reactor != NULL)
+        reactorSignal.Signal();
     }
   }
   else {
@@ -1677,6 +2143,9 @@ PBoolean RTP_UDP::PseudoRead(int & selectStatus)
 
 PBoolean RTP_UDP::ReadData(RTP_DataFrame & frame, PBoolean loop)
 {
+  if (reactor != NULL)
+    return ReadReactorData(frame);
+
   do {
 #ifdef H323_RTP_AGGREGATE
     PTime start;
@@ -1896,6 +2365,531 @@ RTP_Session::SendReceiveStatus RTP_UDP::ReadControlPDU()
 }
 
 
+PBoolean RTP_UDP::CanUseReactor() const
+{
+  return dataSocket != NULL && controlSocket != NULL && !mediaIsTunneled && !natMethodSockets;
+}
+
+
+PBoolean RTP_UDP::AttachReactor(RTP_MediaReactor * newReactor)
+{
+  if (newReactor == NULL || reactor != NULL || !CanUseReactor())
+    return FALSE;
+
+  reactorMutex.Wait();
+  if (reactorFrames == NULL)
+    reactorFrames = new RTP_PooledDataFrame[ReactorQueueSize];
+  reactorHead = 0;
+  reactorCount = 0;
+  reactorAborted = FALSE;
+  reactorMutex.Signal();
+
+  reactor = newReactor;
+  if (!reactor->AddSession(*this)) {
+    reactor = NULL;
+    return FALSE;
+  }
+
+  PTRACE(4, "RTP_UDP\tSession " << sessionID << ", attached to media reactor");
+  return TRUE;
+}
+
+
+void RTP_UDP::DetachReactor()
+{
+  if (reactor == NULL)
+    return;
+
+  reactor->RemoveSession(*this);
+  reactor = NULL;
+  reactorSignal.Signal();
+
+  PTRACE(4, "RTP_UDP\tSession " << sessionID << ", detached from media reactor");
+}
+
+
+PBoolean RTP_UDP::OnReactorRead(PBoolean fromDataChannel)
+{
+  if (!fromDataChannel) {
+    if (ReadControlPDU() != e_AbortTransport)
+      return TRUE;
+  }
+  else {
+    // The slot after the newest queued frame is owned by the reactor thread
+    // until it is counted, so it can be filled without holding the mutex.
+    reactorMutex.Wait();
+    if (reactorCount >= ReactorQueueSize-1) {
+      reactorHead = (reactorHead+1)%ReactorQueueSize;
+      reactorCount--;
+      reactorOverruns++;
+      PTRACE_IF(2, reactorOverruns == 1, "RTP_UDP\tSession " << sessionID
+                << ", reader not keeping up with media reactor, dropping oldest frame");
+    }
+    RTP_DataFrame & slot = reactorFrames[(reactorHead+reactorCount)%ReactorQueueSize];
+    reactorMutex.Signal();
+
+    switch (ReadDataPDU(slot)) {
+      case e_ProcessPacket :
+        reactorMutex.Wait();
+        reactorCount++;
+        reactorMutex.Signal();
+        reactorSignal.Signal();
+        return TRUE;
+
+      case e_IgnorePacket :
+        return TRUE;
+
+      case e_AbortTransport :
+        break;
+    }
+  }
+
+  reactorAborted = TRUE;
+  reactorSignal.Signal();
+  return FALSE;
+}
+
+
+void RTP_UDP::OnReactorTimeout()
+{
+  // SendReport() only does anything once the report timer has expired
+  if (!SendReport()) {
+    reactorAborted = TRUE;
+    reactorSignal.Signal();
+  }
+}
+
+
+PBoolean RTP_UDP::PopReactorFrame(RTP_DataFrame & frame)
+{
+  PWaitAndSignal m(reactorMutex);
+
+  if (reactorCount == 0)
+    return FALSE;
+
+  const RTP_DataFrame & slot = reactorFrames[reactorHead];
+  PINDEX size = slot.GetHeaderSize()+slot.GetPayloadSize();
+  frame.SetMinSize(size);
+  memcpy(frame.GetPointer(), (const BYTE *)slot, size);
+  frame.SetPayloadSize(slot.GetPayloadSize());
+  RTP_FramePool::Default().CountCopy(size);
+  reactorHead = (reactorHead+1)%ReactorQueueSize;
+  reactorCount--;
+  return TRUE;
+}
+
+
+PBoolean RTP_UDP::ReadReactorData(RTP_DataFrame & frame)
+{
+  for (;;) {
+    if (shutdownRead) {
+      PTRACE(3, "RTP_UDP\tSession " << sessionID << ", Read shutdown.");
+      shutdownRead = FALSE;
+      return FALSE;
+    }
+
+    if (PopReactorFrame(frame))
+      return TRUE;
+
+    if (reactorAborted || reactor == NULL)
+      return FALSE;
+
+    reactorSignal.Wait();
+  }
+}
+
+
+PBoolean RTP_UDP::CanReadDataNoWait() const
+{
+  return reactor != NULL;
+}
+
+
+PBoolean RTP_UDP::ReadDataNoWait(RTP_DataFrame & frame, PBoolean & available)
+{
+  available = FALSE;
+
+  if (shutdownRead) {
+    PTRACE(3, "RTP_UDP\tSession " << sessionID << ", Read shutdown.");
+    shutdownRead = FALSE;
+    return FALSE;
+  }
+
+  if (reactor != NULL) {
+    available = PopReactorFrame(frame);
+    return available || !reactorAborted;
+  }
+
+  int selectStatus = PSocket::Select(*dataSocket, *controlSocket, PTimeInterval(0));
+  switch (selectStatus) {
+    case -2 :
+      return ReadControlPDU() != e_AbortTransport;
+
+    case -3 :
+      if (ReadControlPDU() == e_AbortTransport)
+        return FALSE;
+      // Then do -1 case
+
+    case -1 :
+      switch (ReadDataPDU(frame)) {
+        case e_ProcessPacket :
+          available = !shutdownRead;
+          return TRUE;
+        case e_IgnorePacket :
+          return TRUE;
+        case e_AbortTransport :
+          return FALSE;
+      }
+      break;
+
+    case 0 :
+      // SendReport() only does anything once the report timer has expired
+      return SendReport();
+
+    case PSocket::Interrupted:
+      PTRACE(3, "RTP_UDP\tSession " << sessionID << ", Interrupted.");
+      return FALSE;
+
+    default :
+      PTRACE(1, "RTP_UDP\tSession " << sessionID << ", Select error: "
+              << PChannel::GetErrorText((PChannel::Errors)selectStatus));
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+
+/* Number of milliseconds a reactor thread waits for socket activity before
+   checking whether any session is due to send an RTCP report. */
+#define REACTOR_POLL_INTERVAL 100
+
+/* Maximum number of socket events handled per wakeup of a reactor thread */
+#define REACTOR_MAX_EVENTS 64
+
+class RTP_MediaReactor::Worker : public PThread
+{
+    PCLASSINFO(Worker, PThread);
+  public:
+    Worker(PINDEX stackSize);
+    ~Worker();
+
+    PBoolean Add(RTP_UDP & session);
+    void Remove(RTP_UDP & session);
+    PINDEX GetSessionCount() const { return sessionCount; }
+    void Stop();
+
+  protected:
+    void Main();
+    RTP_UDP * Find(unsigned id) const;
+    void Drop(unsigned id);
+    void Dispatch();
+
+    struct Ready {
+      unsigned  id;
+      RTP_UDP * session;
+      PBoolean  isData;
+      PBoolean  isTimeout;
+    };
+    void AddReady(unsigned id, RTP_UDP * session, PBoolean isData, PBoolean isTimeout);
+
+    // The epoll data word holds the session id shifted left by one, with
+    // the low bit set for the control socket.
+    typedef std::map<unsigned, RTP_UDP *> SessionMap;
+    SessionMap       sessions;
+    unsigned         nextId;
+    PAtomicInteger   sessionCount;
+    PMutex           mutex;
+    PMutex           dispatchMutex;
+    std::vector<Ready> ready;
+    PBoolean         shutdown;
+#ifdef P_LINUX
+    int              epollFd;
+#endif
+};
+
+
+RTP_MediaReactor::Worker::Worker(PINDEX stackSize)
+  : PThread(stackSize, NoAutoDeleteThread, HighestPriority, "RTP Reactor:%x"),
+    nextId(1), sessionCount(0), shutdown(FALSE)
+{
+#ifdef P_LINUX
+  epollFd = epoll_create(REACTOR_MAX_EVENTS);
+  PTRACE_IF(1, epollFd < 0, "RTP\tReactor could not create epoll descriptor, errno=" << errno);
+#endif
+  Resume();
+}
+
+
+RTP_MediaReactor::Worker::~Worker()
+{
+#ifdef P_LINUX
+  if (epollFd >= 0)
+    ::close(epollFd);
+#endif
+}
+
+
+void RTP_MediaReactor::Worker::Stop()
+{
+  shutdown = TRUE;
+  WaitForTermination(REACTOR_POLL_INTERVAL*10);
+}
+
+
+RTP_UDP * RTP_MediaReactor::Worker::Find(unsigned id) const
+{
+  SessionMap::const_iterator it = sessions.find(id);
+  return it != sessions.end() ? it->second : NULL;
+}
+
+
+PBoolean RTP_MediaReactor::Worker::Add(RTP_UDP & session)
+{
+  PWaitAndSignal m(mutex);
+
+  unsigned id = nextId++;
+
+#ifdef P_LINUX
+  if (epollFd < 0)
+    return FALSE;
+
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.events = EPOLLIN;
+
+  ev.data.u64 = id << 1;
+  if (epoll_ctl(epollFd, EPOLL_CTL_ADD, session.GetDataSocketHandle(), &ev) < 0) {
+    PTRACE(1, "RTP\tReactor could not add data socket, errno=" << errno);
+    return FALSE;
+  }
+
+  ev.data.u64 = (id << 1) | 1;
+  if (epoll_ctl(epollFd, EPOLL_CTL_ADD, session.GetControlSocketHandle(), &ev) < 0) {
+    PTRACE(1, "RTP\tReactor could not add control socket, errno=" << errno);
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, session.GetDataSocketHandle(), &ev);
+    return FALSE;
+  }
+#endif
+
+  sessions[id] = &session;
+  ++sessionCount;
+  return TRUE;
+}
+
+
+void RTP_MediaReactor::Worker::Drop(unsigned id)
+{
+  SessionMap::iterator it = sessions.find(id);
+  if (it == sessions.end())
+    return;
+
+#ifdef P_LINUX
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  epoll_ctl(epollFd, EPOLL_CTL_DEL, it->second->GetDataSocketHandle(), &ev);
+  epoll_ctl(epollFd, EPOLL_CTL_DEL, it->second->GetControlSocketHandle(), &ev);
+#endif
+
+  sessions.erase(it);
+  --sessionCount;
+}
+
+
+void RTP_MediaReactor::Worker::Remove(RTP_UDP & session)
+{
+  mutex.Wait();
+  for (SessionMap::iterator it = sessions.begin(); it != sessions.end(); ++it) {
+    if (it->second == &session) {
+      Drop(it->first);
+      break;
+    }
+  }
+  mutex.Signal();
+
+  // Callbacks run without the session mutex, so wait for any dispatch pass
+  // that may still hold a pointer to the session. The mutex is recursive so
+  // a callback removing its own session does not block here.
+  PWaitAndSignal d(dispatchMutex);
+}
+
+
+void RTP_MediaReactor::Worker::AddReady(unsigned id, RTP_UDP * session, PBoolean isData, PBoolean isTimeout)
+{
+  Ready r;
+  r.id = id;
+  r.session = session;
+  r.isData = isData;
+  r.isTimeout = isTimeout;
+  ready.push_back(r);
+}
+
+
+void RTP_MediaReactor::Worker::Dispatch()
+{
+  // Called with dispatchMutex held and the session mutex released. A session
+  // removed by an earlier callback in this pass is skipped.
+  for (std::vector<Ready>::iterator r = ready.begin(); r != ready.end(); ++r) {
+    mutex.Wait();
+    PBoolean present = Find(r->id) == r->session;
+    mutex.Signal();
+    if (!present)
+      continue;
+
+    if (r->isTimeout)
+      r->session->OnReactorTimeout();
+    else if (!r->session->OnReactorRead(r->isData)) {
+      mutex.Wait();
+      Drop(r->id);
+      mutex.Signal();
+    }
+  }
+  ready.clear();
+}
+
+
+void RTP_MediaReactor::Worker::Main()
+{
+  PTRACE(3, "RTP\tReactor thread started");
+
+  PTimeInterval lastReportCheck = PTimer::Tick();
+
+  while (!shutdown) {
+#ifdef P_LINUX
+    struct epoll_event events[REACTOR_MAX_EVENTS];
+    int count = epoll_wait(epollFd, events, REACTOR_MAX_EVENTS, REACTOR_POLL_INTERVAL);
+    if (count < 0) {
+      if (errno == EINTR)
+        continue;
+      PTRACE(1, "RTP\tReactor epoll_wait failed, errno=" << errno);
+      break;
+    }
+
+    dispatchMutex.Wait();
+    mutex.Wait();
+    for (int i = 0; i < count; i++) {
+      unsigned id = (unsigned)(events[i].data.u64 >> 1);
+      RTP_UDP * session = Find(id);
+      if (session != NULL)
+        AddReady(id, session, (events[i].data.u64 & 1) == 0, FALSE);
+    }
+#else
+    dispatchMutex.Wait();
+    mutex.Wait();
+    if (sessions.empty()) {
+      mutex.Signal();
+      dispatchMutex.Signal();
+      PThread::Sleep(REACTOR_POLL_INTERVAL);
+      continue;
+    }
+
+    // Sockets cannot be closed while the mutex is held, so select under it
+    // with a short timeout to keep AddSession()/RemoveSession() responsive.
+    PSocket::SelectList readList;
+    SessionMap::iterator it;
+    for (it = sessions.begin(); it != sessions.end(); ++it) {
+      readList += it->second->GetDataSocket();
+      readList += it->second->GetControlSocket();
+    }
+
+    PSocket::Select(readList, PTimeInterval(REACTOR_POLL_INTERVAL/10));
+
+    for (PINDEX i = 0; i < readList.GetSize(); i++) {
+      for (it = sessions.begin(); it != sessions.end(); ++it) {
+        PBoolean isData = &readList[i] == &it->second->GetDataSocket();
+        if (isData || &readList[i] == &it->second->GetControlSocket()) {
+          AddReady(it->first, it->second, isData, FALSE);
+          break;
+        }
+      }
+    }
+#endif
+
+    PTimeInterval now = PTimer::Tick();
+    if ((now - lastReportCheck).GetMilliSeconds() >= REACTOR_POLL_INTERVAL) {
+      lastReportCheck = now;
+      for (SessionMap::iterator s = sessions.begin(); s != sessions.end(); ++s)
+        AddReady(s->first, s->second, FALSE, TRUE);
+    }
+    mutex.Signal();
+
+    // Run the callbacks without the session mutex so a slow read or RTCP
+    // send does not hold up AddSession()/RemoveSession() on other threads.
+    Dispatch();
+    dispatchMutex.Signal();
+  }
+
+  PTRACE(3, "RTP\tReactor thread ended");
+}
+
+
+RTP_MediaReactor::RTP_MediaReactor(PINDEX threadCount, PINDEX stackSize)
+{
+  if (threadCount < 1)
+    threadCount = 1;
+
+  for (PINDEX i = 0; i < threadCount; i++)
+    workers.push_back(new Worker(stackSize));
+
+  PTRACE(3, "RTP\tMedia reactor created with " << threadCount << " threads");
+}
+
+
+RTP_MediaReactor::~RTP_MediaReactor()
+{
+  PTRACE_IF(2, !sessionWorkers.empty(), "RTP\tMedia reactor destroyed with "
+            << sessionWorkers.size() << " sessions still attached");
+
+  for (std::vector<Worker *>::iterator it = workers.begin(); it != workers.end(); ++it) {
+    (*it)->Stop();
+    delete *it;
+  }
+}
+
+
+PBoolean RTP_MediaReactor::AddSession(RTP_UDP & session)
+{
+  PWaitAndSignal m(mutex);
+
+  if (sessionWorkers.find(&session) != sessionWorkers.end())
+    return TRUE;
+
+  Worker * worker = workers.front();
+  for (std::vector<Worker *>::iterator it = workers.begin(); it != workers.end(); ++it) {
+    if ((*it)->GetSessionCount() < worker->GetSessionCount())
+      worker = *it;
+  }
+
+  if (!worker->Add(session))
+    return FALSE;
+
+  sessionWorkers[&session] = worker;
+  return TRUE;
+}
+
+
+void RTP_MediaReactor::RemoveSession(RTP_UDP & session)
+{
+  PWaitAndSignal m(mutex);
+
+  std::map<RTP_UDP *, Worker *>::iterator it = sessionWorkers.find(&session);
+  if (it == sessionWorkers.end())
+    return;
+
+  it->second->Remove(session);
+  sessionWorkers.erase(it);
+}
+
+
+PINDEX RTP_MediaReactor::GetSessionCount() const
+{
+  PWaitAndSignal m(mutex);
+  return (PINDEX)sessionWorkers.size();
+}
+
+
 PBoolean RTP_UDP::PreWriteData(RTP_DataFrame & frame)
 {
   if (shutdownWrite) {
@@ -34,6 +34,13 @@
 
 #include "rtp2wav.h"
 
+#include <set>
+
+#ifdef P_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 
 #define new PNEW
 
@@ -51,6 +58,14 @@ OpalRtpToWavFile::OpalRtpToWavFile()
 {
   payloadType = RTP_DataFrame::IllegalPayloadType;
   lastPayloadSize = 0;
+  writer = NULL;
+  worker = NULL;
+  attached = FALSE;
+  draining = FALSE;
+  failed = FALSE;
+  bytesDropped = 0;
+  bytesLost = 0;
+  unsynced = FALSE;
 }
 
 
@@ -66,6 +81,63 @@ OpalRtpToWavFile::OpalRtpToWavFile(const PString & filename)
   SetFilePath(filename);
   payloadType = RTP_DataFrame::IllegalPayloadType;
   lastPayloadSize = 0;
+  writer = NULL;
+  worker = NULL;
+  attached = FALSE;
+  draining = FALSE;
+  failed = FALSE;
+  bytesDropped = 0;
+  bytesLost = 0;
+  unsynced = FALSE;
+}
+
+
+OpalRtpToWavFile::OpalRtpToWavFile(const PString & filename, OpalRecordingWriter & _writer)
+#ifdef _MSC_VER
+#pragma warning(disable:4355)
+#endif
+  :  receiveHandler(PCREATE_NOTIFIER(ReceivedPacket)),
+     blocks(_writer.GetBlocksPerFile())
+#ifdef _MSC_VER
+#pragma warning(default:4355)
+#endif
+{
+  SetFilePath(filename);
+  payloadType = RTP_DataFrame::IllegalPayloadType;
+  lastPayloadSize = 0;
+  writer = &_writer;
+  worker = NULL;
+  attached = FALSE;
+  draining = FALSE;
+  failed = FALSE;
+  bytesDropped = 0;
+  bytesLost = 0;
+  unsynced = FALSE;
+}
+
+
+OpalRtpToWavFile::~OpalRtpToWavFile()
+{
+  Close();
+
+  for (size_t i = 0; i < blocks.size(); i++)
+    delete [] blocks[i].data;
+}
+
+
+PBoolean OpalRtpToWavFile::Close()
+{
+  if (attached) {
+    // The writer writes the rest, the partly filled block included
+    writer->Detach(*this);
+    attached = FALSE;
+
+    writer->AddStatistics(0, bytesDropped + bytesLost, 0, 0);
+    PTRACE(3, "rtp2wav\tFinished recording to " << GetFilePath()
+           << ", dropped " << bytesDropped + bytesLost << " bytes");
+  }
+
+  return PWAVFile::Close();
 }
 
 
@@ -94,6 +166,15 @@ PBoolean OpalRtpToWavFile::OnFirstPacket(RTP_DataFrame & frame)
     return FALSE;
   }
 
+  // The writer opens the file, keeping the disk off this thread
+  if (writer != NULL) {
+    writer->Attach(*this);
+    attached = TRUE;
+    PTRACE(3, "rtp2wav\tStarted recording payload type " << payloadType
+           << " to " << GetFilePath() << " through writer pool");
+    return TRUE;
+  }
+
   if (!Open(PFile::WriteOnly)) {
     PTRACE(1, "rtp2wav\tCould not open WAV file: " << GetErrorText());
     return FALSE;
@@ -120,6 +201,21 @@ void OpalRtpToWavFile::ReceivedPacket(RTP_DataFrame & frame,  H323_INT)
   if (payloadType != frame.GetPayloadType())
     return;
 
+  if (attached) {
+    if (payloadSize > 0) {
+      Capture(frame.GetPayloadPtr(), payloadSize);
+      lastPayloadSize = payloadSize;
+      memcpy(lastFrame.GetPointer(lastPayloadSize), frame.GetPayloadPtr(), payloadSize);
+    }
+    else if (lastPayloadSize > 0)
+      Capture(lastFrame, lastPayloadSize);
+
+    // Do not hold a partly filled block for long
+    if (blocks[head % blocks.size()].length > 0 && PTimer::Tick() - blockStarted >= writer->GetFlushInterval())
+      QueueBlock();
+    return;
+  }
+
   if (!IsOpen())
     return;
 
@@ -142,4 +238,311 @@ void OpalRtpToWavFile::ReceivedPacket(RTP_DataFrame & frame,  H323_INT)
 }
 
 
+void OpalRtpToWavFile::Capture(const BYTE * data, PINDEX size)
+{
+  if (failed)
+    return;
+
+  PINDEX blockSize = writer->GetBlockSize();
+
+  while (size > 0) {
+    Block & block = blocks[head % blocks.size()];
+    if (block.data == NULL)
+      block.data = new BYTE[blockSize];
+    if (block.length == 0)
+      blockStarted = PTimer::Tick();
+
+    PINDEX count = PMIN(size, blockSize - block.length);
+    memcpy(block.data + block.length, data, count);
+    block.length += count;
+    data += count;
+    size -= count;
+
+    if (block.length >= blockSize)
+      QueueBlock();
+  }
+}
+
+
+void OpalRtpToWavFile::QueueBlock()
+{
+  long queued = head;
+  Block & block = blocks[queued % blocks.size()];
+  if (block.length == 0)
+    return;
+
+  // The next block must not be one still waiting for the writer
+  if (queued - (long)tail >= (long)blocks.size() - 1) {
+    bytesDropped += block.length;
+    block.length = 0;
+    PTRACE(4, "rtp2wav\tWriter behind on " << GetFilePath() << ", dropped block");
+    return;
+  }
+
+  ++head;
+
+  if (attached && queued + 1 - (long)tail >= (long)blocks.size()/2)
+    writer->Wake(*this);
+}
+
+
+PINDEX OpalRtpToWavFile::WriteQueued(PBYTEArray & batch, PBoolean closing)
+{
+  long first = tail;
+  long last = head;
+
+  // Capture has stopped when draining, so the block at the head is ours too
+  long end = last;
+  if (closing && blocks[last % blocks.size()].length > 0)
+    end++;
+
+  if (!IsOpen() && !failed && first != end) {
+    if (!Open(PFile::WriteOnly)) {
+      PTRACE(1, "rtp2wav\tCould not open WAV file: " << GetErrorText());
+      failed = TRUE;
+    }
+#ifdef P_LINUX
+    else if (writer->preallocation > 0)
+      fallocate(GetHandle(), FALLOC_FL_KEEP_SIZE, GetPosition(), writer->preallocation);
+#endif
+  }
+
+  PINDEX total = 0;
+  long i;
+  for (i = first; i < end; i++)
+    total += blocks[i % blocks.size()].length;
+
+  // One sequential write for everything queued
+  PINDEX written = 0;
+  unsigned writeCount = 0;
+  if (total > 0 && !failed) {
+    const BYTE * data;
+    if (end - first == 1)
+      data = blocks[first % blocks.size()].data;
+    else {
+      BYTE * ptr = batch.GetPointer(total);
+      data = ptr;
+      for (i = first; i < end; i++) {
+        Block & block = blocks[i % blocks.size()];
+        memcpy(ptr, block.data, block.length);
+        ptr += block.length;
+      }
+    }
+
+    writeCount++;
+    if (Write(data, total)) {
+      written = total;
+      unsynced = TRUE;
+    }
+    else {
+      PTRACE(1, "rtp2wav\tError writing to WAV file: " << GetErrorText(PChannel::LastWriteError));
+      failed = TRUE;
+    }
+  }
+  bytesLost += total - written;
+
+  for (i = first; i < last; i++) {
+    blocks[i % blocks.size()].length = 0;
+    ++tail;
+  }
+  if (end > last)
+    blocks[last % blocks.size()].length = 0;
+
+  unsigned syncCount = 0;
+#ifdef P_LINUX
+  PTimeInterval now = PTimer::Tick();
+  if (unsynced && IsOpen() && writer->syncInterval > 0 && (closing || now - lastSync >= writer->syncInterval)) {
+    fdatasync(GetHandle());
+    unsynced = FALSE;
+    lastSync = now;
+    syncCount++;
+  }
+#endif
+
+  if (written > 0 || syncCount > 0)
+    writer->AddStatistics(written, 0, writeCount, syncCount);
+
+  return written;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+
+class OpalRecordingWriter::Worker : public PThread
+{
+    PCLASSINFO(Worker, PThread);
+  public:
+    Worker(OpalRecordingWriter & w)
+      : PThread(10000, NoAutoDeleteThread, NormalPriority, "Recorder:%x"),
+        writer(w),
+        shutdown(FALSE),
+        stopped(FALSE)
+    {
+      Resume();
+    }
+
+    void Stop()
+    {
+      shutdown = TRUE;
+      wake.Signal();
+      WaitForTermination();
+    }
+
+    void Main()
+    {
+      // Write at least every half flush interval, or when a recording is half full
+      while (!shutdown) {
+        wake.Wait(PMAX(writer.GetFlushInterval()/2, 10U));
+
+        mutex.Wait();
+        std::vector<OpalRtpToWavFile *> pending(files.begin(), files.end());
+        mutex.Signal();
+
+        for (size_t i = 0; i < pending.size() && !shutdown; i++)
+          Write(*pending[i]);
+      }
+
+      // Finish the recordings already closing, Detach() drains any closed
+      // once stopped is set on its own thread.
+      for (;;) {
+        std::vector<OpalRtpToWavFile *> closing;
+        mutex.Wait();
+        for (std::set<OpalRtpToWavFile *>::iterator it = files.begin(); it != files.end(); ++it) {
+          if ((*it)->draining)
+            closing.push_back(*it);
+        }
+        if (closing.empty())
+          stopped = TRUE;
+        mutex.Signal();
+
+        if (closing.empty())
+          break;
+
+        for (size_t i = 0; i < closing.size(); i++)
+          Write(*closing[i]);
+      }
+    }
+
+    // Only this thread removes a recording, after its final drain
+    void Write(OpalRtpToWavFile & file)
+    {
+      mutex.Wait();
+      PBoolean draining = file.draining;
+      mutex.Signal();
+
+      file.WriteQueued(batch, draining);
+
+      if (draining) {
+        mutex.Wait();
+        files.erase(&file);
+        mutex.Signal();
+        file.drained.Signal();
+      }
+    }
+
+    OpalRecordingWriter & writer;
+    PMutex                mutex;
+    PSyncPoint            wake;
+    std::set<OpalRtpToWavFile *> files;
+    PBYTEArray            batch;
+    PBoolean              shutdown;
+    PBoolean              stopped;    // Set under the mutex once Main() no longer drains
+};
+
+
+OpalRecordingWriter::OpalRecordingWriter(PINDEX threads, PINDEX _blockSize, PINDEX _blocksPerFile, unsigned _syncInterval)
+  : blockSize(PMAX(_blockSize, 1024)),
+    blocksPerFile(PMAX(_blocksPerFile, 2)),
+    syncInterval(_syncInterval),
+    flushInterval(1000),
+    preallocation(0),
+    bytesWritten(0),
+    bytesDropped(0),
+    writes(0),
+    syncs(0)
+{
+  if (threads < 1)
+    threads = 1;
+
+  for (PINDEX i = 0; i < threads; i++)
+    workers.push_back(new Worker(*this));
+}
+
+
+OpalRecordingWriter::~OpalRecordingWriter()
+{
+  for (size_t i = 0; i < workers.size(); i++) {
+    PTRACE_IF(1, !workers[i]->files.empty(), "rtp2wav\tWriter destroyed with recordings still open");
+    workers[i]->Stop();
+    delete workers[i];
+  }
+}
+
+
+void OpalRecordingWriter::Attach(OpalRtpToWavFile & file)
+{
+  Worker * worker = workers[(unsigned)++nextWorker % workers.size()];
+  file.worker = worker;
+
+  PWaitAndSignal m(worker->mutex);
+  worker->files.insert(&file);
+}
+
+
+void OpalRecordingWriter::Detach(OpalRtpToWavFile & file)
+{
+  Worker * worker = file.worker;
+  if (worker == NULL)
+    return;
+
+  worker->mutex.Wait();
+  if (worker->stopped) {
+    worker->files.erase(&file);
+    worker->mutex.Signal();
+    file.worker = NULL;
+
+    // No thread left to wait on, write what is left here
+    PBYTEArray batch;
+    file.WriteQueued(batch, TRUE);
+    return;
+  }
+
+  // The worker writes what is left, then removes the file and signals
+  file.draining = TRUE;
+  worker->mutex.Signal();
+  worker->wake.Signal();
+
+  file.drained.Wait();
+  file.worker = NULL;
+  file.draining = FALSE;
+}
+
+
+void OpalRecordingWriter::Wake(OpalRtpToWavFile & file)
+{
+  if (file.worker != NULL)
+    file.worker->wake.Signal();
+}
+
+
+void OpalRecordingWriter::AddStatistics(PUInt64 written, PUInt64 dropped, unsigned writeCount, unsigned syncCount)
+{
+  PWaitAndSignal m(statisticsMutex);
+  bytesWritten += written;
+  bytesDropped += dropped;
+  writes += writeCount;
+  syncs += syncCount;
+}
+
+
+void OpalRecordingWriter::GetStatistics(PUInt64 & written, PUInt64 & dropped, unsigned & writeCount, unsigned & syncCount)
+{
+  PWaitAndSignal m(statisticsMutex);
+  written = bytesWritten;
+  dropped = bytesDropped;
+  writeCount = writes;
+  syncCount = syncs;
+}
+
+
 /////////////////////////////////////////////////////////////////////////////
@@ -55,6 +55,10 @@
 #include <openssl/err.h>
 #endif
 
+#ifdef P_LINUX
+#include <sys/epoll.h>
+#endif
+
 // TCP KeepAlive
 static int KeepAliveInterval = 19;
 
@@ -219,6 +223,15 @@ void H245TransportThread::Main()
     }
 #endif
 
+    // With the signalling reactor the channel is read by the shared reactor
+    // threads and this thread ends here.
+    if (connection.StartControlChannelReactor(&transport, connection.GetEndPoint().EnableH245KeepAlive())) {
+      m_keepAlive.Stop();
+      if (transport.DetachThread(this))
+        SetAutoDelete(AutoDeleteThread);
+      return;
+    }
+
     connection.HandleControlChannel();
   }
 }
@@ -968,6 +981,7 @@ H323Transport::H323Transport(H323EndPoint & end)
 #endif
   thread = NULL;
   canGetInterface = false;
+  signalReactor = NULL;
 }
 
 
@@ -1064,6 +1078,12 @@ PBoolean H323Transport::Close()
 {
   PTRACE(3, "H323\tH323Transport::Close");
 
+  // The signal reactor reads a duplicate of the socket, which would keep
+  // the connection open after the base channel is closed.
+  H323SignalReactor * reactor = signalReactor;
+  if (reactor != NULL)
+    reactor->OnTransportClosed(*this);
+
   /* Do not use PIndirectChannel::Close() as this deletes the sub-channel
      member field crashing the background thread. Just close the base
      sub-channel so breaks the threads I/O block.
@@ -1159,23 +1179,32 @@ PBoolean H323Transport::HandleFirstSignallingChannelPDU(PThread * thread)
     }
 #endif
 
+    PBoolean keepAlive = false;
+#ifdef H323_H46018
+    keepAlive = connection->IsH46019Enabled();
+#endif
+
+    // All subsequent PDU's should wait forever
+    SetReadTimeout(PMaxTimeInterval);
+
+    // With the signalling reactor the remaining PDUs are read by the shared
+    // reactor threads, this thread (which auto deletes) ends here.
+    if (connection->StartSignalChannelReactor(this, keepAlive || endpoint.EnableH225KeepAlive())) {
+      connection->Unlock();
+      return TRUE;
+    }
+
     // If aggregation is not being used, then this thread is attached to the transport,
     // which is in turn attached to the connection so everything from gets cleaned up by the
     // H323 cleaner thread from now on. So thread must not auto delete and the "transport"
     // variable is not deleted either
     PAssert(PIsDescendant(thread, H225TransportThread), PInvalidCast);
-    PBoolean keepAlive = false;
-#ifdef H323_H46018
-    keepAlive = connection->IsH46019Enabled();
-#endif
     ((H225TransportThread *)thread)->ConnectionEstablished(keepAlive);
     AttachThread(thread);
     thread->SetNoAutoDelete();
 
     connection->Unlock();
 
-    // All subsequent PDU's should wait forever
-    SetReadTimeout(PMaxTimeInterval);
     connection->HandleSignallingChannel();
   }
   else {
@@ -1197,20 +1226,36 @@ void H323Transport::StartControlChannel(H323Connection & connection)
 
 void H323Transport::AttachThread(PThread * thrd)
 {
+  PWaitAndSignal m(threadMutex);
   PAssert(thread == NULL, PLogicError);
   thread = thrd;
 }
 
 
+PBoolean H323Transport::DetachThread(PThread * thrd)
+{
+  PWaitAndSignal m(threadMutex);
+  if (thread != thrd)
+    return FALSE;
+
+  thread = NULL;
+  return TRUE;
+}
+
+
 void H323Transport::CleanUpOnTermination()
 {
   Close();
 
-  if (thread != NULL) {
-    PTRACE(3, "H323\tH323Transport::CleanUpOnTermination for " << thread->GetThreadName());
-    PAssert(thread->WaitForTermination(10000), "Transport thread did not terminate");
-    delete thread;
-    thread = NULL;
+  threadMutex.Wait();
+  PThread * thrd = thread;
+  thread = NULL;
+  threadMutex.Signal();
+
+  if (thrd != NULL) {
+    PTRACE(3, "H323\tH323Transport::CleanUpOnTermination for " << thrd->GetThreadName());
+    PAssert(thrd->WaitForTermination(10000), "Transport thread did not terminate");
+    delete thrd;
   }
 }
 
@@ -2503,6 +2548,740 @@ H323TransportAddress H323TransportUDP::GetLocalAddress() const
   return taddr;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+
+/* Milliseconds an I/O thread waits for socket activity before checking the
+   read timeouts and keep alives of its handles. */
+#define SIGNAL_REACTOR_TICK 500
+
+/* Maximum number of socket events handled per wakeup of an I/O thread */
+#define SIGNAL_REACTOR_MAX_EVENTS 256
+
+/* Bytes read from a socket in one call */
+#define SIGNAL_REACTOR_READ_SIZE 8192
+
+/* PDUs a worker dispatches from one strand before letting other strands run */
+#define SIGNAL_REACTOR_BATCH 16
+
+#ifdef _WIN32
+#define SIGNAL_REACTOR_WOULD_BLOCK() (WSAGetLastError() == WSAEWOULDBLOCK || WSAGetLastError() == WSAEINTR)
+#define SIGNAL_REACTOR_RECV_FLAGS 0
+#else
+#define SIGNAL_REACTOR_WOULD_BLOCK() (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+#define SIGNAL_REACTOR_RECV_FLAGS MSG_DONTWAIT
+#endif
+
+class H323SignalReactor::Strand
+{
+  public:
+    Strand(const void * k)
+      : key(k), refs(0), scheduled(FALSE) { }
+
+    const void        * key;
+    std::deque<Event>   events;
+    PINDEX              refs;       // Handles plus one while in the run queue
+    PBoolean            scheduled;
+    PMutex              dispatchMutex;
+};
+
+
+class H323SignalReactor::IOThread : public PThread
+{
+    PCLASSINFO(IOThread, PThread);
+  public:
+    IOThread(H323SignalReactor & reactor, PINDEX stackSize);
+    ~IOThread();
+
+    PBoolean Add(Handle & handle, int osHandle);
+    void Remove(Handle & handle);
+    PBoolean Close(H323Transport & transport);
+    PINDEX GetHandleCount() const { return handleCount; }
+    void Stop();
+
+  protected:
+    void Main();
+    void OnReadable(Handle & handle);
+    PINDEX ExtractPDUs(Handle & handle, const BYTE * data, PINDEX length);
+    void Drop(Handle & handle);
+    void Fail(Handle & handle, PChannel::Errors error);
+    void CheckTimers();
+
+    typedef std::map<unsigned, Handle *> HandleMap;
+    typedef std::map<const H323Transport *, unsigned> TransportMap;
+    H323SignalReactor & reactor;
+    HandleMap           handles;
+    TransportMap        transports;
+    unsigned            nextId;
+    PAtomicInteger      handleCount;
+    PMutex              mutex;
+    PBoolean            shutdown;
+    PTimeInterval       lastCheck;
+    BYTE                readBuffer[SIGNAL_REACTOR_READ_SIZE];
+#ifdef P_LINUX
+    int                 epollFd;
+#endif
+};
+
+
+class H323SignalReactor::WorkerThread : public PThread
+{
+    PCLASSINFO(WorkerThread, PThread);
+  public:
+    WorkerThread(H323SignalReactor & r, PINDEX stackSize)
+      : PThread(stackSize, NoAutoDeleteThread, NormalPriority, "H323 Signal Worker:%x"),
+        reactor(r)
+    {
+      Resume();
+    }
+
+  protected:
+    void Main()
+    {
+      PTRACE(4, "H323\tSignal reactor worker started");
+
+      for (;;) {
+        Strand * strand = reactor.NextStrand();
+        if (strand != NULL)
+          reactor.RunStrand(*strand);
+        else if (reactor.shutdown)
+          break;
+      }
+
+      PTRACE(4, "H323\tSignal reactor worker ended");
+    }
+
+    H323SignalReactor & reactor;
+};
+
+
+H323SignalReactor::Handle::Handle(H323Transport & t, const void * key)
+  : transport(t),
+    strandKey(key),
+    strand(NULL),
+    id(0),
+    fd(-1),
+    ioThread(0),
+    attached(FALSE),
+    keepAlive(FALSE),
+    bufferLen(0)
+{
+}
+
+
+H323SignalReactor::IOThread::IOThread(H323SignalReactor & r, PINDEX stackSize)
+  : PThread(stackSize, NoAutoDeleteThread, HighPriority, "H323 Signal IO:%x"),
+    reactor(r), nextId(1), handleCount(0), shutdown(FALSE)
+{
+#ifdef P_LINUX
+  epollFd = epoll_create(SIGNAL_REACTOR_MAX_EVENTS);
+  PTRACE_IF(1, epollFd < 0, "H323\tSignal reactor could not create epoll descriptor, errno=" << errno);
+#endif
+  lastCheck = PTimer::Tick();
+  Resume();
+}
+
+
+H323SignalReactor::IOThread::~IOThread()
+{
+#ifdef P_LINUX
+  if (epollFd >= 0)
+    ::close(epollFd);
+#endif
+}
+
+
+void H323SignalReactor::IOThread::Stop()
+{
+  shutdown = TRUE;
+  WaitForTermination(SIGNAL_REACTOR_TICK*10);
+}
+
+
+PBoolean H323SignalReactor::IOThread::Add(Handle & handle, int osHandle)
+{
+  PWaitAndSignal m(mutex);
+
+  if (handle.attached)
+    return TRUE;
+
+  unsigned id = nextId++;
+
+#ifdef P_LINUX
+  if (epollFd < 0)
+    return FALSE;
+
+  /* Service a duplicate of the descriptor, so the registration belongs to
+     the reactor alone: the transport may close its socket at any time and
+     the number be reused for another call before the handle is removed. */
+  int fd = ::dup(osHandle);
+  if (fd < 0) {
+    PTRACE(1, "H323\tSignal reactor could not duplicate socket, errno=" << errno);
+    return FALSE;
+  }
+
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.events = EPOLLIN;
+  ev.data.u64 = id;
+  if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+    PTRACE(1, "H323\tSignal reactor could not add socket, errno=" << errno);
+    ::close(fd);
+    return FALSE;
+  }
+#else
+  int fd = osHandle;
+#endif
+
+  handle.id = id;
+  handle.fd = fd;
+  handle.attached = TRUE;
+  handle.bufferLen = 0;
+  handle.buffer.SetSize(0);
+  handle.lastRead = handle.lastKeepAlive = handle.lastMonitor = PTimer::Tick();
+
+  handles[id] = &handle;
+  transports[&handle.transport] = id;
+  ++handleCount;
+  return TRUE;
+}
+
+
+void H323SignalReactor::IOThread::Drop(Handle & handle)
+{
+  if (!handle.attached)
+    return;
+
+#ifdef P_LINUX
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  epoll_ctl(epollFd, EPOLL_CTL_DEL, handle.fd, &ev);
+  ::close(handle.fd);
+#endif
+
+  handles.erase(handle.id);
+  transports.erase(&handle.transport);
+  --handleCount;
+  handle.attached = FALSE;
+  handle.fd = -1;
+}
+
+
+void H323SignalReactor::IOThread::Remove(Handle & handle)
+{
+  PWaitAndSignal m(mutex);
+  Drop(handle);
+}
+
+
+PBoolean H323SignalReactor::IOThread::Close(H323Transport & transport)
+{
+  PWaitAndSignal m(mutex);
+
+  TransportMap::iterator it = transports.find(&transport);
+  if (it == transports.end())
+    return FALSE;
+
+  PTRACE(4, "H323\tSignal reactor closing " << transport);
+  Fail(*handles[it->second], PChannel::NotOpen);
+  return TRUE;
+}
+
+
+void H323SignalReactor::IOThread::Fail(Handle & handle, PChannel::Errors error)
+{
+  // Stop reading, the worker decides whether the channel is serviced again
+  Drop(handle);
+  reactor.Queue(handle, ReadError, NULL, error);
+}
+
+
+PINDEX H323SignalReactor::IOThread::ExtractPDUs(Handle & handle, const BYTE * data, PINDEX length)
+{
+  // Queue every complete TPKT, returning the number of bytes used
+  PINDEX used = 0;
+  while (length - used >= 4) {
+    const BYTE * tpkt = data + used;
+
+    // only accept TPKT of type 3
+    if (tpkt[0] != 3) {
+      PTRACE(1, "H323\tSignal reactor received invalid TPKT version " << (unsigned)tpkt[0]);
+      return P_MAX_INDEX;
+    }
+
+    PINDEX pduLen = (tpkt[2] << 8)|tpkt[3];
+    if (pduLen < 4) {
+      PTRACE(1, "H323\tSignal reactor dwarf PDU received (length " << pduLen << ")");
+      return P_MAX_INDEX;
+    }
+
+    if (length - used < pduLen)
+      break;
+
+    // Empty TPKTs are keep alives, they only restart the read timeout
+    if (pduLen > 4)
+      reactor.Queue(handle, ReceivedPDU, new PBYTEArray(tpkt+4, pduLen-4));
+
+    used += pduLen;
+  }
+
+  return used;
+}
+
+
+void H323SignalReactor::IOThread::OnReadable(Handle & handle)
+{
+  int len = ::recv(handle.fd, (char *)readBuffer, sizeof(readBuffer), SIGNAL_REACTOR_RECV_FLAGS);
+  if (len < 0) {
+    if (!SIGNAL_REACTOR_WOULD_BLOCK()) {
+      PTRACE(2, "H323\tSignal reactor read error on " << handle.transport);
+      Fail(handle, PChannel::Miscellaneous);
+    }
+    return;
+  }
+
+  if (len == 0) {
+    PTRACE(3, "H323\tSignal reactor connection closed by remote on " << handle.transport);
+    Fail(handle, PChannel::NotOpen);
+    return;
+  }
+
+  handle.lastRead = PTimer::Tick();
+
+  // Most reads hold whole PDUs, only a partial PDU is kept with the handle
+  const BYTE * data = readBuffer;
+  PINDEX length = len;
+  if (handle.bufferLen > 0) {
+    memcpy(handle.buffer.GetPointer(handle.bufferLen+len)+handle.bufferLen, readBuffer, len);
+    handle.bufferLen += len;
+    data = handle.buffer;
+    length = handle.bufferLen;
+  }
+
+  PINDEX used = ExtractPDUs(handle, data, length);
+  if (used == P_MAX_INDEX) {
+    Fail(handle, PChannel::Miscellaneous);
+    return;
+  }
+
+  PINDEX left = length - used;
+  if (left == 0) {
+    handle.bufferLen = 0;
+    handle.buffer.SetSize(0);
+  }
+  else if (data == readBuffer) {
+    memcpy(handle.buffer.GetPointer(left), data+used, left);
+    handle.bufferLen = left;
+  }
+  else if (used > 0) {
+    memmove(handle.buffer.GetPointer(), data+used, left);
+    handle.bufferLen = left;
+  }
+}
+
+
+void H323SignalReactor::IOThread::CheckTimers()
+{
+  PTimeInterval now = PTimer::Tick();
+  if (now - lastCheck < SIGNAL_REACTOR_TICK)
+    return;
+  lastCheck = now;
+
+  PTimeInterval keepAliveTime(0, KeepAliveInterval);
+
+  for (HandleMap::iterator it = handles.begin(); it != handles.end(); ++it) {
+    Handle & handle = *it->second;
+
+    // Equivalent of a blocking read timing out
+    PTimeInterval timeout = handle.transport.GetReadTimeout();
+    if (timeout > 0 && timeout != PMaxTimeInterval && now - handle.lastRead >= timeout) {
+      handle.lastRead = now;
+      reactor.Queue(handle, ReadError, NULL, PChannel::Timeout);
+    }
+
+    // The write may block, so it is left to a worker
+    if (handle.keepAlive && now - handle.lastKeepAlive >= keepAliveTime) {
+      handle.lastKeepAlive = now;
+      reactor.Queue(handle, KeepAliveDue);
+    }
+
+    if (handle.monitorInterval > 0 && now - handle.lastMonitor >= handle.monitorInterval) {
+      handle.lastMonitor = now;
+      reactor.Queue(handle, MonitorDue);
+    }
+  }
+}
+
+
+void H323SignalReactor::IOThread::Main()
+{
+  PTRACE(3, "H323\tSignal reactor I/O thread started");
+
+  while (!shutdown) {
+#ifdef P_LINUX
+    struct epoll_event events[SIGNAL_REACTOR_MAX_EVENTS];
+    int count = epoll_wait(epollFd, events, SIGNAL_REACTOR_MAX_EVENTS, SIGNAL_REACTOR_TICK);
+    if (count < 0) {
+      if (errno == EINTR)
+        continue;
+      PTRACE(1, "H323\tSignal reactor epoll_wait failed, errno=" << errno);
+      break;
+    }
+
+    mutex.Wait();
+    for (int i = 0; i < count; i++) {
+      HandleMap::iterator it = handles.find((unsigned)events[i].data.u64);
+      if (it != handles.end())
+        OnReadable(*it->second);
+    }
+#else
+    mutex.Wait();
+    if (handles.empty()) {
+      mutex.Signal();
+      PThread::Sleep(SIGNAL_REACTOR_TICK/10);
+      continue;
+    }
+
+    // Sockets cannot be closed while the mutex is held, so select under it
+    // with a short timeout to keep AddHandle()/RemoveHandle() responsive.
+    PSocket::SelectList readList;
+    HandleMap::iterator it;
+    for (it = handles.begin(); it != handles.end(); ++it)
+      readList += *(PSocket *)it->second->transport.GetBaseReadChannel();
+
+    PSocket::Select(readList, PTimeInterval(SIGNAL_REACTOR_TICK/10));
+
+    for (PINDEX i = 0; i < readList.GetSize(); i++) {
+      for (it = handles.begin(); it != handles.end(); ++it) {
+        if (&readList[i] == it->second->transport.GetBaseReadChannel()) {
+          OnReadable(*it->second);
+          break;
+        }
+      }
+    }
+#endif
+
+    CheckTimers();
+    mutex.Signal();
+  }
+
+  PTRACE(3, "H323\tSignal reactor I/O thread ended");
+}
+
+
+H323SignalReactor::H323SignalReactor(PINDEX ioCount, PINDEX workerCount, PINDEX stackSize)
+  : runAvailable(0, INT_MAX),
+    handleCount(0),
+    queuedPDUs(0),
+    shutdown(FALSE)
+{
+  if (ioCount < 1)
+    ioCount = 1;
+  if (workerCount < 1)
+    workerCount = 1;
+
+  PINDEX i;
+  for (i = 0; i < ioCount; i++)
+    ioThreads.push_back(new IOThread(*this, stackSize));
+  for (i = 0; i < workerCount; i++)
+    workerThreads.push_back(new WorkerThread(*this, stackSize));
+
+  PTRACE(3, "H323\tSignal reactor created with " << ioCount
+         << " I/O threads and " << workerCount << " workers");
+}
+
+
+H323SignalReactor::~H323SignalReactor()
+{
+  PTRACE_IF(2, handleCount > 0, "H323\tSignal reactor destroyed with "
+            << handleCount << " handles still attached");
+
+  shutdown = TRUE;
+
+  for (std::vector<IOThread *>::iterator io = ioThreads.begin(); io != ioThreads.end(); ++io) {
+    (*io)->Stop();
+    delete *io;
+  }
+
+  std::vector<WorkerThread *>::iterator w;
+  for (w = workerThreads.begin(); w != workerThreads.end(); ++w)
+    runAvailable.Signal();
+  for (w = workerThreads.begin(); w != workerThreads.end(); ++w) {
+    (*w)->WaitForTermination();
+    delete *w;
+  }
+
+  for (std::map<const void *, Strand *>::iterator s = strands.begin(); s != strands.end(); ++s) {
+    for (std::deque<Event>::iterator e = s->second->events.begin(); e != s->second->events.end(); ++e)
+      delete e->pdu;
+    delete s->second;
+  }
+}
+
+
+PBoolean H323SignalReactor::CanService(H323Transport & transport)
+{
+  // TLS and the NAT traversal transports do their own reading
+  return transport.IsClass(H323TransportTCP::Class()) && !transport.IsTransportSecure();
+}
+
+
+PBoolean H323SignalReactor::AddHandle(Handle * handle)
+{
+  if (handle == NULL || !CanService(handle->transport))
+    return FALSE;
+
+  Strand * strand;
+  {
+    PWaitAndSignal m(mutex);
+    if (shutdown)
+      return FALSE;
+
+    Strand * & entry = strands[handle->strandKey];
+    if (entry == NULL)
+      entry = new Strand(handle->strandKey);
+    strand = entry;
+    strand->refs++;
+    handle->strand = strand;
+    handleCount++;
+
+    // Place on the least loaded I/O thread
+    handle->ioThread = 0;
+    for (PINDEX i = 1; i < (PINDEX)ioThreads.size(); i++) {
+      if (ioThreads[i]->GetHandleCount() < ioThreads[handle->ioThread]->GetHandleCount())
+        handle->ioThread = i;
+    }
+  }
+
+  if (Attach(*handle)) {
+    PTRACE(4, "H323\tSignal reactor servicing " << handle->transport);
+    return TRUE;
+  }
+
+  mutex.Wait();
+  handle->strand = NULL;
+  handleCount--;
+  PBoolean remove = ReleaseStrand(strand);
+  mutex.Signal();
+
+  if (remove)
+    delete strand;
+  return FALSE;
+}
+
+
+void H323SignalReactor::RemoveHandle(Handle * handle)
+{
+  if (handle == NULL || handle->strand == NULL)
+    return;
+
+  // Holding the dispatch mutex guarantees no callback is running on the
+  // strand and none can start until the handle is gone.
+  Strand * strand = handle->strand;
+  strand->dispatchMutex.Wait();
+
+  Detach(*handle);
+
+  mutex.Wait();
+  Purge(*handle);
+  handle->strand = NULL;
+  handleCount--;
+  PBoolean remove = ReleaseStrand(strand);
+  mutex.Signal();
+
+  strand->dispatchMutex.Signal();
+
+  if (remove)
+    delete strand;
+}
+
+
+PINDEX H323SignalReactor::GetHandleCount() const
+{
+  PWaitAndSignal m(mutex);
+  return handleCount;
+}
+
+
+PINDEX H323SignalReactor::GetQueuedPDUs() const
+{
+  PWaitAndSignal m(mutex);
+  return queuedPDUs;
+}
+
+
+PBoolean H323SignalReactor::Attach(Handle & handle)
+{
+  PChannel * socket = handle.transport.GetBaseReadChannel();
+  if (socket == NULL || !socket->IsOpen())
+    return FALSE;
+
+  if (!ioThreads[handle.ioThread]->Add(handle, socket->GetHandle()))
+    return FALSE;
+
+  handle.transport.signalReactor = this;
+  return TRUE;
+}
+
+
+void H323SignalReactor::Detach(Handle & handle)
+{
+  ioThreads[handle.ioThread]->Remove(handle);
+  handle.transport.signalReactor = NULL;
+}
+
+
+void H323SignalReactor::OnTransportClosed(H323Transport & transport)
+{
+  for (std::vector<IOThread *>::iterator io = ioThreads.begin(); io != ioThreads.end(); ++io) {
+    if ((*io)->Close(transport))
+      break;
+  }
+}
+
+
+void H323SignalReactor::Queue(Handle & handle, EventKinds kind, PBYTEArray * pdu, PChannel::Errors error)
+{
+  PWaitAndSignal m(mutex);
+
+  Event event;
+  event.handle = &handle;
+  event.kind = kind;
+  event.pdu = pdu;
+  event.error = error;
+
+  Strand & strand = *handle.strand;
+  strand.events.push_back(event);
+  if (pdu != NULL)
+    queuedPDUs++;
+
+  if (!strand.scheduled) {
+    strand.scheduled = TRUE;
+    strand.refs++;
+    runQueue.push_back(&strand);
+    runAvailable.Signal();
+  }
+}
+
+
+void H323SignalReactor::Purge(Handle & handle)
+{
+  // Must be called with mutex held
+  std::deque<Event> & events = handle.strand->events;
+  std::deque<Event>::iterator it = events.begin();
+  while (it != events.end()) {
+    if (it->handle == &handle) {
+      if (it->pdu != NULL) {
+        delete it->pdu;
+        queuedPDUs--;
+      }
+      it = events.erase(it);
+    }
+    else
+      ++it;
+  }
+}
+
+
+PBoolean H323SignalReactor::ReleaseStrand(Strand * strand)
+{
+  // Must be called with mutex held, returns TRUE if strand is to be deleted
+  if (--strand->refs > 0)
+    return FALSE;
+
+  strands.erase(strand->key);
+  return TRUE;
+}
+
+
+H323SignalReactor::Strand * H323SignalReactor::NextStrand()
+{
+  runAvailable.Wait();
+
+  PWaitAndSignal m(mutex);
+  if (runQueue.empty())
+    return NULL;
+
+  Strand * strand = runQueue.front();
+  runQueue.pop_front();
+  return strand;
+}
+
+
+void H323SignalReactor::RunStrand(Strand & strand)
+{
+  for (PINDEX count = 0; ; count++) {
+    strand.dispatchMutex.Wait();
+    mutex.Wait();
+
+    if (strand.events.empty() || count >= SIGNAL_REACTOR_BATCH) {
+      PBoolean remove = FALSE;
+      if (strand.events.empty()) {
+        strand.scheduled = FALSE;
+        remove = ReleaseStrand(&strand);
+      }
+      else {
+        // Let other calls run, this one goes to the back of the queue
+        runQueue.push_back(&strand);
+        runAvailable.Signal();
+      }
+      mutex.Signal();
+      strand.dispatchMutex.Signal();
+
+      if (remove)
+        delete &strand;
+      return;
+    }
+
+    Event event = strand.events.front();
+    strand.events.pop_front();
+    if (event.pdu != NULL)
+      queuedPDUs--;
+    mutex.Signal();
+
+    Handle & handle = *event.handle;
+    PBoolean keep = TRUE;
+    switch (event.kind) {
+      case ReceivedPDU :
+        handle.transport.SetErrorValues(PChannel::NoError, 0, PChannel::LastReadError);
+        keep = handle.OnReceivePDU(*event.pdu);
+        delete event.pdu;
+        break;
+
+      case ReadError :
+        handle.transport.SetErrorValues(event.error, 0, PChannel::LastReadError);
+        keep = handle.OnReadError(event.error);
+        // A channel that was reconnected by the handler is serviced again
+        if (keep && event.error != PChannel::Timeout)
+          keep = handle.transport.IsOpen() && Attach(handle);
+        break;
+
+      case KeepAliveDue :
+        {
+          // Send empty RFC1006 TPKT
+          BYTE tpkt[4] = { 3, 0, 0, 4 };
+          PTRACE(5, "H323\tSignal reactor sending KeepAlive TPKT packet");
+          handle.transport.Write(tpkt, sizeof(tpkt));
+        }
+        break;
+
+      case MonitorDue :
+        handle.OnMonitor();
+        break;
+    }
+
+    if (!keep) {
+      Detach(handle);
+      mutex.Wait();
+      Purge(handle);
+      mutex.Signal();
+      handle.OnDetached();
+    }
+
+    strand.dispatchMutex.Signal();
+  }
+}
+
+
 /////////////////////////////////////////////////////////////////////////////
 
 #ifdef _MSC_VER